@@ -0,0 +1,640 @@
+#include "engine/assets/AssetCooker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+#include "engine/assets/AssetRegistry.hpp"
+#include "engine/assets/ContentHash.hpp"
+#include "engine/assets/CookedMesh.hpp"
+#include "engine/assets/MeshLibrary.hpp"
+#include "engine/core/JobSystem.hpp"
+#include "engine/physics/ColliderGen_WallBoxes.hpp"
+
+namespace engine::assets
+{
+namespace
+{
+using json = nlohmann::json;
+
+enum class NodeKind : std::uint8_t
+{
+    Mesh,
+    Texture,
+    Material,
+    Prefab,
+    Loop,
+    Map,
+    Collider
+};
+
+struct Node
+{
+    NodeKind kind = NodeKind::Mesh;
+    std::string key;               // path relative to the assets root; "<mesh key>#colliders" for colliders
+    std::filesystem::path path;    // source file (the mesh for collider nodes)
+    std::vector<std::size_t> deps;
+    std::vector<std::string> refKeys; // resolved reference targets, cached in the manifest
+    bool refsKnown = false;           // refKeys is complete: parsed (or reused) with nothing missing
+    std::uint64_t size = 0;
+    std::int64_t writeTime = 0;
+    std::uint64_t contentHash = 0;
+    std::uint64_t cookKey = 0;
+    int level = 0;
+    bool stale = false;
+    bool ok = true;
+    std::string error;
+};
+
+bool EndsWith(std::string_view value, std::string_view suffix)
+{
+    return value.size() >= suffix.size() && value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/// Cook outputs, editor sidecars and the manifest itself are never graph inputs.
+bool IsGeneratedFile(const std::filesystem::path& path)
+{
+    const std::string name = path.filename().string();
+    return name.starts_with('.') || EndsWith(name, ".amesh") || EndsWith(name, ".abin") || EndsWith(name, ".tmp") ||
+           EndsWith(name, ".meta.json") || EndsWith(name, ".colliders.json");
+}
+
+std::optional<NodeKind> NodeKindFor(const std::filesystem::path& path)
+{
+    switch (AssetRegistry::KindFromPath(path))
+    {
+        case AssetKind::Mesh:
+            // FBX has no importer; it stays out of the graph like any other unknown file.
+            return MeshLibrary::IsCookable(path) ? std::optional<NodeKind>(NodeKind::Mesh) : std::nullopt;
+        case AssetKind::Texture: return NodeKind::Texture;
+        case AssetKind::Material: return NodeKind::Material;
+        case AssetKind::Prefab: return NodeKind::Prefab;
+        case AssetKind::Loop: return NodeKind::Loop;
+        case AssetKind::Map: return NodeKind::Map;
+        default: return std::nullopt;
+    }
+}
+
+bool IsJsonKind(NodeKind kind)
+{
+    return kind == NodeKind::Material || kind == NodeKind::Prefab || kind == NodeKind::Loop || kind == NodeKind::Map;
+}
+
+std::uint64_t ColliderConfigHash()
+{
+    const physics::WallColliderConfig config = physics::ColliderGen_WallBoxes::LoopMeshConfig();
+    std::uint64_t hash = ContentHash(&config.cellSize, sizeof(config.cellSize));
+    hash = ContentHash(&config.maxBoxes, sizeof(config.maxBoxes), hash);
+    hash = ContentHash(&config.padXZ, sizeof(config.padXZ), hash);
+    hash = ContentHash(&config.minIslandCells, sizeof(config.minIslandCells), hash);
+    hash = ContentHash(&config.cleanup, sizeof(config.cleanup), hash);
+    hash = ContentHash(&config.maxVolumeExcess, sizeof(config.maxVolumeExcess), hash);
+    return ContentHash(&config.minCoverage, sizeof(config.minCoverage), hash);
+}
+
+class CookGraph
+{
+public:
+    explicit CookGraph(std::filesystem::path root)
+        : m_root(std::move(root))
+    {
+    }
+
+    std::vector<Node> nodes;
+    std::vector<std::string> warnings;
+    std::size_t filesParsed = 0;
+
+    void Scan()
+    {
+        std::error_code ec;
+        for (std::filesystem::recursive_directory_iterator it(m_root, ec), end; !ec && it != end; it.increment(ec))
+        {
+            if (it->is_directory(ec) && it->path().filename().string().starts_with('.'))
+            {
+                it.disable_recursion_pending();
+                continue;
+            }
+            if (!it->is_regular_file(ec) || IsGeneratedFile(it->path()))
+            {
+                continue;
+            }
+            const std::optional<NodeKind> kind = NodeKindFor(it->path());
+            if (!kind.has_value())
+            {
+                continue;
+            }
+            Node node;
+            node.kind = *kind;
+            node.path = it->path();
+            node.key = it->path().lexically_relative(m_root).generic_string();
+            node.size = static_cast<std::uint64_t>(it->file_size(ec));
+            node.writeTime = static_cast<std::int64_t>(it->last_write_time(ec).time_since_epoch().count());
+            nodes.push_back(std::move(node));
+        }
+        // Directory iteration order is filesystem-specific; keep reports and manifests stable.
+        std::sort(nodes.begin(), nodes.end(), [](const Node& a, const Node& b) { return a.key < b.key; });
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            m_index.emplace(nodes[i].key, i);
+        }
+    }
+
+    /// Records the references of every JSON node (and .gltf, for external images) as edges. A file
+    /// whose size and timestamp match its manifest entry reuses the reference keys stored there;
+    /// others are parsed.
+    void LinkReferences(const json& manifestFiles)
+    {
+        const std::size_t fileNodes = nodes.size();
+        for (std::size_t i = 0; i < fileNodes; ++i)
+        {
+            const bool gltf = nodes[i].kind == NodeKind::Mesh && nodes[i].path.extension() == ".gltf";
+            if (!IsJsonKind(nodes[i].kind) && !gltf)
+            {
+                continue;
+            }
+            if (!ReuseReferences(i, manifestFiles))
+            {
+                ParseReferences(i);
+            }
+            std::sort(nodes[i].deps.begin(), nodes[i].deps.end());
+            nodes[i].deps.erase(std::unique(nodes[i].deps.begin(), nodes[i].deps.end()), nodes[i].deps.end());
+        }
+    }
+
+    /// Level = longest dependency chain below the node; nodes of one level never depend on each other.
+    /// Returns the highest level.
+    int AssignLevels()
+    {
+        std::vector<std::uint8_t> state(nodes.size(), 0); // 0 = new, 1 = visiting, 2 = done
+        int maxLevel = 0;
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            maxLevel = std::max(maxLevel, Visit(i, state));
+        }
+        return maxLevel;
+    }
+
+private:
+    /// Only entries written with every reference resolved are reused, and only while each stored
+    /// key still exists; a file with a dangling reference is parsed again so the warning repeats and
+    /// a target added since is picked up.
+    bool ReuseReferences(std::size_t index, const json& manifestFiles)
+    {
+        const auto stamp = manifestFiles.find(nodes[index].key);
+        if (stamp == manifestFiles.end() || stamp->value("size", 0ULL) != nodes[index].size ||
+            stamp->value("write_time", 0LL) != nodes[index].writeTime)
+        {
+            return false;
+        }
+        const auto refs = stamp->find("refs");
+        if (refs == stamp->end() || !refs->is_array())
+        {
+            return false;
+        }
+        std::vector<std::size_t> targets;
+        targets.reserve(refs->size());
+        for (const json& ref : *refs)
+        {
+            const std::optional<std::size_t> target = ref.is_string() ? Find(ref.get<std::string>()) : std::nullopt;
+            if (!target.has_value())
+            {
+                return false;
+            }
+            targets.push_back(*target);
+        }
+        for (const std::size_t target : targets)
+        {
+            AddReference(index, target, nodes[target].key);
+        }
+        nodes[index].refsKnown = true;
+        return true;
+    }
+
+    void ParseReferences(std::size_t index)
+    {
+        ++filesParsed;
+        std::ifstream stream(nodes[index].path);
+        const json root = json::parse(stream, nullptr, false);
+        if (root.is_discarded())
+        {
+            nodes[index].ok = false;
+            nodes[index].error = "invalid JSON";
+            return;
+        }
+        nodes[index].refsKnown = true;
+        CollectReferences(index, root, "");
+    }
+
+    std::optional<std::size_t> Find(const std::string& key) const
+    {
+        const auto it = m_index.find(key);
+        return it != m_index.end() ? std::optional<std::size_t>(it->second) : std::nullopt;
+    }
+
+    /// Paths are stored relative to the assets root ("meshes/x.glb") or to the working directory
+    /// ("assets/meshes/x.glb"); .gltf image URIs are relative to the .gltf itself.
+    std::optional<std::size_t> ResolveFile(std::size_t from, const std::string& value) const
+    {
+        const std::filesystem::path relative(value);
+        for (const std::filesystem::path& base : {m_root, m_root.parent_path(), nodes[from].path.parent_path()})
+        {
+            const std::string key = (base / relative).lexically_normal().lexically_relative(m_root).generic_string();
+            if (const std::optional<std::size_t> found = Find(key))
+            {
+                return found;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void AddReference(std::size_t from, std::optional<std::size_t> to, const std::string& what)
+    {
+        if (!to.has_value())
+        {
+            warnings.push_back(nodes[from].key + ": missing " + what);
+            nodes[from].refsKnown = false;
+            return;
+        }
+        nodes[from].refKeys.push_back(nodes[*to].key);
+        if (nodes[from].kind == NodeKind::Loop && nodes[*to].kind == NodeKind::Mesh)
+        {
+            // Loops consume the mesh through its wall colliders.
+            to = ColliderFor(*to);
+        }
+        nodes[from].deps.push_back(*to);
+    }
+
+    std::size_t ColliderFor(std::size_t mesh)
+    {
+        const std::string key = nodes[mesh].key + "#colliders";
+        if (const std::optional<std::size_t> found = Find(key))
+        {
+            return *found;
+        }
+        Node node;
+        node.kind = NodeKind::Collider;
+        node.key = key;
+        node.path = nodes[mesh].path;
+        node.deps.push_back(mesh);
+        node.contentHash = ColliderConfigHash();
+        m_index.emplace(key, nodes.size());
+        nodes.push_back(std::move(node));
+        return nodes.size() - 1;
+    }
+
+    void CollectReferences(std::size_t from, const json& value, const std::string& key)
+    {
+        if (value.is_object())
+        {
+            for (auto it = value.begin(); it != value.end(); ++it)
+            {
+                CollectReferences(from, it.value(), it.key());
+            }
+            return;
+        }
+        if (value.is_array())
+        {
+            for (const json& element : value)
+            {
+                CollectReferences(from, element, key);
+            }
+            return;
+        }
+        if (!value.is_string())
+        {
+            return;
+        }
+        const std::string text = value.get<std::string>();
+        if (text.empty())
+        {
+            return;
+        }
+        if (key == "loop_id")
+        {
+            const std::string target = "loops/" + text + ".json";
+            AddReference(from, Find(target), target);
+        }
+        else if (key == "prefab_source")
+        {
+            const std::string target = "prefabs/" + text + ".json";
+            AddReference(from, Find(target), target);
+        }
+        else if (key == "material_asset")
+        {
+            if (EndsWith(text, ".json"))
+            {
+                AddReference(from, ResolveFile(from, text), text);
+            }
+            else
+            {
+                const std::string target = "materials/" + text + ".json";
+                AddReference(from, Find(target), target);
+            }
+        }
+        else if (text.find("://") == std::string::npos && !text.starts_with("data:"))
+        {
+            const AssetKind kind = AssetRegistry::KindFromPath(text);
+            if (kind == AssetKind::Mesh || kind == AssetKind::Texture)
+            {
+                AddReference(from, ResolveFile(from, text), text);
+            }
+        }
+    }
+
+    int Visit(std::size_t index, std::vector<std::uint8_t>& state)
+    {
+        if (state[index] == 2)
+        {
+            return nodes[index].level;
+        }
+        if (state[index] == 1)
+        {
+            return -1;
+        }
+        state[index] = 1;
+        int level = 0;
+        std::vector<std::size_t> kept;
+        kept.reserve(nodes[index].deps.size());
+        for (const std::size_t dep : nodes[index].deps)
+        {
+            const int depLevel = Visit(dep, state);
+            if (depLevel < 0)
+            {
+                warnings.push_back(nodes[index].key + ": reference cycle through " + nodes[dep].key);
+                continue;
+            }
+            kept.push_back(dep);
+            level = std::max(level, depLevel + 1);
+        }
+        nodes[index].deps = std::move(kept);
+        nodes[index].level = level;
+        state[index] = 2;
+        return level;
+    }
+
+    std::filesystem::path m_root;
+    std::unordered_map<std::string, std::size_t> m_index;
+};
+
+bool CookCollider(const Node& node, const std::vector<Node>& nodes, std::string& outError)
+{
+    using physics::ColliderGen_WallBoxes;
+
+    // Prefer the .amesh the mesh node just cooked; it holds the same geometry as the source.
+    MeshData mesh;
+    const std::uint64_t meshHash = nodes[node.deps.front()].contentHash;
+    if (!CookedMesh::Read(CookedMesh::PathFor(node.path), meshHash, mesh))
+    {
+        mesh = MeshLibrary::LoadSourceFile(node.path, nullptr);
+    }
+    if (!mesh.loaded)
+    {
+        outError = mesh.error.empty() ? "mesh failed to load" : mesh.error;
+        return false;
+    }
+
+    const physics::WallColliderConfig config = ColliderGen_WallBoxes::LoopMeshConfig();
+    const std::string geometryHash = ColliderGen_WallBoxes::ComputeMeshHash(mesh.geometry.positions, mesh.geometry.indices);
+    if (ColliderGen_WallBoxes::LoadValidCache(node.path, geometryHash, config).has_value())
+    {
+        return true;
+    }
+
+    physics::WallColliderCache cache;
+    cache.meshHash = geometryHash;
+    cache.config = config;
+    const physics::WallColliderResult result =
+        ColliderGen_WallBoxes::Generate(mesh.geometry.positions, mesh.geometry.indices, config);
+    if (result.valid)
+    {
+        // Empty boxes are a valid cache too: gameplay falls back to the mesh AABB.
+        cache.boxes = result.boxes;
+    }
+    if (!ColliderGen_WallBoxes::SaveCache(ColliderGen_WallBoxes::GetCachePath(node.path), cache))
+    {
+        outError = "failed to write " + ColliderGen_WallBoxes::GetCachePath(node.path).string();
+        return false;
+    }
+    return true;
+}
+
+void CookNode(Node& node, const std::vector<Node>& nodes)
+{
+    switch (node.kind)
+    {
+        case NodeKind::Mesh:
+            node.ok = MeshLibrary::CookMeshFile(node.path, &node.error);
+            break;
+        case NodeKind::Collider:
+            node.ok = CookCollider(node, nodes, node.error);
+            break;
+        default:
+            // Hashed and validated while building the graph; nothing to write.
+            break;
+    }
+}
+
+/// A deleted output re-cooks even when nothing it was built from changed.
+bool OutputExists(const Node& node)
+{
+    std::error_code ec;
+    switch (node.kind)
+    {
+        case NodeKind::Mesh: return std::filesystem::exists(CookedMesh::PathFor(node.path), ec);
+        case NodeKind::Collider:
+            return std::filesystem::exists(physics::ColliderGen_WallBoxes::GetCachePath(node.path), ec);
+        default: return true;
+    }
+}
+
+json LoadManifest(const std::filesystem::path& path)
+{
+    std::ifstream stream(path);
+    if (!stream.is_open())
+    {
+        return json::object();
+    }
+    json manifest = json::parse(stream, nullptr, false);
+    if (manifest.is_discarded() || !manifest.is_object() ||
+        manifest.value("version", 0U) != AssetCooker::kCookVersion)
+    {
+        return json::object();
+    }
+    return manifest;
+}
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+} // namespace
+
+std::string CookReport::Summary() const
+{
+    std::ostringstream out;
+    out.setf(std::ios::fixed);
+    out.precision(1);
+    out << nodes << " nodes: " << upToDate << " up to date, " << cooked << " cooked, " << failed << " failed ("
+        << filesHashed << " files hashed, " << filesParsed << " parsed, scan " << scanMs << " ms, cook " << cookMs << " ms)";
+    for (const std::string& error : errors)
+    {
+        out << "\n  error: " << error;
+    }
+    for (const std::string& warning : warnings)
+    {
+        out << "\n  warning: " << warning;
+    }
+    return out.str();
+}
+
+AssetCooker::AssetCooker(std::filesystem::path assetsRoot)
+    : m_assetsRoot(std::move(assetsRoot))
+{
+}
+
+CookReport AssetCooker::Run(bool force)
+{
+    CookReport report;
+    auto& jobs = core::JobSystem::Instance();
+    const auto scanStart = std::chrono::steady_clock::now();
+
+    // References and content hashes: reuse the manifest's when size and timestamp are unchanged.
+    const json manifest = force ? json::object() : LoadManifest(ManifestPath());
+    const json files = manifest.value("files", json::object());
+    const json cookedKeys = manifest.value("cooked", json::object());
+
+    CookGraph graph(m_assetsRoot);
+    graph.Scan();
+    const std::size_t fileNodes = graph.nodes.size();
+    graph.LinkReferences(files);
+    const int maxLevel = graph.AssignLevels();
+    std::vector<Node>& nodes = graph.nodes;
+    report.filesParsed = graph.filesParsed;
+
+    std::atomic<std::size_t> hashed{0};
+    {
+        core::JobCounter counter;
+        jobs.ParallelFor(fileNodes, 4, [&](std::size_t i) {
+            Node& node = nodes[i];
+            const auto stamp = files.find(node.key);
+            if (stamp != files.end() && stamp->value("size", 0ULL) == node.size &&
+                stamp->value("write_time", 0LL) == node.writeTime)
+            {
+                node.contentHash = stamp->value("hash", 0ULL);
+                return;
+            }
+            if (!CookedMesh::HashFile(node.path, node.contentHash))
+            {
+                node.ok = false;
+                node.error = "unreadable";
+            }
+            hashed.fetch_add(1, std::memory_order_relaxed);
+        }, core::JobPriority::Normal, &counter);
+        jobs.WaitForCounter(counter);
+    }
+    report.filesHashed = hashed.load();
+
+    // Cook keys in dependency order; a key changes whenever anything below the node changes.
+    std::vector<std::vector<std::size_t>> levels(static_cast<std::size_t>(maxLevel) + 1);
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        levels[static_cast<std::size_t>(nodes[i].level)].push_back(i);
+    }
+    for (const std::vector<std::size_t>& level : levels)
+    {
+        for (const std::size_t i : level)
+        {
+            Node& node = nodes[i];
+            std::uint64_t key = ContentHash(&kCookVersion, sizeof(kCookVersion));
+            key = ContentHash(&node.kind, sizeof(node.kind), key);
+            key = ContentHash(&node.contentHash, sizeof(node.contentHash), key);
+            for (const std::size_t dep : node.deps)
+            {
+                key = ContentHash(&nodes[dep].cookKey, sizeof(nodes[dep].cookKey), key);
+            }
+            node.cookKey = key;
+            node.stale = cookedKeys.value(node.key, 0ULL) != key || !OutputExists(node);
+        }
+    }
+    report.scanMs = MillisecondsSince(scanStart);
+
+    // One parallel batch per level; a node only cooks once everything it depends on succeeded.
+    const auto cookStart = std::chrono::steady_clock::now();
+    for (const std::vector<std::size_t>& level : levels)
+    {
+        std::vector<std::size_t> batch;
+        for (const std::size_t i : level)
+        {
+            Node& node = nodes[i];
+            const auto failedDep = std::find_if(node.deps.begin(), node.deps.end(), [&](std::size_t dep) {
+                return !nodes[dep].ok;
+            });
+            if (node.ok && failedDep != node.deps.end())
+            {
+                node.ok = false;
+                node.error = "dependency " + nodes[*failedDep].key + " failed";
+            }
+            if (node.ok && node.stale)
+            {
+                batch.push_back(i);
+            }
+        }
+        core::JobCounter counter;
+        jobs.ParallelFor(batch.size(), 1, [&](std::size_t i) { CookNode(nodes[batch[i]], nodes); },
+                         core::JobPriority::Normal, &counter);
+        jobs.WaitForCounter(counter);
+    }
+    report.cookMs = MillisecondsSince(cookStart);
+
+    json nextFiles = json::object();
+    json nextCooked = json::object();
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        const Node& node = nodes[i];
+        if (i < fileNodes && node.error != "unreadable")
+        {
+            json& entry = nextFiles[node.key];
+            entry = {{"size", node.size}, {"write_time", node.writeTime}, {"hash", node.contentHash}};
+            if (node.refsKnown)
+            {
+                entry["refs"] = node.refKeys;
+            }
+        }
+        if (!node.ok)
+        {
+            ++report.failed;
+            report.errors.push_back(node.key + ": " + node.error);
+            continue;
+        }
+        nextCooked[node.key] = node.cookKey;
+        ++(node.stale ? report.cooked : report.upToDate);
+    }
+    report.nodes = nodes.size();
+    report.warnings = std::move(graph.warnings);
+
+    const json next = {{"version", kCookVersion}, {"files", nextFiles}, {"cooked", nextCooked}};
+    const std::filesystem::path manifestPath = ManifestPath();
+    const std::filesystem::path tempPath = manifestPath.string() + ".tmp";
+    {
+        std::ofstream stream(tempPath, std::ios::trunc);
+        stream << next.dump(1);
+    }
+    std::error_code ec;
+    std::filesystem::rename(tempPath, manifestPath, ec);
+    if (ec)
+    {
+        report.warnings.push_back("failed to write " + manifestPath.generic_string() + ": " + ec.message());
+    }
+
+    std::cout << "[ASSET COOK] " << report.Summary() << "\n";
+    return report;
+}
+} // namespace engine::assets
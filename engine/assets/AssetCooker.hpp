@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace engine::assets
+{
+struct CookReport
+{
+    std::size_t nodes = 0;       // assets and derived outputs in the dependency graph
+    std::size_t upToDate = 0;
+    std::size_t cooked = 0;
+    std::size_t failed = 0;
+    std::size_t filesHashed = 0; // files read because their size or timestamp changed
+    std::size_t filesParsed = 0; // JSON/.gltf files parsed for references (others reuse the manifest)
+    double scanMs = 0.0;
+    double cookMs = 0.0;
+    std::vector<std::string> errors;   // failed cooks
+    std::vector<std::string> warnings; // missing references
+
+    [[nodiscard]] std::string Summary() const;
+};
+
+/// Incremental, parallel asset cook over assets/. Builds a dependency graph (maps -> loops ->
+/// wall colliders -> meshes, props -> meshes/materials/prefabs, materials -> textures), keys every
+/// node by its content hash plus the keys of its dependencies, and re-cooks only nodes whose key
+/// changed since the manifest was written. Independent nodes cook in parallel on the JobSystem.
+///
+/// Outputs: cooked meshes (.amesh with LODs and albedo mip chains) and loop-mesh wall colliders
+/// (.colliders.json). Textures, materials, prefabs, loops and maps produce nothing themselves; they
+/// carry hashes to their dependents and are validated (parse, dangling references).
+class AssetCooker
+{
+public:
+    explicit AssetCooker(std::filesystem::path assetsRoot = "assets");
+
+    /// force ignores the manifest. Blocks until every stale node was cooked.
+    CookReport Run(bool force = false);
+
+    [[nodiscard]] std::filesystem::path ManifestPath() const { return m_assetsRoot / ".cook_manifest.json"; }
+
+    /// Bump when a cook step changes its output for the same input.
+    static constexpr std::uint32_t kCookVersion = 1;
+
+private:
+    std::filesystem::path m_assetsRoot;
+};
+} // namespace engine::assets
@@ -0,0 +1,125 @@
+#include "engine/assets/AssetManager.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "engine/core/Profiler.hpp"
+
+namespace engine::assets
+{
+TextureHandle AssetManager::FindTexture(std::uint64_t contentKey)
+{
+    const auto it = m_textures.find(contentKey);
+    if (it == m_textures.end())
+    {
+        return nullptr;
+    }
+    it->second.lastUse = ++m_useTick;
+    return it->second.texture;
+}
+
+TextureHandle AssetManager::AddTexture(std::uint64_t contentKey, unsigned int id, std::size_t bytes, std::function<void(unsigned int)> destroy)
+{
+    TextureHandle texture(new GpuTexture{id, bytes}, [destroy = std::move(destroy), live = m_texturesLive](const GpuTexture* released) {
+        if (destroy && *live && released->id != 0)
+        {
+            destroy(released->id);
+        }
+        delete released;
+    });
+    TextureEntry& entry = m_textures[contentKey];
+    entry.texture = texture;
+    entry.lastUse = ++m_useTick;
+    return texture;
+}
+
+void AssetManager::Update()
+{
+    Stats stats = GetStats();
+    const std::size_t resident = stats.meshBytes + stats.textureBytes;
+    if (resident > m_budgetBytes)
+    {
+        // CPU mesh copies go first: they come back from the cooked file quickly, while a texture
+        // costs a decode and a GPU upload.
+        std::size_t overflow = resident - m_budgetBytes;
+        const std::size_t freedMeshes = m_meshes.EvictUnused(overflow);
+        overflow -= std::min(overflow, freedMeshes);
+        const std::size_t freedTextures = overflow > 0 ? EvictTextures(overflow) : 0U;
+        if (freedMeshes + freedTextures > 0)
+        {
+            std::cout << "[ASSETS] Over budget by " << (resident - m_budgetBytes) / 1024U << " KB, evicted "
+                      << (freedMeshes + freedTextures) / 1024U << " KB\n";
+        }
+        stats = GetStats();
+    }
+
+    auto& profilerStats = core::Profiler::Instance().StatsMut();
+    profilerStats.assetMeshBytes = static_cast<std::uint64_t>(stats.meshBytes);
+    profilerStats.assetMeshCount = static_cast<std::uint32_t>(stats.meshCount);
+    profilerStats.assetTextureBytes = static_cast<std::uint64_t>(stats.textureBytes);
+    profilerStats.assetTextureCount = static_cast<std::uint32_t>(stats.textureCount);
+    profilerStats.assetReferencedCount = static_cast<std::uint32_t>(stats.referencedCount);
+    profilerStats.assetBudgetBytes = static_cast<std::uint64_t>(stats.budgetBytes);
+    profilerStats.assetEvictedTotal = static_cast<std::uint32_t>(stats.evictedTotal);
+}
+
+std::size_t AssetManager::EvictTextures(std::size_t bytesToFree)
+{
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> candidates; // lastUse, key
+    for (const auto& [key, entry] : m_textures)
+    {
+        if (entry.texture.use_count() == 1)
+        {
+            candidates.emplace_back(entry.lastUse, key);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    std::size_t freed = 0;
+    for (const auto& [lastUse, key] : candidates)
+    {
+        if (freed >= bytesToFree)
+        {
+            break;
+        }
+        (void)lastUse;
+        const auto it = m_textures.find(key);
+        freed += it->second.texture->bytes;
+        m_textures.erase(it);
+        ++m_evictedTotal;
+    }
+    return freed;
+}
+
+void AssetManager::Clear()
+{
+    m_textures.clear();
+    *m_texturesLive = false;
+    m_texturesLive = std::make_shared<bool>(true);
+    m_meshes.Clear();
+}
+
+AssetManager::Stats AssetManager::GetStats() const
+{
+    Stats stats;
+    const MeshLibrary::Residency meshes = m_meshes.GetResidency();
+    stats.meshBytes = meshes.bytes;
+    stats.meshCount = meshes.meshes;
+    stats.referencedCount = meshes.referenced;
+    for (const auto& [key, entry] : m_textures)
+    {
+        (void)key;
+        stats.textureBytes += entry.texture->bytes;
+        ++stats.textureCount;
+        if (entry.texture.use_count() > 1)
+        {
+            ++stats.referencedCount;
+        }
+    }
+    stats.budgetBytes = m_budgetBytes;
+    stats.evictedTotal = m_evictedTotal + m_meshes.EvictedTotal();
+    return stats;
+}
+} // namespace engine::assets
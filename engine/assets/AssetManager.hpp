@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+#include "engine/assets/MeshLibrary.hpp"
+
+namespace engine::assets
+{
+/// GPU texture owned by the AssetManager. The GL name is released once the texture was evicted and
+/// the last handle dropped.
+struct GpuTexture
+{
+    unsigned int id = 0;
+    std::size_t bytes = 0;
+};
+
+using TextureHandle = std::shared_ptr<const GpuTexture>;
+
+/// The one asset cache shared by the editor and gameplay. Meshes go through a single MeshLibrary
+/// (content-addressed by source hash, so byte-identical files decode once). GPU textures are keyed
+/// by a content hash supplied by the caller. Holding a handle keeps an asset resident. Unreferenced
+/// assets stay cached until the memory budget is exceeded, then go least recently used first.
+class AssetManager
+{
+public:
+    static AssetManager& Instance()
+    {
+        static AssetManager s_instance;
+        return s_instance;
+    }
+
+    struct Stats
+    {
+        std::size_t meshBytes = 0;
+        std::size_t meshCount = 0;
+        std::size_t textureBytes = 0;
+        std::size_t textureCount = 0;
+        std::size_t referencedCount = 0; // assets pinned by a handle
+        std::size_t budgetBytes = 0;
+        std::size_t evictedTotal = 0;
+    };
+
+    [[nodiscard]] MeshLibrary& Meshes() { return m_meshes; }
+
+    /// Returns null when no texture with this content key is resident.
+    [[nodiscard]] TextureHandle FindTexture(std::uint64_t contentKey);
+    /// Takes ownership of the GL texture. destroy runs on the main thread when it is finally released.
+    TextureHandle AddTexture(std::uint64_t contentKey, unsigned int id, std::size_t bytes, std::function<void(unsigned int)> destroy);
+
+    void SetBudgetBytes(std::size_t bytes) { m_budgetBytes = bytes; }
+    [[nodiscard]] std::size_t BudgetBytes() const { return m_budgetBytes; }
+
+    /// Once per frame on the main thread, before any asset use: evicts unreferenced assets while over
+    /// budget and publishes residency to the profiler.
+    void Update();
+    /// Releases every cached asset. Call before the GL context goes away; texture handles still held
+    /// elsewhere are detached and no longer destroy their GL name.
+    void Clear();
+
+    [[nodiscard]] Stats GetStats() const;
+
+private:
+    AssetManager() = default;
+    AssetManager(const AssetManager&) = delete;
+    AssetManager& operator=(const AssetManager&) = delete;
+
+    struct TextureEntry
+    {
+        TextureHandle texture;
+        std::uint64_t lastUse = 0;
+    };
+
+    std::size_t EvictTextures(std::size_t bytesToFree);
+
+    MeshLibrary m_meshes;
+    std::unordered_map<std::uint64_t, TextureEntry> m_textures;
+    std::uint64_t m_useTick = 0;
+    std::size_t m_budgetBytes = std::size_t{768} * 1024U * 1024U;
+    std::size_t m_evictedTotal = 0;
+    std::shared_ptr<bool> m_texturesLive = std::make_shared<bool>(true);
+};
+} // namespace engine::assets
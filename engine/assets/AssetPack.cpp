@@ -0,0 +1,370 @@
+#include "engine/assets/AssetPack.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <system_error>
+
+#include "engine/assets/ContentHash.hpp"
+
+namespace engine::assets
+{
+struct AssetPack::Entry
+{
+    std::uint64_t pathHash = 0;
+    std::uint64_t offset = 0;
+    std::uint64_t size = 0;
+    std::uint64_t contentHash = 0;
+    std::uint32_t nameOffset = 0;
+    std::uint32_t nameLength = 0;
+};
+
+namespace
+{
+struct PackHeader
+{
+    char magic[4] = {'A', 'P', 'A', 'K'};
+    std::uint32_t version = AssetPack::kVersion;
+    std::uint64_t entryCount = 0;
+    std::uint64_t indexOffset = 0;
+    std::uint64_t namesOffset = 0;
+    std::uint64_t namesSize = 0;
+};
+
+std::uint64_t AlignUp(std::uint64_t value)
+{
+    return (value + AssetPack::kAlignment - 1) & ~static_cast<std::uint64_t>(AssetPack::kAlignment - 1);
+}
+
+bool IsPackable(const std::filesystem::path& path)
+{
+    // .meta.json sidecars are editor-only import settings; the runtime never reads them.
+    const std::string name = path.filename().string();
+    return !name.starts_with('.') && !name.ends_with(".tmp") && !name.ends_with(".meta.json");
+}
+
+/// Directories under a pack root that stay loose: audio is opened by path through miniaudio, which
+/// streams from disk and never reads the pack.
+bool IsUnpackedDirectory(const std::filesystem::path& root, const std::filesystem::path& directory)
+{
+    const std::string name = directory.filename().string();
+    return name.starts_with('.') || directory.lexically_relative(root) == "audio";
+}
+
+bool ReadLooseFile(const std::filesystem::path& path, std::string& outBytes)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open())
+    {
+        return false;
+    }
+    outBytes.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    return !stream.bad();
+}
+} // namespace
+
+AssetPack& AssetPack::Instance()
+{
+    static AssetPack instance;
+    return instance;
+}
+
+bool AssetPack::Mount(const std::filesystem::path& packPath)
+{
+    Unmount();
+    MappedFile file;
+    if (!file.Open(packPath) || file.Size() < sizeof(PackHeader))
+    {
+        return false;
+    }
+
+    PackHeader header;
+    std::memcpy(&header, file.Data(), sizeof(header));
+    const PackHeader expected;
+    const std::uint64_t size = file.Size();
+    if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 || header.version != kVersion ||
+        header.indexOffset % alignof(Entry) != 0 || header.indexOffset > size ||
+        header.entryCount > (size - header.indexOffset) / sizeof(Entry) ||
+        header.namesOffset > size || header.namesSize > size - header.namesOffset)
+    {
+        std::cout << "[ASSET PACK] Ignoring malformed pack " << packPath.generic_string() << "\n";
+        return false;
+    }
+
+    const auto* entries = reinterpret_cast<const Entry*>(file.Data() + header.indexOffset);
+    for (std::uint64_t i = 0; i < header.entryCount; ++i)
+    {
+        const Entry& entry = entries[i];
+        if (entry.offset > size || entry.size > size - entry.offset ||
+            static_cast<std::uint64_t>(entry.nameOffset) + entry.nameLength > header.namesSize ||
+            (i > 0 && entries[i - 1].pathHash > entry.pathHash))
+        {
+            std::cout << "[ASSET PACK] Ignoring malformed pack " << packPath.generic_string() << "\n";
+            return false;
+        }
+    }
+
+    m_file = std::move(file);
+    m_entries = entries;
+    m_entryCount = static_cast<std::size_t>(header.entryCount);
+    m_names = reinterpret_cast<const char*>(m_file.Data() + header.namesOffset);
+    m_root = std::filesystem::current_path();
+    std::cout << "[ASSET PACK] Mounted " << packPath.generic_string() << " (" << m_entryCount << " files, "
+              << (m_file.Size() / (1024U * 1024U)) << " MB)\n";
+    return true;
+}
+
+void AssetPack::Unmount()
+{
+    m_file.Close();
+    m_entries = nullptr;
+    m_entryCount = 0;
+    m_names = nullptr;
+    std::lock_guard<std::mutex> lock(m_overrideMutex);
+    m_overrides.clear();
+    m_hasOverrides.store(false, std::memory_order_release);
+}
+
+std::optional<std::string> AssetPack::KeyFor(const std::filesystem::path& path) const
+{
+    const std::filesystem::path full = path.is_absolute() ? path : m_root / path;
+    std::string key = full.lexically_normal().lexically_relative(m_root).generic_string();
+    if (key.empty() || key == "." || key.starts_with(".."))
+    {
+        return std::nullopt;
+    }
+    return key;
+}
+
+bool AssetPack::IsOverridden(const std::string& key) const
+{
+    if (!m_hasOverrides.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_overrideMutex);
+    return m_overrides.contains(key);
+}
+
+std::string_view AssetPack::NameOf(const Entry& entry) const
+{
+    return {m_names + entry.nameOffset, entry.nameLength};
+}
+
+const AssetPack::Entry* AssetPack::FindEntry(const std::filesystem::path& path) const
+{
+    if (!IsMounted())
+    {
+        return nullptr;
+    }
+    const std::optional<std::string> key = KeyFor(path);
+    if (!key.has_value())
+    {
+        return nullptr;
+    }
+    if (IsOverridden(*key))
+    {
+        return nullptr;
+    }
+
+    const std::uint64_t hash = ContentHash(key->data(), key->size());
+    const Entry* end = m_entries + m_entryCount;
+    const Entry* it = std::lower_bound(m_entries, end, hash, [](const Entry& entry, std::uint64_t value) {
+        return entry.pathHash < value;
+    });
+    for (; it != end && it->pathHash == hash; ++it)
+    {
+        if (NameOf(*it) == *key)
+        {
+            return it;
+        }
+    }
+    return nullptr;
+}
+
+std::optional<std::span<const std::uint8_t>> AssetPack::Find(const std::filesystem::path& path) const
+{
+    const Entry* entry = FindEntry(path);
+    if (entry == nullptr)
+    {
+        return std::nullopt;
+    }
+    return std::span<const std::uint8_t>(m_file.Data() + entry->offset, static_cast<std::size_t>(entry->size));
+}
+
+bool AssetPack::FindHash(const std::filesystem::path& path, std::uint64_t& outHash) const
+{
+    const Entry* entry = FindEntry(path);
+    if (entry == nullptr)
+    {
+        return false;
+    }
+    outHash = entry->contentHash;
+    return true;
+}
+
+void AssetPack::MarkLooseOverride(const std::filesystem::path& path)
+{
+    if (!IsMounted())
+    {
+        return;
+    }
+    if (std::optional<std::string> key = KeyFor(path))
+    {
+        std::lock_guard<std::mutex> lock(m_overrideMutex);
+        m_overrides.insert(std::move(*key));
+        m_hasOverrides.store(true, std::memory_order_release);
+    }
+}
+
+bool AssetPack::ReadFile(const std::filesystem::path& path, std::string& outBytes)
+{
+    if (const auto packed = Instance().Find(path))
+    {
+        outBytes.assign(reinterpret_cast<const char*>(packed->data()), packed->size());
+        return true;
+    }
+    return ReadLooseFile(path, outBytes);
+}
+
+std::vector<std::string> AssetPack::ListFiles(const std::filesystem::path& directory, std::string_view extension)
+{
+    std::vector<std::string> names;
+    const AssetPack& pack = Instance();
+    if (pack.IsMounted())
+    {
+        if (const std::optional<std::string> key = pack.KeyFor(directory))
+        {
+            const std::string prefix = *key + "/";
+            for (std::size_t i = 0; i < pack.m_entryCount; ++i)
+            {
+                const std::string_view name = pack.NameOf(pack.m_entries[i]);
+                if (name.size() > prefix.size() && name.starts_with(prefix) && name.ends_with(extension) &&
+                    name.find('/', prefix.size()) == std::string_view::npos && !pack.IsOverridden(std::string(name)))
+                {
+                    names.emplace_back(name.substr(prefix.size()));
+                }
+            }
+        }
+    }
+
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec))
+    {
+        const std::string name = it->path().filename().string();
+        if (it->is_regular_file(ec) && name.ends_with(extension))
+        {
+            names.push_back(name);
+        }
+    }
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+    return names;
+}
+
+bool AssetPack::Build(const std::vector<std::filesystem::path>& roots, const std::filesystem::path& outPath, std::string* outError)
+{
+    const auto fail = [outError](const std::string& message) {
+        if (outError != nullptr)
+        {
+            *outError = message;
+        }
+        return false;
+    };
+
+    std::vector<std::string> keys;
+    for (const std::filesystem::path& root : roots)
+    {
+        std::error_code ec;
+        for (std::filesystem::recursive_directory_iterator it(root, ec), end; !ec && it != end; it.increment(ec))
+        {
+            if (it->is_directory(ec) && IsUnpackedDirectory(root, it->path()))
+            {
+                it.disable_recursion_pending();
+                continue;
+            }
+            if (it->is_regular_file(ec) && IsPackable(it->path()))
+            {
+                keys.push_back(it->path().lexically_normal().generic_string());
+            }
+        }
+    }
+
+    const std::filesystem::path tempPath = outPath.string() + ".tmp";
+    std::ofstream stream(tempPath, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open())
+    {
+        return fail("Could not open " + tempPath.generic_string() + " for writing");
+    }
+
+    const auto padTo = [&stream](std::uint64_t offset) {
+        static constexpr std::array<char, AssetPack::kAlignment> kZeros{};
+        const std::uint64_t position = static_cast<std::uint64_t>(stream.tellp());
+        stream.write(kZeros.data(), static_cast<std::streamsize>(offset - position));
+    };
+
+    PackHeader header;
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::vector<Entry> entries;
+    std::string names;
+    entries.reserve(keys.size());
+    std::uint64_t offset = sizeof(header);
+    for (const std::string& key : keys)
+    {
+        MappedFile file;
+        if (!file.Open(key))
+        {
+            return fail("Could not read " + key);
+        }
+        Entry entry;
+        entry.pathHash = ContentHash(key.data(), key.size());
+        entry.offset = AlignUp(offset);
+        entry.size = file.Size();
+        entry.contentHash = ContentHash(file.Data(), file.Size());
+        entry.nameOffset = static_cast<std::uint32_t>(names.size());
+        entry.nameLength = static_cast<std::uint32_t>(key.size());
+        names += key;
+
+        padTo(entry.offset);
+        stream.write(reinterpret_cast<const char*>(file.Data()), static_cast<std::streamsize>(file.Size()));
+        offset = entry.offset + entry.size;
+        entries.push_back(entry);
+    }
+
+    std::sort(entries.begin(), entries.end(), [&names](const Entry& a, const Entry& b) {
+        if (a.pathHash != b.pathHash)
+        {
+            return a.pathHash < b.pathHash;
+        }
+        return names.compare(a.nameOffset, a.nameLength, names, b.nameOffset, b.nameLength) < 0;
+    });
+
+    header.entryCount = entries.size();
+    header.indexOffset = AlignUp(offset);
+    header.namesOffset = header.indexOffset + entries.size() * sizeof(Entry);
+    header.namesSize = names.size();
+    padTo(header.indexOffset);
+    stream.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(Entry)));
+    stream.write(names.data(), static_cast<std::streamsize>(names.size()));
+    stream.seekp(0);
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    stream.close();
+    if (!stream)
+    {
+        return fail("Failed writing " + tempPath.generic_string());
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, outPath, ec);
+    if (ec)
+    {
+        return fail("Failed to replace " + outPath.generic_string() + ": " + ec.message());
+    }
+    std::cout << "[ASSET PACK] Wrote " << outPath.generic_string() << " (" << entries.size() << " files)\n";
+    return true;
+}
+} // namespace engine::assets
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "engine/assets/MappedFile.hpp"
+
+namespace engine::assets
+{
+/// Optional single-file archive of assets/ ("assets.pak" in the working directory). The header is
+/// followed by 64-byte aligned file entries, then an index sorted by the FNV-1a hash of each path
+/// (relative to the working directory, e.g. "assets/loops/x.json") and a path string table. The pack
+/// is memory-mapped once; lookups binary-search the index and return views into the mapping.
+///
+/// ReadFile/ListFiles/Find resolve through the pack first and fall back to loose files, so dev
+/// builds without a pack behave as before. Files saved at runtime (editor) override the packed copy.
+class AssetPack
+{
+public:
+    static constexpr std::uint32_t kVersion = 1;
+    static constexpr std::size_t kAlignment = 64;
+    static constexpr const char* kDefaultPath = "assets.pak";
+
+    static AssetPack& Instance();
+
+    /// Maps the pack; returns false (and stays unmounted) if it is missing or malformed.
+    /// Mount before loads start: lookups are lock-free reads of the mapping.
+    bool Mount(const std::filesystem::path& packPath);
+    void Unmount();
+
+    [[nodiscard]] bool IsMounted() const { return m_file.IsOpen(); }
+    [[nodiscard]] std::size_t FileCount() const { return m_entryCount; }
+
+    /// Packed bytes of a file, or nullopt. Paths may be relative to the working directory or absolute.
+    [[nodiscard]] std::optional<std::span<const std::uint8_t>> Find(const std::filesystem::path& path) const;
+    /// Content hash recorded at build time (same FNV-1a as CookedMesh::HashFile).
+    [[nodiscard]] bool FindHash(const std::filesystem::path& path, std::uint64_t& outHash) const;
+
+    /// A loose file written or deleted at runtime; later lookups of it skip the stale packed copy.
+    void MarkLooseOverride(const std::filesystem::path& path);
+
+    /// Whole file from the pack, else from disk.
+    static bool ReadFile(const std::filesystem::path& path, std::string& outBytes);
+    /// File names (not paths) with this extension directly inside directory, pack and disk merged, sorted.
+    [[nodiscard]] static std::vector<std::string> ListFiles(const std::filesystem::path& directory, std::string_view extension);
+
+    /// Packs every file under roots (relative to the working directory) into outPath. Audio and
+    /// editor .meta.json sidecars are left out; they are only ever read from loose files.
+    static bool Build(const std::vector<std::filesystem::path>& roots, const std::filesystem::path& outPath, std::string* outError = nullptr);
+
+private:
+    struct Entry;
+
+    AssetPack() = default;
+
+    [[nodiscard]] std::optional<std::string> KeyFor(const std::filesystem::path& path) const;
+    [[nodiscard]] const Entry* FindEntry(const std::filesystem::path& path) const;
+    [[nodiscard]] bool IsOverridden(const std::string& key) const;
+    [[nodiscard]] std::string_view NameOf(const Entry& entry) const;
+
+    MappedFile m_file;
+    const Entry* m_entries = nullptr;
+    std::size_t m_entryCount = 0;
+    const char* m_names = nullptr;
+    std::filesystem::path m_root;
+
+    mutable std::mutex m_overrideMutex;
+    std::unordered_set<std::string> m_overrides;
+    std::atomic<bool> m_hasOverrides{false};
+};
+} // namespace engine::assets
@@ -1,4 +1,6 @@
 #include "engine/assets/AssetRegistry.hpp"
+#include "engine/assets/CookedMesh.hpp"
+#include "engine/assets/MeshLibrary.hpp"
 
 #include <algorithm>
 #include <cctype>
@@ -69,6 +71,13 @@ std::vector<AssetEntry> AssetRegistry::ListDirectory(const std::string& relative
 
     for (const auto& entry : std::filesystem::directory_iterator(dir))
     {
+        const std::string fileName = entry.path().filename().string();
+        const std::string extension = ToLower(entry.path().extension().string());
+        if (extension == ".amesh" || extension == ".abin" || fileName.starts_with('.') ||
+            fileName.ends_with(".colliders.json"))
+        {
+            continue; // cooked build output (and the cook manifest), not an asset
+        }
         AssetEntry out;
         out.directory = entry.is_directory();
         out.name = entry.path().filename().string();
@@ -180,6 +189,15 @@ ImportResult AssetRegistry::ImportExternalFileToDirectory(
     result.success = true;
     result.relativePath = NormalizeRelativePath(std::filesystem::relative(destination, m_assetsRoot));
     result.message = "Imported " + destination.filename().string();
+
+    if (KindFromPath(destination) == AssetKind::Mesh && MeshLibrary::IsCookable(destination))
+    {
+        std::string cookError;
+        if (!MeshLibrary::CookMeshFile(destination, &cookError))
+        {
+            result.message += " (cook failed: " + cookError + ", will load from source)";
+        }
+    }
     return result;
 }
 
@@ -353,36 +371,26 @@ bool AssetRegistry::NeedsImport(const std::filesystem::path& source, const std::
         return true;
     }
 
-    const auto srcTime = std::filesystem::last_write_time(source, ec);
+    const auto srcSize = std::filesystem::file_size(source, ec);
     if (ec)
     {
         return true;
     }
     ec.clear();
-    const auto dstTime = std::filesystem::last_write_time(destination, ec);
-    if (ec)
-    {
-        return true;
-    }
-
-    if (srcTime > dstTime)
+    const auto dstSize = std::filesystem::file_size(destination, ec);
+    if (ec || srcSize != dstSize)
     {
         return true;
     }
 
-    ec.clear();
-    const auto srcSize = std::filesystem::file_size(source, ec);
-    if (ec)
-    {
-        return true;
-    }
-    ec.clear();
-    const auto dstSize = std::filesystem::file_size(destination, ec);
-    if (ec)
+    // Same size: compare content, not timestamps (checkouts and copies touch mtimes without changing bytes).
+    std::uint64_t srcHash = 0;
+    std::uint64_t dstHash = 0;
+    if (!CookedMesh::HashFile(source, srcHash) || !CookedMesh::HashFile(destination, dstHash))
     {
         return true;
     }
-    return srcSize != dstSize;
+    return srcHash != dstHash;
 }
 
 bool AssetRegistry::WriteMetaFile(
@@ -410,6 +418,11 @@ bool AssetRegistry::WriteMetaFile(
     meta["source_path"] = source.generic_string();
     meta["import_path"] = NormalizeRelativePath(std::filesystem::relative(destination, m_assetsRoot));
     meta["source_write_time"] = sourceTime.time_since_epoch().count();
+    std::uint64_t sourceHash = 0;
+    if (CookedMesh::HashFile(source, sourceHash))
+    {
+        meta["source_hash"] = sourceHash;
+    }
     meta["import_settings"] = {
         {"generate_mips", true},
         {"compress", false},
@@ -1,4 +1,5 @@
 #include "engine/assets/AsyncAssetLoader.hpp"
+#include "engine/assets/AssetPack.hpp"
 
 #include <filesystem>
 #include <fstream>
@@ -209,6 +210,24 @@ void AsyncAssetLoader::LoadAssetInternal(
     result.type = expectedType;
 
     std::filesystem::path fullPath = std::filesystem::path(m_assetsRoot) / assetPath;
+
+    if (const auto packed = AssetPack::Instance().Find(fullPath))
+    {
+        result.data.assign(packed->begin(), packed->end());
+        result.state = AssetState::Loaded;
+
+        {
+            std::lock_guard<std::mutex> lock(m_assetsMutex);
+            m_assets[assetPath] = result;
+        }
+
+        ++m_totalLoaded;
+        --m_currentlyLoading;
+        m_loadCounter.Decrement();
+
+        InvokePendingCallbacks(assetPath, result);
+        return;
+    }
     
     std::error_code ec;
     if (!std::filesystem::exists(fullPath, ec))
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::assets
+{
+inline constexpr std::uint64_t kContentHashSeed = 14695981039346656037ULL;
+
+/// FNV-1a 64 over raw bytes; chain calls by passing the previous result as seed.
+[[nodiscard]] inline std::uint64_t ContentHash(const void* data, std::size_t size, std::uint64_t seed = kContentHashSeed)
+{
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    std::uint64_t hash = seed;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+} // namespace engine::assets
@@ -0,0 +1,510 @@
+#include "engine/assets/CookedMesh.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include "engine/assets/AssetPack.hpp"
+#include "engine/assets/ContentHash.hpp"
+#include "engine/assets/MappedFile.hpp"
+
+namespace engine::assets
+{
+namespace
+{
+constexpr std::size_t kBlobAlignment = 16;
+constexpr std::uint32_t kHasNormals = 1U << 0U;
+constexpr std::uint32_t kHasColors = 1U << 1U;
+constexpr std::uint32_t kHasUvs = 1U << 2U;
+constexpr std::uint32_t kMaxCount = 1U << 28U; // sanity cap for counts read from disk
+
+struct FileHeader
+{
+    char magic[4] = {'A', 'M', 'S', 'H'};
+    std::uint32_t version = CookedMesh::kVersion;
+    std::uint64_t sourceHash = 0;
+    float boundsMin[3] = {0.0F, 0.0F, 0.0F};
+    float boundsMax[3] = {0.0F, 0.0F, 0.0F};
+    std::uint32_t surfaceCount = 0;
+    std::uint32_t lodCount = 0;
+    std::uint32_t animationNameCount = 0;
+    std::uint32_t reserved[3] = {0, 0, 0};
+};
+
+struct GeometryHeader
+{
+    std::uint32_t vertexCount = 0;
+    std::uint32_t indexCount = 0;
+    std::uint32_t flags = 0;
+    float lodError = 0.0F; // LOD blocks only
+};
+
+struct TextureHeader
+{
+    std::int32_t width = 0;
+    std::int32_t height = 0;
+    std::uint32_t levelCount = 0; // 0 = no texture, else level 0 + mips, all RGBA8
+    std::uint32_t reserved = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<FileHeader> && sizeof(FileHeader) % kBlobAlignment == 0);
+static_assert(sizeof(GeometryHeader) == kBlobAlignment && sizeof(TextureHeader) == kBlobAlignment);
+
+class BlobWriter
+{
+public:
+    explicit BlobWriter(std::ofstream& stream) : m_stream(stream) {}
+
+    template <typename T>
+    void Pod(const T& value)
+    {
+        Bytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    void Array(const std::vector<T>& values)
+    {
+        Bytes(values.data(), values.size() * sizeof(T));
+        Align();
+    }
+
+    void Bytes(const void* data, std::size_t size)
+    {
+        if (size > 0)
+        {
+            m_stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            m_offset += size;
+        }
+    }
+
+    void Align()
+    {
+        static constexpr std::array<char, kBlobAlignment> kZeros{};
+        Bytes(kZeros.data(), (kBlobAlignment - m_offset % kBlobAlignment) % kBlobAlignment);
+    }
+
+private:
+    std::ofstream& m_stream;
+    std::size_t m_offset = 0;
+};
+
+/// Bounds-checked cursor over the mapped file; every failed read poisons the reader.
+class BlobReader
+{
+public:
+    BlobReader(const std::uint8_t* data, std::size_t size) : m_data(data), m_size(size) {}
+
+    template <typename T>
+    bool Pod(T& value)
+    {
+        return Bytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    bool Array(std::vector<T>& values, std::size_t count)
+    {
+        if (count > kMaxCount || count * sizeof(T) > m_size - std::min(m_offset, m_size))
+        {
+            m_ok = false;
+            return false;
+        }
+        values.resize(count);
+        return Bytes(values.data(), count * sizeof(T)) && Align();
+    }
+
+    bool Bytes(void* out, std::size_t size)
+    {
+        if (!m_ok || size > m_size - std::min(m_offset, m_size))
+        {
+            m_ok = false;
+            return false;
+        }
+        if (size > 0)
+        {
+            std::memcpy(out, m_data + m_offset, size);
+        }
+        m_offset += size;
+        return true;
+    }
+
+    bool Align()
+    {
+        m_offset += (kBlobAlignment - m_offset % kBlobAlignment) % kBlobAlignment;
+        m_ok = m_ok && m_offset <= m_size;
+        return m_ok;
+    }
+
+    [[nodiscard]] bool Ok() const { return m_ok; }
+
+private:
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+    std::size_t m_offset = 0;
+    bool m_ok = true;
+};
+
+void WriteGeometry(BlobWriter& writer, const render::MeshGeometry& geometry, float lodError)
+{
+    const std::size_t vertices = geometry.positions.size();
+    GeometryHeader header;
+    header.vertexCount = static_cast<std::uint32_t>(vertices);
+    header.indexCount = static_cast<std::uint32_t>(geometry.indices.size());
+    header.flags = (geometry.normals.size() == vertices ? kHasNormals : 0U) |
+                   (geometry.colors.size() == vertices ? kHasColors : 0U) |
+                   (geometry.uvs.size() == vertices ? kHasUvs : 0U);
+    header.lodError = lodError;
+    writer.Pod(header);
+    writer.Array(geometry.positions);
+    if ((header.flags & kHasNormals) != 0U)
+    {
+        writer.Array(geometry.normals);
+    }
+    if ((header.flags & kHasColors) != 0U)
+    {
+        writer.Array(geometry.colors);
+    }
+    if ((header.flags & kHasUvs) != 0U)
+    {
+        writer.Array(geometry.uvs);
+    }
+    writer.Array(geometry.indices);
+}
+
+bool ReadGeometry(BlobReader& reader, render::MeshGeometry& geometry, float* outLodError)
+{
+    GeometryHeader header;
+    if (!reader.Pod(header))
+    {
+        return false;
+    }
+    const std::size_t vertices = header.vertexCount;
+    const bool ok = reader.Array(geometry.positions, vertices) &&
+                    reader.Array(geometry.normals, (header.flags & kHasNormals) != 0U ? vertices : 0U) &&
+                    reader.Array(geometry.colors, (header.flags & kHasColors) != 0U ? vertices : 0U) &&
+                    reader.Array(geometry.uvs, (header.flags & kHasUvs) != 0U ? vertices : 0U) &&
+                    reader.Array(geometry.indices, header.indexCount);
+    if (!ok || std::any_of(geometry.indices.begin(), geometry.indices.end(), [vertices](std::uint32_t index) { return index >= vertices; }))
+    {
+        return false;
+    }
+    if (outLodError != nullptr)
+    {
+        *outLodError = header.lodError;
+    }
+    return true;
+}
+
+float SrgbToLinear(unsigned char value)
+{
+    const float c = static_cast<float>(value) / 255.0F;
+    return c <= 0.04045F ? c / 12.92F : std::pow((c + 0.055F) / 1.055F, 2.4F);
+}
+
+unsigned char LinearToSrgb(float value)
+{
+    const float c = std::clamp(value, 0.0F, 1.0F);
+    const float srgb = c <= 0.0031308F ? c * 12.92F : 1.055F * std::pow(c, 1.0F / 2.4F) - 0.055F;
+    return static_cast<unsigned char>(std::lround(srgb * 255.0F));
+}
+} // namespace
+
+std::filesystem::path CookedMesh::PathFor(const std::filesystem::path& sourcePath)
+{
+    return sourcePath.string() + ".amesh";
+}
+
+bool CookedMesh::HashFile(const std::filesystem::path& path, std::uint64_t& outHash)
+{
+    MappedFile file;
+    if (!file.Open(path))
+    {
+        return false;
+    }
+
+    outHash = ContentHash(file.Data(), file.Size());
+    return true;
+}
+
+bool CookedMesh::Write(const std::filesystem::path& cookedPath, const MeshData& mesh, std::uint64_t sourceHash, std::string* outError)
+{
+    // Write to a temporary and rename, so a crash never leaves a truncated file that hashes as valid.
+    // The temporary is per thread: the asset cooker and an in-game load may cook the same mesh at once.
+    const std::filesystem::path tempPath =
+        cookedPath.string() + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+    {
+        std::ofstream stream(tempPath, std::ios::binary | std::ios::trunc);
+        if (!stream.is_open())
+        {
+            if (outError != nullptr)
+            {
+                *outError = "Could not open " + tempPath.generic_string() + " for writing";
+            }
+            return false;
+        }
+
+        FileHeader header;
+        header.sourceHash = sourceHash;
+        std::memcpy(header.boundsMin, &mesh.boundsMin.x, sizeof(header.boundsMin));
+        std::memcpy(header.boundsMax, &mesh.boundsMax.x, sizeof(header.boundsMax));
+        header.surfaceCount = static_cast<std::uint32_t>(mesh.surfaces.size());
+        header.lodCount = static_cast<std::uint32_t>(mesh.lods.size());
+        header.animationNameCount = static_cast<std::uint32_t>(mesh.animationNames.size());
+
+        BlobWriter writer(stream);
+        writer.Pod(header);
+        WriteGeometry(writer, mesh.geometry, 0.0F);
+        for (const MeshSurfaceData& surface : mesh.surfaces)
+        {
+            WriteGeometry(writer, surface.geometry, 0.0F);
+            TextureHeader texture;
+            const bool hasTexture = !surface.albedoPixels.empty() && surface.albedoChannels == 4;
+            if (hasTexture)
+            {
+                texture.width = surface.albedoWidth;
+                texture.height = surface.albedoHeight;
+                texture.levelCount = static_cast<std::uint32_t>(1U + surface.albedoMips.size());
+            }
+            writer.Pod(texture);
+            if (hasTexture)
+            {
+                writer.Array(surface.albedoPixels);
+                for (const auto& level : surface.albedoMips)
+                {
+                    writer.Array(level);
+                }
+            }
+        }
+        for (const MeshLod& lod : mesh.lods)
+        {
+            WriteGeometry(writer, lod.geometry, lod.error);
+        }
+        for (const std::string& name : mesh.animationNames)
+        {
+            writer.Pod(static_cast<std::uint32_t>(name.size()));
+            writer.Bytes(name.data(), name.size());
+            writer.Align();
+        }
+
+        if (!stream.good())
+        {
+            if (outError != nullptr)
+            {
+                *outError = "Failed writing " + tempPath.generic_string();
+            }
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, cookedPath, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempPath, ec);
+        if (outError != nullptr)
+        {
+            *outError = "Failed to replace " + cookedPath.generic_string();
+        }
+        return false;
+    }
+    return true;
+}
+
+bool CookedMesh::Read(const std::filesystem::path& cookedPath, std::uint64_t sourceHash, MeshData& outMesh)
+{
+    // Packed .amesh files are read straight out of the pack mapping.
+    MappedFile file;
+    std::span<const std::uint8_t> bytes;
+    if (const auto packed = AssetPack::Instance().Find(cookedPath))
+    {
+        bytes = *packed;
+    }
+    else if (file.Open(cookedPath))
+    {
+        bytes = std::span<const std::uint8_t>(file.Data(), file.Size());
+    }
+    if (bytes.size() < sizeof(FileHeader))
+    {
+        return false;
+    }
+
+    BlobReader reader(bytes.data(), bytes.size());
+    FileHeader header;
+    const FileHeader expected;
+    if (!reader.Pod(header) ||
+        std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 ||
+        header.version != kVersion ||
+        header.sourceHash != sourceHash ||
+        header.surfaceCount > kMaxCount || header.lodCount > 16U || header.animationNameCount > kMaxCount)
+    {
+        return false;
+    }
+
+    MeshData mesh;
+    std::memcpy(&mesh.boundsMin.x, header.boundsMin, sizeof(header.boundsMin));
+    std::memcpy(&mesh.boundsMax.x, header.boundsMax, sizeof(header.boundsMax));
+    if (!ReadGeometry(reader, mesh.geometry, nullptr))
+    {
+        return false;
+    }
+
+    mesh.surfaces.resize(header.surfaceCount);
+    for (MeshSurfaceData& surface : mesh.surfaces)
+    {
+        TextureHeader texture;
+        if (!ReadGeometry(reader, surface.geometry, nullptr) || !reader.Pod(texture))
+        {
+            return false;
+        }
+        if (texture.levelCount == 0)
+        {
+            continue;
+        }
+        if (texture.width <= 0 || texture.height <= 0 || texture.levelCount > 32U)
+        {
+            return false;
+        }
+        surface.albedoWidth = texture.width;
+        surface.albedoHeight = texture.height;
+        surface.albedoChannels = 4;
+        std::size_t width = static_cast<std::size_t>(texture.width);
+        std::size_t height = static_cast<std::size_t>(texture.height);
+        if (!reader.Array(surface.albedoPixels, width * height * 4U))
+        {
+            return false;
+        }
+        surface.albedoMips.resize(texture.levelCount - 1U);
+        for (auto& level : surface.albedoMips)
+        {
+            width = std::max<std::size_t>(1U, width / 2U);
+            height = std::max<std::size_t>(1U, height / 2U);
+            if (!reader.Array(level, width * height * 4U))
+            {
+                return false;
+            }
+        }
+    }
+
+    mesh.lods.resize(header.lodCount);
+    for (MeshLod& lod : mesh.lods)
+    {
+        if (!ReadGeometry(reader, lod.geometry, &lod.error))
+        {
+            return false;
+        }
+    }
+
+    mesh.animationNames.resize(header.animationNameCount);
+    for (std::string& name : mesh.animationNames)
+    {
+        std::uint32_t length = 0;
+        std::vector<char> chars;
+        if (!reader.Pod(length) || !reader.Array(chars, length))
+        {
+            return false;
+        }
+        name.assign(chars.begin(), chars.end());
+    }
+
+    if (!reader.Ok())
+    {
+        return false;
+    }
+    mesh.loaded = true;
+    outMesh = std::move(mesh);
+    return true;
+}
+
+void CookedMesh::PrepareSurfaceTextures(MeshData& mesh)
+{
+    for (MeshSurfaceData& surface : mesh.surfaces)
+    {
+        const int width = surface.albedoWidth;
+        const int height = surface.albedoHeight;
+        const int channels = std::clamp(surface.albedoChannels, 1, 4);
+        const std::size_t pixels = static_cast<std::size_t>(std::max(0, width)) * static_cast<std::size_t>(std::max(0, height));
+        if (surface.albedoPixels.empty() || pixels == 0 || surface.albedoPixels.size() < pixels * static_cast<std::size_t>(channels))
+        {
+            surface.albedoPixels.clear();
+            surface.albedoMips.clear();
+            continue;
+        }
+
+        if (channels != 4)
+        {
+            std::vector<unsigned char> rgba(pixels * 4U, 255U);
+            for (std::size_t i = 0; i < pixels; ++i)
+            {
+                const unsigned char* src = surface.albedoPixels.data() + i * static_cast<std::size_t>(channels);
+                rgba[i * 4U + 0U] = src[0];
+                rgba[i * 4U + 1U] = channels > 1 ? src[1] : src[0];
+                rgba[i * 4U + 2U] = channels > 2 ? src[2] : src[0];
+            }
+            surface.albedoPixels = std::move(rgba);
+            surface.albedoChannels = 4;
+        }
+        surface.albedoMips = BuildMipChain(surface.albedoPixels, width, height);
+    }
+}
+
+std::vector<std::vector<unsigned char>> CookedMesh::BuildMipChain(const std::vector<unsigned char>& rgba, int width, int height)
+{
+    std::vector<std::vector<unsigned char>> levels;
+    if (width <= 0 || height <= 0 || rgba.size() < static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4U)
+    {
+        return levels;
+    }
+
+    std::array<float, 256> toLinear{};
+    for (int i = 0; i < 256; ++i)
+    {
+        toLinear[static_cast<std::size_t>(i)] = SrgbToLinear(static_cast<unsigned char>(i));
+    }
+
+    const std::vector<unsigned char>* previous = &rgba;
+    int previousWidth = width;
+    int previousHeight = height;
+    while (previousWidth > 1 || previousHeight > 1)
+    {
+        const int levelWidth = std::max(1, previousWidth / 2);
+        const int levelHeight = std::max(1, previousHeight / 2);
+        std::vector<unsigned char> level(static_cast<std::size_t>(levelWidth) * static_cast<std::size_t>(levelHeight) * 4U);
+        for (int y = 0; y < levelHeight; ++y)
+        {
+            for (int x = 0; x < levelWidth; ++x)
+            {
+                std::array<float, 4> sum{};
+                for (int dy = 0; dy < 2; ++dy)
+                {
+                    for (int dx = 0; dx < 2; ++dx)
+                    {
+                        const int sx = std::min(x * 2 + dx, previousWidth - 1);
+                        const int sy = std::min(y * 2 + dy, previousHeight - 1);
+                        const unsigned char* src = previous->data() + (static_cast<std::size_t>(sy) * static_cast<std::size_t>(previousWidth) + static_cast<std::size_t>(sx)) * 4U;
+                        sum[0] += toLinear[src[0]];
+                        sum[1] += toLinear[src[1]];
+                        sum[2] += toLinear[src[2]];
+                        sum[3] += static_cast<float>(src[3]);
+                    }
+                }
+                unsigned char* dst = level.data() + (static_cast<std::size_t>(y) * static_cast<std::size_t>(levelWidth) + static_cast<std::size_t>(x)) * 4U;
+                dst[0] = LinearToSrgb(sum[0] * 0.25F);
+                dst[1] = LinearToSrgb(sum[1] * 0.25F);
+                dst[2] = LinearToSrgb(sum[2] * 0.25F);
+                dst[3] = static_cast<unsigned char>(std::lround(sum[3] * 0.25F));
+            }
+        }
+        levels.push_back(std::move(level));
+        previous = &levels.back();
+        previousWidth = levelWidth;
+        previousHeight = levelHeight;
+    }
+    return levels;
+}
+} // namespace engine::assets
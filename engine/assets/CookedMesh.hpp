@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "engine/assets/MeshLibrary.hpp"
+
+namespace engine::assets
+{
+/// Cooked ".amesh" files written next to a source mesh (<file>.amesh). A versioned header is
+/// followed by 16-byte aligned blobs: merged geometry, per-surface geometry with a pre-decoded RGBA8
+/// albedo mip chain, and the simplified LODs. Reading maps the file and copies the blobs out with no
+/// parsing. A cooked file is only used while the FNV-1a hash of its source still matches.
+class CookedMesh
+{
+public:
+    static constexpr std::uint32_t kVersion = 1;
+
+    [[nodiscard]] static std::filesystem::path PathFor(const std::filesystem::path& sourcePath);
+    [[nodiscard]] static bool HashFile(const std::filesystem::path& path, std::uint64_t& outHash);
+
+    static bool Write(const std::filesystem::path& cookedPath, const MeshData& mesh, std::uint64_t sourceHash, std::string* outError = nullptr);
+    [[nodiscard]] static bool Read(const std::filesystem::path& cookedPath, std::uint64_t sourceHash, MeshData& outMesh);
+
+    /// Converts every surface albedo to RGBA8 and fills albedoMips, so source and cooked loads match.
+    static void PrepareSurfaceTextures(MeshData& mesh);
+    /// RGBA8 levels 1..N of an RGBA8 image (2x2 box filter in linear light, sRGB encoded).
+    [[nodiscard]] static std::vector<std::vector<unsigned char>> BuildMipChain(const std::vector<unsigned char>& rgba, int width, int height);
+};
+} // namespace engine::assets
@@ -1,9 +1,12 @@
 #include "engine/assets/MeshLibrary.hpp"
 #include "engine/animation/AnimationClip.hpp"
+#include "engine/assets/AssetPack.hpp"
+#include "engine/assets/CookedMesh.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
@@ -11,6 +14,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <glm/common.hpp>
@@ -816,21 +820,234 @@ void CollectNodeInstances(
         CollectNodeInstances(model, child, world, outNodeWorlds, outMeshInstances);
     }
 }
+
+bool IsSupportedMeshExtension(const std::string& ext)
+{
+    return ext == ".obj" || ext == ".gltf" || ext == ".glb";
+}
 } // namespace
 
+void MeshLoad::Wait() const
+{
+    m_state.wait(AssetState::Loading, std::memory_order_acquire);
+}
+
+void MeshLoad::Finish(std::shared_ptr<const MeshData> data, std::uint64_t contentHash)
+{
+    const bool loaded = data->loaded;
+    m_data = std::move(data);
+    m_contentHash = contentHash;
+    m_state.store(loaded ? AssetState::Loaded : AssetState::Failed, std::memory_order_release);
+    m_state.notify_all();
+}
+
+void MeshLibrary::LoadInto(
+    MeshLoad& load,
+    const std::filesystem::path& absolutePath,
+    ContentIndex& index,
+    AnimationLoadedCallback* animationCallback
+)
+{
+    try
+    {
+        std::uint64_t hash = 0;
+        // Packed files carry their content hash in the pack index; only loose files are read to hash.
+        const bool hashed = IsSupportedMeshExtension(ToLower(absolutePath.extension().string())) &&
+                            (AssetPack::Instance().FindHash(absolutePath, hash) || CookedMesh::HashFile(absolutePath, hash));
+        // Animation callbacks must see every load, so those never reuse another path's data.
+        const bool shareable = hashed && animationCallback == nullptr;
+        if (shareable)
+        {
+            std::lock_guard<std::mutex> lock(index.mutex);
+            const auto it = index.meshes.find(hash);
+            if (it != index.meshes.end())
+            {
+                if (std::shared_ptr<const MeshData> existing = it->second.lock())
+                {
+                    load.Finish(std::move(existing), hash);
+                    return;
+                }
+            }
+        }
+
+        auto data = std::make_shared<const MeshData>(LoadCookedOrSource(absolutePath, hashed ? &hash : nullptr, animationCallback));
+        if (shareable && data->loaded)
+        {
+            std::lock_guard<std::mutex> lock(index.mutex);
+            index.meshes[hash] = data;
+        }
+        load.Finish(std::move(data), hashed ? hash : 0U);
+    }
+    catch (const std::exception& e)
+    {
+        // Never leave the handle pending: waiters would block forever.
+        MeshData failed;
+        failed.error = e.what();
+        load.Finish(std::make_shared<const MeshData>(std::move(failed)), 0U);
+    }
+}
+
 const MeshData* MeshLibrary::LoadMesh(const std::filesystem::path& absolutePath, std::string* outError)
+{
+    const MeshHandle load = AcquireMesh(absolutePath);
+    if (outError != nullptr)
+    {
+        *outError = load->Data().error;
+    }
+    return &load->Data(); // the cache keeps it alive
+}
+
+MeshHandle MeshLibrary::AcquireMesh(const std::filesystem::path& absolutePath)
 {
     const std::string key = absolutePath.lexically_normal().generic_string();
-    const auto existing = m_cache.find(key);
-    if (existing != m_cache.end())
+    CacheEntry& entry = m_cache[key];
+    if (entry.load == nullptr)
     {
-        if (outError != nullptr)
+        entry.load = std::make_shared<MeshLoad>();
+        LoadInto(*entry.load, absolutePath, *m_contentIndex, m_animationCallback ? &m_animationCallback : nullptr);
+    }
+    entry.lastUse = ++m_useTick;
+    entry.load->Wait();
+    return entry.load;
+}
+
+MeshHandle MeshLibrary::LoadMeshAsync(const std::filesystem::path& absolutePath)
+{
+    const std::string key = absolutePath.lexically_normal().generic_string();
+    CacheEntry& entry = m_cache[key];
+    entry.lastUse = ++m_useTick;
+    if (entry.load != nullptr)
+    {
+        return entry.load;
+    }
+
+    entry.load = std::make_shared<MeshLoad>();
+    auto job = [load = entry.load, absolutePath, index = m_contentIndex]() {
+        LoadInto(*load, absolutePath, *index, nullptr);
+    };
+    if (core::JobSystem::Instance().Schedule(job, core::JobPriority::Normal, "mesh_load") == core::kInvalidJobId)
+    {
+        job();
+    }
+    return entry.load;
+}
+
+void MeshLibrary::Evict(const std::filesystem::path& absolutePath)
+{
+    m_cache.erase(absolutePath.lexically_normal().generic_string());
+}
+
+void MeshLibrary::Clear()
+{
+    m_cache.clear();
+}
+
+MeshLibrary::Residency MeshLibrary::GetResidency() const
+{
+    Residency residency;
+    std::unordered_set<const MeshData*> seen;
+    seen.reserve(m_cache.size());
+    for (const auto& [key, entry] : m_cache)
+    {
+        (void)key;
+        if (entry.load.use_count() > 1)
+        {
+            ++residency.referenced;
+        }
+        if (!entry.load->IsDone() || !entry.load->Data().loaded)
+        {
+            continue;
+        }
+        const MeshData* data = &entry.load->Data();
+        if (seen.insert(data).second)
+        {
+            residency.bytes += ResidentBytes(*data);
+        }
+    }
+    residency.meshes = seen.size();
+    return residency;
+}
+
+std::size_t MeshLibrary::EvictUnused(std::size_t bytesToFree)
+{
+    std::vector<std::pair<std::uint64_t, std::string>> candidates;
+    for (const auto& [key, entry] : m_cache)
+    {
+        // use_count 1: only the cache holds it (no handle, no queued upload, no running job).
+        if (entry.load.use_count() == 1 && entry.load->IsDone())
+        {
+            candidates.emplace_back(entry.lastUse, key);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    std::size_t freed = 0;
+    for (const auto& [lastUse, key] : candidates)
+    {
+        if (freed >= bytesToFree)
+        {
+            break;
+        }
+        (void)lastUse;
+        const auto it = m_cache.find(key);
+        // The data may be shared with another path of the same content; it is only freed with the last.
+        if (it->second.load->m_data.use_count() == 1)
+        {
+            freed += ResidentBytes(it->second.load->Data());
+        }
+        m_cache.erase(it);
+        ++m_evictedTotal;
+    }
+
+    if (!candidates.empty())
+    {
+        std::lock_guard<std::mutex> lock(m_contentIndex->mutex);
+        std::erase_if(m_contentIndex->meshes, [](const auto& item) { return item.second.expired(); });
+    }
+    return freed;
+}
+
+std::size_t MeshLibrary::ResidentBytes(const MeshData& mesh)
+{
+    const auto geometryBytes = [](const render::MeshGeometry& geometry) {
+        return geometry.positions.capacity() * sizeof(glm::vec3) + geometry.normals.capacity() * sizeof(glm::vec3) +
+               geometry.colors.capacity() * sizeof(glm::vec3) + geometry.uvs.capacity() * sizeof(glm::vec2) +
+               geometry.indices.capacity() * sizeof(std::uint32_t);
+    };
+
+    std::size_t bytes = sizeof(MeshData) + geometryBytes(mesh.geometry);
+    for (const MeshSurfaceData& surface : mesh.surfaces)
+    {
+        bytes += geometryBytes(surface.geometry) + surface.albedoPixels.capacity();
+        for (const auto& level : surface.albedoMips)
         {
-            *outError = existing->second.error;
+            bytes += level.capacity();
         }
-        return &existing->second;
     }
+    for (const MeshLod& lod : mesh.lods)
+    {
+        bytes += geometryBytes(lod.geometry);
+    }
+    return bytes;
+}
+
+bool MeshLibrary::IsCookable(const std::filesystem::path& absolutePath)
+{
+    return IsSupportedMeshExtension(ToLower(absolutePath.extension().string()));
+}
 
+MeshData MeshLibrary::LoadSourceFile(const std::filesystem::path& absolutePath, AnimationLoadedCallback* animationCallback)
+{
+    MeshData loaded = LoadSourceGeometry(absolutePath, animationCallback);
+    if (loaded.loaded)
+    {
+        BuildLods(absolutePath, loaded);
+    }
+    return loaded;
+}
+
+MeshData MeshLibrary::LoadSourceGeometry(const std::filesystem::path& absolutePath, AnimationLoadedCallback* animationCallback)
+{
     MeshData loaded;
     const std::string ext = ToLower(absolutePath.extension().string());
     if (ext == ".obj")
@@ -839,7 +1056,7 @@ const MeshData* MeshLibrary::LoadMesh(const std::filesystem::path& absolutePath,
     }
     else if (ext == ".gltf" || ext == ".glb")
     {
-        loaded = LoadGltf(absolutePath, m_animationCallback ? &m_animationCallback : nullptr);
+        loaded = LoadGltf(absolutePath, animationCallback);
     }
     else
     {
@@ -847,30 +1064,122 @@ const MeshData* MeshLibrary::LoadMesh(const std::filesystem::path& absolutePath,
         loaded.error = "Mesh format not supported yet (supported: .obj, .gltf, .glb)";
     }
 
-    const auto [it, inserted] = m_cache.emplace(key, std::move(loaded));
-    (void)inserted;
-    if (outError != nullptr)
+    if (loaded.loaded)
     {
-        *outError = it->second.error;
+        CookedMesh::PrepareSurfaceTextures(loaded);
     }
-    return &it->second;
+    return loaded;
 }
 
-void MeshLibrary::Clear()
+bool MeshLibrary::CookMeshFile(const std::filesystem::path& absolutePath, std::string* outError)
 {
-    m_cache.clear();
+    std::uint64_t sourceHash = 0;
+    if (!IsCookable(absolutePath) || !CookedMesh::HashFile(absolutePath, sourceHash))
+    {
+        if (outError != nullptr)
+        {
+            *outError = "Cannot cook " + absolutePath.generic_string();
+        }
+        return false;
+    }
+
+    const std::filesystem::path cookedPath = CookedMesh::PathFor(absolutePath);
+    MeshData cached;
+    if (CookedMesh::Read(cookedPath, sourceHash, cached))
+    {
+        return true;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const MeshData mesh = LoadSourceFile(absolutePath, nullptr);
+    if (!mesh.loaded)
+    {
+        if (outError != nullptr)
+        {
+            *outError = mesh.error;
+        }
+        return false;
+    }
+    // Animated meshes are cooked too: loads still parse the source for clips but take the LODs from here.
+    if (!CookedMesh::Write(cookedPath, mesh, sourceHash, outError))
+    {
+        return false;
+    }
+
+    const float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "[MESH COOK] " << cookedPath.filename().string() << " (" << ms << " ms)\n";
+    return true;
+}
+
+MeshData MeshLibrary::LoadCookedOrSource(
+    const std::filesystem::path& absolutePath,
+    const std::uint64_t* sourceHash,
+    AnimationLoadedCallback* animationCallback
+)
+{
+    MeshData loaded;
+    if (!IsSupportedMeshExtension(ToLower(absolutePath.extension().string())))
+    {
+        loaded.loaded = false;
+        loaded.error = "Mesh format not supported yet (supported: .obj, .gltf, .glb)";
+        return loaded;
+    }
+    if (sourceHash != nullptr && CookedMesh::Read(CookedMesh::PathFor(absolutePath), *sourceHash, loaded))
+    {
+        const bool wantsClips = animationCallback != nullptr && *animationCallback;
+        if (loaded.animationNames.empty() || !wantsClips)
+        {
+            return loaded;
+        }
+        // Clips are only extracted from the source; the cooked LODs spare re-simplifying it.
+        std::vector<MeshLod> cookedLods = std::move(loaded.lods);
+        loaded = LoadSourceGeometry(absolutePath, animationCallback);
+        loaded.lods = std::move(cookedLods);
+        return loaded;
+    }
+
+    // No cooked file yet, or the source changed since it was cooked.
+    loaded = LoadSourceFile(absolutePath, animationCallback);
+    if (loaded.loaded && sourceHash != nullptr)
+    {
+        std::string cookError;
+        if (!CookedMesh::Write(CookedMesh::PathFor(absolutePath), loaded, *sourceHash, &cookError))
+        {
+            std::cout << "[MESH COOK] " << cookError << "\n";
+        }
+    }
+    return loaded;
+}
+
+void MeshLibrary::BuildLods(const std::filesystem::path& absolutePath, MeshData& mesh)
+{
+    const auto start = std::chrono::steady_clock::now();
+    mesh.lods = MeshSimplifier::BuildLodChain(mesh.geometry);
+    if (mesh.lods.empty())
+    {
+        return;
+    }
+
+    const float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "[MESH LOD] " << absolutePath.filename().string() << ": " << MeshSimplifier::TriangleCount(mesh.geometry) << " tris";
+    for (const MeshLod& lod : mesh.lods)
+    {
+        std::cout << " -> " << MeshSimplifier::TriangleCount(lod.geometry);
+    }
+    std::cout << " (" << ms << " ms)\n";
 }
 
 MeshData MeshLibrary::LoadObj(const std::filesystem::path& absolutePath)
 {
     MeshData out;
 
-    std::ifstream stream(absolutePath);
-    if (!stream.is_open())
+    std::string text;
+    if (!AssetPack::ReadFile(absolutePath, text))
     {
         out.error = "Unable to open OBJ: " + absolutePath.generic_string();
         return out;
     }
+    std::istringstream stream(std::move(text));
 
     std::vector<glm::vec3> positions;
     std::vector<glm::vec3> normals;
@@ -1022,7 +1331,20 @@ MeshData MeshLibrary::LoadGltf(const std::filesystem::path& absolutePath, Animat
 
     const std::string ext = ToLower(absolutePath.extension().string());
     bool loaded = false;
-    if (ext == ".glb")
+    const auto packed = AssetPack::Instance().Find(absolutePath);
+    if (packed.has_value() && ext == ".glb")
+    {
+        loaded = loader.LoadBinaryFromMemory(
+            &model, &err, &warn, packed->data(), static_cast<unsigned int>(packed->size()), absolutePath.parent_path().string());
+    }
+    else if (packed.has_value())
+    {
+        // External buffers/images of a packed .gltf still resolve relative to its directory.
+        loaded = loader.LoadASCIIFromString(
+            &model, &err, &warn, reinterpret_cast<const char*>(packed->data()), static_cast<unsigned int>(packed->size()),
+            absolutePath.parent_path().string());
+    }
+    else if (ext == ".glb")
     {
         loaded = loader.LoadBinaryFromFile(&model, &err, &warn, absolutePath.string());
     }
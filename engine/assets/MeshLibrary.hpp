@@ -1,14 +1,18 @@
 #pragma once
 
+#include <atomic>
 #include <filesystem>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include <glm/vec3.hpp>
 
+#include "engine/assets/AsyncAssetLoader.hpp"
+#include "engine/assets/MeshSimplifier.hpp"
 #include "engine/render/Renderer.hpp"
 
 namespace engine::animation
@@ -25,6 +29,7 @@ struct MeshSurfaceData
     int albedoWidth = 0;
     int albedoHeight = 0;
     int albedoChannels = 0;
+    std::vector<std::vector<unsigned char>> albedoMips;  // RGBA8 mip levels 1..N (albedoPixels is level 0)
 };
 
 struct MeshData
@@ -36,25 +41,112 @@ struct MeshData
     bool loaded = false;
     std::string error;
     std::vector<std::string> animationNames;  // Names of animations found in this mesh
+    std::vector<MeshLod> lods;                // Simplified LOD 1..N of geometry, coarsest last
 };
 
+/// One mesh load shared by LoadMesh and LoadMeshAsync. Data() is written by the loading thread and
+/// may only be read once State() is Loaded or Failed. Loads of byte-identical files share one
+/// MeshData (content-addressed by the source hash).
+class MeshLoad
+{
+public:
+    [[nodiscard]] AssetState State() const { return m_state.load(std::memory_order_acquire); }
+    [[nodiscard]] bool IsDone() const { return State() != AssetState::Loading; }
+    [[nodiscard]] const MeshData& Data() const { return *m_data; }
+    [[nodiscard]] std::uint64_t ContentHash() const { return m_contentHash; } // 0 when the file could not be hashed
+
+    /// Blocks until the load finished.
+    void Wait() const;
+
+private:
+    friend class MeshLibrary;
+    void Finish(std::shared_ptr<const MeshData> data, std::uint64_t contentHash);
+
+    std::shared_ptr<const MeshData> m_data;
+    std::uint64_t m_contentHash = 0;
+    std::atomic<AssetState> m_state{AssetState::Loading};
+};
+
+using MeshHandle = std::shared_ptr<const MeshLoad>;
+
 // Callback type for animation loading
 using AnimationLoadedCallback = std::function<void(const std::string& clipName, std::unique_ptr<engine::animation::AnimationClip> clip)>;
 
 class MeshLibrary
 {
 public:
+    /// Blocking load. Waits for an in-flight LoadMeshAsync of the same path instead of loading twice.
     const MeshData* LoadMesh(const std::filesystem::path& absolutePath, std::string* outError = nullptr);
+    /// Decodes on a JobSystem worker (inline when the job system is not running) and returns at once.
+    /// Calls for the same path share one handle. Animation clips are not extracted on this path,
+    /// because the animation callback is not thread-safe. Call from the main thread only.
+    [[nodiscard]] MeshHandle LoadMeshAsync(const std::filesystem::path& absolutePath);
+    /// Blocking load that pins the mesh: it is never evicted while the handle lives. LoadMesh pointers
+    /// are only guaranteed until the next EvictUnused (AssetManager::Update, start of frame).
+    [[nodiscard]] MeshHandle AcquireMesh(const std::filesystem::path& absolutePath);
+    /// Drops the cached entry so the next load reads the file again. Outstanding handles stay valid.
+    void Evict(const std::filesystem::path& absolutePath);
     void Clear();
 
+    struct Residency
+    {
+        std::size_t bytes = 0;       // CPU bytes of distinct resident MeshData
+        std::size_t meshes = 0;      // distinct resident MeshData
+        std::size_t referenced = 0;  // cache entries pinned by a handle outside the library
+    };
+    [[nodiscard]] Residency GetResidency() const;
+    /// Drops finished entries nobody holds a handle to, least recently used first, until at least
+    /// bytesToFree were released. Returns the bytes released. Main thread only.
+    std::size_t EvictUnused(std::size_t bytesToFree);
+    [[nodiscard]] std::size_t EvictedTotal() const { return m_evictedTotal; }
+    [[nodiscard]] static std::size_t ResidentBytes(const MeshData& mesh);
+
     // Set callback to receive loaded animations
     void SetAnimationLoadedCallback(AnimationLoadedCallback callback) { m_animationCallback = std::move(callback); }
 
+    /// Parses the source file and builds everything a cooked .amesh stores (RGBA8 mips, LODs).
+    static MeshData LoadSourceFile(const std::filesystem::path& absolutePath, AnimationLoadedCallback* animationCallback);
+    /// Writes <file>.amesh for a source mesh unless an up-to-date one exists. Animated meshes get one
+    /// as well, so the cook stays incremental and their LODs are not rebuilt on every cold load.
+    static bool CookMeshFile(const std::filesystem::path& absolutePath, std::string* outError = nullptr);
+    [[nodiscard]] static bool IsCookable(const std::filesystem::path& absolutePath);
+
 private:
     static MeshData LoadObj(const std::filesystem::path& absolutePath);
     static MeshData LoadGltf(const std::filesystem::path& absolutePath, AnimationLoadedCallback* animationCallback);
+    // LoadSourceFile without the LOD chain.
+    static MeshData LoadSourceGeometry(const std::filesystem::path& absolutePath, AnimationLoadedCallback* animationCallback);
+    static void BuildLods(const std::filesystem::path& absolutePath, MeshData& mesh);
+    // Cooked file when its source hash matches, else the source (re-cooking it). sourceHash is null
+    // when the source could not be hashed.
+    static MeshData LoadCookedOrSource(
+        const std::filesystem::path& absolutePath,
+        const std::uint64_t* sourceHash,
+        AnimationLoadedCallback* animationCallback
+    );
+
+    // Source hash -> decoded mesh, shared with the loading jobs (which may outlive the library).
+    struct ContentIndex
+    {
+        std::mutex mutex;
+        std::unordered_map<std::uint64_t, std::weak_ptr<const MeshData>> meshes;
+    };
+    static void LoadInto(
+        MeshLoad& load,
+        const std::filesystem::path& absolutePath,
+        ContentIndex& index,
+        AnimationLoadedCallback* animationCallback
+    );
 
-    std::unordered_map<std::string, MeshData> m_cache;
+    struct CacheEntry
+    {
+        std::shared_ptr<MeshLoad> load;
+        std::uint64_t lastUse = 0;
+    };
+    std::unordered_map<std::string, CacheEntry> m_cache;
+    std::shared_ptr<ContentIndex> m_contentIndex = std::make_shared<ContentIndex>();
+    std::uint64_t m_useTick = 0;
+    std::size_t m_evictedTotal = 0;
     AnimationLoadedCallback m_animationCallback;
 };
 } // namespace engine::assets
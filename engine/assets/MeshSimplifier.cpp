@@ -0,0 +1,539 @@
+#include "engine/assets/MeshSimplifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+
+namespace engine::assets
+{
+namespace
+{
+constexpr std::uint32_t kInvalidIndex = std::numeric_limits<std::uint32_t>::max();
+constexpr double kBorderPlaneWeight = 10.0;  // keeps open borders from drifting inwards
+constexpr float kMinNormalAgreement = 0.2F; // cosine between a face normal before and after a collapse
+
+/// Symmetric 4x4 plane quadric (xx xy xz xw yy yz yw zz zw ww). weight is the face area it was built
+/// from, so Evaluate() / weight is a mean squared distance in mesh units.
+struct Quadric
+{
+    std::array<double, 10> m{};
+    double weight = 0.0;
+
+    void AddPlane(const glm::vec3& normal, float distance, double planeWeight, bool countsAsArea)
+    {
+        const double x = normal.x;
+        const double y = normal.y;
+        const double z = normal.z;
+        const double d = distance;
+        m[0] += planeWeight * x * x;
+        m[1] += planeWeight * x * y;
+        m[2] += planeWeight * x * z;
+        m[3] += planeWeight * x * d;
+        m[4] += planeWeight * y * y;
+        m[5] += planeWeight * y * z;
+        m[6] += planeWeight * y * d;
+        m[7] += planeWeight * z * z;
+        m[8] += planeWeight * z * d;
+        m[9] += planeWeight * d * d;
+        if (countsAsArea)
+        {
+            weight += planeWeight;
+        }
+    }
+
+    void Add(const Quadric& other)
+    {
+        for (std::size_t i = 0; i < m.size(); ++i)
+        {
+            m[i] += other.m[i];
+        }
+        weight += other.weight;
+    }
+
+    [[nodiscard]] double Evaluate(const glm::vec3& p) const
+    {
+        const double x = p.x;
+        const double y = p.y;
+        const double z = p.z;
+        const double error = m[0] * x * x + 2.0 * m[1] * x * y + 2.0 * m[2] * x * z + 2.0 * m[3] * x +
+                             m[4] * y * y + 2.0 * m[5] * y * z + 2.0 * m[6] * y +
+                             m[7] * z * z + 2.0 * m[8] * z + m[9];
+        return std::max(0.0, error);
+    }
+};
+
+std::uint64_t EdgeKey(std::uint32_t a, std::uint32_t b)
+{
+    return (static_cast<std::uint64_t>(std::min(a, b)) << 32U) | std::max(a, b);
+}
+
+/// Groups equal fixed-size float keys; returns the group id of every key and the number of groups.
+template <std::size_t N>
+std::uint32_t GroupEqualKeys(const std::vector<std::array<float, N>>& keys, std::vector<std::uint32_t>& outGroup)
+{
+    // Keys compare bytewise; callers fold -0 into +0 so equal values share a bit pattern.
+    std::vector<std::uint32_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0U);
+    std::sort(order.begin(), order.end(), [&keys](std::uint32_t a, std::uint32_t b) {
+        return std::memcmp(keys[a].data(), keys[b].data(), sizeof(float) * N) < 0;
+    });
+
+    outGroup.assign(keys.size(), 0U);
+    std::uint32_t groups = 0;
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        if (i > 0 && std::memcmp(keys[order[i]].data(), keys[order[i - 1]].data(), sizeof(float) * N) != 0)
+        {
+            ++groups;
+        }
+        outGroup[order[i]] = groups;
+    }
+    return order.empty() ? 0U : groups + 1U;
+}
+
+glm::vec3 FaceNormal(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+{
+    return glm::cross(b - a, c - a);
+}
+} // namespace
+
+std::size_t MeshSimplifier::TriangleCount(const render::MeshGeometry& geometry)
+{
+    return (geometry.indices.empty() ? geometry.positions.size() : geometry.indices.size()) / 3U;
+}
+
+render::MeshGeometry MeshSimplifier::Simplify(
+    const render::MeshGeometry& source,
+    std::size_t targetTriangles,
+    float maxError,
+    float* outError
+)
+{
+    if (outError != nullptr)
+    {
+        *outError = 0.0F;
+    }
+
+    const std::size_t vertexCount = source.positions.size();
+    const bool hasNormals = source.normals.size() == vertexCount;
+    const bool hasColors = source.colors.size() == vertexCount;
+    const bool hasUvs = source.uvs.size() == vertexCount;
+
+    // Attribute vertices: identical position/normal/color/uv collapse into one id.
+    std::vector<std::array<float, 11>> attributeKeys(vertexCount);
+    for (std::size_t i = 0; i < vertexCount; ++i)
+    {
+        const glm::vec3 normal = hasNormals ? source.normals[i] : glm::vec3{0.0F};
+        const glm::vec3 color = hasColors ? source.colors[i] : glm::vec3{0.0F};
+        const glm::vec2 uv = hasUvs ? source.uvs[i] : glm::vec2{0.0F};
+        const glm::vec3& p = source.positions[i];
+        attributeKeys[i] = {p.x, p.y, p.z, normal.x, normal.y, normal.z, color.x, color.y, color.z, uv.x, uv.y};
+        for (float& value : attributeKeys[i])
+        {
+            value += 0.0F;
+        }
+    }
+    std::vector<std::uint32_t> attributeOfVertex;
+    const std::uint32_t attributeCount = GroupEqualKeys(attributeKeys, attributeOfVertex);
+    std::vector<std::uint32_t> sourceOfAttribute(attributeCount, 0U);
+    for (std::size_t i = 0; i < vertexCount; ++i)
+    {
+        sourceOfAttribute[attributeOfVertex[i]] = static_cast<std::uint32_t>(i);
+    }
+
+    // Topology vertices: attribute vertices sharing a position (seams) collapse together.
+    std::vector<std::array<float, 3>> positionKeys(attributeCount);
+    for (std::uint32_t a = 0; a < attributeCount; ++a)
+    {
+        const glm::vec3& p = source.positions[sourceOfAttribute[a]];
+        positionKeys[a] = {p.x + 0.0F, p.y + 0.0F, p.z + 0.0F};
+    }
+    std::vector<std::uint32_t> topologyOf;
+    const std::uint32_t topologyCount = GroupEqualKeys(positionKeys, topologyOf);
+    std::vector<glm::vec3> positions(topologyCount);
+    for (std::uint32_t a = 0; a < attributeCount; ++a)
+    {
+        positions[topologyOf[a]] = source.positions[sourceOfAttribute[a]];
+    }
+
+    // Triangles as attribute-vertex corners, without topologically degenerate ones.
+    std::vector<std::uint32_t> triangles;
+    const std::size_t cornerCount = source.indices.empty() ? vertexCount - vertexCount % 3U : source.indices.size() - source.indices.size() % 3U;
+    triangles.reserve(cornerCount);
+    for (std::size_t i = 0; i < cornerCount; i += 3)
+    {
+        std::array<std::uint32_t, 3> corner{};
+        bool valid = true;
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            const std::uint32_t index = source.indices.empty() ? static_cast<std::uint32_t>(i + k) : source.indices[i + k];
+            valid = valid && index < vertexCount;
+            corner[k] = valid ? attributeOfVertex[index] : 0U;
+        }
+        if (!valid ||
+            topologyOf[corner[0]] == topologyOf[corner[1]] ||
+            topologyOf[corner[1]] == topologyOf[corner[2]] ||
+            topologyOf[corner[2]] == topologyOf[corner[0]])
+        {
+            continue;
+        }
+        triangles.insert(triangles.end(), corner.begin(), corner.end());
+    }
+
+    // Face quadrics (area weighted) plus perpendicular planes along open borders.
+    std::vector<Quadric> quadrics(topologyCount);
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> edgeFaces;
+    edgeFaces.reserve(triangles.size());
+    for (std::size_t t = 0; t < triangles.size(); t += 3)
+    {
+        const std::uint32_t v0 = topologyOf[triangles[t]];
+        const std::uint32_t v1 = topologyOf[triangles[t + 1]];
+        const std::uint32_t v2 = topologyOf[triangles[t + 2]];
+        const glm::vec3 normal = FaceNormal(positions[v0], positions[v1], positions[v2]);
+        const float length = glm::length(normal);
+        if (length > 0.0F)
+        {
+            const glm::vec3 unit = normal / length;
+            const float distance = -glm::dot(unit, positions[v0]);
+            for (const std::uint32_t v : {v0, v1, v2})
+            {
+                quadrics[v].AddPlane(unit, distance, 0.5 * length, true);
+            }
+        }
+        const auto face = static_cast<std::uint32_t>(t / 3U);
+        edgeFaces.emplace_back(EdgeKey(v0, v1), face);
+        edgeFaces.emplace_back(EdgeKey(v1, v2), face);
+        edgeFaces.emplace_back(EdgeKey(v2, v0), face);
+    }
+    std::sort(edgeFaces.begin(), edgeFaces.end());
+    for (std::size_t i = 0; i < edgeFaces.size(); ++i)
+    {
+        const bool single = (i == 0 || edgeFaces[i - 1].first != edgeFaces[i].first) &&
+                            (i + 1 == edgeFaces.size() || edgeFaces[i + 1].first != edgeFaces[i].first);
+        if (!single)
+        {
+            continue;
+        }
+        const auto a = static_cast<std::uint32_t>(edgeFaces[i].first >> 32U);
+        const auto b = static_cast<std::uint32_t>(edgeFaces[i].first & 0xFFFFFFFFU);
+        const std::size_t t = static_cast<std::size_t>(edgeFaces[i].second) * 3U;
+        const glm::vec3 faceNormal = FaceNormal(
+            positions[topologyOf[triangles[t]]], positions[topologyOf[triangles[t + 1]]], positions[topologyOf[triangles[t + 2]]]);
+        const glm::vec3 edge = positions[b] - positions[a];
+        const glm::vec3 planeNormal = glm::cross(edge, faceNormal);
+        const float planeLength = glm::length(planeNormal);
+        if (planeLength <= 0.0F)
+        {
+            continue;
+        }
+        const glm::vec3 unit = planeNormal / planeLength;
+        const float distance = -glm::dot(unit, positions[a]);
+        const double weight = kBorderPlaneWeight * static_cast<double>(glm::dot(edge, edge));
+        quadrics[a].AddPlane(unit, distance, weight, false);
+        quadrics[b].AddPlane(unit, distance, weight, false);
+    }
+
+    struct Candidate
+    {
+        double cost = 0.0;
+        std::uint32_t from = 0;
+        std::uint32_t to = 0;
+    };
+
+    const double maxCost = static_cast<double>(maxError) * static_cast<double>(maxError);
+    double worstCost = 0.0;
+    std::vector<std::uint32_t> attributeRemap(attributeCount);
+    std::vector<std::uint32_t> triangleStart;
+    std::vector<std::uint32_t> triangleList;
+    std::vector<std::uint64_t> edges;
+    std::vector<std::uint64_t> borderEdges;
+    std::vector<std::uint8_t> borderVertex;
+    std::vector<std::uint8_t> locked;
+    std::vector<Candidate> candidates;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> partners;
+
+    const auto collapseCost = [&](std::uint32_t from, std::uint32_t to) {
+        Quadric combined = quadrics[from];
+        combined.Add(quadrics[to]);
+        return combined.Evaluate(positions[to]) / std::max(combined.weight, 1.0e-12);
+    };
+
+    // Greedy passes: cheapest collapses first; a collapse locks its one-ring for the rest of the pass.
+    while (triangles.size() / 3U > targetTriangles)
+    {
+        const std::size_t triangleCount = triangles.size() / 3U;
+
+        triangleStart.assign(topologyCount + 1U, 0U);
+        for (const std::uint32_t corner : triangles)
+        {
+            ++triangleStart[topologyOf[corner] + 1U];
+        }
+        for (std::uint32_t v = 0; v < topologyCount; ++v)
+        {
+            triangleStart[v + 1U] += triangleStart[v];
+        }
+        triangleList.resize(triangles.size());
+        {
+            std::vector<std::uint32_t> cursor(triangleStart.begin(), triangleStart.end() - 1);
+            for (std::size_t i = 0; i < triangles.size(); ++i)
+            {
+                triangleList[cursor[topologyOf[triangles[i]]]++] = static_cast<std::uint32_t>(i / 3U);
+            }
+        }
+
+        edges.clear();
+        for (std::size_t t = 0; t < triangles.size(); t += 3)
+        {
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                edges.push_back(EdgeKey(topologyOf[triangles[t + k]], topologyOf[triangles[t + (k + 1U) % 3U]]));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        borderEdges.clear();
+        borderVertex.assign(topologyCount, 0U);
+        for (std::size_t i = 0; i < edges.size(); ++i)
+        {
+            const bool single = (i == 0 || edges[i - 1] != edges[i]) && (i + 1 == edges.size() || edges[i + 1] != edges[i]);
+            if (single)
+            {
+                borderEdges.push_back(edges[i]);
+                borderVertex[edges[i] >> 32U] = 1U;
+                borderVertex[edges[i] & 0xFFFFFFFFU] = 1U;
+            }
+        }
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        candidates.clear();
+        for (const std::uint64_t edge : edges)
+        {
+            const auto a = static_cast<std::uint32_t>(edge >> 32U);
+            const auto b = static_cast<std::uint32_t>(edge & 0xFFFFFFFFU);
+            const bool isBorderEdge = std::binary_search(borderEdges.begin(), borderEdges.end(), edge);
+            Candidate best{std::numeric_limits<double>::max(), 0U, 0U};
+            for (const auto& [from, to] : {std::pair{a, b}, std::pair{b, a}})
+            {
+                if (borderVertex[from] != 0U && !isBorderEdge)
+                {
+                    continue; // border vertices may only slide along the border
+                }
+                const double cost = collapseCost(from, to);
+                if (cost < best.cost)
+                {
+                    best = Candidate{cost, from, to};
+                }
+            }
+            if (best.cost <= maxCost)
+            {
+                candidates.push_back(best);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const Candidate& x, const Candidate& y) { return x.cost < y.cost; });
+
+        std::iota(attributeRemap.begin(), attributeRemap.end(), 0U);
+        locked.assign(topologyCount, 0U);
+        const std::size_t removeBudget = triangleCount - targetTriangles;
+        std::size_t removed = 0;
+        std::size_t collapses = 0;
+        for (const Candidate& candidate : candidates)
+        {
+            if (removed >= removeBudget)
+            {
+                break;
+            }
+            const std::uint32_t from = candidate.from;
+            const std::uint32_t to = candidate.to;
+            if (locked[from] != 0U || locked[to] != 0U)
+            {
+                continue;
+            }
+
+            // Every attribute vertex of `from` must share a triangle with one of `to`, which keeps seams
+            // intact; faces not touching `to` must not flip once `from` moves onto it.
+            partners.clear();
+            bool valid = true;
+            std::size_t collapsedFaces = 0;
+            for (std::uint32_t i = triangleStart[from]; i < triangleStart[from + 1U] && valid; ++i)
+            {
+                const std::size_t t = static_cast<std::size_t>(triangleList[i]) * 3U;
+                std::uint32_t fromCorner = kInvalidIndex;
+                std::uint32_t toCorner = kInvalidIndex;
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    const std::uint32_t topology = topologyOf[triangles[t + k]];
+                    if (topology == from)
+                    {
+                        fromCorner = triangles[t + k];
+                    }
+                    else if (topology == to)
+                    {
+                        toCorner = triangles[t + k];
+                    }
+                }
+
+                if (toCorner != kInvalidIndex)
+                {
+                    ++collapsedFaces;
+                    const auto existing = std::find_if(partners.begin(), partners.end(), [fromCorner](const auto& pair) {
+                        return pair.first == fromCorner;
+                    });
+                    if (existing == partners.end())
+                    {
+                        partners.emplace_back(fromCorner, toCorner);
+                    }
+                    continue;
+                }
+
+                std::array<glm::vec3, 3> corners{};
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    corners[k] = positions[topologyOf[triangles[t + k]]];
+                }
+                const glm::vec3 before = FaceNormal(corners[0], corners[1], corners[2]);
+                for (glm::vec3& corner : corners)
+                {
+                    if (corner == positions[from])
+                    {
+                        corner = positions[to];
+                    }
+                }
+                const glm::vec3 after = FaceNormal(corners[0], corners[1], corners[2]);
+                const float lengths = glm::length(before) * glm::length(after);
+                valid = lengths > 0.0F && glm::dot(before, after) >= kMinNormalAgreement * lengths;
+            }
+            for (std::uint32_t i = triangleStart[from]; i < triangleStart[from + 1U] && valid; ++i)
+            {
+                const std::size_t t = static_cast<std::size_t>(triangleList[i]) * 3U;
+                for (std::size_t k = 0; k < 3 && valid; ++k)
+                {
+                    const std::uint32_t corner = triangles[t + k];
+                    if (topologyOf[corner] == from)
+                    {
+                        valid = std::any_of(partners.begin(), partners.end(), [corner](const auto& pair) { return pair.first == corner; });
+                    }
+                }
+            }
+            if (!valid || collapsedFaces == 0)
+            {
+                continue;
+            }
+
+            for (const auto& [fromCorner, toCorner] : partners)
+            {
+                attributeRemap[fromCorner] = toCorner;
+            }
+            quadrics[to].Add(quadrics[from]);
+            for (std::uint32_t i = triangleStart[from]; i < triangleStart[from + 1U]; ++i)
+            {
+                const std::size_t t = static_cast<std::size_t>(triangleList[i]) * 3U;
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    locked[topologyOf[triangles[t + k]]] = 1U;
+                }
+            }
+            worstCost = std::max(worstCost, candidate.cost);
+            removed += collapsedFaces;
+            ++collapses;
+        }
+
+        if (collapses == 0)
+        {
+            break;
+        }
+
+        std::size_t write = 0;
+        for (std::size_t t = 0; t < triangles.size(); t += 3)
+        {
+            const std::uint32_t a = attributeRemap[triangles[t]];
+            const std::uint32_t b = attributeRemap[triangles[t + 1]];
+            const std::uint32_t c = attributeRemap[triangles[t + 2]];
+            if (topologyOf[a] == topologyOf[b] || topologyOf[b] == topologyOf[c] || topologyOf[c] == topologyOf[a])
+            {
+                continue;
+            }
+            triangles[write++] = a;
+            triangles[write++] = b;
+            triangles[write++] = c;
+        }
+        triangles.resize(write);
+    }
+
+    // Compact the surviving attribute vertices into the output geometry.
+    render::MeshGeometry result;
+    std::vector<std::uint32_t> outputIndex(attributeCount, kInvalidIndex);
+    result.indices.reserve(triangles.size());
+    for (const std::uint32_t attribute : triangles)
+    {
+        if (outputIndex[attribute] == kInvalidIndex)
+        {
+            const std::uint32_t vertex = sourceOfAttribute[attribute];
+            outputIndex[attribute] = static_cast<std::uint32_t>(result.positions.size());
+            result.positions.push_back(source.positions[vertex]);
+            if (hasNormals)
+            {
+                result.normals.push_back(source.normals[vertex]);
+            }
+            if (hasColors)
+            {
+                result.colors.push_back(source.colors[vertex]);
+            }
+            if (hasUvs)
+            {
+                result.uvs.push_back(source.uvs[vertex]);
+            }
+        }
+        result.indices.push_back(outputIndex[attribute]);
+    }
+
+    if (outError != nullptr)
+    {
+        *outError = static_cast<float>(std::sqrt(worstCost));
+    }
+    return result;
+}
+
+std::vector<MeshLod> MeshSimplifier::BuildLodChain(const render::MeshGeometry& source, const MeshLodSettings& settings)
+{
+    std::vector<MeshLod> lods;
+    const std::size_t sourceTriangles = TriangleCount(source);
+    if (sourceTriangles < settings.minSourceTriangles || source.positions.empty())
+    {
+        return lods;
+    }
+
+    glm::vec3 boundsMin = source.positions.front();
+    glm::vec3 boundsMax = source.positions.front();
+    for (const glm::vec3& p : source.positions)
+    {
+        boundsMin = glm::min(boundsMin, p);
+        boundsMax = glm::max(boundsMax, p);
+    }
+    const float maxError = glm::length(boundsMax - boundsMin) * settings.maxRelativeError;
+
+    lods.reserve(settings.triangleRatios.size());
+    std::size_t previousTriangles = sourceTriangles;
+    float accumulatedError = 0.0F;
+    for (const float ratio : settings.triangleRatios)
+    {
+        const auto target = static_cast<std::size_t>(static_cast<float>(sourceTriangles) * ratio);
+        const render::MeshGeometry& previous = lods.empty() ? source : lods.back().geometry;
+        float stepError = 0.0F;
+        render::MeshGeometry reduced = Simplify(previous, target, std::max(0.0F, maxError - accumulatedError), &stepError);
+        const std::size_t triangles = TriangleCount(reduced);
+        if (triangles == 0 || static_cast<float>(triangles) > static_cast<float>(previousTriangles) * settings.minReduction)
+        {
+            break;
+        }
+        accumulatedError += stepError;
+        lods.push_back(MeshLod{std::move(reduced), accumulatedError});
+        previousTriangles = triangles;
+    }
+    return lods;
+}
+} // namespace engine::assets
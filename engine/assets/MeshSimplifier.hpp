@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "engine/render/Renderer.hpp"
+
+namespace engine::assets
+{
+/// One reduced level of detail. error estimates the deviation from the source mesh in mesh units, used
+/// for screen-space LOD selection: the sum over the chain of each step's worst collapse, measured as
+/// sqrt(quadric error / face area), i.e. an RMS distance to the merged planes. It is not a bound;
+/// single vertices can stray further.
+struct MeshLod
+{
+    render::MeshGeometry geometry;
+    float error = 0.0F;
+};
+
+struct MeshLodSettings
+{
+    std::array<float, 3> triangleRatios{0.5F, 0.25F, 0.125F}; // of the source triangle count
+    float maxRelativeError = 0.08F;                           // of the bounds diagonal
+    std::size_t minSourceTriangles = 256;                     // smaller meshes get no LODs
+    float minReduction = 0.85F;                               // each LOD must keep at most this share of the previous
+};
+
+/// Quadric error metric edge-collapse simplifier (half-edge collapses, so attributes are never
+/// interpolated). Open borders and UV/normal seams are preserved; collapses that would flip a
+/// triangle are rejected. Pure CPU.
+class MeshSimplifier
+{
+public:
+    /// Reduces source to at most targetTriangles, or fewer collapses if maxError (mesh units) would be
+    /// exceeded. outError receives the largest collapse cost as an RMS plane distance (see MeshLod).
+    [[nodiscard]] static render::MeshGeometry Simplify(
+        const render::MeshGeometry& source,
+        std::size_t targetTriangles,
+        float maxError,
+        float* outError = nullptr
+    );
+
+    /// LOD 1..N for source (LOD 0 is the source itself). Stops early when a level stops paying off.
+    [[nodiscard]] static std::vector<MeshLod> BuildLodChain(const render::MeshGeometry& source, const MeshLodSettings& settings = {});
+
+    [[nodiscard]] static std::size_t TriangleCount(const render::MeshGeometry& geometry);
+};
+} // namespace engine::assets
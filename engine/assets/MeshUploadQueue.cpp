@@ -0,0 +1,62 @@
+#include "engine/assets/MeshUploadQueue.hpp"
+
+#include <chrono>
+
+namespace engine::assets
+{
+void MeshUploadQueue::Enqueue(MeshHandle handle, UploadCallback onReady, FailureCallback onFailed)
+{
+    if (handle == nullptr)
+    {
+        return;
+    }
+    m_entries.push_back(Entry{std::move(handle), std::move(onReady), std::move(onFailed)});
+}
+
+std::size_t MeshUploadQueue::Drain(render::Renderer& renderer, float budgetMs)
+{
+    if (m_entries.empty())
+    {
+        return 0;
+    }
+
+    // Work on a detached list so callbacks can enqueue safely.
+    std::vector<Entry> entries;
+    entries.swap(m_entries);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t uploads = 0;
+    std::vector<Entry> remaining;
+    for (Entry& entry : entries)
+    {
+        const bool overBudget = uploads > 0 &&
+                                std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count() >= budgetMs;
+        if (overBudget || !entry.handle->IsDone())
+        {
+            remaining.push_back(std::move(entry));
+            continue;
+        }
+
+        if (entry.handle->State() == AssetState::Loaded)
+        {
+            if (entry.onReady)
+            {
+                entry.onReady(renderer, entry.handle->Data());
+            }
+            ++uploads;
+        }
+        else if (entry.onFailed)
+        {
+            entry.onFailed(entry.handle->Data().error);
+        }
+    }
+
+    // Keep request order: carried-over entries go before the ones enqueued by callbacks.
+    for (Entry& entry : m_entries)
+    {
+        remaining.push_back(std::move(entry));
+    }
+    m_entries = std::move(remaining);
+    return uploads;
+}
+} // namespace engine::assets
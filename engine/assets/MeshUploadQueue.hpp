@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "engine/assets/MeshLibrary.hpp"
+#include "engine/render/Renderer.hpp"
+
+namespace engine::assets
+{
+/// Main-thread GPU uploads for meshes decoded by MeshLibrary::LoadMeshAsync. Drain() runs the uploads
+/// whose decode finished, in request order, until the frame's time budget is spent. Loads still
+/// decoding are skipped, so one slow file never holds back the rest. Callers draw a placeholder until
+/// their upload callback runs.
+class MeshUploadQueue
+{
+public:
+    using UploadCallback = std::function<void(render::Renderer& renderer, const MeshData& mesh)>;
+    using FailureCallback = std::function<void(const std::string& error)>;
+
+    void Enqueue(MeshHandle handle, UploadCallback onReady, FailureCallback onFailed = {});
+
+    /// Runs at least one ready upload per call, so the queue always makes progress. Callbacks may
+    /// enqueue further uploads; those are picked up on the next call. Returns the uploads run.
+    std::size_t Drain(render::Renderer& renderer, float budgetMs);
+
+    void Clear() { m_entries.clear(); }
+    [[nodiscard]] std::size_t PendingCount() const { return m_entries.size(); }
+
+private:
+    struct Entry
+    {
+        MeshHandle handle;
+        UploadCallback onReady;
+        FailureCallback onFailed;
+    };
+
+    std::vector<Entry> m_entries;
+};
+} // namespace engine::assets
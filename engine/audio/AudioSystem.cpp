@@ -2,7 +2,10 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <filesystem>
+#include <fstream>
+#include <iostream>
 #include <memory>
 #include <string>
 #include <utility>
@@ -13,6 +16,11 @@
 #define MINIAUDIO_IMPLEMENTATION
 #include "external/miniaudio/miniaudio.h"
 
+#include <glm/geometric.hpp>
+#include <nlohmann/json.hpp>
+
+#include "engine/core/Profiler.hpp"
+
 namespace engine::audio
 {
 struct AudioSystem::ActiveSound
@@ -20,7 +28,18 @@ struct AudioSystem::ActiveSound
     ma_sound sound{};
     bool initialized = false;
     bool looping = false;
+    bool isVirtual = false;
     AudioSystem::Bus bus = AudioSystem::Bus::Sfx;
+    int priority = 0;
+    float volume = 1.0F;
+    float pitch = 1.0F;
+    std::optional<glm::vec3> position;
+    float minDistance = 1.0F;
+    float maxDistance = 64.0F;
+    float gain = 1.0F; // last EstimateGain
+    // While virtual the cursor advances with engine time from this anchor instead of being mixed.
+    std::uint64_t virtualCursor = 0;
+    std::uint64_t virtualSinceFrame = 0;
 };
 
 struct AudioSystem::EngineData
@@ -35,6 +54,32 @@ struct AudioSystem::EngineData
     bool uiGroupInitialized = false;
     bool ambienceGroupInitialized = false;
     std::unordered_map<AudioSystem::SoundHandle, std::unique_ptr<AudioSystem::ActiveSound>> sounds;
+    // Stopped voices are recycled instead of allocating an ma_sound per play.
+    std::vector<std::unique_ptr<AudioSystem::ActiveSound>> freeVoices;
+
+    std::unique_ptr<AudioSystem::ActiveSound> AcquireVoice()
+    {
+        if (freeVoices.empty())
+        {
+            return std::make_unique<AudioSystem::ActiveSound>();
+        }
+        std::unique_ptr<AudioSystem::ActiveSound> voice = std::move(freeVoices.back());
+        freeVoices.pop_back();
+        return voice;
+    }
+
+    void ReleaseVoice(std::unique_ptr<AudioSystem::ActiveSound> voice)
+    {
+        constexpr std::size_t kMaxPooledVoices = 64;
+        if (voice != nullptr && freeVoices.size() < kMaxPooledVoices)
+        {
+            voice->initialized = false;
+            voice->looping = false;
+            voice->isVirtual = false;
+            voice->position.reset();
+            freeVoices.push_back(std::move(voice));
+        }
+    }
 };
 
 namespace
@@ -43,12 +88,19 @@ float Clamped01(float value)
 {
     return std::clamp(value, 0.0F, 1.0F);
 }
+
+/// Bus ranking: priority first, then the louder voice.
+bool RanksAbove(int priorityA, float gainA, int priorityB, float gainB)
+{
+    return priorityA != priorityB ? priorityA > priorityB : gainA > gainB;
+}
 } // namespace
 
 bool AudioSystem::Initialize(const std::string& assetRoot)
 {
     Shutdown();
     m_assetRoot = assetRoot;
+    m_resolvedPaths.clear();
 
     m_engine = new EngineData{};
     if (ma_engine_init(nullptr, &m_engine->engine) != MA_SUCCESS)
@@ -93,6 +145,10 @@ void AudioSystem::Shutdown()
     }
 
     StopAll();
+    while (!m_banks.empty())
+    {
+        UnloadBank(m_banks.begin()->first);
+    }
 
     if (m_engine->ambienceGroupInitialized)
     {
@@ -133,7 +189,7 @@ void AudioSystem::Update(float /*deltaSeconds*/)
     finished.reserve(m_engine->sounds.size());
     for (const auto& [handle, active] : m_engine->sounds)
     {
-        if (active == nullptr || !active->initialized || active->looping)
+        if (active == nullptr || !active->initialized || active->looping || active->isVirtual)
         {
             continue;
         }
@@ -147,6 +203,13 @@ void AudioSystem::Update(float /*deltaSeconds*/)
     {
         Stop(handle);
     }
+
+    ApplyVoiceBudgets();
+
+    auto& stats = core::Profiler::Instance().StatsMut();
+    stats.audioVoicesActive = m_voiceStats.active;
+    stats.audioVoicesVirtual = m_voiceStats.virtualized;
+    stats.audioVoicesStolen = m_voiceStats.stolen;
 }
 
 AudioSystem::SoundHandle AudioSystem::PlayOneShot(const std::string& clipName, Bus bus)
@@ -156,62 +219,7 @@ AudioSystem::SoundHandle AudioSystem::PlayOneShot(const std::string& clipName, B
 
 AudioSystem::SoundHandle AudioSystem::PlayOneShot(const std::string& clipName, Bus bus, const PlayOptions& options)
 {
-    if (!m_initialized || m_engine == nullptr)
-    {
-        return 0;
-    }
-
-    const std::string path = ResolveClipPath(clipName);
-    if (path.empty())
-    {
-        return 0;
-    }
-
-    auto active = std::make_unique<ActiveSound>();
-    active->looping = false;
-    active->bus = bus;
-
-    const ma_uint32 flags = MA_SOUND_FLAG_ASYNC;
-    if (ma_sound_init_from_file(
-            &m_engine->engine,
-            path.c_str(),
-            flags,
-            reinterpret_cast<ma_sound_group*>(GroupForBus(bus)),
-            nullptr,
-            &active->sound
-        ) != MA_SUCCESS)
-    {
-        return 0;
-    }
-
-    active->initialized = true;
-    ma_sound_set_looping(&active->sound, MA_FALSE);
-    ma_sound_set_volume(&active->sound, std::max(0.0F, options.volume));
-    ma_sound_set_pitch(&active->sound, std::max(0.01F, options.pitch));
-
-    if (options.position.has_value())
-    {
-        const glm::vec3 p = *options.position;
-        ma_sound_set_spatialization_enabled(&active->sound, MA_TRUE);
-        ma_sound_set_position(&active->sound, p.x, p.y, p.z);
-        ma_sound_set_min_distance(&active->sound, std::max(0.1F, options.minDistance));
-        ma_sound_set_max_distance(&active->sound, std::max(options.minDistance + 0.1F, options.maxDistance));
-    }
-    else
-    {
-        ma_sound_set_spatialization_enabled(&active->sound, MA_FALSE);
-    }
-
-    if (ma_sound_start(&active->sound) != MA_SUCCESS)
-    {
-        ma_sound_uninit(&active->sound);
-        return 0;
-    }
-
-    const SoundHandle handle = m_nextHandle++;
-    m_active[handle] = active.get();
-    m_engine->sounds.emplace(handle, std::move(active));
-    return handle;
+    return StartSound(clipName, bus, options, false);
 }
 
 AudioSystem::SoundHandle AudioSystem::PlayLoop(const std::string& clipName, Bus bus)
@@ -222,6 +230,11 @@ AudioSystem::SoundHandle AudioSystem::PlayLoop(const std::string& clipName, Bus
 AudioSystem::SoundHandle AudioSystem::PlayLoop(const std::string& clipName, Bus bus, const PlayOptions& options, float loopDurationSeconds)
 {
     (void)loopDurationSeconds; // Reserved for future use (e.g., auto-stop after duration)
+    return StartSound(clipName, bus, options, true);
+}
+
+AudioSystem::SoundHandle AudioSystem::StartSound(const std::string& clipName, Bus bus, const PlayOptions& options, bool looping)
+{
     if (!m_initialized || m_engine == nullptr)
     {
         return 0;
@@ -233,11 +246,43 @@ AudioSystem::SoundHandle AudioSystem::PlayLoop(const std::string& clipName, Bus
         return 0;
     }
 
-    auto active = std::make_unique<ActiveSound>();
-    active->looping = true;
+    // A preloaded clip must be opened with the same name and DECODE flag as its bank registration to
+    // reuse the resident PCM. Loops and music/ambience stream; other one-shots load in memory.
+    ma_uint32 flags = MA_SOUND_FLAG_ASYNC;
+    if (m_preloadRefs.contains(path))
+    {
+        flags |= MA_SOUND_FLAG_DECODE;
+    }
+    else if (looping || bus == Bus::Music || bus == Bus::Ambience)
+    {
+        flags |= MA_SOUND_FLAG_STREAM;
+    }
+
+    std::unique_ptr<ActiveSound> active = m_engine->AcquireVoice();
+    active->looping = looping;
     active->bus = bus;
+    active->priority = options.priority;
+    active->volume = std::max(0.0F, options.volume);
+    active->pitch = std::max(0.01F, options.pitch);
+    active->position = options.position;
+    active->minDistance = std::max(0.1F, options.minDistance);
+    active->maxDistance = std::max(active->minDistance + 0.1F, options.maxDistance);
+    active->gain = EstimateGain(*active);
+
+    // A one-shot that loses against a full bus is dropped before any file is touched. A loop still
+    // starts, but virtual: it must keep time for when it becomes audible or wins a slot.
+    bool startVirtual = looping && active->gain < kVirtualGain;
+    if (!startVirtual && !AdmitVoice(*active))
+    {
+        if (!looping)
+        {
+            ++m_voiceStats.rejected;
+            m_engine->ReleaseVoice(std::move(active));
+            return 0;
+        }
+        startVirtual = true;
+    }
 
-    const ma_uint32 flags = MA_SOUND_FLAG_STREAM | MA_SOUND_FLAG_ASYNC;
     if (ma_sound_init_from_file(
             &m_engine->engine,
             path.c_str(),
@@ -247,30 +292,38 @@ AudioSystem::SoundHandle AudioSystem::PlayLoop(const std::string& clipName, Bus
             &active->sound
         ) != MA_SUCCESS)
     {
+        m_engine->ReleaseVoice(std::move(active));
         return 0;
     }
 
     active->initialized = true;
-    ma_sound_set_looping(&active->sound, MA_TRUE);
-    ma_sound_set_volume(&active->sound, std::max(0.0F, options.volume));
-    ma_sound_set_pitch(&active->sound, std::max(0.01F, options.pitch));
+    ma_sound_set_looping(&active->sound, looping ? MA_TRUE : MA_FALSE);
+    ma_sound_set_volume(&active->sound, active->volume);
+    ma_sound_set_pitch(&active->sound, active->pitch);
 
-    if (options.position.has_value())
+    if (active->position.has_value())
     {
-        const glm::vec3 p = *options.position;
+        const glm::vec3 p = *active->position;
         ma_sound_set_spatialization_enabled(&active->sound, MA_TRUE);
         ma_sound_set_position(&active->sound, p.x, p.y, p.z);
-        ma_sound_set_min_distance(&active->sound, std::max(0.1F, options.minDistance));
-        ma_sound_set_max_distance(&active->sound, std::max(options.minDistance + 0.1F, options.maxDistance));
+        ma_sound_set_min_distance(&active->sound, active->minDistance);
+        ma_sound_set_max_distance(&active->sound, active->maxDistance);
     }
     else
     {
         ma_sound_set_spatialization_enabled(&active->sound, MA_FALSE);
     }
 
-    if (ma_sound_start(&active->sound) != MA_SUCCESS)
+    if (startVirtual)
+    {
+        active->isVirtual = true;
+        active->virtualCursor = 0;
+        active->virtualSinceFrame = ma_engine_get_time_in_pcm_frames(&m_engine->engine);
+    }
+    else if (ma_sound_start(&active->sound) != MA_SUCCESS)
     {
         ma_sound_uninit(&active->sound);
+        m_engine->ReleaseVoice(std::move(active));
         return 0;
     }
 
@@ -301,6 +354,7 @@ void AudioSystem::Stop(SoundHandle handle)
         active->initialized = false;
     }
 
+    m_engine->ReleaseVoice(std::move(it->second));
     m_engine->sounds.erase(it);
     m_active.erase(handle);
 }
@@ -335,7 +389,8 @@ bool AudioSystem::SetHandleVolume(SoundHandle handle, float volume)
     {
         return false;
     }
-    ma_sound_set_volume(&it->second->sound, std::max(0.0F, volume));
+    it->second->volume = std::max(0.0F, volume);
+    ma_sound_set_volume(&it->second->sound, it->second->volume);
     return true;
 }
 
@@ -378,6 +433,10 @@ std::uint64_t AudioSystem::GetSoundCursorInPcmFrames(SoundHandle handle) const
     {
         return 0;
     }
+    if (it->second->isVirtual)
+    {
+        return VirtualCursor(*it->second);
+    }
     ma_uint64 cursor = 0;
     if (ma_sound_get_cursor_in_pcm_frames(&it->second->sound, &cursor) == MA_SUCCESS)
     {
@@ -397,6 +456,12 @@ bool AudioSystem::SeekSoundToPcmFrame(SoundHandle handle, std::uint64_t frameInd
     {
         return false;
     }
+    if (it->second->isVirtual)
+    {
+        it->second->virtualCursor = frameIndex;
+        it->second->virtualSinceFrame = ma_engine_get_time_in_pcm_frames(&m_engine->engine);
+        return true;
+    }
     return ma_sound_seek_to_pcm_frame(&it->second->sound, static_cast<ma_uint64>(frameIndex)) == MA_SUCCESS;
 }
 
@@ -407,12 +472,338 @@ void AudioSystem::SetListener(const glm::vec3& position, const glm::vec3& forwar
         return;
     }
 
+    m_listenerPosition = position;
     ma_engine_listener_set_position(&m_engine->engine, 0, position.x, position.y, position.z);
     ma_engine_listener_set_direction(&m_engine->engine, 0, forward.x, forward.y, forward.z);
     ma_engine_listener_set_world_up(&m_engine->engine, 0, up.x, up.y, up.z);
 }
 
+std::size_t AudioSystem::LoadBank(const std::string& bankName, const std::vector<std::string>& clipNames, bool resident)
+{
+    if (!m_initialized || m_engine == nullptr)
+    {
+        return 0;
+    }
+
+    ma_resource_manager* resourceManager = ma_engine_get_resource_manager(&m_engine->engine);
+    std::vector<std::string> preloaded;
+    std::size_t found = 0;
+    std::size_t streamed = 0;
+    for (const std::string& clipName : clipNames)
+    {
+        const std::string path = ResolveClipPath(clipName);
+        if (path.empty())
+        {
+            std::cout << "[AUDIO] Bank '" << bankName << "': clip not found: " << clipName << "\n";
+            continue;
+        }
+        ++found;
+
+        std::error_code ec;
+        const std::uintmax_t fileBytes = std::filesystem::file_size(path, ec);
+        if (ec || (!resident && fileBytes >= kStreamThresholdBytes))
+        {
+            ++streamed;
+            continue;
+        }
+        if (std::find(preloaded.begin(), preloaded.end(), path) != preloaded.end())
+        {
+            continue;
+        }
+
+        // Decoded synchronously (at startup or match load): a voice stopped while its buffer is still
+        // loading asynchronously has to wait on the resource manager thread.
+        int& refs = m_preloadRefs[path];
+        if (refs == 0 &&
+            ma_resource_manager_register_file(resourceManager, path.c_str(), MA_RESOURCE_MANAGER_DATA_SOURCE_FLAG_DECODE) !=
+                MA_SUCCESS)
+        {
+            m_preloadRefs.erase(path);
+            continue;
+        }
+        ++refs;
+        preloaded.push_back(path);
+    }
+
+    // Register the new set before releasing the old one so clips kept across a reload stay decoded.
+    UnloadBank(bankName);
+    std::cout << "[AUDIO] Bank '" << bankName << "': " << preloaded.size() << " preloaded, " << streamed << " streamed, "
+              << (clipNames.size() - found) << " missing\n";
+    m_banks[bankName] = std::move(preloaded);
+    return found;
+}
+
+std::size_t AudioSystem::LoadBankFile(const std::string& bankName)
+{
+    const std::filesystem::path path = std::filesystem::path(m_assetRoot) / "banks" / (bankName + ".json");
+    std::ifstream stream(path);
+    if (!stream.is_open())
+    {
+        std::cout << "[AUDIO] Bank file missing: " << path.string() << "\n";
+        return 0;
+    }
+
+    const nlohmann::json root = nlohmann::json::parse(stream, nullptr, false);
+    if (root.is_discarded() || !root.contains("clips") || !root["clips"].is_array())
+    {
+        std::cout << "[AUDIO] Invalid bank file: " << path.string() << "\n";
+        return 0;
+    }
+
+    std::vector<std::string> clipNames;
+    for (const auto& clip : root["clips"])
+    {
+        if (clip.is_string())
+        {
+            clipNames.push_back(clip.get<std::string>());
+        }
+    }
+    return LoadBank(bankName, clipNames, root.value("resident", false));
+}
+
+void AudioSystem::UnloadBank(const std::string& bankName)
+{
+    const auto bank = m_banks.find(bankName);
+    if (bank == m_banks.end())
+    {
+        return;
+    }
+
+    for (const std::string& path : bank->second)
+    {
+        const auto refs = m_preloadRefs.find(path);
+        if (refs == m_preloadRefs.end() || --refs->second > 0)
+        {
+            continue;
+        }
+        // Voices still playing hold their own reference; the PCM is freed after the last one stops.
+        if (m_engine != nullptr)
+        {
+            ma_resource_manager_unregister_file(ma_engine_get_resource_manager(&m_engine->engine), path.c_str());
+        }
+        m_preloadRefs.erase(refs);
+    }
+    m_banks.erase(bank);
+}
+
+bool AudioSystem::IsPreloaded(const std::string& clipName) const
+{
+    const std::string path = ResolveClipPath(clipName);
+    return !path.empty() && m_preloadRefs.contains(path);
+}
+
+void AudioSystem::SetBusVoiceLimit(Bus bus, int voices)
+{
+    m_busVoiceLimit[static_cast<std::size_t>(bus)] = std::max(1, voices);
+}
+
+int AudioSystem::GetBusVoiceLimit(Bus bus) const
+{
+    return m_busVoiceLimit[static_cast<std::size_t>(bus)];
+}
+
+AudioSystem::VoiceStats AudioSystem::GetVoiceStats() const
+{
+    return m_voiceStats;
+}
+
+float AudioSystem::EstimateGain(const ActiveSound& active) const
+{
+    float gain = active.volume * m_busVolume[static_cast<std::size_t>(Bus::Master)];
+    if (active.bus != Bus::Master)
+    {
+        gain *= m_busVolume[static_cast<std::size_t>(active.bus)];
+    }
+    if (active.position.has_value())
+    {
+        // miniaudio's default inverse model with rolloff 1, clamped to [min, max] distance.
+        const float distance = glm::clamp(glm::distance(m_listenerPosition, *active.position), active.minDistance, active.maxDistance);
+        gain *= active.minDistance / distance;
+    }
+    return gain;
+}
+
+std::uint64_t AudioSystem::VirtualCursor(const ActiveSound& active) const
+{
+    const ma_uint64 now = ma_engine_get_time_in_pcm_frames(&m_engine->engine);
+    const ma_uint64 elapsedEngineFrames = now > active.virtualSinceFrame ? now - active.virtualSinceFrame : 0U;
+    ma_uint32 soundRate = 0;
+    (void)ma_sound_get_data_format(&active.sound, nullptr, nullptr, &soundRate, nullptr, 0);
+    const ma_uint32 engineRate = ma_engine_get_sample_rate(&m_engine->engine);
+    const double rateScale = (soundRate > 0 && engineRate > 0) ? static_cast<double>(soundRate) / static_cast<double>(engineRate) : 1.0;
+
+    std::uint64_t cursor =
+        active.virtualCursor + static_cast<std::uint64_t>(static_cast<double>(elapsedEngineFrames) * rateScale * static_cast<double>(active.pitch));
+    ma_uint64 length = 0;
+    if (ma_sound_get_length_in_pcm_frames(&active.sound, &length) == MA_SUCCESS && length > 0)
+    {
+        cursor %= length;
+    }
+    return cursor;
+}
+
+void AudioSystem::SetVirtual(ActiveSound& active, bool isVirtual)
+{
+    if (active.isVirtual == isVirtual || !active.initialized)
+    {
+        return;
+    }
+    if (isVirtual)
+    {
+        ma_uint64 cursor = 0;
+        (void)ma_sound_get_cursor_in_pcm_frames(&active.sound, &cursor);
+        active.virtualCursor = cursor;
+        active.virtualSinceFrame = ma_engine_get_time_in_pcm_frames(&m_engine->engine);
+        ma_sound_stop(&active.sound); // keeps the data source, only leaves the mix
+    }
+    else
+    {
+        (void)ma_sound_seek_to_pcm_frame(&active.sound, VirtualCursor(active));
+        ma_sound_start(&active.sound);
+    }
+    active.isVirtual = isVirtual;
+}
+
+bool AudioSystem::AdmitVoice(const ActiveSound& candidate)
+{
+    int realVoices = 0;
+    SoundHandle weakestHandle = 0;
+    ActiveSound* weakest = nullptr;
+    for (const auto& [handle, active] : m_engine->sounds)
+    {
+        if (active == nullptr || !active->initialized || active->isVirtual || active->bus != candidate.bus)
+        {
+            continue;
+        }
+        ++realVoices;
+        if (weakest == nullptr || RanksAbove(weakest->priority, weakest->gain, active->priority, active->gain))
+        {
+            weakest = active.get();
+            weakestHandle = handle;
+        }
+    }
+
+    if (realVoices < m_busVoiceLimit[static_cast<std::size_t>(candidate.bus)])
+    {
+        return true;
+    }
+    if (weakest == nullptr || !RanksAbove(candidate.priority, candidate.gain, weakest->priority, weakest->gain))
+    {
+        return false;
+    }
+
+    ++m_voiceStats.stolen;
+    if (weakest->looping)
+    {
+        SetVirtual(*weakest, true);
+    }
+    else
+    {
+        Stop(weakestHandle);
+    }
+    return true;
+}
+
+void AudioSystem::ApplyVoiceBudgets()
+{
+    struct Ranked
+    {
+        SoundHandle handle;
+        ActiveSound* sound;
+    };
+    std::vector<Ranked> ranked;
+    ranked.reserve(m_engine->sounds.size());
+    for (const auto& [handle, active] : m_engine->sounds)
+    {
+        if (active == nullptr || !active->initialized)
+        {
+            continue;
+        }
+        active->gain = EstimateGain(*active);
+        // Twice the threshold to come back, so a loop fading around it does not flip every frame.
+        const float audibleGain = active->isVirtual ? kVirtualGain * 2.0F : kVirtualGain;
+        if (active->looping && active->gain < audibleGain)
+        {
+            SetVirtual(*active, true);
+            continue;
+        }
+        ranked.push_back(Ranked{handle, active.get()});
+    }
+
+    std::sort(ranked.begin(), ranked.end(), [](const Ranked& a, const Ranked& b) {
+        if (a.sound->bus != b.sound->bus)
+        {
+            return a.sound->bus < b.sound->bus;
+        }
+        const bool aAbove = RanksAbove(a.sound->priority, a.sound->gain, b.sound->priority, b.sound->gain);
+        const bool bAbove = RanksAbove(b.sound->priority, b.sound->gain, a.sound->priority, a.sound->gain);
+        if (aAbove != bAbove)
+        {
+            return aAbove;
+        }
+        // Equal rank: keep what is already mixing rather than swapping voices every frame.
+        return !a.sound->isVirtual && b.sound->isVirtual;
+    });
+
+    std::array<int, 5> realPerBus{};
+    std::vector<SoundHandle> evicted;
+    for (const Ranked& entry : ranked)
+    {
+        const std::size_t bus = static_cast<std::size_t>(entry.sound->bus);
+        if (realPerBus[bus] < m_busVoiceLimit[bus])
+        {
+            ++realPerBus[bus];
+            SetVirtual(*entry.sound, false);
+            continue;
+        }
+        if (entry.sound->looping)
+        {
+            if (!entry.sound->isVirtual)
+            {
+                SetVirtual(*entry.sound, true);
+                ++m_voiceStats.stolen;
+            }
+        }
+        else
+        {
+            evicted.push_back(entry.handle);
+            ++m_voiceStats.stolen;
+        }
+    }
+    for (const SoundHandle handle : evicted)
+    {
+        Stop(handle);
+    }
+
+    m_voiceStats.active = 0;
+    m_voiceStats.virtualized = 0;
+    for (const auto& [handle, active] : m_engine->sounds)
+    {
+        (void)handle;
+        if (active != nullptr && active->initialized)
+        {
+            ++(active->isVirtual ? m_voiceStats.virtualized : m_voiceStats.active);
+        }
+    }
+}
+
 std::string AudioSystem::ResolveClipPath(const std::string& clipName) const
+{
+    // Cache hits only, so a clip dropped into the asset folder later is still picked up.
+    const auto cached = m_resolvedPaths.find(clipName);
+    if (cached != m_resolvedPaths.end())
+    {
+        return cached->second;
+    }
+    std::string path = ResolveClipPathUncached(clipName);
+    if (!path.empty())
+    {
+        m_resolvedPaths.emplace(clipName, path);
+    }
+    return path;
+}
+
+std::string AudioSystem::ResolveClipPathUncached(const std::string& clipName) const
 {
     namespace fs = std::filesystem;
     if (clipName.empty())
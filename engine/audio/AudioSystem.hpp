@@ -5,6 +5,7 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <glm/vec3.hpp>
 
@@ -29,6 +30,15 @@ public:
         float pitch = 1.0F;
         float minDistance = 1.0F;
         float maxDistance = 64.0F;
+        int priority = 0; // higher wins when a bus is over its voice budget
+    };
+
+    struct VoiceStats
+    {
+        std::uint32_t active = 0;      // mixed this frame
+        std::uint32_t virtualized = 0; // looping, inaudible or over budget: cursor tracked, not mixed
+        std::uint32_t stolen = 0;      // voices stopped or virtualized for a higher-ranked one (total)
+        std::uint32_t rejected = 0;    // one-shots refused by a full bus (total)
     };
 
     using SoundHandle = std::uint64_t;
@@ -57,10 +67,38 @@ public:
 
     void SetListener(const glm::vec3& position, const glm::vec3& forward, const glm::vec3& up = glm::vec3{0.0F, 1.0F, 0.0F});
 
+    /// Decodes the bank's short clips once into the shared resource manager pool; every voice of a
+    /// preloaded clip then mixes from that PCM instead of opening and decoding the file again.
+    /// Clips at or above kStreamThresholdBytes (music, ambience beds) are left to stream unless the
+    /// bank is resident. Banks are reference counted per clip, so overlapping banks share data.
+    /// Returns the number of clips found.
+    std::size_t LoadBank(const std::string& bankName, const std::vector<std::string>& clipNames, bool resident = false);
+    /// Reads clip names from <assetRoot>/banks/<bankName>.json ({"clips": [...], "resident": bool}).
+    std::size_t LoadBankFile(const std::string& bankName);
+    void UnloadBank(const std::string& bankName);
+    [[nodiscard]] bool IsPreloaded(const std::string& clipName) const;
+
+    /// Real (mixed) voices allowed per bus. Over budget, the lowest priority then quietest voices are
+    /// virtualized (loops) or stopped (one-shots).
+    void SetBusVoiceLimit(Bus bus, int voices);
+    [[nodiscard]] int GetBusVoiceLimit(Bus bus) const;
+    [[nodiscard]] VoiceStats GetVoiceStats() const;
+
+    static constexpr std::uintmax_t kStreamThresholdBytes = 1024U * 1024U;
+    /// Estimated gain (volume x bus x distance attenuation) below which a loop goes virtual (-60 dB).
+    static constexpr float kVirtualGain = 0.001F;
+
 private:
     struct ActiveSound;
 
+    SoundHandle StartSound(const std::string& clipName, Bus bus, const PlayOptions& options, bool looping);
+    [[nodiscard]] float EstimateGain(const ActiveSound& active) const;
+    void SetVirtual(ActiveSound& active, bool isVirtual);
+    [[nodiscard]] std::uint64_t VirtualCursor(const ActiveSound& active) const;
+    bool AdmitVoice(const ActiveSound& candidate);
+    void ApplyVoiceBudgets();
     [[nodiscard]] std::string ResolveClipPath(const std::string& clipName) const;
+    [[nodiscard]] std::string ResolveClipPathUncached(const std::string& clipName) const;
     [[nodiscard]] static bool IsAbsolutePathLike(const std::string& value);
     [[nodiscard]] void* GroupForBus(Bus bus) const;
 
@@ -71,6 +109,19 @@ private:
     struct EngineData;
     EngineData* m_engine = nullptr;
     std::unordered_map<SoundHandle, ActiveSound*> m_active;
+    mutable std::unordered_map<std::string, std::string> m_resolvedPaths; // clip name -> path ("" = missing)
+    std::unordered_map<std::string, std::vector<std::string>> m_banks;   // bank -> preloaded paths
+    std::unordered_map<std::string, int> m_preloadRefs;                  // path -> banks holding it
+
+    glm::vec3 m_listenerPosition{0.0F};
+    std::array<int, 5> m_busVoiceLimit{
+        8,  // Master
+        8,  // Music
+        24, // Sfx
+        8,  // Ui
+        6,  // Ambience
+    };
+    VoiceStats m_voiceStats;
 
     std::array<float, 5> m_busVolume{
         1.0F, // Master
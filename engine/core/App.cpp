@@ -2,8 +2,18 @@
 #include "engine/core/App.hpp"
 #include "engine/core/Profiler.hpp"
 #include "engine/core/JobSystem.hpp"
+#include "engine/core/StartupTimeline.hpp"
+#include "engine/assets/AssetCooker.hpp"
+#include "engine/assets/AssetManager.hpp"
+#include "engine/assets/AssetPack.hpp"
 #include "engine/assets/AsyncAssetLoader.hpp"
+#include "engine/assets/CookedMesh.hpp"
+#include "engine/assets/MeshLibrary.hpp"
+#include "engine/render/Frustum.hpp"
+#include "engine/render/LightClusters.hpp"
 #include "engine/render/RenderThread.hpp"
+#include "engine/render/ShaderCache.hpp"
+#include "game/net/NetProtocol.hpp"
 
 #include <algorithm>
 #include <array>
@@ -15,8 +25,10 @@
 #include <cstring>
 #include <ctime>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <optional>
+#include <random>
 #include <sstream>
 #include <iomanip>
 #include <thread>
@@ -50,48 +62,41 @@ namespace engine::core
 {
 namespace
 {
-constexpr std::uint8_t kPacketRoleInput = 1;
-constexpr std::uint8_t kPacketSnapshot = 2;
-constexpr std::uint8_t kPacketAssignRole = 3;
-constexpr std::uint8_t kPacketHello = 4;
-constexpr std::uint8_t kPacketReject = 5;
-constexpr std::uint8_t kPacketGameplayTuning = 6;
-constexpr std::uint8_t kPacketRoleChangeRequest = 7;
-constexpr std::uint8_t kPacketFxSpawn = 8;
-constexpr std::uint8_t kPacketLobbyState = 9;
-constexpr std::uint8_t kPacketLobbyPlayerJoin = 10;
-constexpr std::uint8_t kPacketLobbyPlayerLeave = 11;
-constexpr std::uint8_t kPacketLobbyPlayerUpdate = 12;
-
 // Maximum players in lobby (DBD-like: 4 survivors + 1 killer)
 constexpr std::size_t kMaxLobbySurvivors = 4;
 constexpr std::size_t kMaxLobbyKillers = 1;
 constexpr std::size_t kMaxLobbyPlayers = kMaxLobbySurvivors + kMaxLobbyKillers;
 
-constexpr int kProtocolVersion = 1;
-#ifndef BUILD_ID
-#define BUILD_ID "unknown"
-#endif
-constexpr const char* kBuildId = BUILD_ID;
-
 using json = nlohmann::json;
-
-constexpr std::uint16_t kButtonSprint = 1 << 0;
-constexpr std::uint16_t kButtonInteractPressed = 1 << 1;
-constexpr std::uint16_t kButtonInteractHeld = 1 << 2;
-constexpr std::uint16_t kButtonAttackPressed = 1 << 3;
-constexpr std::uint16_t kButtonJumpPressed = 1 << 4;
-constexpr std::uint16_t kButtonWiggleLeftPressed = 1 << 5;
-constexpr std::uint16_t kButtonWiggleRightPressed = 1 << 6;
-constexpr std::uint16_t kButtonAttackHeld = 1 << 7;
-constexpr std::uint16_t kButtonAttackReleased = 1 << 8;
-constexpr std::uint16_t kButtonCrouchHeld = 1 << 9;
-constexpr std::uint16_t kButtonLungeHeld = 1 << 10;
-constexpr std::uint16_t kButtonUseAltPressed = 1 << 11;
-constexpr std::uint16_t kButtonUseAltHeld = 1 << 12;
-constexpr std::uint16_t kButtonUseAltReleased = 1 << 13;
-constexpr std::uint16_t kButtonDropItemPressed = 1 << 14;
-constexpr std::uint16_t kButtonPickupItemPressed = 1 << 15;
+using namespace game::net;
+
+// Wraith cloak draw recorded into the frame's command list; it samples the finished backbuffer.
+struct CloakPassPayload
+{
+    glm::mat4 viewProjection{1.0F};
+    glm::mat4 model{1.0F};
+    glm::vec3 cameraPosition{0.0F};
+    glm::vec3 wraithPosition{0.0F};
+    float capsuleHeight = 0.0F;
+    float capsuleRadius = 0.0F;
+    render::WraithCloakParams params{};
+};
+
+void RenderCloakPass(void* user, const void* payload)
+{
+    auto& cloak = *static_cast<render::WraithCloakRenderer*>(user);
+    const auto& pass = *static_cast<const CloakPassPayload*>(payload);
+    cloak.CaptureBackbuffer();
+    cloak.Render(
+        pass.viewProjection,
+        pass.model,
+        pass.cameraPosition,
+        pass.wraithPosition,
+        pass.capsuleHeight,
+        pass.capsuleRadius,
+        pass.params
+    );
+}
 
 std::string RenderModeToText(render::RenderMode mode)
 {
@@ -127,49 +132,6 @@ App::DisplayModeSetting DisplayModeFromText(const std::string& value)
     return App::DisplayModeSetting::Windowed;
 }
 
-game::gameplay::GameplaySystems::MapType ByteToMapType(std::uint8_t value)
-{
-    switch (value)
-    {
-        case 1: return game::gameplay::GameplaySystems::MapType::Main;
-        case 2: return game::gameplay::GameplaySystems::MapType::CollisionTest;
-        case 0:
-        default: return game::gameplay::GameplaySystems::MapType::Test;
-    }
-}
-
-std::uint8_t MapTypeToByte(game::gameplay::GameplaySystems::MapType mapType)
-{
-    switch (mapType)
-    {
-        case game::gameplay::GameplaySystems::MapType::Main: return 1;
-        case game::gameplay::GameplaySystems::MapType::CollisionTest: return 2;
-        case game::gameplay::GameplaySystems::MapType::Test:
-        default: return 0;
-    }
-}
-
-std::string MapTypeToName(game::gameplay::GameplaySystems::MapType mapType)
-{
-    switch (mapType)
-    {
-        case game::gameplay::GameplaySystems::MapType::Main: return "main";
-        case game::gameplay::GameplaySystems::MapType::CollisionTest: return "collision_test";
-        case game::gameplay::GameplaySystems::MapType::Test:
-        default: return "test";
-    }
-}
-
-std::uint8_t RoleNameToByte(const std::string& roleName)
-{
-    return roleName == "killer" ? 1U : 0U;
-}
-
-std::string RoleByteToName(std::uint8_t roleByte)
-{
-    return roleByte == 1U ? "killer" : "survivor";
-}
-
 audio::AudioSystem::Bus AudioBusFromName(const std::string& value)
 {
     if (value == "music")
@@ -228,102 +190,69 @@ glm::vec2 ReadMoveAxis(const platform::Input& input, const platform::ActionBindi
 
     return axis;
 }
+} // namespace
 
-template <typename T>
-void AppendValue(std::vector<std::uint8_t>& buffer, const T& value)
-{
-    const std::uint8_t* ptr = reinterpret_cast<const std::uint8_t*>(&value);
-    buffer.insert(buffer.end(), ptr, ptr + sizeof(T));
-}
-
-template <typename T>
-bool ReadValue(const std::vector<std::uint8_t>& buffer, std::size_t& offset, T& outValue)
-{
-    if (offset + sizeof(T) > buffer.size())
-    {
-        return false;
-    }
-
-    std::memcpy(&outValue, buffer.data() + offset, sizeof(T));
-    offset += sizeof(T);
-    return true;
-}
-
-bool SerializeFxSpawnEvent(const engine::fx::FxSpawnEvent& event, std::vector<std::uint8_t>& outBuffer)
-{
-    outBuffer.clear();
-    outBuffer.reserve(1 + sizeof(std::uint16_t) + event.assetId.size() + sizeof(float) * 6 + sizeof(std::uint8_t));
-    AppendValue(outBuffer, kPacketFxSpawn);
-
-    const std::uint16_t length = static_cast<std::uint16_t>(std::min<std::size_t>(event.assetId.size(), 4096));
-    AppendValue(outBuffer, length);
-    outBuffer.insert(outBuffer.end(), event.assetId.begin(), event.assetId.begin() + length);
-
-    AppendValue(outBuffer, event.position.x);
-    AppendValue(outBuffer, event.position.y);
-    AppendValue(outBuffer, event.position.z);
-    AppendValue(outBuffer, event.forward.x);
-    AppendValue(outBuffer, event.forward.y);
-    AppendValue(outBuffer, event.forward.z);
-    AppendValue(outBuffer, static_cast<std::uint8_t>(event.netMode));
-    return true;
-}
-
-bool DeserializeFxSpawnEvent(const std::vector<std::uint8_t>& buffer, engine::fx::FxSpawnEvent& outEvent)
+bool App::Run()
 {
-    std::size_t offset = 0;
-    std::uint8_t type = 0;
-    if (!ReadValue(buffer, offset, type) || type != kPacketFxSpawn)
+    StartupTimeline& timeline = StartupTimeline::Instance();
+    timeline.Begin();
+    std::cout << "Asymmetric Horror Prototype - Build: " << kBuildId << "\n";
     {
-        return false;
+        StartupScope scope("asset_pack");
+        // Optional single-file archive built with --pack-assets; loose files remain the fallback.
+        (void)assets::AssetPack::Instance().Mount(assets::AssetPack::kDefaultPath);
     }
-
-    std::uint16_t length = 0;
-    if (!ReadValue(buffer, offset, length))
     {
-        return false;
+        StartupScope scope("network_setup");
+        OpenNetworkLogFile();
+        BuildLocalIpv4List();
     }
-    if (offset + length > buffer.size())
     {
-        return false;
+        StartupScope scope("job_system");
+        if (!JobSystem::Instance().Initialize())
+        {
+            std::cerr << "Warning: failed to initialize JobSystem.\n";
+        }
     }
-    outEvent.assetId.assign(reinterpret_cast<const char*>(buffer.data() + offset), length);
-    offset += length;
-
-    if (!ReadValue(buffer, offset, outEvent.position.x) ||
-        !ReadValue(buffer, offset, outEvent.position.y) ||
-        !ReadValue(buffer, offset, outEvent.position.z) ||
-        !ReadValue(buffer, offset, outEvent.forward.x) ||
-        !ReadValue(buffer, offset, outEvent.forward.y) ||
-        !ReadValue(buffer, offset, outEvent.forward.z))
     {
-        return false;
+        // The window and fixed tick need these two before anything else; they also create config/.
+        StartupScope scope("config_window");
+        (void)LoadGraphicsConfig();
+        (void)LoadGameplayConfig();
     }
 
-    std::uint8_t modeByte = 0;
-    if (!ReadValue(buffer, offset, modeByte))
-    {
-        return false;
-    }
-    outEvent.netMode = static_cast<engine::fx::FxNetMode>(modeByte);
-    return true;
-}
-} // namespace
+    // File-only init runs on workers while this thread brings up the window, GL context, renderer and
+    // UI. Each job writes members nothing else touches before the wait below.
+    JobCounter startupJobs;
+    auto runStartupJob = [&startupJobs](const char* name, std::function<void()> job) {
+        auto timed = [name, job = std::move(job)] {
+            StartupScope scope(name);
+            job();
+        };
+        if (JobSystem::Instance().Schedule(timed, JobPriority::High, name, &startupJobs) == kInvalidJobId)
+        {
+            timed(); // job system disabled or failed to start
+        }
+    };
+    auto waitStartupJobs = [&startupJobs] {
+        StartupScope scope("wait_startup_jobs");
+        JobSystem::Instance().WaitForCounter(startupJobs);
+    };
 
-bool App::Run()
-{
-    std::cout << "Asymmetric Horror Prototype - Build: " << kBuildId << "\n";
-    OpenNetworkLogFile();
-    BuildLocalIpv4List();
-
-    (void)LoadControlsConfig();
-    (void)LoadGraphicsConfig();
-    (void)LoadAudioConfig();
-    (void)LoadGameplayConfig();
-    (void)LoadPowersConfig();
-    ApplyPowersSettings(m_powersApplied, false);
-    (void)LoadAnimationConfig();
-    (void)LoadHudLayoutConfig();
+    runStartupJob("config_parse", [this] {
+        (void)LoadControlsConfig();
+        (void)LoadAudioConfig();
+        (void)LoadPowersConfig();
+        (void)LoadHudLayoutConfig();
+    });
+    runStartupJob("gameplay_assets", [this] { m_gameplay.PreloadAssets(); });
+    bool audioReady = false;
+    runStartupJob("audio", [this, &audioReady] {
+        audioReady = m_audio.Initialize("assets/audio");
+        // Decoded off the main thread here, so the first match start finds the terror radius layers
+        // registered instead of decoding them on its loading screen.
+        (void)m_audio.LoadBankFile("match");
+    });
 
     m_windowSettings.width = m_graphicsApplied.width;
     m_windowSettings.height = m_graphicsApplied.height;
@@ -339,9 +268,13 @@ bool App::Run()
     m_clientInterpolationBufferMs = glm::clamp(m_gameplayApplied.interpolationBufferMs, 50, 1000);
     m_time.SetFixedDeltaSeconds(1.0 / static_cast<double>(m_fixedTickHz));
 
-    if (!m_window.Initialize(m_windowSettings))
     {
-        return false;
+        StartupScope scope("window");
+        if (!m_window.Initialize(m_windowSettings))
+        {
+            waitStartupJobs();
+            return false;
+        }
     }
     m_window.SetFileDropCallback([this](const std::vector<std::string>& paths) {
         m_pendingDroppedFiles.insert(m_pendingDroppedFiles.end(), paths.begin(), paths.end());
@@ -352,54 +285,73 @@ bool App::Run()
         m_window.SetDisplayMode(platform::Window::DisplayMode::Borderless, m_graphicsApplied.width, m_graphicsApplied.height);
     }
 
-    if (!gladLoadGL(reinterpret_cast<GLADloadfunc>(glfwGetProcAddress)))
     {
-        std::cerr << "Failed to initialize GLAD.\n";
-        return false;
-    }
+        StartupScope scope("gl_context");
+        if (!gladLoadGL(reinterpret_cast<GLADloadfunc>(glfwGetProcAddress)))
+        {
+            std::cerr << "Failed to initialize GLAD.\n";
+            waitStartupJobs();
+            return false;
+        }
 
-    const unsigned char* glVersion = glGetString(GL_VERSION);
-    std::cout << "OpenGL version: " << (glVersion != nullptr ? reinterpret_cast<const char*>(glVersion) : "unknown") << "\n";
+        const unsigned char* glVersion = glGetString(GL_VERSION);
+        std::cout << "OpenGL version: " << (glVersion != nullptr ? reinterpret_cast<const char*>(glVersion) : "unknown") << "\n";
+        render::ShaderCache::Initialize();
+    }
 
-    if (!m_renderer.Initialize(m_window.FramebufferWidth(), m_window.FramebufferHeight()))
     {
-        std::cerr << "Failed to initialize renderer.\n";
-        return false;
+        StartupScope scope("renderer");
+        if (!m_renderer.Initialize(m_window.FramebufferWidth(), m_window.FramebufferHeight()))
+        {
+            std::cerr << "Failed to initialize renderer.\n";
+            waitStartupJobs();
+            return false;
+        }
+
+        m_sceneFbo.Create(m_window.FramebufferWidth(), m_window.FramebufferHeight());
+        // The cloak shader is built on the match loading screen (EnsureGameplayShaders), not before the menu.
+        m_wraithCloakRenderer.SetScreenSize(m_window.FramebufferWidth(), m_window.FramebufferHeight());
     }
 
-    m_sceneFbo.Create(m_window.FramebufferWidth(), m_window.FramebufferHeight());
-    if (!m_wraithCloakRenderer.Initialize())
     {
-        std::cerr << "Warning: failed to initialize Wraith cloak renderer.\n";
+        StartupScope scope("ui");
+        if (!m_ui.Initialize())
+        {
+            std::cerr << "Failed to initialize custom UI.\n";
+            waitStartupJobs();
+            return false;
+        }
     }
-    m_wraithCloakRenderer.SetScreenSize(m_window.FramebufferWidth(), m_window.FramebufferHeight());
 
-    if (!m_ui.Initialize())
+    waitStartupJobs();
     {
-        std::cerr << "Failed to initialize custom UI.\n";
-        return false;
+        StartupScope scope("config_apply");
+        ApplyPowersSettings(m_powersApplied, false);
+        (void)LoadAnimationConfig(); // applies to the gameplay animation system
+        m_ui.SetGlobalUiScale(m_hudLayout.hudScale);
     }
-    m_ui.SetGlobalUiScale(m_hudLayout.hudScale);
 
-    if (!m_audio.Initialize("assets/audio"))
     {
-        std::cerr << "Warning: failed to initialize audio backend.\n";
+        StartupScope scope("audio_settings");
+        if (!audioReady)
+        {
+            std::cerr << "Warning: failed to initialize audio backend.\n";
+        }
+        ApplyAudioSettings();
+        (void)LoadTerrorRadiusProfile("default_killer");
     }
-    ApplyAudioSettings();
-    (void)LoadTerrorRadiusProfile("default_killer");
 
     // Initialize threading systems
-    if (!JobSystem::Instance().Initialize())
     {
-        std::cerr << "Warning: failed to initialize JobSystem.\n";
-    }
-    if (!assets::AsyncAssetLoader::Instance().Initialize("assets"))
-    {
-        std::cerr << "Warning: failed to initialize AsyncAssetLoader.\n";
-    }
-    if (!render::RenderThread::Instance().Initialize())
-    {
-        std::cerr << "Warning: failed to initialize RenderThread.\n";
+        StartupScope scope("async_loaders");
+        if (!assets::AsyncAssetLoader::Instance().Initialize("assets"))
+        {
+            std::cerr << "Warning: failed to initialize AsyncAssetLoader.\n";
+        }
+        if (!render::RenderThread::Instance().Initialize(m_window.NativeHandle()))
+        {
+            std::cerr << "Warning: failed to initialize RenderThread.\n";
+        }
     }
 
     m_renderer.SetRenderMode(m_graphicsApplied.renderMode);
@@ -410,7 +362,10 @@ bool App::Run()
         m_wraithCloakRenderer.SetScreenSize(width, height);
     });
 
-    m_gameplay.Initialize(m_eventBus);
+    {
+        StartupScope scope("gameplay");
+        m_gameplay.Initialize(m_eventBus);
+    }
     m_gameplay.SetFxReplicationCallback([this](const engine::fx::FxSpawnEvent& event) {
         if (m_multiplayerMode != MultiplayerMode::Host || !m_network.IsConnected())
         {
@@ -418,7 +373,7 @@ bool App::Run()
         }
 
         std::vector<std::uint8_t> payload;
-        if (!SerializeFxSpawnEvent(event, payload))
+        if (!game::net::SerializeFxSpawnEvent(event, payload))
         {
             return;
         }
@@ -427,14 +382,19 @@ bool App::Run()
     m_gameplay.ApplyGameplayTuning(m_gameplayApplied);
     ApplyControlsSettings();
     m_gameplay.SetRenderModeLabel(RenderModeToText(m_renderer.GetRenderMode()));
-    m_levelEditor.Initialize();
+    {
+        StartupScope scope("level_editor");
+        m_levelEditor.Initialize();
+    }
 
+    const auto screensBegin = StartupTimeline::Clock::now();
     // Initialize loading manager
     game::ui::LoadingContext loadingContext;
     loadingContext.ui = &m_ui;
     loadingContext.input = &m_input;
     loadingContext.renderer = &m_renderer;
     loadingContext.gameplay = &m_gameplay;
+    loadingContext.compileShaders = [this] { (void)EnsureGameplayShaders(); };
     if (!m_loadingManager.Initialize(loadingContext))
     {
         std::cerr << "Failed to initialize loading manager.\n";
@@ -691,14 +651,18 @@ bool App::Run()
             CloseNetworkLogFile();
             return false;
         }
+    timeline.Record("ui_screens", screensBegin, StartupTimeline::Clock::now());
     float currentFps = 0.0F;
     double fpsAccumulator = 0.0;
     int fpsFrames = 0;
+    bool startupReported = false;
+    const auto firstFrameBegin = StartupTimeline::Clock::now();
 
     while (!m_window.ShouldClose() && !m_gameplay.QuitRequested())
     {
         auto& profiler = engine::core::Profiler::Instance();
         profiler.BeginFrame();
+        engine::assets::AssetManager::Instance().Update();
 
         const double frameStart = glfwGetTime();
 
@@ -784,7 +748,7 @@ bool App::Run()
         }
         if (m_input.IsKeyPressed(GLFW_KEY_F8))
         {
-            m_wraithCloakDebugEnabled = !m_wraithCloakDebugEnabled;
+            m_wraithCloakDebugEnabled = !m_wraithCloakDebugEnabled && EnsureGameplayShaders();
             m_statusToastMessage = m_wraithCloakDebugEnabled ? "Wraith cloak debug ON (F9 to toggle)" : "Wraith cloak debug OFF";
             m_statusToastUntilSeconds = glfwGetTime() + 2.0;
         }
@@ -914,10 +878,8 @@ bool App::Run()
             m_renderer.SetLightingEnabled(true);
             m_renderer.SetCameraWorldPosition(glm::vec3{0.0F, 2.0F, 0.0F});
         }
-        m_renderer.EndFrame(viewProjection);
-
-        // Wraith cloak shader rendering
-        if (inGame && m_wraithCloakRenderer.IsInitialized())
+        // Wraith cloak shader rendering, recorded as a pass so it runs after the scene on the render thread
+        if (inGame && EnsureGameplayShaders())
         {
             const auto hudState = m_gameplay.BuildHudState();
 
@@ -931,30 +893,24 @@ bool App::Run()
             // AND the local player is NOT the killer in first-person (to avoid obstructing view)
             if (hudState.killerPowerId == "wraith_cloak" && hudState.wraithCloakAmount > 0.01F && !isLocalKillerInFirstPerson)
             {
-                m_wraithCloakRenderer.CaptureBackbuffer();
-
                 m_wraithCloakParams.time = static_cast<float>(glfwGetTime());
                 m_wraithCloakParams.cloakAmount = hudState.wraithCloakAmount;
 
-                const glm::mat4 model = glm::translate(glm::mat4{1.0F}, hudState.killerWorldPosition);
-
-                m_wraithCloakRenderer.Render(
-                    viewProjection,
-                    model,
-                    m_gameplay.CameraPosition(),
-                    hudState.killerWorldPosition,
-                    hudState.killerCapsuleHeight,
-                    hudState.killerCapsuleRadius,
-                    m_wraithCloakParams
-                );
+                CloakPassPayload pass;
+                pass.viewProjection = viewProjection;
+                pass.model = glm::translate(glm::mat4{1.0F}, hudState.killerWorldPosition);
+                pass.cameraPosition = m_gameplay.CameraPosition();
+                pass.wraithPosition = hudState.killerWorldPosition;
+                pass.capsuleHeight = hudState.killerCapsuleHeight;
+                pass.capsuleRadius = hudState.killerCapsuleRadius;
+                pass.params = m_wraithCloakParams;
+                m_renderer.RecordPass(&RenderCloakPass, &m_wraithCloakRenderer, &pass, sizeof(pass));
             }
         }
         
         // Debug cloak rendering (F8 toggle)
         if (m_wraithCloakDebugEnabled && m_wraithCloakRenderer.IsInitialized())
         {
-            m_wraithCloakRenderer.CaptureBackbuffer();
-            
             m_wraithCloakParams.time = static_cast<float>(glfwGetTime());
             
             const float target = m_wraithCloakEnabled ? 1.0F : 0.0F;
@@ -965,19 +921,23 @@ bool App::Run()
             if (m_wraithCloakParams.cloakAmount > 0.01F)
             {
                 const glm::vec3 testPos{0.0F, 1.0F, 3.0F};
-                const glm::mat4 model = glm::translate(glm::mat4{1.0F}, testPos);
-                
-                m_wraithCloakRenderer.Render(
-                    viewProjection,
-                    model,
-                    inGame ? m_gameplay.CameraPosition() : (inEditor ? m_levelEditor.CameraPosition() : glm::vec3{0.0F, 2.0F, 0.0F}),
-                    testPos,
-                    2.0F,
-                    0.4F,
-                    m_wraithCloakParams
-                );
+
+                CloakPassPayload pass;
+                pass.viewProjection = viewProjection;
+                pass.model = glm::translate(glm::mat4{1.0F}, testPos);
+                pass.cameraPosition = inGame ? m_gameplay.CameraPosition() : (inEditor ? m_levelEditor.CameraPosition() : glm::vec3{0.0F, 2.0F, 0.0F});
+                pass.wraithPosition = testPos;
+                pass.capsuleHeight = 2.0F;
+                pass.capsuleRadius = 0.4F;
+                pass.params = m_wraithCloakParams;
+                m_renderer.RecordPass(&RenderCloakPass, &m_wraithCloakRenderer, &pass, sizeof(pass));
             }
         }
+
+        // Gameplay frames without menus hand the context to the render thread: the scene, UI and ImGui
+        // lists run there in order while the main thread builds the UI, until Swap takes it back.
+        render::RenderThread::Instance().SetThreadedSubmissionAllowed(inGame && !m_pauseMenuOpen && !m_settingsMenuOpen);
+        m_renderer.EndFrame(viewProjection);
         } // end PROFILE_SCOPE("Render")
 
         bool shouldQuit = false;
@@ -1058,6 +1018,7 @@ bool App::Run()
 
         if (m_graphicsAutoConfirmPending && glfwGetTime() >= m_graphicsAutoConfirmDeadline)
         {
+            render::RenderThread::Instance().AcquireContext();
             ApplyGraphicsSettings(m_graphicsRollback, false);
             m_graphicsEditing = m_graphicsRollback;
             m_graphicsApplied = m_graphicsRollback;
@@ -1072,6 +1033,7 @@ bool App::Run()
         }
         if (backToMenu)
         {
+            render::RenderThread::Instance().AcquireContext();
             ResetToMainMenu();
         }
         if (shouldQuit)
@@ -1356,13 +1318,18 @@ bool App::Run()
                 << " port=" << m_lanDiscovery.DiscoveryPort()
                 << " servers=" << m_lanDiscovery.Servers().size()
                 << " last_rx=" << m_lanDiscovery.LastResponseReceivedSeconds()
-                << " last_tx=" << m_lanDiscovery.LastHostBroadcastSeconds();
+                << " last_tx=" << m_lanDiscovery.LastHostBroadcastSeconds()
+                << " rate_limited=" << m_lanDiscovery.RateLimitedRequests();
             return oss.str();
         };
         context.lanDebug = [this](bool enabled) {
             m_showLanDebug = enabled;
             m_lanDiscovery.SetDebugEnabled(enabled);
         };
+        context.setNetConditions = [this](const net::NetworkConditions& conditions) {
+            m_network.SetConditions(conditions);
+            AppendNetworkLog(conditions.enabled ? "Network simulation enabled" : "Network simulation disabled");
+        };
         context.setTerrorRadiusVisible = [this](bool enabled) {
             m_gameplay.ToggleTerrorRadiusVisualization(enabled);
         };
@@ -1507,6 +1474,231 @@ bool App::Run()
             std::cout << "[JobTest] Completed " << counter.load() << " iterations in " << ms << "ms\n";
         };
 
+        context.cullBenchmark = [](int boxCount) -> std::string {
+            // Random boxes around a camera at the origin: per-box IntersectsAABB vs Frustum::CullBatch.
+            const glm::mat4 viewProjection = glm::perspective(glm::radians(60.0F), 16.0F / 9.0F, 0.05F, 400.0F) *
+                                             glm::lookAt(glm::vec3{0.0F, 2.0F, 0.0F}, glm::vec3{0.0F, 2.0F, -1.0F}, glm::vec3{0.0F, 1.0F, 0.0F});
+            engine::render::Frustum frustum;
+            frustum.Extract(viewProjection);
+
+            const auto count = static_cast<std::size_t>(boxCount);
+            std::mt19937 rng(1337U);
+            std::uniform_real_distribution<float> position(-300.0F, 300.0F);
+            std::uniform_real_distribution<float> extent(0.1F, 4.0F);
+            std::vector<glm::vec3> mins(count);
+            std::vector<glm::vec3> maxs(count);
+            engine::render::AabbBatch batch;
+            batch.Reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const glm::vec3 center{position(rng), position(rng) * 0.1F, position(rng)};
+                const glm::vec3 halfExtents{extent(rng), extent(rng), extent(rng)};
+                mins[i] = center - halfExtents;
+                maxs[i] = center + halfExtents;
+                batch.Add(mins[i], maxs[i]);
+            }
+
+            constexpr int kRuns = 50;
+            std::vector<std::uint32_t> visible;
+            visible.reserve(count);
+            std::size_t scalarVisible = 0;
+            const auto scalarStart = std::chrono::high_resolution_clock::now();
+            for (int run = 0; run < kRuns; ++run)
+            {
+                scalarVisible = 0;
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    scalarVisible += frustum.IntersectsAABB(mins[i], maxs[i]) ? 1U : 0U;
+                }
+            }
+            const auto batchStart = std::chrono::high_resolution_clock::now();
+            for (int run = 0; run < kRuns; ++run)
+            {
+                visible.clear();
+                frustum.CullBatch(batch, visible);
+            }
+            const auto batchEnd = std::chrono::high_resolution_clock::now();
+
+            const double scalarUs = std::chrono::duration<double, std::micro>(batchStart - scalarStart).count() / kRuns;
+            const double batchUs = std::chrono::duration<double, std::micro>(batchEnd - batchStart).count() / kRuns;
+            std::ostringstream ss;
+            ss << "=== Frustum Cull Benchmark ===\n"
+               << "  Boxes:         " << count << " (" << visible.size() << " visible"
+               << (visible.size() == scalarVisible ? "" : ", MISMATCH vs scalar") << ")\n"
+               << "  Scalar:        " << std::fixed << std::setprecision(1) << scalarUs << " us\n"
+               << "  Batch (" << engine::render::Frustum::CullBatchPath() << "): " << std::fixed << std::setprecision(1) << batchUs << " us\n"
+               << "  Speedup:       " << std::fixed << std::setprecision(2) << (batchUs > 0.0 ? scalarUs / batchUs : 0.0) << "x\n"
+               << "==============================";
+            return ss.str();
+        };
+
+        context.lightBenchmark = [](int lightCount) -> std::string {
+            // Random point and spot lights in front of a camera at the origin. The check samples points
+            // inside each light's real volume (sphere or cone) and looks up the cluster a fragment there
+            // would read; the light must be in that cluster's list.
+            using engine::render::LightClusters;
+            const glm::mat4 viewProjection = glm::perspective(glm::radians(60.0F), 16.0F / 9.0F, 0.05F, 400.0F) *
+                                             glm::lookAt(glm::vec3{0.0F, 2.0F, 0.0F}, glm::vec3{0.0F, 2.0F, -1.0F}, glm::vec3{0.0F, 1.0F, 0.0F});
+
+            struct BenchLight
+            {
+                glm::vec3 position{0.0F};
+                glm::vec3 direction{0.0F, -1.0F, 0.0F};
+                float range = 0.0F;
+                float outerCos = -1.0F; // -1 = point light
+            };
+            const auto count = static_cast<std::size_t>(lightCount);
+            std::mt19937 rng(1337U);
+            std::uniform_real_distribution<float> unit(-1.0F, 1.0F);
+            std::uniform_real_distribution<float> across(-60.0F, 60.0F);
+            std::uniform_real_distribution<float> height(0.0F, 6.0F);
+            std::uniform_real_distribution<float> ahead(-150.0F, 10.0F);
+            std::uniform_real_distribution<float> range(2.0F, 14.0F);
+            std::uniform_real_distribution<float> halfAngle(glm::radians(10.0F), glm::radians(70.0F));
+            std::vector<BenchLight> lights(count);
+            std::vector<LightClusters::LightBounds> bounds(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                BenchLight& light = lights[i];
+                light.position = glm::vec3{across(rng), height(rng), ahead(rng)};
+                light.range = range(rng);
+                if (i % 2 == 1)
+                {
+                    glm::vec3 direction{unit(rng), unit(rng) - 0.5F, unit(rng)};
+                    light.direction = glm::length(direction) > 1.0e-3F ? glm::normalize(direction) : glm::vec3{0.0F, -1.0F, 0.0F};
+                    light.outerCos = std::cos(halfAngle(rng));
+                    bounds[i] = LightClusters::SpotLightBounds(light.position, light.direction, light.range, light.outerCos);
+                }
+                else
+                {
+                    bounds[i] = LightClusters::LightBounds{light.position, light.range};
+                }
+            }
+
+            constexpr int kRuns = 50;
+            LightClusters clusters;
+            const auto buildStart = std::chrono::high_resolution_clock::now();
+            for (int run = 0; run < kRuns; ++run)
+            {
+                clusters.Build(viewProjection, bounds);
+            }
+            const auto buildEnd = std::chrono::high_resolution_clock::now();
+            const double buildUs = std::chrono::duration<double, std::micro>(buildEnd - buildStart).count() / kRuns;
+
+            constexpr int kSamplesPerLight = 256;
+            std::size_t samples = 0;
+            std::size_t missingPoint = 0;
+            std::size_t missingSpot = 0;
+            std::size_t skippedFull = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const BenchLight& light = lights[i];
+                const bool spot = light.outerCos > -1.0F;
+                int accepted = 0;
+                for (int attempt = 0; attempt < kSamplesPerLight * 64 && accepted < kSamplesPerLight; ++attempt)
+                {
+                    const glm::vec3 offset{unit(rng), unit(rng), unit(rng)};
+                    const float offsetLength = glm::length(offset);
+                    if (offsetLength > 1.0F || offsetLength < 1.0e-4F)
+                    {
+                        continue;
+                    }
+                    if (spot && glm::dot(offset / offsetLength, light.direction) < light.outerCos)
+                    {
+                        continue;
+                    }
+                    ++accepted;
+                    std::size_t cluster = 0;
+                    if (!LightClusters::ClusterForPoint(viewProjection, light.position + offset * light.range, &cluster))
+                    {
+                        continue;
+                    }
+                    ++samples;
+                    if (clusters.ClusterHasLight(cluster, static_cast<std::uint32_t>(i)))
+                    {
+                        continue;
+                    }
+                    if (clusters.Clusters()[cluster].count >= LightClusters::kMaxLightsPerCluster)
+                    {
+                        ++skippedFull; // dropped by the per-cluster cap, reported as overflow
+                        continue;
+                    }
+                    ++(spot ? missingSpot : missingPoint);
+                }
+            }
+
+            const LightClusters::Stats& stats = clusters.GetStats();
+            std::ostringstream ss;
+            ss << "=== Light Cluster Benchmark ===\n"
+               << "  Lights:        " << count << " (" << stats.lightsVisible << " visible, half spots)\n"
+               << "  Build:         " << std::fixed << std::setprecision(1) << buildUs << " us\n"
+               << "  Clusters:      " << stats.occupiedClusters << " occupied, max " << stats.maxLightsInCluster
+               << " lights, " << stats.overflowClusters << " overflowed\n"
+               << "  Brute force:   " << samples << " samples, " << missingPoint << " point / " << missingSpot << " spot missing"
+               << (missingPoint + missingSpot == 0 ? "" : " (MISMATCH)");
+            if (skippedFull > 0)
+            {
+                ss << ", " << skippedFull << " in full clusters";
+            }
+            ss << "\n===============================";
+            return ss.str();
+        };
+
+        context.meshBenchmark = []() -> std::string {
+            // Source parse (+ mips and LODs) vs mapped .amesh read for every mesh under assets/meshes.
+            const std::filesystem::path root = std::filesystem::path("assets") / "meshes";
+            std::error_code ec;
+            if (!std::filesystem::is_directory(root, ec))
+            {
+                return "mesh_bench: assets/meshes not found";
+            }
+
+            int cookedCount = 0;
+            int sourceOnlyCount = 0;
+            double sourceMs = 0.0;
+            double cookedMs = 0.0;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(root, ec))
+            {
+                if (!entry.is_regular_file() || !engine::assets::MeshLibrary::IsCookable(entry.path()))
+                {
+                    continue;
+                }
+
+                const auto sourceStart = std::chrono::high_resolution_clock::now();
+                const engine::assets::MeshData source = engine::assets::MeshLibrary::LoadSourceFile(entry.path(), nullptr);
+                const auto sourceEnd = std::chrono::high_resolution_clock::now();
+                if (!source.loaded || !source.animationNames.empty() || !engine::assets::MeshLibrary::CookMeshFile(entry.path()))
+                {
+                    ++sourceOnlyCount;
+                    continue;
+                }
+
+                const auto cookedStart = std::chrono::high_resolution_clock::now();
+                std::uint64_t hash = 0;
+                engine::assets::MeshData cooked;
+                const bool ok = engine::assets::CookedMesh::HashFile(entry.path(), hash) &&
+                                engine::assets::CookedMesh::Read(engine::assets::CookedMesh::PathFor(entry.path()), hash, cooked);
+                const auto cookedEnd = std::chrono::high_resolution_clock::now();
+                if (!ok)
+                {
+                    ++sourceOnlyCount;
+                    continue;
+                }
+                ++cookedCount;
+                sourceMs += std::chrono::duration<double, std::milli>(sourceEnd - sourceStart).count();
+                cookedMs += std::chrono::duration<double, std::milli>(cookedEnd - cookedStart).count();
+            }
+
+            std::ostringstream ss;
+            ss << "=== Mesh Load Benchmark ===\n"
+               << "  Meshes:        " << cookedCount << " cooked, " << sourceOnlyCount << " source only (animated/failed)\n"
+               << "  Source load:   " << std::fixed << std::setprecision(2) << sourceMs << " ms\n"
+               << "  Cooked load:   " << std::fixed << std::setprecision(2) << cookedMs << " ms\n"
+               << "  Speedup:       " << std::fixed << std::setprecision(2) << (cookedMs > 0.0 ? sourceMs / cookedMs : 0.0) << "x\n"
+               << "===========================";
+            return ss.str();
+        };
+
         context.assetLoaderStats = []() -> std::string {
             auto& loader = engine::assets::AsyncAssetLoader::Instance();
             auto stats = loader.GetStats();
@@ -1515,18 +1707,54 @@ bool App::Run()
                << "  Total Loaded:  " << stats.totalLoaded << "\n"
                << "  Total Failed:  " << stats.totalFailed << "\n"
                << "  Loading Now:   " << stats.currentlyLoading << "\n"
-               << "  Pending Queue: " << stats.pendingInQueue << "\n"
+               << "  Pending Queue: " << stats.pendingInQueue << "\n";
+            const auto cache = engine::assets::AssetManager::Instance().GetStats();
+            constexpr double kMb = 1024.0 * 1024.0;
+            ss << "  Cached Meshes: " << cache.meshCount << " (" << std::fixed << std::setprecision(1)
+               << static_cast<double>(cache.meshBytes) / kMb << " MB)\n"
+               << "  Cached Tex:    " << cache.textureCount << " (" << std::fixed << std::setprecision(1)
+               << static_cast<double>(cache.textureBytes) / kMb << " MB)\n"
+               << "  Referenced:    " << cache.referencedCount << "\n"
+               << "  Evicted:       " << cache.evictedTotal << "\n"
                << "==========================";
             return ss.str();
         };
 
+        context.assetBudget = [](int megabytes) -> std::string {
+            auto& assets = engine::assets::AssetManager::Instance();
+            if (megabytes > 0)
+            {
+                assets.SetBudgetBytes(static_cast<std::size_t>(megabytes) * 1024U * 1024U);
+            }
+            return "Asset budget: " + std::to_string(assets.BudgetBytes() / (1024U * 1024U)) + " MB";
+        };
+
+        context.assetCook = [](bool force) -> std::string {
+            return engine::assets::AssetCooker().Run(force).Summary();
+        };
+
         m_console.Render(context, currentFps, hudState);
 
         {
             PROFILE_SCOPE("Swap");
+            render::RenderThread::Instance().AcquireContext();
             m_window.SwapBuffers();
         }
 
+        if (!startupReported)
+        {
+            startupReported = true;
+            const auto& pack = assets::AssetPack::Instance();
+            const render::ShaderCache::Stats shaders = render::ShaderCache::GetStats();
+            const double presentedMs = timeline.ElapsedMs();
+            timeline.Record("first_frame", firstFrameBegin, StartupTimeline::Clock::now());
+            timeline.Report();
+            std::cout << "[STARTUP] Main menu presented after " << std::fixed << std::setprecision(1) << presentedMs
+                      << " ms (" << (pack.IsMounted() ? "asset pack, " + std::to_string(pack.FileCount()) + " files" : std::string("loose assets"))
+                      << "; shaders " << shaders.milliseconds << " ms, " << shaders.cacheHits << " cached / " << shaders.compiled
+                      << " compiled)\n";
+        }
+
         profiler.EndFrame();
 
         const double frameEnd = glfwGetTime();
@@ -1576,6 +1804,8 @@ bool App::Run()
         }
     }
 
+    // Editor saves still on the background save thread must land before exit.
+    game::editor::LevelAssetIO::FlushSaves();
     TransitionNetworkState(NetworkState::Disconnecting, "Application shutdown");
     m_lanDiscovery.Stop();
     m_network.Shutdown();
@@ -1590,6 +1820,7 @@ bool App::Run()
     m_audio.Shutdown();
     m_wraithCloakRenderer.Shutdown();
     m_sceneFbo.Destroy();
+    assets::AssetManager::Instance().Clear();
     m_renderer.Shutdown();
     
     // Shutdown threading systems
@@ -1601,16 +1832,32 @@ bool App::Run()
     return true;
 }
 
+bool App::EnsureGameplayShaders()
+{
+    if (!m_wraithCloakRenderer.IsInitialized() && !m_wraithCloakInitFailed)
+    {
+        m_wraithCloakInitFailed = !m_wraithCloakRenderer.Initialize();
+        if (m_wraithCloakInitFailed)
+        {
+            std::cerr << "Warning: failed to initialize Wraith cloak renderer.\n";
+        }
+    }
+    return m_wraithCloakRenderer.IsInitialized();
+}
+
 void App::ResetToMainMenu()
 {
     StopTerrorRadiusAudio();
     m_audio.StopAll();
+    m_audio.UnloadBank("match");
     m_debugAudioLoops.clear();
     m_sessionAmbienceLoop = 0;
 
     TransitionNetworkState(NetworkState::Disconnecting, "Reset to main menu");
     m_lanDiscovery.Stop();
     m_network.Disconnect();
+    m_replicationPeers.clear();
+    m_remotePlayerPeer = net::NetworkSession::kInvalidPeer;
     m_gameplay.SetNetworkAuthorityMode(false);
     m_gameplay.ClearRemoteRoleCommands();
 
@@ -1664,6 +1911,7 @@ void App::StartMatchFromLobbyMultiplayer(const std::string& mapName, const std::
     m_settingsOpenedFromPause = false;
     m_audio.StopAll();
     m_debugAudioLoops.clear();
+    (void)m_audio.LoadBankFile("match");
     m_sessionAmbienceLoop = m_audio.PlayLoop("ambience_loop", audio::AudioSystem::Bus::Ambience);
     (void)LoadTerrorRadiusProfile("default_killer");
 
@@ -1739,6 +1987,7 @@ void App::StartSoloSession(const std::string& mapName, const std::string& roleNa
     m_serverGameplayValues = false;
     m_audio.StopAll();
     m_debugAudioLoops.clear();
+    (void)m_audio.LoadBankFile("match");
     m_sessionAmbienceLoop = m_audio.PlayLoop("ambience_loop", audio::AudioSystem::Bus::Ambience);
     (void)LoadTerrorRadiusProfile("default_killer");
 
@@ -1808,6 +2057,7 @@ bool App::StartHostSession(const std::string& mapName, const std::string& roleNa
     m_serverGameplayValues = false;
     m_audio.StopAll();
     m_debugAudioLoops.clear();
+    (void)m_audio.LoadBankFile("match");
     m_sessionAmbienceLoop = m_audio.PlayLoop("ambience_loop", audio::AudioSystem::Bus::Ambience);
     (void)LoadTerrorRadiusProfile("default_killer");
 
@@ -1869,6 +2119,7 @@ bool App::StartJoinSession(const std::string& ip, std::uint16_t port, const std:
     m_serverGameplayValues = false;
     m_audio.StopAll();
     m_debugAudioLoops.clear();
+    (void)m_audio.LoadBankFile("match");
     m_sessionAmbienceLoop = m_audio.PlayLoop("ambience_loop", audio::AudioSystem::Bus::Ambience);
     (void)LoadTerrorRadiusProfile("default_killer");
 
@@ -1911,7 +2162,8 @@ void App::PollNetwork()
                 TransitionNetworkState(NetworkState::HostListening, "Client connected, waiting for HELLO");
                 m_remotePlayer.connected = true;
                 m_remotePlayer.lastSnapshotSeconds = glfwGetTime();
-                AppendNetworkLog("Peer connected: remote player slot reserved.");
+                m_replicationPeers[event->peerId] = PeerReplicationState{};
+                AppendNetworkLog("Peer connected: remote player slot reserved (peer " + std::to_string(event->peerId) + ").");
             }
             else if (m_multiplayerMode == MultiplayerMode::Client)
             {
@@ -1921,7 +2173,7 @@ void App::PollNetwork()
                 AppendNetworkLog("Client transport connected. Sending HELLO packet.");
 
                 std::vector<std::uint8_t> hello;
-                if (SerializeHello(m_preferredJoinRole, hello))
+                if (game::net::SerializeHello(m_preferredJoinRole, m_sessionMapName, m_roleSelectionPlayerName, hello))
                 {
                     m_network.SendReliable(hello.data(), hello.size());
                 }
@@ -1949,6 +2201,14 @@ void App::PollNetwork()
 
             if (m_multiplayerMode == MultiplayerMode::Host)
             {
+                m_replicationPeers.erase(event->peerId);
+                if (event->peerId != m_remotePlayerPeer && m_remotePlayerPeer != net::NetworkSession::kInvalidPeer)
+                {
+                    // An extra spectator/survivor left; the bound remote pawn keeps playing.
+                    AppendNetworkLog("Peer " + std::to_string(event->peerId) + " disconnected.");
+                    continue;
+                }
+                m_remotePlayerPeer = net::NetworkSession::kInvalidPeer;
                 m_menuNetStatus = "Client disconnected.";
                 m_gameplay.ClearRemoteRoleCommands();
                 m_lanDiscovery.UpdateHostInfo(m_sessionMapName, 1, 2, PrimaryLocalIp());
@@ -1962,12 +2222,12 @@ void App::PollNetwork()
 
         if (!event->payload.empty())
         {
-            HandleNetworkPacket(event->payload);
+            HandleNetworkPacket(event->payload, event->peerId);
         }
     }
 }
 
-void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload)
+void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload, net::NetworkSession::PeerId fromPeer)
 {
     if (payload.empty())
     {
@@ -1976,35 +2236,18 @@ void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload)
 
     if (payload[0] == kPacketRoleInput && m_multiplayerMode == MultiplayerMode::Host)
     {
-        NetRoleInputPacket inputPacket;
-        if (!DeserializeRoleInput(payload, inputPacket))
+        // Only the peer bound to the remote pawn drives it; spectators and other peers are ignored.
+        if (fromPeer != m_remotePlayerPeer)
+        {
+            return;
+        }
+        game::net::RoleInputPacket inputPacket;
+        if (!game::net::DeserializeRoleInput(payload, inputPacket))
         {
             return;
         }
 
-        game::gameplay::GameplaySystems::RoleCommand command;
-        command.moveAxis = glm::vec2{
-            static_cast<float>(inputPacket.moveX) / 100.0F,
-            static_cast<float>(inputPacket.moveY) / 100.0F,
-        };
-        command.lookDelta = glm::vec2{inputPacket.lookX, inputPacket.lookY};
-        command.sprinting = (inputPacket.buttons & kButtonSprint) != 0;
-        command.interactPressed = (inputPacket.buttons & kButtonInteractPressed) != 0;
-        command.interactHeld = (inputPacket.buttons & kButtonInteractHeld) != 0;
-        command.attackPressed = (inputPacket.buttons & kButtonAttackPressed) != 0;
-        command.attackHeld = (inputPacket.buttons & kButtonAttackHeld) != 0;
-        command.attackReleased = (inputPacket.buttons & kButtonAttackReleased) != 0;
-        command.lungeHeld = (inputPacket.buttons & kButtonLungeHeld) != 0;
-        command.jumpPressed = (inputPacket.buttons & kButtonJumpPressed) != 0;
-        command.crouchHeld = (inputPacket.buttons & kButtonCrouchHeld) != 0;
-        command.useAltPressed = (inputPacket.buttons & kButtonUseAltPressed) != 0;
-        command.useAltHeld = (inputPacket.buttons & kButtonUseAltHeld) != 0;
-        command.useAltReleased = (inputPacket.buttons & kButtonUseAltReleased) != 0;
-        command.dropItemPressed = (inputPacket.buttons & kButtonDropItemPressed) != 0;
-        command.pickupItemPressed = (inputPacket.buttons & kButtonPickupItemPressed) != 0;
-        command.wiggleLeftPressed = (inputPacket.buttons & kButtonWiggleLeftPressed) != 0;
-        command.wiggleRightPressed = (inputPacket.buttons & kButtonWiggleRightPressed) != 0;
-
+        const game::gameplay::GameplaySystems::RoleCommand command = game::net::RoleCommandFromInput(inputPacket);
         const engine::scene::Role remoteRole = m_remoteRoleName == "survivor" ? engine::scene::Role::Survivor : engine::scene::Role::Killer;
         m_gameplay.SetRemoteRoleCommand(remoteRole, command);
         m_remotePlayer.lastInputSeconds = glfwGetTime();
@@ -2030,7 +2273,7 @@ void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload)
         int protocolVersion = 0;
         std::string buildId;
         std::string playerName;
-        if (!DeserializeHello(payload, requestedRole, requestedMap, protocolVersion, buildId, playerName))
+        if (!game::net::DeserializeHello(payload, requestedRole, requestedMap, protocolVersion, buildId, playerName))
         {
             return;
         }
@@ -2041,9 +2284,9 @@ void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload)
             const std::string reason =
                 "Version mismatch: client " + std::to_string(protocolVersion) + "/" + buildId +
                 ", server " + std::to_string(kProtocolVersion) + "/" + std::string(kBuildId);
-            if (SerializeReject(reason, reject))
+            if (game::net::SerializeReject(reason, reject))
             {
-                m_network.SendReliable(reject.data(), reject.size());
+                m_network.SendReliableTo(fromPeer, reject.data(), reject.size());
             }
             m_lastNetworkError = reason;
             TransitionNetworkState(NetworkState::Error, reason, true);
@@ -2055,9 +2298,9 @@ void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload)
         {
             std::vector<std::uint8_t> reject;
             const std::string reason = "Role " + requestedRole + " is full (4 survivors max, 1 killer max)";
-            if (SerializeReject(reason, reject))
+            if (game::net::SerializeReject(reason, reject))
             {
-                m_network.SendReliable(reject.data(), reject.size());
+                m_network.SendReliableTo(fromPeer, reject.data(), reject.size());
             }
             m_lastNetworkError = reason;
             AppendNetworkLog("Rejected client: " + reason);
@@ -2082,14 +2325,37 @@ void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload)
         // Update host's own UI to show new player
         ApplyLobbyStateToUi(m_lobbyState);
 
-        RequestRoleChange(requestedRole, true);
+        const bool bindsRemotePawn = m_remotePlayerPeer == net::NetworkSession::kInvalidPeer || m_remotePlayerPeer == fromPeer;
+        PeerReplicationState& replication = m_replicationPeers[fromPeer];
+        replication.netId = newPlayer.netId;
+        replication.handshaken = true;
+        if (bindsRemotePawn)
+        {
+            m_remotePlayerPeer = fromPeer;
+            RequestRoleChange(requestedRole, true);
+        }
+        else
+        {
+            // Gameplay has a single pawn per role today; extra survivors get their own slot
+            // (resolving to no pawn yet) and spectate, with relevancy centered on the survivor pawn.
+            replication.role = engine::scene::Role::Survivor;
+            std::uint8_t slot = 1;
+            for (const auto& [otherPeer, other] : m_replicationPeers)
+            {
+                if (otherPeer != fromPeer && other.handshaken && other.role == engine::scene::Role::Survivor)
+                {
+                    slot = static_cast<std::uint8_t>(std::max<int>(slot, other.slot + 1));
+                }
+            }
+            replication.slot = slot;
+        }
         SendGameplayTuningToClient();
         
         // Send lobby state to the new client with THEIR localPlayerNetId
         std::vector<std::uint8_t> dataForNewClient;
         if (SerializeLobbyState(stateForNewClient, dataForNewClient))
         {
-            m_network.SendReliable(dataForNewClient.data(), dataForNewClient.size());
+            m_network.SendReliableTo(fromPeer, dataForNewClient.data(), dataForNewClient.size());
             AppendNetworkLog("Sent lobby state to new client (netId=" + std::to_string(newPlayer.netId) + ")");
         }
         
@@ -2106,7 +2372,7 @@ void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload)
     if (payload[0] == kPacketReject && m_multiplayerMode == MultiplayerMode::Client)
     {
         std::string reason;
-        if (!DeserializeReject(payload, reason))
+        if (!game::net::DeserializeReject(payload, reason))
         {
             reason = "Handshake rejected by host";
         }
@@ -2129,7 +2395,7 @@ void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload)
     if (payload[0] == kPacketSnapshot && m_multiplayerMode == MultiplayerMode::Client)
     {
         game::gameplay::GameplaySystems::Snapshot snapshot;
-        if (!DeserializeSnapshot(payload, snapshot))
+        if (!game::net::DeserializeSnapshot(payload, snapshot))
         {
             return;
         }
@@ -2152,7 +2418,7 @@ void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload)
         const game::gameplay::GameplaySystems::MapType previousMapType = m_sessionMapType;
         const unsigned int previousSeed = m_sessionSeed;
 
-        if (!DeserializeAssignRole(payload, roleByte, mapType, seed))
+        if (!game::net::DeserializeAssignRole(payload, roleByte, mapType, seed))
         {
             return;
         }
@@ -2194,7 +2460,7 @@ void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload)
     if (payload[0] == kPacketFxSpawn && m_multiplayerMode == MultiplayerMode::Client)
     {
         engine::fx::FxSpawnEvent event;
-        if (!DeserializeFxSpawnEvent(payload, event))
+        if (!game::net::DeserializeFxSpawnEvent(payload, event))
         {
             return;
         }
@@ -2206,7 +2472,7 @@ void App::HandleNetworkPacket(const std::vector<std::uint8_t>& payload)
     if (payload[0] == kPacketGameplayTuning && m_multiplayerMode == MultiplayerMode::Client)
     {
         game::gameplay::GameplaySystems::GameplayTuning tuning = m_gameplayEditing;
-        if (!DeserializeGameplayTuning(payload, tuning))
+        if (!game::net::DeserializeGameplayTuning(payload, tuning))
         {
             return;
         }
@@ -2279,7 +2545,8 @@ void App::SendClientInput(const engine::platform::Input& input, bool controlsEna
         return;
     }
 
-    NetRoleInputPacket packet;
+    game::net::RoleInputPacket packet;
+    packet.viewTick = m_gameplay.ClientViewTick();
 
     if (controlsEnabled)
     {
@@ -2358,7 +2625,7 @@ void App::SendClientInput(const engine::platform::Input& input, bool controlsEna
     }
 
     std::vector<std::uint8_t> data;
-    if (!SerializeRoleInput(packet, data))
+    if (!game::net::SerializeRoleInput(packet, data))
     {
         return;
     }
@@ -2379,764 +2646,85 @@ void App::SendHostSnapshot()
     m_sessionMapType = snapshot.mapType;
     m_sessionSeed = snapshot.seed;
     m_sessionMapName = MapTypeToName(snapshot.mapType);
-    std::vector<std::uint8_t> data;
-    if (!SerializeSnapshot(snapshot, data))
-    {
-        return;
-    }
-
-    m_network.SendReliable(data.data(), data.size());
-    m_lastSnapshotSentSeconds = glfwGetTime();
-    m_remotePlayer.lastSnapshotSeconds = m_lastSnapshotSentSeconds;
-}
-
-void App::SendGameplayTuningToClient()
-{
-    if (m_multiplayerMode != MultiplayerMode::Host || !m_network.IsConnected())
-    {
-        return;
-    }
-
-    std::vector<std::uint8_t> payload;
-    if (!SerializeGameplayTuning(m_gameplayApplied, payload))
-    {
-        return;
-    }
-    m_network.SendReliable(payload.data(), payload.size());
-}
 
-bool App::SerializeRoleInput(const NetRoleInputPacket& packet, std::vector<std::uint8_t>& outBuffer)
-{
-    outBuffer.clear();
-    outBuffer.reserve(1 + sizeof(NetRoleInputPacket));
-
-    AppendValue(outBuffer, kPacketRoleInput);
-    AppendValue(outBuffer, packet.moveX);
-    AppendValue(outBuffer, packet.moveY);
-    AppendValue(outBuffer, packet.lookX);
-    AppendValue(outBuffer, packet.lookY);
-    AppendValue(outBuffer, packet.buttons);
-    return true;
-}
-
-bool App::DeserializeRoleInput(const std::vector<std::uint8_t>& buffer, NetRoleInputPacket& outPacket)
-{
-    std::size_t offset = 0;
-    std::uint8_t type = 0;
-    if (!ReadValue(buffer, offset, type) || type != kPacketRoleInput)
+    // One stream per client, filtered by what that client can use. Clients whose filtered
+    // snapshot encodes identically share one buffer and one ref-counted ENet packet.
+    struct EncodedSnapshot
     {
-        return false;
-    }
-
-    return ReadValue(buffer, offset, outPacket.moveX) &&
-           ReadValue(buffer, offset, outPacket.moveY) &&
-           ReadValue(buffer, offset, outPacket.lookX) &&
-           ReadValue(buffer, offset, outPacket.lookY) &&
-           ReadValue(buffer, offset, outPacket.buttons);
-}
-
-bool App::SerializeSnapshot(const game::gameplay::GameplaySystems::Snapshot& snapshot, std::vector<std::uint8_t>& outBuffer) const
-{
-    outBuffer.clear();
-
-    AppendValue(outBuffer, kPacketSnapshot);
-    AppendValue(outBuffer, MapTypeToByte(snapshot.mapType));
-    AppendValue(outBuffer, snapshot.seed);
-
-    auto writePerks = [&](const std::array<std::string, 3>& perkIds) {
-        for (const auto& perkId : perkIds)
-        {
-            const std::uint16_t length = static_cast<std::uint16_t>(std::min<std::size_t>(perkId.size(), 256));
-            AppendValue(outBuffer, length);
-            outBuffer.insert(outBuffer.end(), perkId.begin(), perkId.begin() + length);
-        }
-    };
-
-    writePerks(snapshot.survivorPerkIds);
-    writePerks(snapshot.killerPerkIds);
-
-    auto writeString = [&](const std::string& value, std::uint16_t maxLen) {
-        const std::uint16_t length = static_cast<std::uint16_t>(std::min<std::size_t>(value.size(), maxLen));
-        AppendValue(outBuffer, length);
-        outBuffer.insert(outBuffer.end(), value.begin(), value.begin() + length);
-    };
-
-    writeString(snapshot.survivorCharacterId, 128);
-    writeString(snapshot.killerCharacterId, 128);
-    writeString(snapshot.survivorItemId, 128);
-    writeString(snapshot.survivorItemAddonA, 128);
-    writeString(snapshot.survivorItemAddonB, 128);
-    writeString(snapshot.killerPowerId, 128);
-    writeString(snapshot.killerPowerAddonA, 128);
-    writeString(snapshot.killerPowerAddonB, 128);
-
-    auto writeActor = [&](const game::gameplay::GameplaySystems::ActorSnapshot& actor) {
-        AppendValue(outBuffer, actor.position.x);
-        AppendValue(outBuffer, actor.position.y);
-        AppendValue(outBuffer, actor.position.z);
-        AppendValue(outBuffer, actor.forward.x);
-        AppendValue(outBuffer, actor.forward.y);
-        AppendValue(outBuffer, actor.forward.z);
-        AppendValue(outBuffer, actor.velocity.x);
-        AppendValue(outBuffer, actor.velocity.y);
-        AppendValue(outBuffer, actor.velocity.z);
-        AppendValue(outBuffer, actor.yaw);
-        AppendValue(outBuffer, actor.pitch);
-    };
-
-    writeActor(snapshot.survivor);
-    writeActor(snapshot.killer);
-
-    AppendValue(outBuffer, snapshot.survivorState);
-    AppendValue(outBuffer, snapshot.killerAttackState);
-    AppendValue(outBuffer, snapshot.killerAttackStateTimer);
-    AppendValue(outBuffer, snapshot.killerLungeCharge);
-    AppendValue(outBuffer, static_cast<std::uint8_t>(snapshot.chaseActive ? 1 : 0));
-    AppendValue(outBuffer, snapshot.chaseDistance);
-    AppendValue(outBuffer, static_cast<std::uint8_t>(snapshot.chaseLos ? 1 : 0));
-    AppendValue(outBuffer, static_cast<std::uint8_t>(snapshot.chaseInCenterFOV ? 1 : 0));
-    AppendValue(outBuffer, snapshot.chaseTimeSinceLOS);
-    AppendValue(outBuffer, snapshot.chaseTimeSinceCenterFOV);
-    AppendValue(outBuffer, snapshot.chaseTimeInChase);
-    AppendValue(outBuffer, snapshot.bloodlustTier);
-    AppendValue(outBuffer, snapshot.survivorItemCharges);
-    AppendValue(outBuffer, snapshot.survivorItemActive);
-    AppendValue(outBuffer, snapshot.survivorItemUsesRemaining);
-    AppendValue(outBuffer, snapshot.wraithCloaked);
-    AppendValue(outBuffer, snapshot.wraithTransitionTimer);
-    AppendValue(outBuffer, snapshot.wraithPostUncloakTimer);
-    AppendValue(outBuffer, snapshot.killerBlindTimer);
-    AppendValue(outBuffer, snapshot.killerBlindStyleWhite);
-    AppendValue(outBuffer, snapshot.carriedTrapCount);
-
-    const std::uint16_t palletCount = static_cast<std::uint16_t>(std::min<std::size_t>(snapshot.pallets.size(), 1024));
-    AppendValue(outBuffer, palletCount);
-    for (std::size_t i = 0; i < palletCount; ++i)
-    {
-        const auto& pallet = snapshot.pallets[i];
-        AppendValue(outBuffer, pallet.entity);
-        AppendValue(outBuffer, pallet.state);
-        AppendValue(outBuffer, pallet.breakTimer);
-        AppendValue(outBuffer, pallet.position.x);
-        AppendValue(outBuffer, pallet.position.y);
-        AppendValue(outBuffer, pallet.position.z);
-        AppendValue(outBuffer, pallet.halfExtents.x);
-        AppendValue(outBuffer, pallet.halfExtents.y);
-        AppendValue(outBuffer, pallet.halfExtents.z);
-    }
-
-    const std::uint16_t trapCount = static_cast<std::uint16_t>(std::min<std::size_t>(snapshot.traps.size(), 1024));
-    AppendValue(outBuffer, trapCount);
-    for (std::size_t i = 0; i < trapCount; ++i)
-    {
-        const auto& trap = snapshot.traps[i];
-        AppendValue(outBuffer, trap.entity);
-        AppendValue(outBuffer, trap.state);
-        AppendValue(outBuffer, trap.trappedEntity);
-        AppendValue(outBuffer, trap.position.x);
-        AppendValue(outBuffer, trap.position.y);
-        AppendValue(outBuffer, trap.position.z);
-        AppendValue(outBuffer, trap.halfExtents.x);
-        AppendValue(outBuffer, trap.halfExtents.y);
-        AppendValue(outBuffer, trap.halfExtents.z);
-        AppendValue(outBuffer, trap.escapeChance);
-        AppendValue(outBuffer, trap.escapeAttempts);
-        AppendValue(outBuffer, trap.maxEscapeAttempts);
-    }
-
-    const std::uint16_t groundItemCount = static_cast<std::uint16_t>(std::min<std::size_t>(snapshot.groundItems.size(), 1024));
-    AppendValue(outBuffer, groundItemCount);
-    for (std::size_t i = 0; i < groundItemCount; ++i)
-    {
-        const auto& groundItem = snapshot.groundItems[i];
-        AppendValue(outBuffer, groundItem.entity);
-        AppendValue(outBuffer, groundItem.position.x);
-        AppendValue(outBuffer, groundItem.position.y);
-        AppendValue(outBuffer, groundItem.position.z);
-        AppendValue(outBuffer, groundItem.charges);
-        writeString(groundItem.itemId, 128);
-        writeString(groundItem.addonAId, 128);
-        writeString(groundItem.addonBId, 128);
-    }
-
-    return true;
-}
-
-bool App::DeserializeSnapshot(const std::vector<std::uint8_t>& buffer, game::gameplay::GameplaySystems::Snapshot& outSnapshot) const
-{
-    std::size_t offset = 0;
-    std::uint8_t type = 0;
-    std::uint8_t mapTypeByte = 0;
-
-    if (!ReadValue(buffer, offset, type) || type != kPacketSnapshot)
-    {
-        return false;
-    }
-
-    if (!ReadValue(buffer, offset, mapTypeByte))
-    {
-        return false;
-    }
-
-    outSnapshot.mapType = ByteToMapType(mapTypeByte);
-    if (!ReadValue(buffer, offset, outSnapshot.seed))
-    {
-        return false;
-    }
-
-    auto readPerks = [&](std::array<std::string, 3>& perkIds) {
-        for (int i = 0; i < 3; ++i)
-        {
-            std::uint16_t length = 0;
-            if (!ReadValue(buffer, offset, length))
-            {
-                return false;
-            }
-            if (offset + length > buffer.size())
-            {
-                return false;
-            }
-            perkIds[i].assign(reinterpret_cast<const char*>(buffer.data() + offset), length);
-            offset += length;
-        }
-        return true;
+        std::vector<std::uint8_t> data;
+        std::vector<net::NetworkSession::PeerId> peers;
     };
+    std::vector<EncodedSnapshot> encoded;
+    encoded.reserve(m_replicationPeers.size());
+    std::vector<std::uint8_t> data;
 
-    if (!readPerks(outSnapshot.survivorPerkIds) || !readPerks(outSnapshot.killerPerkIds))
+    m_snapshotBytesLastTick = 0;
+    for (auto& [peerId, replication] : m_replicationPeers)
     {
-        return false;
-    }
-
-    auto readString = [&](std::string& outValue) {
-        std::uint16_t length = 0;
-        if (!ReadValue(buffer, offset, length))
+        if (!replication.handshaken)
         {
-            return false;
+            continue;
         }
-        if (offset + length > buffer.size())
+        if (peerId == m_remotePlayerPeer)
         {
-            return false;
+            replication.role = m_remoteRoleName == "killer" ? engine::scene::Role::Killer : engine::scene::Role::Survivor;
+            replication.slot = 0;
         }
-        outValue.assign(reinterpret_cast<const char*>(buffer.data() + offset), length);
-        offset += length;
-        return true;
-    };
 
-    if (!readString(outSnapshot.survivorCharacterId) ||
-        !readString(outSnapshot.killerCharacterId) ||
-        !readString(outSnapshot.survivorItemId) ||
-        !readString(outSnapshot.survivorItemAddonA) ||
-        !readString(outSnapshot.survivorItemAddonB) ||
-        !readString(outSnapshot.killerPowerId) ||
-        !readString(outSnapshot.killerPowerAddonA) ||
-        !readString(outSnapshot.killerPowerAddonB))
-    {
-        return false;
-    }
-
-    auto readActor = [&](game::gameplay::GameplaySystems::ActorSnapshot& actor) {
-        return ReadValue(buffer, offset, actor.position.x) &&
-               ReadValue(buffer, offset, actor.position.y) &&
-               ReadValue(buffer, offset, actor.position.z) &&
-               ReadValue(buffer, offset, actor.forward.x) &&
-               ReadValue(buffer, offset, actor.forward.y) &&
-               ReadValue(buffer, offset, actor.forward.z) &&
-               ReadValue(buffer, offset, actor.velocity.x) &&
-               ReadValue(buffer, offset, actor.velocity.y) &&
-               ReadValue(buffer, offset, actor.velocity.z) &&
-               ReadValue(buffer, offset, actor.yaw) &&
-               ReadValue(buffer, offset, actor.pitch);
-    };
-
-    if (!readActor(outSnapshot.survivor) || !readActor(outSnapshot.killer))
-    {
-        return false;
-    }
-
-    std::uint8_t chaseActiveByte = 0;
-    std::uint8_t chaseLosByte = 0;
-    std::uint8_t chaseInCenterFOVByte = 0;
-    if (!ReadValue(buffer, offset, outSnapshot.survivorState) ||
-        !ReadValue(buffer, offset, outSnapshot.killerAttackState) ||
-        !ReadValue(buffer, offset, outSnapshot.killerAttackStateTimer) ||
-        !ReadValue(buffer, offset, outSnapshot.killerLungeCharge) ||
-        !ReadValue(buffer, offset, chaseActiveByte) ||
-        !ReadValue(buffer, offset, outSnapshot.chaseDistance) ||
-        !ReadValue(buffer, offset, chaseLosByte) ||
-        !ReadValue(buffer, offset, chaseInCenterFOVByte) ||
-        !ReadValue(buffer, offset, outSnapshot.chaseTimeSinceLOS) ||
-        !ReadValue(buffer, offset, outSnapshot.chaseTimeSinceCenterFOV) ||
-        !ReadValue(buffer, offset, outSnapshot.chaseTimeInChase) ||
-        !ReadValue(buffer, offset, outSnapshot.bloodlustTier) ||
-        !ReadValue(buffer, offset, outSnapshot.survivorItemCharges) ||
-        !ReadValue(buffer, offset, outSnapshot.survivorItemActive) ||
-        !ReadValue(buffer, offset, outSnapshot.survivorItemUsesRemaining) ||
-        !ReadValue(buffer, offset, outSnapshot.wraithCloaked) ||
-        !ReadValue(buffer, offset, outSnapshot.wraithTransitionTimer) ||
-        !ReadValue(buffer, offset, outSnapshot.wraithPostUncloakTimer) ||
-        !ReadValue(buffer, offset, outSnapshot.killerBlindTimer) ||
-        !ReadValue(buffer, offset, outSnapshot.killerBlindStyleWhite) ||
-        !ReadValue(buffer, offset, outSnapshot.carriedTrapCount))
-    {
-        return false;
-    }
-
-    outSnapshot.chaseActive = chaseActiveByte != 0;
-    outSnapshot.chaseLos = chaseLosByte != 0;
-    outSnapshot.chaseInCenterFOV = chaseInCenterFOVByte != 0;
-
-    std::uint16_t palletCount = 0;
-    if (!ReadValue(buffer, offset, palletCount))
-    {
-        return false;
-    }
-
-    outSnapshot.pallets.clear();
-    outSnapshot.pallets.reserve(palletCount);
-
-    for (std::uint16_t i = 0; i < palletCount; ++i)
-    {
-        game::gameplay::GameplaySystems::PalletSnapshot pallet;
-        if (!ReadValue(buffer, offset, pallet.entity) ||
-            !ReadValue(buffer, offset, pallet.state) ||
-            !ReadValue(buffer, offset, pallet.breakTimer) ||
-            !ReadValue(buffer, offset, pallet.position.x) ||
-            !ReadValue(buffer, offset, pallet.position.y) ||
-            !ReadValue(buffer, offset, pallet.position.z) ||
-            !ReadValue(buffer, offset, pallet.halfExtents.x) ||
-            !ReadValue(buffer, offset, pallet.halfExtents.y) ||
-            !ReadValue(buffer, offset, pallet.halfExtents.z))
+        game::gameplay::GameplaySystems::ReplicationViewer viewer;
+        viewer.role = replication.role;
+        viewer.slot = replication.slot;
+        viewer.sequence = replication.snapshotSequence++;
+        if (!game::net::SerializeSnapshot(m_gameplay.FilterSnapshotForViewer(snapshot, viewer), data))
         {
-            return false;
+            continue;
         }
 
-        outSnapshot.pallets.push_back(pallet);
-    }
-
-    std::uint16_t trapCount = 0;
-    if (!ReadValue(buffer, offset, trapCount))
-    {
-        return false;
-    }
-    outSnapshot.traps.clear();
-    outSnapshot.traps.reserve(trapCount);
-    for (std::uint16_t i = 0; i < trapCount; ++i)
-    {
-        game::gameplay::GameplaySystems::TrapSnapshot trap;
-        if (!ReadValue(buffer, offset, trap.entity) ||
-            !ReadValue(buffer, offset, trap.state) ||
-            !ReadValue(buffer, offset, trap.trappedEntity) ||
-            !ReadValue(buffer, offset, trap.position.x) ||
-            !ReadValue(buffer, offset, trap.position.y) ||
-            !ReadValue(buffer, offset, trap.position.z) ||
-            !ReadValue(buffer, offset, trap.halfExtents.x) ||
-            !ReadValue(buffer, offset, trap.halfExtents.y) ||
-            !ReadValue(buffer, offset, trap.halfExtents.z) ||
-            !ReadValue(buffer, offset, trap.escapeChance) ||
-            !ReadValue(buffer, offset, trap.escapeAttempts) ||
-            !ReadValue(buffer, offset, trap.maxEscapeAttempts))
-        {
-            return false;
-        }
-        outSnapshot.traps.push_back(trap);
-    }
+        replication.lastSnapshotBytes = data.size();
+        replication.snapshotBytesSent += data.size();
+        m_snapshotBytesLastTick += data.size();
 
-    std::uint16_t groundItemCount = 0;
-    if (!ReadValue(buffer, offset, groundItemCount))
-    {
-        return false;
-    }
-    outSnapshot.groundItems.clear();
-    outSnapshot.groundItems.reserve(groundItemCount);
-    for (std::uint16_t i = 0; i < groundItemCount; ++i)
-    {
-        game::gameplay::GameplaySystems::GroundItemSnapshot groundItem;
-        if (!ReadValue(buffer, offset, groundItem.entity) ||
-            !ReadValue(buffer, offset, groundItem.position.x) ||
-            !ReadValue(buffer, offset, groundItem.position.y) ||
-            !ReadValue(buffer, offset, groundItem.position.z) ||
-            !ReadValue(buffer, offset, groundItem.charges))
+        const auto sameIt = std::find_if(encoded.begin(), encoded.end(), [&](const EncodedSnapshot& entry) {
+            return entry.data == data;
+        });
+        if (sameIt != encoded.end())
         {
-            return false;
+            sameIt->peers.push_back(peerId);
         }
-        if (!readString(groundItem.itemId) ||
-            !readString(groundItem.addonAId) ||
-            !readString(groundItem.addonBId))
+        else
         {
-            return false;
+            encoded.push_back(EncodedSnapshot{data, {peerId}});
         }
-        outSnapshot.groundItems.push_back(groundItem);
-    }
-
-    return true;
-}
-
-bool App::SerializeGameplayTuning(
-    const game::gameplay::GameplaySystems::GameplayTuning& tuning,
-    std::vector<std::uint8_t>& outBuffer
-) const
-{
-    outBuffer.clear();
-    AppendValue(outBuffer, kPacketGameplayTuning);
-    AppendValue(outBuffer, tuning.assetVersion);
-    AppendValue(outBuffer, tuning.survivorWalkSpeed);
-    AppendValue(outBuffer, tuning.survivorSprintSpeed);
-    AppendValue(outBuffer, tuning.survivorCrouchSpeed);
-    AppendValue(outBuffer, tuning.survivorCrawlSpeed);
-    AppendValue(outBuffer, tuning.killerMoveSpeed);
-    AppendValue(outBuffer, tuning.survivorCapsuleRadius);
-    AppendValue(outBuffer, tuning.survivorCapsuleHeight);
-    AppendValue(outBuffer, tuning.killerCapsuleRadius);
-    AppendValue(outBuffer, tuning.killerCapsuleHeight);
-    AppendValue(outBuffer, tuning.terrorRadiusMeters);
-    AppendValue(outBuffer, tuning.terrorRadiusChaseMeters);
-    AppendValue(outBuffer, tuning.vaultSlowTime);
-    AppendValue(outBuffer, tuning.vaultMediumTime);
-    AppendValue(outBuffer, tuning.vaultFastTime);
-    AppendValue(outBuffer, tuning.fastVaultDotThreshold);
-    AppendValue(outBuffer, tuning.fastVaultSpeedMultiplier);
-    AppendValue(outBuffer, tuning.fastVaultMinRunup);
-    AppendValue(outBuffer, tuning.shortAttackRange);
-    AppendValue(outBuffer, tuning.shortAttackAngleDegrees);
-    AppendValue(outBuffer, tuning.lungeHoldMinSeconds);
-    AppendValue(outBuffer, tuning.lungeDurationSeconds);
-    AppendValue(outBuffer, tuning.lungeRecoverSeconds);
-    AppendValue(outBuffer, tuning.shortRecoverSeconds);
-    AppendValue(outBuffer, tuning.missRecoverSeconds);
-    AppendValue(outBuffer, tuning.lungeSpeedStart);
-    AppendValue(outBuffer, tuning.lungeSpeedEnd);
-    AppendValue(outBuffer, tuning.healDurationSeconds);
-    AppendValue(outBuffer, tuning.skillCheckMinInterval);
-    AppendValue(outBuffer, tuning.skillCheckMaxInterval);
-    AppendValue(outBuffer, tuning.generatorRepairSecondsBase);
-    AppendValue(outBuffer, tuning.medkitFullHealCharges);
-    AppendValue(outBuffer, tuning.medkitHealSpeedMultiplier);
-    AppendValue(outBuffer, tuning.toolboxCharges);
-    AppendValue(outBuffer, tuning.toolboxChargeDrainPerSecond);
-    AppendValue(outBuffer, tuning.toolboxRepairSpeedBonus);
-    AppendValue(outBuffer, tuning.flashlightMaxUseSeconds);
-    AppendValue(outBuffer, tuning.flashlightBlindBuildSeconds);
-    AppendValue(outBuffer, tuning.flashlightBlindDurationSeconds);
-    AppendValue(outBuffer, tuning.flashlightBeamRange);
-    AppendValue(outBuffer, tuning.flashlightBeamAngleDegrees);
-    AppendValue(outBuffer, tuning.flashlightBlindStyle);
-    AppendValue(outBuffer, tuning.mapChannelSeconds);
-    AppendValue(outBuffer, tuning.mapUses);
-    AppendValue(outBuffer, tuning.mapRevealRangeMeters);
-    AppendValue(outBuffer, tuning.mapRevealDurationSeconds);
-    AppendValue(outBuffer, tuning.trapperStartCarryTraps);
-    AppendValue(outBuffer, tuning.trapperMaxCarryTraps);
-    AppendValue(outBuffer, tuning.trapperGroundSpawnTraps);
-    AppendValue(outBuffer, tuning.trapperSetTrapSeconds);
-    AppendValue(outBuffer, tuning.trapperDisarmSeconds);
-    AppendValue(outBuffer, tuning.trapEscapeBaseChance);
-    AppendValue(outBuffer, tuning.trapEscapeChanceStep);
-    AppendValue(outBuffer, tuning.trapEscapeChanceMax);
-    AppendValue(outBuffer, tuning.trapKillerStunSeconds);
-    AppendValue(outBuffer, tuning.wraithCloakMoveSpeedMultiplier);
-    AppendValue(outBuffer, tuning.wraithCloakTransitionSeconds);
-    AppendValue(outBuffer, tuning.wraithUncloakTransitionSeconds);
-    AppendValue(outBuffer, tuning.wraithPostUncloakHasteSeconds);
-    AppendValue(outBuffer, tuning.weightTLWalls);
-    AppendValue(outBuffer, tuning.weightJungleGymLong);
-    AppendValue(outBuffer, tuning.weightJungleGymShort);
-    AppendValue(outBuffer, tuning.weightShack);
-    AppendValue(outBuffer, tuning.weightFourLane);
-    AppendValue(outBuffer, tuning.weightFillerA);
-    AppendValue(outBuffer, tuning.weightFillerB);
-    AppendValue(outBuffer, tuning.weightLongWall);
-    AppendValue(outBuffer, tuning.weightShortWall);
-    AppendValue(outBuffer, tuning.weightLWallWindow);
-    AppendValue(outBuffer, tuning.weightLWallPallet);
-    AppendValue(outBuffer, tuning.weightTWalls);
-    AppendValue(outBuffer, tuning.weightGymBox);
-    AppendValue(outBuffer, tuning.weightDebrisPile);
-    AppendValue(outBuffer, tuning.maxLoopsPerMap);
-    AppendValue(outBuffer, tuning.minLoopDistanceTiles);
-    AppendValue(outBuffer, tuning.maxSafePallets);
-    AppendValue(outBuffer, tuning.maxDeadzoneTiles);
-    AppendValue(outBuffer, static_cast<std::uint8_t>(tuning.edgeBiasLoops ? 1 : 0));
-    AppendValue(outBuffer, tuning.serverTickRate);
-    AppendValue(outBuffer, tuning.interpolationBufferMs);
-    return true;
-}
-
-bool App::DeserializeGameplayTuning(
-    const std::vector<std::uint8_t>& buffer,
-    game::gameplay::GameplaySystems::GameplayTuning& outTuning
-) const
-{
-    std::size_t offset = 0;
-    std::uint8_t type = 0;
-    if (!ReadValue(buffer, offset, type) || type != kPacketGameplayTuning)
-    {
-        return false;
     }
 
-    return ReadValue(buffer, offset, outTuning.assetVersion) &&
-           ReadValue(buffer, offset, outTuning.survivorWalkSpeed) &&
-           ReadValue(buffer, offset, outTuning.survivorSprintSpeed) &&
-           ReadValue(buffer, offset, outTuning.survivorCrouchSpeed) &&
-           ReadValue(buffer, offset, outTuning.survivorCrawlSpeed) &&
-           ReadValue(buffer, offset, outTuning.killerMoveSpeed) &&
-           ReadValue(buffer, offset, outTuning.survivorCapsuleRadius) &&
-           ReadValue(buffer, offset, outTuning.survivorCapsuleHeight) &&
-           ReadValue(buffer, offset, outTuning.killerCapsuleRadius) &&
-           ReadValue(buffer, offset, outTuning.killerCapsuleHeight) &&
-           ReadValue(buffer, offset, outTuning.terrorRadiusMeters) &&
-           ReadValue(buffer, offset, outTuning.terrorRadiusChaseMeters) &&
-           ReadValue(buffer, offset, outTuning.vaultSlowTime) &&
-           ReadValue(buffer, offset, outTuning.vaultMediumTime) &&
-           ReadValue(buffer, offset, outTuning.vaultFastTime) &&
-           ReadValue(buffer, offset, outTuning.fastVaultDotThreshold) &&
-           ReadValue(buffer, offset, outTuning.fastVaultSpeedMultiplier) &&
-           ReadValue(buffer, offset, outTuning.fastVaultMinRunup) &&
-           ReadValue(buffer, offset, outTuning.shortAttackRange) &&
-           ReadValue(buffer, offset, outTuning.shortAttackAngleDegrees) &&
-           ReadValue(buffer, offset, outTuning.lungeHoldMinSeconds) &&
-           ReadValue(buffer, offset, outTuning.lungeDurationSeconds) &&
-           ReadValue(buffer, offset, outTuning.lungeRecoverSeconds) &&
-           ReadValue(buffer, offset, outTuning.shortRecoverSeconds) &&
-           ReadValue(buffer, offset, outTuning.missRecoverSeconds) &&
-           ReadValue(buffer, offset, outTuning.lungeSpeedStart) &&
-           ReadValue(buffer, offset, outTuning.lungeSpeedEnd) &&
-           ReadValue(buffer, offset, outTuning.healDurationSeconds) &&
-           ReadValue(buffer, offset, outTuning.skillCheckMinInterval) &&
-           ReadValue(buffer, offset, outTuning.skillCheckMaxInterval) &&
-           ReadValue(buffer, offset, outTuning.generatorRepairSecondsBase) &&
-           ReadValue(buffer, offset, outTuning.medkitFullHealCharges) &&
-           ReadValue(buffer, offset, outTuning.medkitHealSpeedMultiplier) &&
-           ReadValue(buffer, offset, outTuning.toolboxCharges) &&
-           ReadValue(buffer, offset, outTuning.toolboxChargeDrainPerSecond) &&
-           ReadValue(buffer, offset, outTuning.toolboxRepairSpeedBonus) &&
-           ReadValue(buffer, offset, outTuning.flashlightMaxUseSeconds) &&
-           ReadValue(buffer, offset, outTuning.flashlightBlindBuildSeconds) &&
-           ReadValue(buffer, offset, outTuning.flashlightBlindDurationSeconds) &&
-           ReadValue(buffer, offset, outTuning.flashlightBeamRange) &&
-           ReadValue(buffer, offset, outTuning.flashlightBeamAngleDegrees) &&
-           ReadValue(buffer, offset, outTuning.flashlightBlindStyle) &&
-           ReadValue(buffer, offset, outTuning.mapChannelSeconds) &&
-           ReadValue(buffer, offset, outTuning.mapUses) &&
-           ReadValue(buffer, offset, outTuning.mapRevealRangeMeters) &&
-           ReadValue(buffer, offset, outTuning.mapRevealDurationSeconds) &&
-           ReadValue(buffer, offset, outTuning.trapperStartCarryTraps) &&
-           ReadValue(buffer, offset, outTuning.trapperMaxCarryTraps) &&
-           ReadValue(buffer, offset, outTuning.trapperGroundSpawnTraps) &&
-           ReadValue(buffer, offset, outTuning.trapperSetTrapSeconds) &&
-           ReadValue(buffer, offset, outTuning.trapperDisarmSeconds) &&
-           ReadValue(buffer, offset, outTuning.trapEscapeBaseChance) &&
-           ReadValue(buffer, offset, outTuning.trapEscapeChanceStep) &&
-           ReadValue(buffer, offset, outTuning.trapEscapeChanceMax) &&
-           ReadValue(buffer, offset, outTuning.trapKillerStunSeconds) &&
-           ReadValue(buffer, offset, outTuning.wraithCloakMoveSpeedMultiplier) &&
-           ReadValue(buffer, offset, outTuning.wraithCloakTransitionSeconds) &&
-           ReadValue(buffer, offset, outTuning.wraithUncloakTransitionSeconds) &&
-           ReadValue(buffer, offset, outTuning.wraithPostUncloakHasteSeconds) &&
-           ReadValue(buffer, offset, outTuning.weightTLWalls) &&
-           ReadValue(buffer, offset, outTuning.weightJungleGymLong) &&
-           ReadValue(buffer, offset, outTuning.weightJungleGymShort) &&
-           ReadValue(buffer, offset, outTuning.weightShack) &&
-           ReadValue(buffer, offset, outTuning.weightFourLane) &&
-           ReadValue(buffer, offset, outTuning.weightFillerA) &&
-           ReadValue(buffer, offset, outTuning.weightFillerB) &&
-           ReadValue(buffer, offset, outTuning.weightLongWall) &&
-           ReadValue(buffer, offset, outTuning.weightShortWall) &&
-           ReadValue(buffer, offset, outTuning.weightLWallWindow) &&
-           ReadValue(buffer, offset, outTuning.weightLWallPallet) &&
-           ReadValue(buffer, offset, outTuning.weightTWalls) &&
-           ReadValue(buffer, offset, outTuning.weightGymBox) &&
-           ReadValue(buffer, offset, outTuning.weightDebrisPile) &&
-           ReadValue(buffer, offset, outTuning.maxLoopsPerMap) &&
-           ReadValue(buffer, offset, outTuning.minLoopDistanceTiles) &&
-           [&]() -> bool {
-               if (!ReadValue(buffer, offset, outTuning.maxSafePallets)) return false;
-               if (!ReadValue(buffer, offset, outTuning.maxDeadzoneTiles)) return false;
-               std::uint8_t edgeBias = 0;
-               if (!ReadValue(buffer, offset, edgeBias)) return false;
-               outTuning.edgeBiasLoops = (edgeBias != 0);
-               return true;
-           }() &&
-           ReadValue(buffer, offset, outTuning.serverTickRate) &&
-           ReadValue(buffer, offset, outTuning.interpolationBufferMs);
-}
-
-bool App::SerializeAssignRole(
-    std::uint8_t roleByte,
-    game::gameplay::GameplaySystems::MapType mapType,
-    unsigned int seed,
-    std::vector<std::uint8_t>& outBuffer
-)
-{
-    outBuffer.clear();
-    AppendValue(outBuffer, kPacketAssignRole);
-    AppendValue(outBuffer, roleByte);
-    AppendValue(outBuffer, MapTypeToByte(mapType));
-    AppendValue(outBuffer, seed);
-    return true;
-}
-
-bool App::DeserializeAssignRole(
-    const std::vector<std::uint8_t>& buffer,
-    std::uint8_t& outRole,
-    game::gameplay::GameplaySystems::MapType& outMapType,
-    unsigned int& outSeed
-) const
-{
-    std::size_t offset = 0;
-    std::uint8_t type = 0;
-    std::uint8_t mapTypeByte = 0;
-
-    if (!ReadValue(buffer, offset, type) || type != kPacketAssignRole)
+    m_snapshotEncodesLastTick = encoded.size();
+    if (encoded.empty())
     {
-        return false;
+        return;
     }
 
-    if (!ReadValue(buffer, offset, outRole) ||
-        !ReadValue(buffer, offset, mapTypeByte) ||
-        !ReadValue(buffer, offset, outSeed))
+    for (const EncodedSnapshot& entry : encoded)
     {
-        return false;
+        m_network.SendReliableToPeers(entry.peers, entry.data.data(), entry.data.size(), false);
     }
-
-    outMapType = ByteToMapType(mapTypeByte);
-    return true;
-}
-
-bool App::SerializeHello(const std::string& requestedRole, std::vector<std::uint8_t>& outBuffer) const
-{
-    outBuffer.clear();
-    AppendValue(outBuffer, kPacketHello);
-    AppendValue(outBuffer, static_cast<std::int32_t>(kProtocolVersion));
-
-    const std::string build = kBuildId;
-    const std::uint16_t buildLen = static_cast<std::uint16_t>(std::min<std::size_t>(build.size(), 255));
-    AppendValue(outBuffer, buildLen);
-    outBuffer.insert(outBuffer.end(), build.begin(), build.begin() + buildLen);
-
-    const std::uint16_t roleLen = static_cast<std::uint16_t>(std::min<std::size_t>(requestedRole.size(), 64));
-    AppendValue(outBuffer, roleLen);
-    outBuffer.insert(outBuffer.end(), requestedRole.begin(), requestedRole.begin() + roleLen);
-
-    const std::uint16_t mapLen = static_cast<std::uint16_t>(std::min<std::size_t>(m_sessionMapName.size(), 64));
-    AppendValue(outBuffer, mapLen);
-    outBuffer.insert(outBuffer.end(), m_sessionMapName.begin(), m_sessionMapName.begin() + mapLen);
-
-    const std::uint16_t nameLen = static_cast<std::uint16_t>(std::min<std::size_t>(m_roleSelectionPlayerName.size(), 64));
-    AppendValue(outBuffer, nameLen);
-    outBuffer.insert(outBuffer.end(), m_roleSelectionPlayerName.begin(), m_roleSelectionPlayerName.begin() + nameLen);
-
-    return true;
+    m_network.Flush();
+    m_lastSnapshotSentSeconds = glfwGetTime();
+    m_remotePlayer.lastSnapshotSeconds = m_lastSnapshotSentSeconds;
 }
 
-bool App::DeserializeHello(
-    const std::vector<std::uint8_t>& buffer,
-    std::string& outRequestedRole,
-    std::string& outMapName,
-    int& outProtocolVersion,
-    std::string& outBuildId,
-    std::string& outPlayerName
-) const
+void App::SendGameplayTuningToClient()
 {
-    outRequestedRole.clear();
-    outMapName.clear();
-    outBuildId.clear();
-    outPlayerName.clear();
-    outProtocolVersion = 0;
-
-    std::size_t offset = 0;
-    std::uint8_t type = 0;
-    std::int32_t protocol = 0;
-    std::uint16_t buildLen = 0;
-    std::uint16_t roleLen = 0;
-    std::uint16_t mapLen = 0;
-
-    if (!ReadValue(buffer, offset, type) || type != kPacketHello)
-    {
-        return false;
-    }
-    if (!ReadValue(buffer, offset, protocol))
-    {
-        return false;
-    }
-    outProtocolVersion = protocol;
-    if (!ReadValue(buffer, offset, buildLen))
-    {
-        return false;
-    }
-    if (offset + buildLen > buffer.size())
-    {
-        return false;
-    }
-    outBuildId.assign(reinterpret_cast<const char*>(buffer.data() + offset), buildLen);
-    offset += buildLen;
-
-    if (!ReadValue(buffer, offset, roleLen))
-    {
-        return false;
-    }
-    if (offset + roleLen > buffer.size())
-    {
-        return false;
-    }
-    outRequestedRole.assign(reinterpret_cast<const char*>(buffer.data() + offset), roleLen);
-    offset += roleLen;
-
-    if (!ReadValue(buffer, offset, mapLen))
-    {
-        return false;
-    }
-    if (offset + mapLen > buffer.size())
-    {
-        return false;
-    }
-    outMapName.assign(reinterpret_cast<const char*>(buffer.data() + offset), mapLen);
-    offset += mapLen;
-
-    std::uint16_t nameLen = 0;
-    if (offset + sizeof(nameLen) <= buffer.size())
+    if (m_multiplayerMode != MultiplayerMode::Host || !m_network.IsConnected())
     {
-        if (!ReadValue(buffer, offset, nameLen))
-        {
-            return true;
-        }
-        if (offset + nameLen <= buffer.size())
-        {
-            outPlayerName.assign(reinterpret_cast<const char*>(buffer.data() + offset), nameLen);
-        }
+        return;
     }
-    return true;
-}
-
-bool App::SerializeReject(const std::string& reason, std::vector<std::uint8_t>& outBuffer) const
-{
-    outBuffer.clear();
-    AppendValue(outBuffer, kPacketReject);
-    const std::uint16_t reasonLen = static_cast<std::uint16_t>(std::min<std::size_t>(reason.size(), 512));
-    AppendValue(outBuffer, reasonLen);
-    outBuffer.insert(outBuffer.end(), reason.begin(), reason.begin() + reasonLen);
-    return true;
-}
 
-bool App::DeserializeReject(const std::vector<std::uint8_t>& buffer, std::string& outReason) const
-{
-    outReason.clear();
-    std::size_t offset = 0;
-    std::uint8_t type = 0;
-    std::uint16_t reasonLen = 0;
-    if (!ReadValue(buffer, offset, type) || type != kPacketReject)
-    {
-        return false;
-    }
-    if (!ReadValue(buffer, offset, reasonLen))
-    {
-        return false;
-    }
-    if (offset + reasonLen > buffer.size())
+    std::vector<std::uint8_t> payload;
+    if (!game::net::SerializeGameplayTuning(m_gameplayApplied, payload))
     {
-        return false;
+        return;
     }
-    outReason.assign(reinterpret_cast<const char*>(buffer.data() + offset), reasonLen);
-    return true;
+    m_network.SendReliable(payload.data(), payload.size());
 }
 
 bool App::SerializeRoleChangeRequest(const NetRoleChangeRequestPacket& packet, std::vector<std::uint8_t>& outBuffer)
@@ -3896,6 +3484,16 @@ std::string App::NetStatusDump() const
     {
         oss << " rtt_ms=n/a loss=n/a";
     }
+
+    const net::NetworkConditions& conditions = m_network.Conditions();
+    if (conditions.enabled)
+    {
+        const net::NetworkConditioner::Stats& simStats = m_network.ConditionerStats();
+        oss << " sim=" << conditions.latencyMs << "+-" << conditions.jitterMs << "ms"
+            << " loss=" << conditions.lossPercent << "% dup=" << conditions.duplicatePercent
+            << "% reorder=" << conditions.reorderPercent << "% kbps=" << conditions.bandwidthKbps
+            << " dropped=" << simStats.droppedDatagrams << " queued_bytes=" << simStats.queuedBytes;
+    }
     return oss.str();
 }
 
@@ -4050,13 +3648,20 @@ void App::SendAssignRoleToClient(const std::string& remoteRole)
     }
 
     std::vector<std::uint8_t> assign;
-    if (!SerializeAssignRole(RoleNameToByte(remoteRole), m_sessionMapType, m_sessionSeed, assign))
+    if (!game::net::SerializeAssignRole(RoleNameToByte(remoteRole), m_sessionMapType, m_sessionSeed, assign))
     {
         AppendNetworkLog("SerializeAssignRole failed while sending role update.");
         return;
     }
 
-    m_network.SendReliable(assign.data(), assign.size());
+    if (m_remotePlayerPeer != net::NetworkSession::kInvalidPeer)
+    {
+        m_network.SendReliableTo(m_remotePlayerPeer, assign.data(), assign.size());
+    }
+    else
+    {
+        m_network.SendReliable(assign.data(), assign.size());
+    }
     AppendNetworkLog("Sent possession update to client: role=" + NormalizeRoleName(remoteRole));
 }
 
@@ -4965,6 +4570,7 @@ bool App::LoadGameplayConfig()
     readFloat("min_loop_distance_tiles", m_gameplayApplied.minLoopDistanceTiles);
     readInt("server_tick_rate", m_gameplayApplied.serverTickRate);
     readInt("interpolation_buffer_ms", m_gameplayApplied.interpolationBufferMs);
+    readInt("lag_compensation_max_ms", m_gameplayApplied.lagCompensationMaxMs);
 
     m_gameplayEditing = m_gameplayApplied;
     return true;
@@ -5047,6 +4653,7 @@ bool App::SaveGameplayConfig() const
     root["min_loop_distance_tiles"] = t.minLoopDistanceTiles;
     root["server_tick_rate"] = t.serverTickRate;
     root["interpolation_buffer_ms"] = t.interpolationBufferMs;
+    root["lag_compensation_max_ms"] = t.lagCompensationMaxMs;
 
     std::ofstream stream(path);
     if (!stream.is_open())
@@ -5182,7 +4789,8 @@ bool App::LoadTerrorRadiusProfile(const std::string& killerId)
     // First pass: Start all TR layers at 0 volume
     for (TerrorRadiusLayerAudio& layer : m_terrorAudioProfile.layers)
     {
-        const audio::AudioSystem::PlayOptions options{};
+        audio::AudioSystem::PlayOptions options{};
+        options.priority = 10; // the terror radius is gameplay information, never stolen by other music
         layer.handle = m_audio.PlayLoop(layer.clip, audio::AudioSystem::Bus::Music, options);
         layer.currentVolume = 0.0F;
         std::cout << "[TR Load] clip=" << layer.clip << " handle=" << layer.handle << "\n";
@@ -5831,6 +5439,35 @@ void App::DrawNetworkOverlayUi(double nowSeconds)
         ImGui::Text("Connected Peers: %u", stats.peerCount);
         ImGui::Text("Last Snapshot Rx: %.2fs ago", m_lastSnapshotReceivedSeconds > 0.0 ? nowSeconds - m_lastSnapshotReceivedSeconds : -1.0);
         ImGui::Text("Last Input Tx: %.2fs ago", m_lastInputSentSeconds > 0.0 ? nowSeconds - m_lastInputSentSeconds : -1.0);
+        if (m_multiplayerMode == MultiplayerMode::Client)
+        {
+            ImGui::Text("View Tick: %u", m_gameplay.ClientViewTick());
+        }
+        if (m_multiplayerMode == MultiplayerMode::Host)
+        {
+            const auto& lagComp = m_gameplay.GetLagCompensationStats();
+            ImGui::Text("Lag Comp: rewind %d ticks (%.0f ms), max %d, window %d ticks, clamped %llu/%llu",
+                        lagComp.lastRewindTicks,
+                        lagComp.lastRewindMs,
+                        lagComp.maxRewindTicks,
+                        lagComp.windowTicks,
+                        static_cast<unsigned long long>(lagComp.clampedChecks),
+                        static_cast<unsigned long long>(lagComp.rewoundChecks));
+            ImGui::Text("Snapshot Tx/tick: %zu bytes (%zu encodes for %zu peers)",
+                        m_snapshotBytesLastTick,
+                        m_snapshotEncodesLastTick,
+                        m_replicationPeers.size());
+            for (const auto& [peerId, replication] : m_replicationPeers)
+            {
+                ImGui::Text("  peer %u netId=%u %s#%u last=%zuB total=%.1fKB",
+                            peerId,
+                            replication.netId,
+                            replication.role == engine::scene::Role::Killer ? "killer" : "survivor",
+                            static_cast<unsigned int>(replication.slot),
+                            replication.lastSnapshotBytes,
+                            static_cast<double>(replication.snapshotBytesSent) / 1024.0);
+            }
+        }
         ImGui::Separator();
         ImGui::Text("LAN Discovery: %s",
                     m_lanDiscovery.GetMode() == net::LanDiscovery::Mode::Disabled
@@ -7464,6 +7101,7 @@ void App::DrawSettingsUiCustom(bool* closeSettings)
         m_ui.Label("Networking", m_ui.Theme().colorAccent);
         m_ui.SliderInt("gp_server_tick", "Server Tick Rate", &t.serverTickRate, 30, 60);
         m_ui.SliderInt("gp_interp_ms", "Interpolation Buffer (ms)", &t.interpolationBufferMs, 50, 1000);
+        m_ui.SliderInt("gp_lag_comp_ms", "Lag Compensation Window (ms)", &t.lagCompensationMaxMs, 0, 1000);
 
         m_ui.Label("Tip: Apply for runtime changes, Save To File for persistence.", m_ui.Theme().colorTextMuted);
         if (!m_gameplayStatus.empty())
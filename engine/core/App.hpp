@@ -5,6 +5,7 @@
 #include <fstream>
 #include <random>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <glm/vec2.hpp>
@@ -203,15 +204,6 @@ private:
         Controls
     };
 
-    struct NetRoleInputPacket
-    {
-        std::int8_t moveX = 0;
-        std::int8_t moveY = 0;
-        float lookX = 0.0F;
-        float lookY = 0.0F;
-        std::uint16_t buttons = 0;
-    };
-
     struct NetRoleChangeRequestPacket
     {
         std::uint8_t requestedRole = 0;
@@ -252,7 +244,21 @@ private:
         double lastSnapshotSeconds = 0.0;
     };
 
+    // Host-side state for one client's interest-managed snapshot stream.
+    struct PeerReplicationState
+    {
+        std::uint32_t netId = 0;
+        bool handshaken = false;
+        engine::scene::Role role = engine::scene::Role::Survivor;
+        std::uint8_t slot = 0;
+        std::uint32_t snapshotSequence = 0;
+        std::size_t lastSnapshotBytes = 0;
+        std::uint64_t snapshotBytesSent = 0;
+    };
+
     void ResetToMainMenu();
+    /// Builds the in-match GL programs (wraith cloak) once; false if they are unavailable.
+    bool EnsureGameplayShaders();
     void StartSoloSession(const std::string& mapName, const std::string& roleName);
     void StartMatchFromLobbyMultiplayer(const std::string& mapName, const std::string& roleName);
     bool StartHostSession(const std::string& mapName, const std::string& roleName, std::uint16_t port);
@@ -276,29 +282,10 @@ private:
     game::ui::LoadingScenario m_currentScenario = game::ui::LoadingScenario::Startup;
 
     void PollNetwork();
-    void HandleNetworkPacket(const std::vector<std::uint8_t>& payload);
+    void HandleNetworkPacket(const std::vector<std::uint8_t>& payload, net::NetworkSession::PeerId fromPeer);
     void SendClientInput(const engine::platform::Input& input, bool controlsEnabled);
     void SendHostSnapshot();
 
-    static bool SerializeRoleInput(const NetRoleInputPacket& packet, std::vector<std::uint8_t>& outBuffer);
-    static bool DeserializeRoleInput(const std::vector<std::uint8_t>& buffer, NetRoleInputPacket& outPacket);
-    bool SerializeSnapshot(const game::gameplay::GameplaySystems::Snapshot& snapshot, std::vector<std::uint8_t>& outBuffer) const;
-    bool DeserializeSnapshot(const std::vector<std::uint8_t>& buffer, game::gameplay::GameplaySystems::Snapshot& outSnapshot) const;
-    bool SerializeGameplayTuning(const game::gameplay::GameplaySystems::GameplayTuning& tuning, std::vector<std::uint8_t>& outBuffer) const;
-    bool DeserializeGameplayTuning(const std::vector<std::uint8_t>& buffer, game::gameplay::GameplaySystems::GameplayTuning& outTuning) const;
-    static bool SerializeAssignRole(std::uint8_t roleByte, game::gameplay::GameplaySystems::MapType mapType, unsigned int seed, std::vector<std::uint8_t>& outBuffer);
-    bool DeserializeAssignRole(const std::vector<std::uint8_t>& buffer, std::uint8_t& outRole, game::gameplay::GameplaySystems::MapType& outMapType, unsigned int& outSeed) const;
-    bool SerializeHello(const std::string& requestedRole, std::vector<std::uint8_t>& outBuffer) const;
-    bool DeserializeHello(
-        const std::vector<std::uint8_t>& buffer,
-        std::string& outRequestedRole,
-        std::string& outMapName,
-        int& outProtocolVersion,
-        std::string& outBuildId,
-        std::string& outPlayerName
-    ) const;
-    bool SerializeReject(const std::string& reason, std::vector<std::uint8_t>& outBuffer) const;
-    bool DeserializeReject(const std::vector<std::uint8_t>& buffer, std::string& outReason) const;
     static bool SerializeRoleChangeRequest(const NetRoleChangeRequestPacket& packet, std::vector<std::uint8_t>& outBuffer);
     static bool DeserializeRoleChangeRequest(const std::vector<std::uint8_t>& buffer, NetRoleChangeRequestPacket& outPacket);
 
@@ -410,6 +397,7 @@ private:
     render::WraithCloakParams m_wraithCloakParams;
     bool m_wraithCloakEnabled = false;
     bool m_wraithCloakDebugEnabled = false;
+    bool m_wraithCloakInitFailed = false;
     ui::UiSystem m_ui;
 
     EventBus m_eventBus;
@@ -606,6 +594,10 @@ private:
     double m_lastSnapshotReceivedSeconds = 0.0;
     double m_lastInputSentSeconds = 0.0;
     double m_lastSnapshotSentSeconds = 0.0;
+    std::unordered_map<net::NetworkSession::PeerId, PeerReplicationState> m_replicationPeers;
+    net::NetworkSession::PeerId m_remotePlayerPeer = net::NetworkSession::kInvalidPeer;
+    std::size_t m_snapshotBytesLastTick = 0;
+    std::size_t m_snapshotEncodesLastTick = 0;
     std::vector<std::string> m_pendingDroppedFiles;
     std::vector<audio::AudioSystem::SoundHandle> m_debugAudioLoops;
     audio::AudioSystem::SoundHandle m_sessionAmbienceLoop = 0;
@@ -114,6 +114,9 @@ struct FrameStats
     float fxMs = 0.0F;
     float audioMs = 0.0F;
     float swapMs = 0.0F;
+    float renderExecuteMs = 0.0F;   // recorded command list execution (render thread or inline)
+    float renderWaitMs = 0.0F;      // main thread blocked taking the GL context back
+    bool renderSubmitThreaded = false;
 
     // Draw call / vertex stats.
     std::uint32_t drawCalls = 0;
@@ -121,13 +124,49 @@ struct FrameStats
     std::uint32_t trianglesSubmitted = 0;
     std::uint32_t staticBatchChunksVisible = 0;
     std::uint32_t staticBatchChunksTotal = 0;
+    std::uint32_t staticBatchDrawRanges = 0;  // multi-draw entries after merging adjacent visible clusters
+    bool staticBatchRangesReused = false;      // visible cluster set unchanged since last frame
+    std::uint32_t solidInstances = 0;         // instanced unit boxes/capsules this frame
+    std::uint32_t renderQueueItems = 0;       // sorted submissions before batching
+    std::uint32_t renderStateChanges = 0;     // program/VAO/texture/uniform-mode switches
+    std::uint32_t instancedDrawsMerged = 0;   // GPU mesh draws folded into a preceding instanced draw
+    std::uint32_t uniformBlockUploads = 0;    // frame UBO / light buffer uploads (0 when environment and lights are unchanged)
+    std::uint32_t lightClusterLights = 0;     // lights binned into the froxel grid this frame
+    std::uint32_t lightClusterIndices = 0;
+    std::uint32_t lightClusterMaxPerCluster = 0;
+    std::uint32_t lightClusterOverflow = 0;   // clusters that hit the per-cluster light cap
+    float lightClusterBuildMs = 0.0F;         // 0 when the grid was reused
     std::uint32_t dynamicObjectsCulled = 0;
     std::uint32_t dynamicObjectsDrawn = 0;
+    std::uint32_t occlusionOccluders = 0;     // wall boxes rasterized into the CPU depth buffer
+    std::uint32_t occlusionTriangles = 0;
+    std::uint32_t occlusionTested = 0;
+    std::uint32_t occlusionCulled = 0;        // frustum-visible boxes hidden behind occluders
+    float occlusionRasterMs = 0.0F;
+    std::uint32_t meshLodFullDraws = 0;       // high-poly / loop meshes drawn at LOD 0
+    std::uint32_t meshLodReducedDraws = 0;    // drawn from a simplified LOD
+    std::uint32_t meshLodImpostors = 0;       // sub-pixel meshes replaced by a box
+    std::uint32_t meshUploadsDone = 0;        // async mesh loads uploaded this frame
+    std::uint32_t meshUploadsQueued = 0;      // still decoding or over budget
+    float meshUploadMs = 0.0F;
+    std::uint64_t assetMeshBytes = 0;         // AssetManager residency (CPU mesh data)
+    std::uint32_t assetMeshCount = 0;
+    std::uint64_t assetTextureBytes = 0;      // AssetManager residency (GPU textures)
+    std::uint32_t assetTextureCount = 0;
+    std::uint32_t assetReferencedCount = 0;   // pinned by a handle, not evictable
+    std::uint64_t assetBudgetBytes = 0;
+    std::uint32_t assetEvictedTotal = 0;
+    std::uint32_t audioVoicesActive = 0;      // mixed ma_sounds
+    std::uint32_t audioVoicesVirtual = 0;     // inaudible / over-budget loops, cursor tracked but not mixed
+    std::uint32_t audioVoicesStolen = 0;      // total voices stopped or virtualized by the voice budgets
     std::uint32_t uiBatches = 0;
     std::uint32_t uiVertices = 0;
 
     // Memory.
     std::size_t solidVboBytes = 0;
+    std::size_t gpuMeshBytes = 0;          // cached meshes: welded vertices + index buffers
+    std::size_t gpuMeshUnweldedBytes = 0;  // same meshes as one 52-byte vertex per triangle corner
+    std::size_t instanceVboBytes = 0;
     std::size_t texturedVboBytes = 0;
     std::size_t lineVboBytes = 0;
     std::size_t systemRamBytes = 0;    // Process working set (RAM)
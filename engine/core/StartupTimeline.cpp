@@ -0,0 +1,112 @@
+#include "engine/core/StartupTimeline.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <system_error>
+
+#include <nlohmann/json.hpp>
+
+namespace engine::core
+{
+
+void StartupTimeline::Begin()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_origin = Clock::now();
+    m_mainThread = std::this_thread::get_id();
+    m_phases.clear();
+    m_reported = false;
+}
+
+void StartupTimeline::Record(std::string_view name, Clock::time_point start, Clock::time_point end)
+{
+    Phase phase;
+    phase.name = std::string(name);
+    phase.thread = std::this_thread::get_id();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    phase.startMs = std::chrono::duration<double, std::milli>(start - m_origin).count();
+    phase.durationMs = std::chrono::duration<double, std::milli>(end - start).count();
+    m_phases.push_back(std::move(phase));
+}
+
+double StartupTimeline::ElapsedMs() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::chrono::duration<double, std::milli>(Clock::now() - m_origin).count();
+}
+
+void StartupTimeline::Report(const std::filesystem::path& tracePath)
+{
+    std::vector<Phase> phases;
+    std::thread::id mainThread;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_reported)
+        {
+            return;
+        }
+        m_reported = true;
+        phases = m_phases;
+        mainThread = m_mainThread;
+    }
+    std::stable_sort(phases.begin(), phases.end(), [](const Phase& a, const Phase& b) { return a.startMs < b.startMs; });
+
+    // Trace thread ids: 0 is the main thread, workers are numbered in order of first appearance.
+    std::vector<std::thread::id> threads{mainThread};
+    auto threadIndex = [&threads](std::thread::id id) {
+        const auto it = std::find(threads.begin(), threads.end(), id);
+        if (it != threads.end())
+        {
+            return static_cast<int>(it - threads.begin());
+        }
+        threads.push_back(id);
+        return static_cast<int>(threads.size() - 1);
+    };
+
+    nlohmann::json events = nlohmann::json::array();
+    for (const Phase& phase : phases)
+    {
+        const int tid = threadIndex(phase.thread);
+        std::cout << "[STARTUP] " << std::left << std::setw(24) << phase.name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(8) << phase.durationMs << " ms  (at " << phase.startMs << " ms"
+                  << (tid == 0 ? "" : ", worker " + std::to_string(tid)) << ")\n";
+        events.push_back({
+            {"name", phase.name},
+            {"cat", "startup"},
+            {"ph", "X"},
+            {"pid", 1},
+            {"tid", tid},
+            {"ts", phase.startMs * 1000.0},
+            {"dur", phase.durationMs * 1000.0},
+        });
+    }
+    for (std::size_t i = 0; i < threads.size(); ++i)
+    {
+        events.push_back({
+            {"name", "thread_name"},
+            {"ph", "M"},
+            {"pid", 1},
+            {"tid", static_cast<int>(i)},
+            {"args", {{"name", i == 0 ? std::string("main") : "worker " + std::to_string(i)}}},
+        });
+    }
+
+    std::error_code ec;
+    if (tracePath.has_parent_path())
+    {
+        std::filesystem::create_directories(tracePath.parent_path(), ec);
+    }
+    std::ofstream stream(tracePath, std::ios::out | std::ios::trunc);
+    if (!stream.is_open())
+    {
+        std::cout << "[STARTUP] Cannot write trace " << tracePath.generic_string() << "\n";
+        return;
+    }
+    stream << nlohmann::json{{"traceEvents", events}, {"displayTimeUnit", "ms"}}.dump() << "\n";
+    std::cout << "[STARTUP] Trace written to " << tracePath.generic_string() << "\n";
+}
+
+} // namespace engine::core
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace engine::core
+{
+
+/// Wall-clock record of startup phases, including ones running concurrently on job workers.
+/// Report() prints one [STARTUP] line per phase and writes a Chrome trace (chrome://tracing or
+/// ui.perfetto.dev) so overlapping phases can be read per thread.
+class StartupTimeline
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static StartupTimeline& Instance()
+    {
+        static StartupTimeline s_instance;
+        return s_instance;
+    }
+
+    /// Resets the timeline; the calling thread is labelled "main" in the trace.
+    void Begin();
+
+    /// Thread-safe; phases may be recorded from any thread.
+    void Record(std::string_view name, Clock::time_point start, Clock::time_point end);
+
+    /// Milliseconds since Begin().
+    [[nodiscard]] double ElapsedMs() const;
+
+    /// Logs every phase in start order and writes the trace file. Later calls do nothing.
+    void Report(const std::filesystem::path& tracePath = "logs/startup_trace.json");
+
+private:
+    struct Phase
+    {
+        std::string name;
+        std::thread::id thread;
+        double startMs = 0.0;
+        double durationMs = 0.0;
+    };
+
+    StartupTimeline() = default;
+
+    mutable std::mutex m_mutex;
+    Clock::time_point m_origin = Clock::now();
+    std::thread::id m_mainThread;
+    std::vector<Phase> m_phases;
+    bool m_reported = false;
+};
+
+/// Records the enclosing scope as one startup phase.
+class StartupScope
+{
+public:
+    explicit StartupScope(std::string_view name)
+        : m_name(name)
+        , m_start(StartupTimeline::Clock::now())
+    {
+    }
+    ~StartupScope()
+    {
+        StartupTimeline::Instance().Record(m_name, m_start, StartupTimeline::Clock::now());
+    }
+
+    StartupScope(const StartupScope&) = delete;
+    StartupScope& operator=(const StartupScope&) = delete;
+
+private:
+    std::string m_name;
+    StartupTimeline::Clock::time_point m_start;
+};
+
+} // namespace engine::core
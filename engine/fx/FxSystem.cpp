@@ -11,6 +11,7 @@
 #include <glm/trigonometric.hpp>
 #include <nlohmann/json.hpp>
 
+#include "engine/assets/AssetPack.hpp"
 #include "engine/render/Renderer.hpp"
 
 namespace engine::fx
@@ -366,21 +367,17 @@ bool FxSystem::ReloadAssets()
     m_assets.clear();
     std::filesystem::create_directories(m_assetDirectory);
 
-    for (const auto& entry : std::filesystem::directory_iterator(m_assetDirectory))
+    for (const std::string& fileName : assets::AssetPack::ListFiles(m_assetDirectory, ".json"))
     {
-        if (!entry.is_regular_file() || entry.path().extension() != ".json")
-        {
-            continue;
-        }
-
+        const std::filesystem::path path = std::filesystem::path(m_assetDirectory) / fileName;
         FxAsset asset;
-        if (!LoadAssetFromFile(entry.path().string(), &asset, nullptr))
+        if (!LoadAssetFromFile(path.string(), &asset, nullptr))
         {
             continue;
         }
         if (asset.id.empty())
         {
-            asset.id = entry.path().stem().string();
+            asset.id = path.stem().string();
         }
         m_assets[asset.id] = std::move(asset);
     }
@@ -965,8 +962,8 @@ void FxSystem::Render(engine::render::Renderer& renderer, const glm::vec3& camer
 
 bool FxSystem::LoadAssetFromFile(const std::string& path, FxAsset* outAsset, std::string* outError)
 {
-    std::ifstream stream(path);
-    if (!stream.is_open())
+    std::string text;
+    if (!assets::AssetPack::ReadFile(path, text))
     {
         if (outError != nullptr)
         {
@@ -978,7 +975,7 @@ bool FxSystem::LoadAssetFromFile(const std::string& path, FxAsset* outAsset, std
     json root;
     try
     {
-        stream >> root;
+        root = json::parse(text);
     }
     catch (const std::exception& ex)
     {
@@ -1146,6 +1143,7 @@ bool FxSystem::SaveAssetToFile(const std::string& path, const FxAsset& asset, st
     }
     root["emitters"] = std::move(emitters);
 
+    assets::AssetPack::Instance().MarkLooseOverride(path);
     std::ofstream stream(path);
     if (!stream.is_open())
     {
@@ -1164,7 +1162,7 @@ void FxSystem::EnsureDefaultAssets()
 {
     auto saveIfMissing = [this](const FxAsset& asset) {
         const std::filesystem::path path = std::filesystem::path(m_assetDirectory) / (asset.id + ".json");
-        if (!std::filesystem::exists(path))
+        if (!assets::AssetPack::Instance().Find(path).has_value() && !std::filesystem::exists(path))
         {
             (void)SaveAssetToFile(path.string(), asset, nullptr);
         }
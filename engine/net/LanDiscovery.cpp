@@ -3,10 +3,8 @@
 
 #include <algorithm>
 #include <array>
-#include <cctype>
 #include <cstring>
 #include <iostream>
-#include <sstream>
 
 #ifdef _WIN32
 #include <winsock2.h>
@@ -34,12 +32,96 @@ constexpr double kClientScanIntervalSeconds = 1.0;
 constexpr double kServerBroadcastIntervalSeconds = 1.0;
 constexpr double kServerTtlSeconds = 3.5;
 
-std::string ToLower(std::string value)
+// Host-side response limits: one unicast reply per requester per interval, and a
+// global bucket so dozens of scanning clients cannot make the host spam the LAN.
+constexpr double kRequesterMinIntervalSeconds = 0.25;
+constexpr double kResponseBucketSize = 16.0;
+constexpr double kResponseRefillPerSecond = 32.0;
+constexpr double kRequesterForgetSeconds = 5.0;
+
+// Fixed-layout discovery packets, little-endian:
+//   header:   u32 magic | u8 version | u8 type | u16 protocol | u32 build hash       (12 bytes)
+//   response: header | u16 game port | u8 players | u8 max players | u32 ipv4 (0 = source)
+//             | u8 name len | char[32] name | u8 map len | char[32] map              (86 bytes)
+constexpr std::uint32_t kDiscoveryMagic = 0x444C5341U; // "ASLD"
+constexpr std::uint8_t kDiscoveryVersion = 1;
+constexpr std::uint8_t kPacketRequest = 1;
+constexpr std::uint8_t kPacketResponse = 2;
+constexpr std::size_t kMaxNameBytes = 32;
+constexpr std::size_t kHeaderSize = 12;
+constexpr std::size_t kResponseSize = kHeaderSize + 2 + 1 + 1 + 4 + 1 + kMaxNameBytes + 1 + kMaxNameBytes;
+
+struct PacketHeader
 {
-    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) {
-        return static_cast<char>(std::tolower(c));
-    });
-    return value;
+    std::uint8_t type = 0;
+    std::uint16_t protocolVersion = 0;
+    std::uint32_t buildHash = 0;
+};
+
+void WriteU16(std::uint8_t* out, std::uint16_t value)
+{
+    out[0] = static_cast<std::uint8_t>(value & 0xFFU);
+    out[1] = static_cast<std::uint8_t>((value >> 8U) & 0xFFU);
+}
+
+void WriteU32(std::uint8_t* out, std::uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        out[i] = static_cast<std::uint8_t>((value >> (8U * static_cast<unsigned>(i))) & 0xFFU);
+    }
+}
+
+std::uint16_t ReadU16(const std::uint8_t* in)
+{
+    return static_cast<std::uint16_t>(in[0] | (in[1] << 8U));
+}
+
+std::uint32_t ReadU32(const std::uint8_t* in)
+{
+    return static_cast<std::uint32_t>(in[0]) | (static_cast<std::uint32_t>(in[1]) << 8U) |
+           (static_cast<std::uint32_t>(in[2]) << 16U) | (static_cast<std::uint32_t>(in[3]) << 24U);
+}
+
+void WriteHeader(std::uint8_t* out, std::uint8_t type, int protocolVersion, std::uint32_t buildHash)
+{
+    WriteU32(out, kDiscoveryMagic);
+    out[4] = kDiscoveryVersion;
+    out[5] = type;
+    WriteU16(out + 6, static_cast<std::uint16_t>(std::clamp(protocolVersion, 0, 0xFFFF)));
+    WriteU32(out + 8, buildHash);
+}
+
+bool ReadHeader(const std::uint8_t* in, std::size_t size, PacketHeader& outHeader)
+{
+    if (size < kHeaderSize || ReadU32(in) != kDiscoveryMagic || in[4] != kDiscoveryVersion)
+    {
+        return false;
+    }
+    outHeader.type = in[5];
+    outHeader.protocolVersion = ReadU16(in + 6);
+    outHeader.buildHash = ReadU32(in + 8);
+    return true;
+}
+
+void WriteName(std::uint8_t* out, const std::string& value)
+{
+    const std::size_t length = std::min(value.size(), kMaxNameBytes);
+    out[0] = static_cast<std::uint8_t>(length);
+    std::memset(out + 1, 0, kMaxNameBytes);
+    std::memcpy(out + 1, value.data(), length);
+}
+
+void ReadName(const std::uint8_t* in, std::string& outValue)
+{
+    const std::size_t length = std::min<std::size_t>(in[0], kMaxNameBytes);
+    // assign() reuses capacity, so refreshing a known server does not allocate.
+    outValue.assign(reinterpret_cast<const char*>(in + 1), length);
+}
+
+std::uint64_t EndpointKey(std::uint32_t ipv4HostOrder, std::uint16_t port)
+{
+    return (static_cast<std::uint64_t>(ipv4HostOrder) << 16U) | port;
 }
 
 #ifdef _WIN32
@@ -91,7 +173,14 @@ bool LanDiscovery::StartHost(
     m_maxPlayers = maxPlayers;
     m_protocolVersion = protocolVersion;
     m_buildId = buildId;
+    m_buildHash = HashBuildId(buildId);
     m_preferredIp = preferredIp;
+    m_preferredIpv4 = 0;
+    in_addr parsed{};
+    if (!preferredIp.empty() && inet_pton(AF_INET, preferredIp.c_str(), &parsed) == 1)
+    {
+        m_preferredIpv4 = ntohl(parsed.s_addr);
+    }
 
     if (!OpenSocket(m_discoveryPort, true))
     {
@@ -100,6 +189,10 @@ bool LanDiscovery::StartHost(
     }
 
     m_lastHostBroadcastSeconds = 0.0;
+    m_lastResponseByRequester.clear();
+    m_responseTokens = kResponseBucketSize;
+    m_lastTokenRefillSeconds = -1.0;
+    m_lastRequesterPruneSeconds = 0.0;
     return true;
 }
 
@@ -111,6 +204,7 @@ bool LanDiscovery::StartClient(std::uint16_t discoveryPort, int protocolVersion,
     m_discoveryPort = discoveryPort;
     m_protocolVersion = protocolVersion;
     m_buildId = buildId;
+    m_buildHash = HashBuildId(buildId);
 
     if (!OpenSocket(0, true))
     {
@@ -121,6 +215,8 @@ bool LanDiscovery::StartClient(std::uint16_t discoveryPort, int protocolVersion,
     m_lastRequestSentSeconds = 0.0;
     m_lastResponseReceivedSeconds = 0.0;
     m_servers.clear();
+    m_serverIndex.clear();
+    m_serverKeys.clear();
     return true;
 }
 
@@ -139,9 +235,11 @@ void LanDiscovery::UpdateHostInfo(
     m_mapName = mapName;
     m_players = players;
     m_maxPlayers = maxPlayers;
-    if (!preferredIp.empty())
+    if (!preferredIp.empty() && preferredIp != m_preferredIp)
     {
         m_preferredIp = preferredIp;
+        in_addr parsed{};
+        m_preferredIpv4 = inet_pton(AF_INET, preferredIp.c_str(), &parsed) == 1 ? ntohl(parsed.s_addr) : 0;
     }
 }
 
@@ -150,6 +248,9 @@ void LanDiscovery::Stop()
     CloseSocket();
     m_mode = Mode::Disabled;
     m_servers.clear();
+    m_serverIndex.clear();
+    m_serverKeys.clear();
+    m_lastResponseByRequester.clear();
     m_lastRequestSentSeconds = 0.0;
     m_lastResponseReceivedSeconds = 0.0;
     m_lastHostBroadcastSeconds = 0.0;
@@ -269,7 +370,7 @@ void LanDiscovery::CloseSocket()
 
 void LanDiscovery::TickHost(double nowSeconds)
 {
-    std::array<char, 1024> buffer{};
+    std::array<std::uint8_t, 256> buffer{};
 
     while (true)
     {
@@ -277,8 +378,8 @@ void LanDiscovery::TickHost(double nowSeconds)
         SocketLength fromLength = sizeof(from);
         const int received = recvfrom(
             static_cast<NativeSocket>(m_socket),
-            buffer.data(),
-            static_cast<int>(buffer.size() - 1),
+            reinterpret_cast<char*>(buffer.data()),
+            static_cast<int>(buffer.size()),
             0,
             reinterpret_cast<sockaddr*>(&from),
             &fromLength
@@ -289,14 +390,22 @@ void LanDiscovery::TickHost(double nowSeconds)
             break;
         }
 
-        buffer[static_cast<std::size_t>(received)] = '\0';
-        const std::string payload(buffer.data());
+        PacketHeader header;
+        if (!ReadHeader(buffer.data(), static_cast<std::size_t>(received), header) || header.type != kPacketRequest)
+        {
+            continue;
+        }
 
-        if (payload.rfind("DISCOVER_REQUEST", 0) == 0)
+        const std::uint32_t fromIp = ntohl(from.sin_addr.s_addr);
+        const std::uint16_t fromPort = ntohs(from.sin_port);
+        if (!AllowResponse(EndpointKey(fromIp, fromPort), nowSeconds))
         {
-            SendResponseTo(ntohl(from.sin_addr.s_addr), ntohs(from.sin_port));
-            m_lastHostBroadcastSeconds = nowSeconds;
+            ++m_rateLimitedRequests;
+            continue;
         }
+
+        SendResponseTo(fromIp, fromPort);
+        m_lastHostBroadcastSeconds = nowSeconds;
     }
 
     if (nowSeconds - m_lastHostBroadcastSeconds >= kServerBroadcastIntervalSeconds)
@@ -304,6 +413,15 @@ void LanDiscovery::TickHost(double nowSeconds)
         SendResponseTo(INADDR_BROADCAST, m_discoveryPort);
         m_lastHostBroadcastSeconds = nowSeconds;
     }
+
+    if (nowSeconds - m_lastRequesterPruneSeconds >= kRequesterForgetSeconds)
+    {
+        for (auto it = m_lastResponseByRequester.begin(); it != m_lastResponseByRequester.end();)
+        {
+            it = nowSeconds - it->second > kRequesterForgetSeconds ? m_lastResponseByRequester.erase(it) : std::next(it);
+        }
+        m_lastRequesterPruneSeconds = nowSeconds;
+    }
 }
 
 void LanDiscovery::TickClient(double nowSeconds)
@@ -316,7 +434,7 @@ void LanDiscovery::TickClient(double nowSeconds)
         }
     }
 
-    std::array<char, 1024> buffer{};
+    std::array<std::uint8_t, 256> buffer{};
 
     while (true)
     {
@@ -324,8 +442,8 @@ void LanDiscovery::TickClient(double nowSeconds)
         SocketLength fromLength = sizeof(from);
         const int received = recvfrom(
             static_cast<NativeSocket>(m_socket),
-            buffer.data(),
-            static_cast<int>(buffer.size() - 1),
+            reinterpret_cast<char*>(buffer.data()),
+            static_cast<int>(buffer.size()),
             0,
             reinterpret_cast<sockaddr*>(&from),
             &fromLength
@@ -336,63 +454,51 @@ void LanDiscovery::TickClient(double nowSeconds)
             break;
         }
 
-        buffer[static_cast<std::size_t>(received)] = '\0';
-        const std::string payload(buffer.data());
-
-        if (payload.rfind("DISCOVER_RESPONSE", 0) != 0)
+        PacketHeader header;
+        if (static_cast<std::size_t>(received) != kResponseSize ||
+            !ReadHeader(buffer.data(), kResponseSize, header) || header.type != kPacketResponse)
         {
             continue;
         }
 
-        char ipBuffer[64]{};
-        inet_ntop(AF_INET, &from.sin_addr, ipBuffer, sizeof(ipBuffer));
-
-        ServerEntry entry;
-        auto parseIntField = [&](const std::string& key, int fallback) {
-            const std::string text = ParseField(payload, key);
-            if (text.empty())
-            {
-                return fallback;
-            }
-            try
-            {
-                return std::stoi(text);
-            }
-            catch (...)
-            {
-                return fallback;
-            }
-        };
-
-        entry.hostName = ParseField(payload, "name");
-        entry.ip = ParseField(payload, "ip");
-        if (entry.ip.empty())
+        const std::uint8_t* body = buffer.data() + kHeaderSize;
+        const std::uint16_t gamePort = std::max<std::uint16_t>(1, ReadU16(body));
+        const std::uint32_t advertisedIp = ReadU32(body + 4);
+        const std::uint32_t ipv4 = advertisedIp != 0 ? advertisedIp : ntohl(from.sin_addr.s_addr);
+
+        if ((ipv4 >> 24U) == 127U)
         {
-            entry.ip = ipBuffer;
+            continue;
         }
-        entry.port = static_cast<std::uint16_t>(std::max(1, parseIntField("port", 7777)));
-        entry.mapName = ParseField(payload, "map");
-        if (entry.mapName.empty())
+        if (m_preferredIpv4 != 0 && ipv4 == m_preferredIpv4 && gamePort == m_gamePort)
         {
-            entry.mapName = "main_map";
+            continue;
         }
-        entry.players = std::max(0, parseIntField("players", 1));
-        entry.maxPlayers = std::max(1, parseIntField("max", 2));
-        entry.protocolVersion = parseIntField("protocol", 1);
-        entry.buildId = ParseField(payload, "build");
-        entry.compatible = entry.protocolVersion == m_protocolVersion && entry.buildId == m_buildId;
-        entry.lastSeenSeconds = nowSeconds;
 
-        if (entry.ip.rfind("127.", 0) == 0)
+        bool inserted = false;
+        ServerEntry& entry = UpsertServer(ipv4, gamePort, inserted);
+        if (inserted)
         {
-            continue;
+            in_addr address{};
+            address.s_addr = htonl(ipv4);
+            char ipBuffer[INET_ADDRSTRLEN]{};
+            inet_ntop(AF_INET, &address, ipBuffer, sizeof(ipBuffer));
+            entry.ip = ipBuffer;
+            entry.port = gamePort;
         }
-        if (!m_preferredIp.empty() && entry.ip == m_preferredIp && entry.port == m_gamePort)
+
+        entry.players = body[2];
+        entry.maxPlayers = std::max(1, static_cast<int>(body[3]));
+        ReadName(body + 8, entry.hostName);
+        ReadName(body + 9 + kMaxNameBytes, entry.mapName);
+        if (entry.mapName.empty())
         {
-            continue;
+            entry.mapName = "main_map";
         }
-
-        UpsertServer(entry);
+        entry.protocolVersion = header.protocolVersion;
+        entry.buildHash = header.buildHash;
+        entry.compatible = entry.protocolVersion == m_protocolVersion && entry.buildHash == m_buildHash;
+        entry.lastSeenSeconds = nowSeconds;
         m_lastResponseReceivedSeconds = nowSeconds;
     }
 }
@@ -404,25 +510,9 @@ bool LanDiscovery::SendBroadcastRequest()
         return false;
     }
 
-    const std::string payload =
-        "DISCOVER_REQUEST|protocol=" + std::to_string(m_protocolVersion) +
-        "|build=" + m_buildId;
-
-    sockaddr_in address{};
-    address.sin_family = AF_INET;
-    address.sin_port = htons(m_discoveryPort);
-    address.sin_addr.s_addr = htonl(INADDR_BROADCAST);
-
-    const int sent = sendto(
-        static_cast<NativeSocket>(m_socket),
-        payload.c_str(),
-        static_cast<int>(payload.size()),
-        0,
-        reinterpret_cast<sockaddr*>(&address),
-        sizeof(address)
-    );
-
-    return sent >= 0;
+    std::array<std::uint8_t, kHeaderSize> packet{};
+    WriteHeader(packet.data(), kPacketRequest, m_protocolVersion, m_buildHash);
+    return SendPacket(packet.data(), packet.size(), INADDR_BROADCAST, m_discoveryPort);
 }
 
 bool LanDiscovery::SendResponseTo(std::uint32_t ipv4HostOrder, std::uint16_t portHostOrder)
@@ -432,30 +522,34 @@ bool LanDiscovery::SendResponseTo(std::uint32_t ipv4HostOrder, std::uint16_t por
         return false;
     }
 
-    const std::string payload =
-        "DISCOVER_RESPONSE|name=" + m_hostName +
-        "|ip=" + m_preferredIp +
-        "|port=" + std::to_string(m_gamePort) +
-        "|map=" + m_mapName +
-        "|players=" + std::to_string(m_players) +
-        "|max=" + std::to_string(m_maxPlayers) +
-        "|protocol=" + std::to_string(m_protocolVersion) +
-        "|build=" + m_buildId;
+    std::array<std::uint8_t, kResponseSize> packet{};
+    WriteHeader(packet.data(), kPacketResponse, m_protocolVersion, m_buildHash);
+    std::uint8_t* body = packet.data() + kHeaderSize;
+    WriteU16(body, m_gamePort);
+    body[2] = static_cast<std::uint8_t>(std::clamp(m_players, 0, 255));
+    body[3] = static_cast<std::uint8_t>(std::clamp(m_maxPlayers, 1, 255));
+    WriteU32(body + 4, m_preferredIpv4);
+    WriteName(body + 8, m_hostName);
+    WriteName(body + 9 + kMaxNameBytes, m_mapName);
+
+    if (ipv4HostOrder == INADDR_BROADCAST)
+    {
+        portHostOrder = m_discoveryPort;
+    }
+    return SendPacket(packet.data(), packet.size(), ipv4HostOrder, portHostOrder);
+}
 
+bool LanDiscovery::SendPacket(const void* data, std::size_t size, std::uint32_t ipv4HostOrder, std::uint16_t portHostOrder)
+{
     sockaddr_in address{};
     address.sin_family = AF_INET;
     address.sin_port = htons(portHostOrder);
     address.sin_addr.s_addr = htonl(ipv4HostOrder);
 
-    if (ipv4HostOrder == INADDR_BROADCAST)
-    {
-        address.sin_port = htons(m_discoveryPort);
-    }
-
     const int sent = sendto(
         static_cast<NativeSocket>(m_socket),
-        payload.c_str(),
-        static_cast<int>(payload.size()),
+        static_cast<const char*>(data),
+        static_cast<int>(size),
         0,
         reinterpret_cast<sockaddr*>(&address),
         sizeof(address)
@@ -464,47 +558,77 @@ bool LanDiscovery::SendResponseTo(std::uint32_t ipv4HostOrder, std::uint16_t por
     return sent >= 0;
 }
 
-void LanDiscovery::PruneServers(double nowSeconds)
+bool LanDiscovery::AllowResponse(std::uint64_t requesterKey, double nowSeconds)
 {
-    m_servers.erase(
-        std::remove_if(m_servers.begin(), m_servers.end(), [&](const ServerEntry& entry) {
-            return nowSeconds - entry.lastSeenSeconds > kServerTtlSeconds;
-        }),
-        m_servers.end()
+    if (m_lastTokenRefillSeconds < 0.0)
+    {
+        m_lastTokenRefillSeconds = nowSeconds;
+    }
+    m_responseTokens = std::min(
+        kResponseBucketSize,
+        m_responseTokens + (nowSeconds - m_lastTokenRefillSeconds) * kResponseRefillPerSecond
     );
+    m_lastTokenRefillSeconds = nowSeconds;
+
+    const auto it = m_lastResponseByRequester.find(requesterKey);
+    if (it != m_lastResponseByRequester.end() && nowSeconds - it->second < kRequesterMinIntervalSeconds)
+    {
+        return false;
+    }
+    if (m_responseTokens < 1.0)
+    {
+        return false;
+    }
+
+    m_responseTokens -= 1.0;
+    m_lastResponseByRequester[requesterKey] = nowSeconds;
+    return true;
 }
 
-void LanDiscovery::UpsertServer(const ServerEntry& entry)
+void LanDiscovery::PruneServers(double nowSeconds)
 {
-    for (ServerEntry& existing : m_servers)
+    // Compact in place, keeping the surviving servers in discovery order so the lobby list stays put.
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < m_servers.size(); ++i)
     {
-        if (existing.ip == entry.ip && existing.port == entry.port)
+        if (nowSeconds - m_servers[i].lastSeenSeconds > kServerTtlSeconds)
+        {
+            m_serverIndex.erase(m_serverKeys[i]);
+            continue;
+        }
+        if (kept != i)
         {
-            existing = entry;
-            return;
+            m_servers[kept] = std::move(m_servers[i]);
+            m_serverKeys[kept] = std::move(m_serverKeys[i]);
+            m_serverIndex[m_serverKeys[kept]] = kept;
         }
+        ++kept;
     }
-
-    m_servers.push_back(entry);
+    m_servers.resize(kept);
+    m_serverKeys.resize(kept);
 }
 
-std::string LanDiscovery::ParseField(const std::string& payload, const std::string& key)
+LanDiscovery::ServerEntry& LanDiscovery::UpsertServer(std::uint32_t ipv4HostOrder, std::uint16_t port, bool& outInserted)
 {
-    const std::string token = "|" + ToLower(key) + "=";
-    const std::string lowerPayload = ToLower(payload);
-    const std::size_t begin = lowerPayload.find(token);
-    if (begin == std::string::npos)
+    const std::uint64_t key = EndpointKey(ipv4HostOrder, port);
+    const auto [it, inserted] = m_serverIndex.try_emplace(key, m_servers.size());
+    outInserted = inserted;
+    if (inserted)
     {
-        return {};
+        m_servers.emplace_back();
+        m_serverKeys.push_back(key);
     }
+    return m_servers[it->second];
+}
 
-    const std::size_t valueStart = begin + token.size();
-    std::size_t valueEnd = payload.find('|', valueStart);
-    if (valueEnd == std::string::npos)
+std::uint32_t LanDiscovery::HashBuildId(const std::string& buildId)
+{
+    std::uint32_t hash = 2166136261U;
+    for (const char c : buildId)
     {
-        valueEnd = payload.size();
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 16777619U;
     }
-
-    return payload.substr(valueStart, valueEnd - valueStart);
+    return hash;
 }
 } // namespace engine::net
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace engine::net
@@ -17,7 +19,7 @@ public:
         std::string mapName = "main_map";
         int players = 1;
         int maxPlayers = 2;
-        std::string buildId;
+        std::uint32_t buildHash = 0; // FNV-1a of the host's build id string
         int protocolVersion = 1;
         bool compatible = true;
         double lastSeenSeconds = 0.0;
@@ -73,6 +75,10 @@ public:
     [[nodiscard]] double LastRequestSentSeconds() const { return m_lastRequestSentSeconds; }
     [[nodiscard]] double LastResponseReceivedSeconds() const { return m_lastResponseReceivedSeconds; }
     [[nodiscard]] double LastHostBroadcastSeconds() const { return m_lastHostBroadcastSeconds; }
+    [[nodiscard]] std::uint64_t RateLimitedRequests() const { return m_rateLimitedRequests; }
+
+    /// FNV-1a 32-bit; discovery packets carry this instead of the full build id string.
+    [[nodiscard]] static std::uint32_t HashBuildId(const std::string& buildId);
 
 private:
     bool OpenSocket(std::uint16_t bindPort, bool enableBroadcast);
@@ -83,11 +89,13 @@ private:
 
     bool SendBroadcastRequest();
     bool SendResponseTo(std::uint32_t ipv4HostOrder, std::uint16_t portHostOrder);
+    bool SendPacket(const void* data, std::size_t size, std::uint32_t ipv4HostOrder, std::uint16_t portHostOrder);
+    /// Per-requester minimum interval plus a global token bucket, so a burst of scanners cannot flood the host.
+    [[nodiscard]] bool AllowResponse(std::uint64_t requesterKey, double nowSeconds);
 
     void PruneServers(double nowSeconds);
-    void UpsertServer(const ServerEntry& entry);
-
-    static std::string ParseField(const std::string& payload, const std::string& key);
+    /// Returns the entry for ip:port, inserting it when new. O(1) via m_serverIndex.
+    ServerEntry& UpsertServer(std::uint32_t ipv4HostOrder, std::uint16_t port, bool& outInserted);
 
     int m_socket = -1;
     Mode m_mode = Mode::Disabled;
@@ -105,12 +113,23 @@ private:
     int m_maxPlayers = 2;
     int m_protocolVersion = 1;
     std::string m_buildId = "dev";
+    std::uint32_t m_buildHash = 0;
     std::string m_preferredIp;
+    std::uint32_t m_preferredIpv4 = 0; // host order, 0 = let clients use the datagram source
 
     double m_lastRequestSentSeconds = 0.0;
     double m_lastResponseReceivedSeconds = 0.0;
     double m_lastHostBroadcastSeconds = 0.0;
 
     std::vector<ServerEntry> m_servers;
+    // (ipv4 << 16 | port) -> index into m_servers; pruning compacts in order and re-points moved entries.
+    std::unordered_map<std::uint64_t, std::size_t> m_serverIndex;
+    std::vector<std::uint64_t> m_serverKeys; // parallel to m_servers
+
+    std::unordered_map<std::uint64_t, double> m_lastResponseByRequester;
+    double m_responseTokens = 0.0;
+    double m_lastTokenRefillSeconds = -1.0;
+    double m_lastRequesterPruneSeconds = 0.0;
+    std::uint64_t m_rateLimitedRequests = 0;
 };
 } // namespace engine::net
@@ -0,0 +1,176 @@
+#include "engine/net/NetworkConditioner.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace engine::net
+{
+namespace
+{
+// Extra hold applied to a reordered message, on top of the regular latency.
+constexpr double kReorderHoldSeconds = 0.030;
+// Bandwidth bucket depth: how much burst is allowed after an idle period.
+constexpr double kBurstSeconds = 0.050;
+} // namespace
+
+NetworkConditioner::NetworkConditioner()
+    : m_rng(0xC0FFEEU)
+{
+}
+
+void NetworkConditioner::SetConditions(const NetworkConditions& conditions)
+{
+    m_conditions = conditions;
+    m_conditions.latencyMs = std::max(0.0F, m_conditions.latencyMs);
+    m_conditions.jitterMs = std::clamp(m_conditions.jitterMs, 0.0F, m_conditions.latencyMs);
+    m_conditions.lossPercent = std::clamp(m_conditions.lossPercent, 0.0F, 100.0F);
+    m_conditions.duplicatePercent = std::clamp(m_conditions.duplicatePercent, 0.0F, 100.0F);
+    m_conditions.reorderPercent = std::clamp(m_conditions.reorderPercent, 0.0F, 100.0F);
+}
+
+void NetworkConditioner::Submit(Direction direction, std::uint32_t peerId, const void* data, std::size_t size, double nowSeconds)
+{
+    Lane& lane = LaneFor(direction);
+    std::vector<std::uint8_t> payload(size);
+    if (size > 0)
+    {
+        std::memcpy(payload.data(), data, size);
+    }
+
+    const double latency = static_cast<double>(m_conditions.latencyMs) / 1000.0;
+    const double jitter = static_cast<double>(m_conditions.jitterMs) / 1000.0;
+    std::uniform_real_distribution<double> jitterDist(-jitter, jitter);
+    double release = nowSeconds + latency + (jitter > 0.0 ? jitterDist(m_rng) : 0.0);
+
+    if (Roll(m_conditions.reorderPercent))
+    {
+        release += std::max(kReorderHoldSeconds, 2.0 * jitter);
+        ++m_stats.reorderedMessages;
+    }
+    else
+    {
+        // Jitter alone must not reorder: real links are mostly FIFO.
+        release = std::max(release, lane.lastInOrderRelease);
+        lane.lastInOrderRelease = release;
+    }
+
+    if (Roll(m_conditions.duplicatePercent))
+    {
+        Enqueue(lane, peerId, payload, release + jitter * 0.5);
+        ++m_stats.duplicatedMessages;
+    }
+    Enqueue(lane, peerId, std::move(payload), release);
+    ++m_stats.delayedMessages;
+}
+
+void NetworkConditioner::Release(Direction direction, double nowSeconds, std::vector<Message>& outMessages)
+{
+    Lane& lane = LaneFor(direction);
+    const bool limited = m_conditions.bandwidthKbps > 0;
+    const double bytesPerSecond = static_cast<double>(m_conditions.bandwidthKbps) * 1000.0 / 8.0;
+    if (limited)
+    {
+        if (lane.lastRefillSeconds < 0.0)
+        {
+            lane.lastRefillSeconds = nowSeconds;
+            lane.budgetBytes = bytesPerSecond * kBurstSeconds;
+        }
+        lane.budgetBytes = std::min(
+            bytesPerSecond * kBurstSeconds,
+            lane.budgetBytes + (nowSeconds - lane.lastRefillSeconds) * bytesPerSecond
+        );
+        lane.lastRefillSeconds = nowSeconds;
+    }
+
+    while (!lane.pending.empty())
+    {
+        auto it = lane.pending.begin();
+        if (it->first.first > nowSeconds)
+        {
+            break;
+        }
+        // A message may overdraw the bucket so large payloads cannot starve; the debt delays the next one.
+        if (limited && lane.budgetBytes <= 0.0)
+        {
+            break;
+        }
+
+        const std::size_t size = it->second.payload.size();
+        if (limited)
+        {
+            lane.budgetBytes -= static_cast<double>(size);
+        }
+        m_stats.queuedBytes -= std::min(m_stats.queuedBytes, size);
+        outMessages.push_back(std::move(it->second));
+        lane.pending.erase(it);
+    }
+}
+
+void NetworkConditioner::DrainAll(Direction direction, std::vector<Message>& outMessages)
+{
+    Lane& lane = LaneFor(direction);
+    for (auto& [key, message] : lane.pending)
+    {
+        m_stats.queuedBytes -= std::min(m_stats.queuedBytes, message.payload.size());
+        outMessages.push_back(std::move(message));
+    }
+    lane = Lane{};
+}
+
+bool NetworkConditioner::ShouldDropDatagram()
+{
+    if (!m_conditions.enabled || !Roll(m_conditions.lossPercent))
+    {
+        return false;
+    }
+    ++m_stats.droppedDatagrams;
+    return true;
+}
+
+void NetworkConditioner::DropPeer(std::uint32_t peerId)
+{
+    for (Lane* lane : {&m_outbound, &m_inbound})
+    {
+        for (auto it = lane->pending.begin(); it != lane->pending.end();)
+        {
+            if (it->second.peerId == peerId)
+            {
+                m_stats.queuedBytes -= std::min(m_stats.queuedBytes, it->second.payload.size());
+                it = lane->pending.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
+
+void NetworkConditioner::Clear()
+{
+    m_outbound = Lane{};
+    m_inbound = Lane{};
+    m_stats.queuedBytes = 0;
+}
+
+NetworkConditioner::Lane& NetworkConditioner::LaneFor(Direction direction)
+{
+    return direction == Direction::Outbound ? m_outbound : m_inbound;
+}
+
+bool NetworkConditioner::Roll(float percent)
+{
+    if (percent <= 0.0F)
+    {
+        return false;
+    }
+    std::uniform_real_distribution<float> dist(0.0F, 100.0F);
+    return dist(m_rng) < percent;
+}
+
+void NetworkConditioner::Enqueue(Lane& lane, std::uint32_t peerId, std::vector<std::uint8_t> payload, double releaseSeconds)
+{
+    m_stats.queuedBytes += payload.size();
+    lane.pending.emplace(std::make_pair(releaseSeconds, m_sequence++), Message{peerId, std::move(payload)});
+}
+} // namespace engine::net
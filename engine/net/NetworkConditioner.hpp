@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace engine::net
+{
+/// Simulated link conditions applied by NetworkSession. All zero = pass-through.
+struct NetworkConditions
+{
+    bool enabled = false;
+    float latencyMs = 0.0F;      // one-way, added on send and on receive
+    float jitterMs = 0.0F;       // +/- uniform around latencyMs
+    float lossPercent = 0.0F;    // incoming UDP datagrams dropped before ENet sees them
+    float duplicatePercent = 0.0F;
+    float reorderPercent = 0.0F; // message held back so later ones overtake it
+    std::uint32_t bandwidthKbps = 0; // per direction, 0 = unlimited
+};
+
+/// Delays, duplicates, reorders and rate-limits whole messages per direction.
+/// Loss is applied at datagram level (see ShouldDropDatagram) so ENet's reliable
+/// channel retransmits exactly as it would on a lossy link.
+class NetworkConditioner
+{
+public:
+    enum class Direction
+    {
+        Outbound,
+        Inbound
+    };
+
+    struct Message
+    {
+        std::uint32_t peerId = 0;
+        std::vector<std::uint8_t> payload;
+    };
+
+    struct Stats
+    {
+        std::uint64_t delayedMessages = 0;
+        std::uint64_t duplicatedMessages = 0;
+        std::uint64_t reorderedMessages = 0;
+        std::uint64_t droppedDatagrams = 0;
+        std::size_t queuedBytes = 0;
+    };
+
+    NetworkConditioner();
+
+    void SetConditions(const NetworkConditions& conditions);
+    [[nodiscard]] const NetworkConditions& Conditions() const { return m_conditions; }
+    [[nodiscard]] bool Active() const { return m_conditions.enabled; }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+
+    void Submit(Direction direction, std::uint32_t peerId, const void* data, std::size_t size, double nowSeconds);
+    /// Moves every message that is due and fits the bandwidth budget into outMessages (in release order).
+    void Release(Direction direction, double nowSeconds, std::vector<Message>& outMessages);
+    /// Moves every queued message into outMessages (in release order), ignoring release times and the
+    /// bandwidth budget. Used when the simulator is switched off so in-flight traffic is not lost.
+    void DrainAll(Direction direction, std::vector<Message>& outMessages);
+    [[nodiscard]] bool ShouldDropDatagram();
+
+    void DropPeer(std::uint32_t peerId);
+    void Clear();
+
+private:
+    struct Lane
+    {
+        // (release time, submit sequence) -> message; sequence keeps equal release times FIFO.
+        std::map<std::pair<double, std::uint64_t>, Message> pending;
+        double lastInOrderRelease = 0.0;
+        double budgetBytes = 0.0;
+        double lastRefillSeconds = -1.0;
+    };
+
+    [[nodiscard]] Lane& LaneFor(Direction direction);
+    [[nodiscard]] bool Roll(float percent);
+    void Enqueue(Lane& lane, std::uint32_t peerId, std::vector<std::uint8_t> payload, double releaseSeconds);
+
+    NetworkConditions m_conditions;
+    Lane m_outbound;
+    Lane m_inbound;
+    std::uint64_t m_sequence = 0;
+    std::mt19937 m_rng;
+    Stats m_stats;
+};
+} // namespace engine::net
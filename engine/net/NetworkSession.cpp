@@ -1,12 +1,48 @@
 #include "engine/net/NetworkSession.hpp"
 
+#include <chrono>
 #include <cstring>
 #include <iostream>
+#include <mutex>
 
 #include <enet/enet.h>
 
 namespace engine::net
 {
+namespace
+{
+NetworkSession::PeerId PeerIdOf(const ENetPeer* peer)
+{
+    if (peer == nullptr)
+    {
+        return NetworkSession::kInvalidPeer;
+    }
+    return static_cast<NetworkSession::PeerId>(reinterpret_cast<std::uintptr_t>(peer->data));
+}
+
+double SteadySeconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ENet's intercept callback carries no user pointer, so hosts are mapped back to their conditioner.
+std::mutex g_interceptMutex;
+std::unordered_map<ENetHost*, NetworkConditioner*> g_interceptConditioners;
+
+int ENET_CALLBACK InterceptDatagram(ENetHost* host, ENetEvent* event)
+{
+    (void)event;
+    std::lock_guard<std::mutex> lock(g_interceptMutex);
+    const auto it = g_interceptConditioners.find(host);
+    if (it == g_interceptConditioners.end())
+    {
+        return 0;
+    }
+    // 1 = consumed: ENet never sees the datagram, so reliable commands in it time out and get resent.
+    return it->second->ShouldDropDatagram() ? 1 : 0;
+}
+} // namespace
+
 NetworkSession::~NetworkSession()
 {
     Shutdown();
@@ -60,6 +96,7 @@ bool NetworkSession::StartHost(std::uint16_t port, std::size_t maxPeers)
         m_mode = Mode::Offline;
         return false;
     }
+    AttachHost(m_host);
 
     m_mode = Mode::Host;
     m_connected = false;
@@ -82,6 +119,7 @@ bool NetworkSession::StartClient(const std::string& host, std::uint16_t port)
         m_mode = Mode::Offline;
         return false;
     }
+    AttachHost(m_host);
 
     ENetAddress address{};
     if (enet_address_set_host(&address, host.c_str()) != 0)
@@ -109,9 +147,20 @@ bool NetworkSession::StartClient(const std::string& host, std::uint16_t port)
 
 void NetworkSession::Disconnect()
 {
-    if (m_connectedPeer != nullptr)
+    if (m_connectedPeer != nullptr || !m_peers.empty())
     {
-        enet_peer_disconnect(m_connectedPeer, 0);
+        for (const auto& [peerId, peer] : m_peers)
+        {
+            (void)peerId;
+            if (peer != m_connectedPeer)
+            {
+                enet_peer_disconnect(peer, 0);
+            }
+        }
+        if (m_connectedPeer != nullptr)
+        {
+            enet_peer_disconnect(m_connectedPeer, 0);
+        }
 
         ENetEvent event{};
         while (m_host != nullptr && enet_host_service(m_host, &event, 10) > 0)
@@ -138,6 +187,12 @@ void NetworkSession::Poll(int timeoutMs)
         return;
     }
 
+    const bool conditioned = m_conditioner.Active();
+    if (conditioned)
+    {
+        ReleaseConditioned(NetworkConditioner::Direction::Outbound);
+    }
+
     ENetEvent event{};
     while (enet_host_service(m_host, &event, timeoutMs) > 0)
     {
@@ -147,16 +202,34 @@ void NetworkSession::Poll(int timeoutMs)
         {
             case ENET_EVENT_TYPE_CONNECT:
             {
+                const PeerId peerId = m_nextPeerId++;
+                event.peer->data = reinterpret_cast<void*>(static_cast<std::uintptr_t>(peerId));
+                m_peers[peerId] = event.peer;
+                m_peerBytesSent[peerId] = 0;
                 m_connectedPeer = event.peer;
                 m_connected = true;
                 PollEvent pollEvent;
+                pollEvent.peerId = peerId;
                 pollEvent.connected = true;
                 m_events.push_back(std::move(pollEvent));
                 break;
             }
             case ENET_EVENT_TYPE_RECEIVE:
             {
+                if (conditioned)
+                {
+                    m_conditioner.Submit(
+                        NetworkConditioner::Direction::Inbound,
+                        PeerIdOf(event.peer),
+                        event.packet->data,
+                        event.packet->dataLength,
+                        SteadySeconds()
+                    );
+                    enet_packet_destroy(event.packet);
+                    break;
+                }
                 PollEvent pollEvent;
+                pollEvent.peerId = PeerIdOf(event.peer);
                 pollEvent.payload.resize(event.packet->dataLength);
                 if (event.packet->dataLength > 0)
                 {
@@ -168,12 +241,21 @@ void NetworkSession::Poll(int timeoutMs)
             }
             case ENET_EVENT_TYPE_DISCONNECT:
             {
-                m_connected = false;
+                const PeerId peerId = PeerIdOf(event.peer);
+                m_peers.erase(peerId);
+                m_peerBytesSent.erase(peerId);
+                m_peerLastPacketsLost.erase(peerId);
+                m_peerRetransmits.erase(peerId);
+                m_conditioner.DropPeer(peerId);
+                event.peer->data = nullptr;
                 if (event.peer == m_connectedPeer)
                 {
-                    m_connectedPeer = nullptr;
+                    // Keep legacy single-peer sends pointed at a live client while others remain.
+                    m_connectedPeer = m_peers.empty() ? nullptr : m_peers.begin()->second;
                 }
+                m_connected = m_connectedPeer != nullptr;
                 PollEvent pollEvent;
+                pollEvent.peerId = peerId;
                 pollEvent.disconnected = true;
                 m_events.push_back(std::move(pollEvent));
                 break;
@@ -183,6 +265,12 @@ void NetworkSession::Poll(int timeoutMs)
                 break;
         }
     }
+
+    if (conditioned)
+    {
+        ReleaseConditioned(NetworkConditioner::Direction::Inbound);
+    }
+    SampleRetransmits();
 }
 
 std::optional<NetworkSession::PollEvent> NetworkSession::PopEvent()
@@ -204,15 +292,14 @@ bool NetworkSession::SendReliable(const void* data, std::size_t size)
         return false;
     }
 
-    ENetPacket* packet = enet_packet_create(data, size, ENET_PACKET_FLAG_RELIABLE);
-    if (packet == nullptr)
+    if (m_conditioner.Active())
     {
-        return false;
+        m_conditioner.Submit(NetworkConditioner::Direction::Outbound, PeerIdOf(m_connectedPeer), data, size, SteadySeconds());
+        return true;
     }
 
-    if (enet_peer_send(m_connectedPeer, 0, packet) != 0)
+    if (!SendNow(m_connectedPeer, data, size))
     {
-        enet_packet_destroy(packet);
         return false;
     }
 
@@ -227,6 +314,17 @@ bool NetworkSession::BroadcastReliable(const void* data, std::size_t size)
         return false;
     }
 
+    if (m_conditioner.Active())
+    {
+        const double now = SteadySeconds();
+        for (const auto& [peerId, peer] : m_peers)
+        {
+            (void)peer;
+            m_conditioner.Submit(NetworkConditioner::Direction::Outbound, peerId, data, size, now);
+        }
+        return true;
+    }
+
     ENetPacket* packet = enet_packet_create(data, size, ENET_PACKET_FLAG_RELIABLE);
     if (packet == nullptr)
     {
@@ -239,12 +337,107 @@ bool NetworkSession::BroadcastReliable(const void* data, std::size_t size)
     return true;
 }
 
+bool NetworkSession::SendReliableTo(PeerId peerId, const void* data, std::size_t size, bool flush)
+{
+    ENetPeer* peer = FindPeer(peerId);
+    if (peer == nullptr || data == nullptr || size == 0)
+    {
+        return false;
+    }
+
+    if (m_conditioner.Active())
+    {
+        m_conditioner.Submit(NetworkConditioner::Direction::Outbound, peerId, data, size, SteadySeconds());
+        m_peerBytesSent[peerId] += size;
+        return true;
+    }
+
+    if (!SendNow(peer, data, size))
+    {
+        return false;
+    }
+
+    m_peerBytesSent[peerId] += size;
+    if (flush)
+    {
+        enet_host_flush(m_host);
+    }
+    return true;
+}
+
+bool NetworkSession::SendReliableToPeers(const std::vector<PeerId>& peerIds, const void* data, std::size_t size, bool flush)
+{
+    if (m_host == nullptr || peerIds.empty() || data == nullptr || size == 0)
+    {
+        return false;
+    }
+
+    if (m_conditioner.Active())
+    {
+        const double now = SteadySeconds();
+        bool anyQueued = false;
+        for (const PeerId peerId : peerIds)
+        {
+            if (FindPeer(peerId) != nullptr)
+            {
+                m_conditioner.Submit(NetworkConditioner::Direction::Outbound, peerId, data, size, now);
+                m_peerBytesSent[peerId] += size;
+                anyQueued = true;
+            }
+        }
+        return anyQueued;
+    }
+
+    ENetPacket* packet = enet_packet_create(data, size, ENET_PACKET_FLAG_RELIABLE);
+    if (packet == nullptr)
+    {
+        return false;
+    }
+
+    bool anySent = false;
+    for (const PeerId peerId : peerIds)
+    {
+        ENetPeer* peer = FindPeer(peerId);
+        if (peer == nullptr)
+        {
+            continue;
+        }
+        // ENet ref-counts the packet per queued peer, so the payload is encoded and allocated once.
+        if (enet_peer_send(peer, 0, packet) == 0)
+        {
+            m_peerBytesSent[peerId] += size;
+            anySent = true;
+        }
+    }
+
+    if (!anySent)
+    {
+        enet_packet_destroy(packet);
+        return false;
+    }
+
+    if (flush)
+    {
+        enet_host_flush(m_host);
+    }
+    return true;
+}
+
+void NetworkSession::Flush()
+{
+    if (m_host != nullptr)
+    {
+        enet_host_flush(m_host);
+    }
+}
+
 NetworkSession::ConnectionStats NetworkSession::GetConnectionStats() const
 {
     ConnectionStats stats;
     if (m_host != nullptr)
     {
         stats.peerCount = static_cast<std::uint32_t>(m_host->connectedPeers);
+        stats.totalSentBytes = m_host->totalSentData;
     }
 
     if (m_connectedPeer != nullptr)
@@ -256,6 +449,37 @@ NetworkSession::ConnectionStats NetworkSession::GetConnectionStats() const
     return stats;
 }
 
+std::vector<NetworkSession::PeerStats> NetworkSession::GetPeerStats() const
+{
+    std::vector<PeerStats> result;
+    result.reserve(m_peers.size());
+    for (const auto& [peerId, peer] : m_peers)
+    {
+        PeerStats stats;
+        stats.peerId = peerId;
+        stats.rttMs = peer->roundTripTime;
+        stats.packetLoss = peer->packetLoss;
+        const auto bytesIt = m_peerBytesSent.find(peerId);
+        stats.bytesSent = bytesIt != m_peerBytesSent.end() ? bytesIt->second : 0;
+        const auto retransmitIt = m_peerRetransmits.find(peerId);
+        stats.reliableRetransmits = retransmitIt != m_peerRetransmits.end() ? retransmitIt->second : 0;
+        result.push_back(stats);
+    }
+    return result;
+}
+
+std::vector<NetworkSession::PeerId> NetworkSession::ConnectedPeers() const
+{
+    std::vector<PeerId> result;
+    result.reserve(m_peers.size());
+    for (const auto& [peerId, peer] : m_peers)
+    {
+        (void)peer;
+        result.push_back(peerId);
+    }
+    return result;
+}
+
 std::size_t NetworkSession::ConnectedPeerCount() const
 {
     if (m_host == nullptr)
@@ -274,9 +498,114 @@ void NetworkSession::ResetTransport()
 {
     if (m_host != nullptr)
     {
+        {
+            std::lock_guard<std::mutex> lock(g_interceptMutex);
+            g_interceptConditioners.erase(m_host);
+        }
         enet_host_destroy(m_host);
         m_host = nullptr;
     }
     m_connectedPeer = nullptr;
+    m_peers.clear();
+    m_peerBytesSent.clear();
+    m_peerLastPacketsLost.clear();
+    m_peerRetransmits.clear();
+    m_conditioner.Clear();
+}
+
+ENetPeer* NetworkSession::FindPeer(PeerId peerId) const
+{
+    const auto it = m_peers.find(peerId);
+    return it != m_peers.end() ? it->second : nullptr;
+}
+
+void NetworkSession::SetConditions(const NetworkConditions& conditions)
+{
+    const bool wasActive = m_conditioner.Active();
+    m_conditioner.SetConditions(conditions);
+    if (wasActive && !m_conditioner.Active())
+    {
+        // Deliver what is still in flight instead of silently losing reliable traffic.
+        ReleaseConditioned(NetworkConditioner::Direction::Outbound, true);
+        ReleaseConditioned(NetworkConditioner::Direction::Inbound, true);
+        Flush();
+    }
+}
+
+bool NetworkSession::SendNow(ENetPeer* peer, const void* data, std::size_t size)
+{
+    ENetPacket* packet = enet_packet_create(data, size, ENET_PACKET_FLAG_RELIABLE);
+    if (packet == nullptr)
+    {
+        return false;
+    }
+
+    if (enet_peer_send(peer, 0, packet) != 0)
+    {
+        enet_packet_destroy(packet);
+        return false;
+    }
+    return true;
+}
+
+void NetworkSession::ReleaseConditioned(NetworkConditioner::Direction direction, bool drainAll)
+{
+    m_releasedScratch.clear();
+    if (drainAll)
+    {
+        m_conditioner.DrainAll(direction, m_releasedScratch);
+    }
+    else
+    {
+        m_conditioner.Release(direction, SteadySeconds(), m_releasedScratch);
+    }
+    if (m_releasedScratch.empty())
+    {
+        return;
+    }
+
+    for (NetworkConditioner::Message& message : m_releasedScratch)
+    {
+        if (direction == NetworkConditioner::Direction::Inbound)
+        {
+            PollEvent pollEvent;
+            pollEvent.peerId = message.peerId;
+            pollEvent.payload = std::move(message.payload);
+            m_events.push_back(std::move(pollEvent));
+            continue;
+        }
+
+        // Bytes were already counted in m_peerBytesSent when the message was submitted.
+        ENetPeer* peer = FindPeer(message.peerId);
+        if (peer != nullptr)
+        {
+            (void)SendNow(peer, message.payload.data(), message.payload.size());
+        }
+    }
+
+    if (direction == NetworkConditioner::Direction::Outbound && m_host != nullptr)
+    {
+        enet_host_flush(m_host);
+    }
+}
+
+void NetworkSession::SampleRetransmits()
+{
+    // ENet bumps packetsLost per timed-out reliable command (which it then resends) and zeroes it
+    // every packet-loss interval, so accumulate the deltas.
+    for (const auto& [peerId, peer] : m_peers)
+    {
+        std::uint32_t& last = m_peerLastPacketsLost[peerId];
+        const std::uint32_t current = peer->packetsLost;
+        m_peerRetransmits[peerId] += current >= last ? current - last : current;
+        last = current;
+    }
+}
+
+void NetworkSession::AttachHost(ENetHost* host)
+{
+    host->intercept = InterceptDatagram;
+    std::lock_guard<std::mutex> lock(g_interceptMutex);
+    g_interceptConditioners[host] = &m_conditioner;
 }
 } // namespace engine::net
@@ -4,8 +4,11 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "engine/net/NetworkConditioner.hpp"
+
 struct _ENetHost;
 struct _ENetPeer;
 
@@ -21,8 +24,13 @@ public:
         Client
     };
 
+    /// Stable per-connection id (host: one per client, client: the host peer). 0 = none.
+    using PeerId = std::uint32_t;
+    static constexpr PeerId kInvalidPeer = 0;
+
     struct PollEvent
     {
+        PeerId peerId = kInvalidPeer;
         bool connected = false;
         bool disconnected = false;
         std::vector<std::uint8_t> payload;
@@ -34,6 +42,16 @@ public:
         std::uint32_t rttMs = 0;
         std::uint32_t packetLoss = 0;
         std::uint32_t peerCount = 0;
+        std::uint64_t totalSentBytes = 0;
+    };
+
+    struct PeerStats
+    {
+        PeerId peerId = kInvalidPeer;
+        std::uint32_t rttMs = 0;
+        std::uint32_t packetLoss = 0;
+        std::uint64_t bytesSent = 0; // cumulative payload bytes submitted to this peer
+        std::uint64_t reliableRetransmits = 0;
     };
 
     NetworkSession() = default;
@@ -54,7 +72,19 @@ public:
 
     bool SendReliable(const void* data, std::size_t size);
     bool BroadcastReliable(const void* data, std::size_t size);
+    /// Queue a reliable packet for one peer. Pass flush=false when sending a batch and call Flush() once.
+    bool SendReliableTo(PeerId peerId, const void* data, std::size_t size, bool flush = true);
+    /// Queue one shared packet (single allocation, ENet ref-counted) for several peers.
+    bool SendReliableToPeers(const std::vector<PeerId>& peerIds, const void* data, std::size_t size, bool flush = true);
+    void Flush();
     [[nodiscard]] ConnectionStats GetConnectionStats() const;
+    [[nodiscard]] std::vector<PeerStats> GetPeerStats() const;
+    [[nodiscard]] std::vector<PeerId> ConnectedPeers() const;
+
+    /// Link simulation (latency/jitter/loss/duplication/reordering/bandwidth) on send and receive.
+    void SetConditions(const NetworkConditions& conditions);
+    [[nodiscard]] const NetworkConditions& Conditions() const { return m_conditioner.Conditions(); }
+    [[nodiscard]] const NetworkConditioner::Stats& ConditionerStats() const { return m_conditioner.GetStats(); }
 
     [[nodiscard]] Mode GetMode() const { return m_mode; }
     [[nodiscard]] bool IsConnected() const { return m_connectedPeer != nullptr && m_connected; }
@@ -64,6 +94,11 @@ public:
 private:
     bool EnsureInitialized();
     void ResetTransport();
+    [[nodiscard]] _ENetPeer* FindPeer(PeerId peerId) const;
+    bool SendNow(_ENetPeer* peer, const void* data, std::size_t size);
+    void ReleaseConditioned(NetworkConditioner::Direction direction, bool drainAll = false);
+    void SampleRetransmits();
+    void AttachHost(_ENetHost* host);
 
     bool m_initialized = false;
     bool m_connected = false;
@@ -71,6 +106,14 @@ private:
 
     _ENetHost* m_host = nullptr;
     _ENetPeer* m_connectedPeer = nullptr;
+    std::unordered_map<PeerId, _ENetPeer*> m_peers;
+    std::unordered_map<PeerId, std::uint64_t> m_peerBytesSent;
+    PeerId m_nextPeerId = 1;
+    std::unordered_map<PeerId, std::uint32_t> m_peerLastPacketsLost;
+    std::unordered_map<PeerId, std::uint64_t> m_peerRetransmits;
+
+    NetworkConditioner m_conditioner;
+    std::vector<NetworkConditioner::Message> m_releasedScratch;
 
     std::vector<PollEvent> m_events;
 };
@@ -690,6 +690,39 @@ std::filesystem::path ColliderGen_WallBoxes::GetCachePath(const std::filesystem:
     return meshPath.string() + ".colliders.json";
 }
 
+WallColliderConfig ColliderGen_WallBoxes::LoopMeshConfig()
+{
+    WallColliderConfig config;
+    config.cellSize = 0.06f;
+    config.maxBoxes = 8;
+    config.padXZ = 0.03f;
+    config.minIslandCells = 1;
+    config.cleanup = true;
+    config.maxVolumeExcess = 2.5f;
+    config.minCoverage = 0.70f;
+    return config;
+}
+
+std::optional<std::vector<WallBoxCollider>> ColliderGen_WallBoxes::LoadValidCache(
+    const std::filesystem::path& meshPath,
+    const std::string& meshHash,
+    const WallColliderConfig& config)
+{
+    const std::optional<WallColliderCache> cache = LoadCache(GetCachePath(meshPath));
+    if (!cache.has_value() || cache->meshHash != meshHash)
+    {
+        return std::nullopt;
+    }
+    const WallColliderConfig& cached = cache->config;
+    if (cached.cellSize != config.cellSize || cached.maxBoxes != config.maxBoxes || cached.padXZ != config.padXZ ||
+        cached.minIslandCells != config.minIslandCells || cached.cleanup != config.cleanup ||
+        cached.maxVolumeExcess != config.maxVolumeExcess || cached.minCoverage != config.minCoverage)
+    {
+        return std::nullopt;
+    }
+    return cache->boxes;
+}
+
 std::optional<WallColliderCache> ColliderGen_WallBoxes::LoadCache(const std::filesystem::path& cachePath)
 {
     std::ifstream file(cachePath);
@@ -713,6 +746,8 @@ std::optional<WallColliderCache> ColliderGen_WallBoxes::LoadCache(const std::fil
             cache.config.padXZ = cfg.value("padXZ", 0.02f);
             cache.config.minIslandCells = cfg.value("minIslandCells", 4);
             cache.config.cleanup = cfg.value("cleanup", true);
+            cache.config.maxVolumeExcess = cfg.value("maxVolumeExcess", 0.5f);
+            cache.config.minCoverage = cfg.value("minCoverage", 0.95f);
         }
 
         // Load boxes
@@ -758,7 +793,9 @@ bool ColliderGen_WallBoxes::SaveCache(
             {"maxBoxes", cache.config.maxBoxes},
             {"padXZ", cache.config.padXZ},
             {"minIslandCells", cache.config.minIslandCells},
-            {"cleanup", cache.config.cleanup}
+            {"cleanup", cache.config.cleanup},
+            {"maxVolumeExcess", cache.config.maxVolumeExcess},
+            {"minCoverage", cache.config.minCoverage}
         };
 
         // Save boxes
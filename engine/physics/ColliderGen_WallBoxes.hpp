@@ -81,6 +81,16 @@ public:
     // Get default cache path for a mesh file
     static std::filesystem::path GetCachePath(const std::filesystem::path& meshPath);
 
+    // Config used for loop element meshes (gameplay and the asset cooker must agree on it)
+    static WallColliderConfig LoopMeshConfig();
+
+    // Cached boxes for this mesh, if the cache was built from the same geometry and config
+    static std::optional<std::vector<WallBoxCollider>> LoadValidCache(
+        const std::filesystem::path& meshPath,
+        const std::string& meshHash,
+        const WallColliderConfig& config
+    );
+
 private:
     // Internal: build occupancy grid from mesh triangles
     static void BuildOccupancyGrid(
@@ -6,6 +6,10 @@ namespace engine::platform
 {
 void Input::Update(GLFWwindow* window)
 {
+#if BUILD_HEADLESS
+    // Headless builds link no glfw: there is no window to poll.
+    (void)window;
+#else
     m_previousKeys = m_currentKeys;
     m_previousMouse = m_currentMouse;
 
@@ -35,6 +39,7 @@ void Input::Update(GLFWwindow* window)
         m_mouseDelta = newPosition - m_mousePosition;
         m_mousePosition = newPosition;
     }
+#endif
 }
 
 bool Input::IsKeyDown(int key) const
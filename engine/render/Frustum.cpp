@@ -1,12 +1,72 @@
 #include "engine/render/Frustum.hpp"
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
 
 #include <glm/geometric.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#if defined(__AVX2__)
+#define FRUSTUM_CULL_AVX2 1
+#define FRUSTUM_CULL_SSE 0
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FRUSTUM_CULL_AVX2 0
+#define FRUSTUM_CULL_SSE 1
+#include <emmintrin.h>
+#else
+#define FRUSTUM_CULL_AVX2 0
+#define FRUSTUM_CULL_SSE 0
+#endif
+
 namespace engine::render
 {
+void AabbBatch::Clear()
+{
+    for (std::vector<float>* bound : {&minX, &minY, &minZ, &maxX, &maxY, &maxZ})
+    {
+        bound->clear();
+    }
+}
+
+void AabbBatch::Reserve(std::size_t count)
+{
+    for (std::vector<float>* bound : {&minX, &minY, &minZ, &maxX, &maxY, &maxZ})
+    {
+        bound->reserve(count);
+    }
+}
+
+void AabbBatch::Resize(std::size_t count)
+{
+    for (std::vector<float>* bound : {&minX, &minY, &minZ, &maxX, &maxY, &maxZ})
+    {
+        bound->resize(count, 0.0F);
+    }
+}
+
+void AabbBatch::Add(const glm::vec3& min, const glm::vec3& max)
+{
+    minX.push_back(min.x);
+    minY.push_back(min.y);
+    minZ.push_back(min.z);
+    maxX.push_back(max.x);
+    maxY.push_back(max.y);
+    maxZ.push_back(max.z);
+}
+
+void AabbBatch::Set(std::size_t index, const glm::vec3& min, const glm::vec3& max)
+{
+    minX[index] = min.x;
+    minY[index] = min.y;
+    minZ[index] = min.z;
+    maxX[index] = max.x;
+    maxY[index] = max.y;
+    maxZ[index] = max.z;
+}
+
 void Frustum::Extract(const glm::mat4& viewProjection)
 {
     const float* m = glm::value_ptr(viewProjection);
@@ -81,6 +141,29 @@ bool Frustum::IntersectsAABB(const glm::vec3& min, const glm::vec3& max) const
     return true;
 }
 
+Frustum::Containment Frustum::ClassifyAABB(const glm::vec3& min, const glm::vec3& max) const
+{
+    Containment result = Containment::Inside;
+    for (const auto& plane : m_planes)
+    {
+        glm::vec3 positive = min;
+        glm::vec3 negative = max;
+        if (plane.x >= 0.0F) { positive.x = max.x; negative.x = min.x; }
+        if (plane.y >= 0.0F) { positive.y = max.y; negative.y = min.y; }
+        if (plane.z >= 0.0F) { positive.z = max.z; negative.z = min.z; }
+
+        if (plane.x * positive.x + plane.y * positive.y + plane.z * positive.z + plane.w < 0.0F)
+        {
+            return Containment::Outside;
+        }
+        if (plane.x * negative.x + plane.y * negative.y + plane.z * negative.z + plane.w < 0.0F)
+        {
+            result = Containment::Intersecting;
+        }
+    }
+    return result;
+}
+
 bool Frustum::IntersectsSphere(const glm::vec3& center, float radius) const
 {
     for (const auto& plane : m_planes)
@@ -106,4 +189,114 @@ bool Frustum::IntersectsPoint(const glm::vec3& point) const
     }
     return true;
 }
+
+const char* Frustum::CullBatchPath()
+{
+#if FRUSTUM_CULL_AVX2
+    return "AVX2";
+#elif FRUSTUM_CULL_SSE
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+std::size_t Frustum::CullBatch(
+    const AabbBatch& boxes,
+    std::vector<std::uint32_t>& outVisible,
+    std::size_t begin,
+    std::size_t end
+) const
+{
+    end = std::min(end, boxes.Size());
+    if (begin >= end)
+    {
+        return 0;
+    }
+
+    // Per plane the positive vertex picks min or max per axis; in SoA that is just a choice of array.
+    struct PlaneArrays
+    {
+        const float* x;
+        const float* y;
+        const float* z;
+    };
+    std::array<PlaneArrays, 6> planeArrays{};
+    for (std::size_t p = 0; p < 6; ++p)
+    {
+        const glm::vec4& plane = m_planes[p];
+        planeArrays[p] = PlaneArrays{
+            plane.x >= 0.0F ? boxes.maxX.data() : boxes.minX.data(),
+            plane.y >= 0.0F ? boxes.maxY.data() : boxes.minY.data(),
+            plane.z >= 0.0F ? boxes.maxZ.data() : boxes.minZ.data(),
+        };
+    }
+
+    // Write compacted indices straight into the reserved tail, then trim.
+    const std::size_t firstOut = outVisible.size();
+    outVisible.resize(firstOut + (end - begin));
+    std::uint32_t* out = outVisible.data() + firstOut;
+    std::size_t written = 0;
+    std::size_t i = begin;
+
+    // Same arithmetic order as IntersectsAABB, and rejection is "not >= 0" like its "distance < 0",
+    // so results match it exactly (NaN bounds stay visible).
+#if FRUSTUM_CULL_AVX2
+    const __m256 zero = _mm256_setzero_ps();
+    for (; i + 8 <= end; i += 8)
+    {
+        __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (std::size_t p = 0; p < 6; ++p)
+        {
+            const glm::vec4& plane = m_planes[p];
+            __m256 distance = _mm256_mul_ps(_mm256_set1_ps(plane.x), _mm256_loadu_ps(planeArrays[p].x + i));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.y), _mm256_loadu_ps(planeArrays[p].y + i)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.z), _mm256_loadu_ps(planeArrays[p].z + i)));
+            distance = _mm256_add_ps(distance, _mm256_set1_ps(plane.w));
+            visible = _mm256_and_ps(visible, _mm256_cmp_ps(distance, zero, _CMP_NLT_UQ));
+        }
+        for (auto mask = static_cast<unsigned int>(_mm256_movemask_ps(visible)); mask != 0; mask &= mask - 1)
+        {
+            out[written++] = static_cast<std::uint32_t>(i + static_cast<std::size_t>(std::countr_zero(mask)));
+        }
+    }
+#elif FRUSTUM_CULL_SSE
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (std::size_t p = 0; p < 6; ++p)
+        {
+            const glm::vec4& plane = m_planes[p];
+            __m128 distance = _mm_mul_ps(_mm_set1_ps(plane.x), _mm_loadu_ps(planeArrays[p].x + i));
+            distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.y), _mm_loadu_ps(planeArrays[p].y + i)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.z), _mm_loadu_ps(planeArrays[p].z + i)));
+            distance = _mm_add_ps(distance, _mm_set1_ps(plane.w));
+            visible = _mm_and_ps(visible, _mm_cmpnlt_ps(distance, zero));
+        }
+        for (auto mask = static_cast<unsigned int>(_mm_movemask_ps(visible)); mask != 0; mask &= mask - 1)
+        {
+            out[written++] = static_cast<std::uint32_t>(i + static_cast<std::size_t>(std::countr_zero(mask)));
+        }
+    }
+#endif
+
+    for (; i < end; ++i)
+    {
+        bool visible = true;
+        for (std::size_t p = 0; p < 6 && visible; ++p)
+        {
+            const glm::vec4& plane = m_planes[p];
+            const float distance = plane.x * planeArrays[p].x[i] + plane.y * planeArrays[p].y[i] + plane.z * planeArrays[p].z[i] + plane.w;
+            visible = !(distance < 0.0F);
+        }
+        if (visible)
+        {
+            out[written++] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    outVisible.resize(firstOut + written);
+    return written;
+}
 }
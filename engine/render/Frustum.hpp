@@ -1,19 +1,64 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include <glm/mat4x4.hpp>
 #include <glm/vec3.hpp>
 
 namespace engine::render
 {
+/// Axis-aligned boxes stored as structure of arrays (one contiguous array per bound), so
+/// Frustum::CullBatch can test a SIMD register's worth of boxes against a plane at once.
+struct AabbBatch
+{
+    std::vector<float> minX;
+    std::vector<float> minY;
+    std::vector<float> minZ;
+    std::vector<float> maxX;
+    std::vector<float> maxY;
+    std::vector<float> maxZ;
+
+    void Clear();
+    void Reserve(std::size_t count);
+    void Resize(std::size_t count);
+    void Add(const glm::vec3& min, const glm::vec3& max);
+    void Set(std::size_t index, const glm::vec3& min, const glm::vec3& max);
+    [[nodiscard]] std::size_t Size() const { return minX.size(); }
+    [[nodiscard]] bool Empty() const { return minX.empty(); }
+};
+
 class Frustum
 {
 public:
+    enum class Containment
+    {
+        Outside,
+        Intersecting,
+        Inside
+    };
+
     void Extract(const glm::mat4& viewProjection);
 
     [[nodiscard]] bool IntersectsAABB(const glm::vec3& min, const glm::vec3& max) const;
+    /// Like IntersectsAABB, but also reports boxes fully inside so children need no further tests.
+    [[nodiscard]] Containment ClassifyAABB(const glm::vec3& min, const glm::vec3& max) const;
     [[nodiscard]] bool IntersectsSphere(const glm::vec3& center, float radius) const;
     [[nodiscard]] bool IntersectsPoint(const glm::vec3& point) const;
 
+    /// IntersectsAABB for boxes [begin, end) of a batch, 8 (AVX2) or 4 (SSE2) boxes per step.
+    /// Appends the indices of intersecting boxes to outVisible in ascending order; returns how many.
+    std::size_t CullBatch(
+        const AabbBatch& boxes,
+        std::vector<std::uint32_t>& outVisible,
+        std::size_t begin = 0,
+        std::size_t end = std::numeric_limits<std::size_t>::max()
+    ) const;
+    /// SIMD width CullBatch was compiled for: "AVX2", "SSE2" or "scalar".
+    [[nodiscard]] static const char* CullBatchPath();
+
 private:
     glm::vec4 m_planes[6]{};
 
@@ -0,0 +1,269 @@
+#include "engine/render/LightClusters.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+
+#include "engine/core/JobSystem.hpp"
+
+namespace engine::render
+{
+namespace
+{
+constexpr int kSliceClusters = LightClusters::kClustersX * LightClusters::kClustersY;
+
+int TileFromNdc(float ndc, int tiles)
+{
+    const int tile = static_cast<int>(std::floor((ndc * 0.5F + 0.5F) * static_cast<float>(tiles)));
+    return std::clamp(tile, 0, tiles - 1);
+}
+} // namespace
+
+float LightClusters::DepthSliceScale()
+{
+    return static_cast<float>(kClustersZ) / std::log(kFarDepth / kNearDepth);
+}
+
+float LightClusters::DepthSliceBias()
+{
+    return -std::log(kNearDepth) * DepthSliceScale();
+}
+
+int LightClusters::DepthSlice(float viewDepth)
+{
+    if (!(viewDepth > kNearDepth))
+    {
+        return 0;
+    }
+    const int slice = static_cast<int>(std::floor(std::log(viewDepth) * DepthSliceScale() + DepthSliceBias()));
+    return std::clamp(slice, 0, kClustersZ - 1);
+}
+
+bool LightClusters::ClusterForPoint(const glm::mat4& viewProjection, const glm::vec3& point, std::size_t* outIndex)
+{
+    const glm::vec4 clip = viewProjection * glm::vec4{point, 1.0F};
+    if (clip.w <= 0.0F)
+    {
+        return false;
+    }
+    const glm::vec2 ndc = glm::vec2{clip.x, clip.y} / clip.w;
+    if (ndc.x < -1.0F || ndc.x > 1.0F || ndc.y < -1.0F || ndc.y > 1.0F)
+    {
+        return false;
+    }
+    *outIndex = ClusterIndex(TileFromNdc(ndc.x, kClustersX), TileFromNdc(ndc.y, kClustersY), DepthSlice(clip.w));
+    return true;
+}
+
+bool LightClusters::ClusterHasLight(std::size_t clusterIndex, std::uint32_t light) const
+{
+    const Cluster& cluster = m_clusters[clusterIndex];
+    const auto begin = m_indices.begin() + cluster.offset;
+    return std::find(begin, begin + cluster.count, light) != begin + cluster.count;
+}
+
+LightClusters::LightBounds LightClusters::SpotLightBounds(const glm::vec3& position, const glm::vec3& direction, float range, float outerCos)
+{
+    const float cosAngle = glm::clamp(outerCos, -1.0F, 1.0F);
+    if (cosAngle <= 0.0F)
+    {
+        return LightBounds{position, range};
+    }
+
+    constexpr float kCos45 = 0.70710678F;
+    if (cosAngle >= kCos45)
+    {
+        // Narrow cone: the sphere through the apex and the rim circle also contains the cap.
+        const float radius = range / (2.0F * cosAngle);
+        return LightBounds{position + direction * radius, radius};
+    }
+    const float sinAngle = std::sqrt(std::max(0.0F, 1.0F - cosAngle * cosAngle));
+    return LightBounds{position + direction * (range * cosAngle), range * sinAngle};
+}
+
+void LightClusters::Build(const glm::mat4& viewProjection, const std::vector<LightBounds>& lights)
+{
+    const auto start = std::chrono::steady_clock::now();
+    m_stats = Stats{};
+    m_stats.lights = static_cast<std::uint32_t>(lights.size());
+
+    // Clip w is the view depth; it is affine in world space, so a sphere spans w +/- radius * |dw/dp|.
+    const glm::vec4 depthRow{viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]};
+    const float depthGradient = glm::length(glm::vec3{depthRow});
+
+    m_ranges.clear();
+    m_ranges.reserve(lights.size());
+    for (std::size_t i = 0; i < lights.size(); ++i)
+    {
+        const LightBounds& light = lights[i];
+        if (light.radius <= 0.0F)
+        {
+            continue;
+        }
+
+        const float centerDepth = glm::dot(depthRow, glm::vec4{light.center, 1.0F});
+        const float minDepth = centerDepth - light.radius * depthGradient;
+        const float maxDepth = centerDepth + light.radius * depthGradient;
+        if (maxDepth <= 0.0F)
+        {
+            continue; // entirely behind the camera
+        }
+
+        LightRange range;
+        range.light = static_cast<std::uint32_t>(i);
+        range.minZ = DepthSlice(minDepth);
+        range.maxZ = DepthSlice(maxDepth);
+        range.maxX = kClustersX - 1;
+        range.maxY = kClustersY - 1;
+
+        // Screen rectangle of the sphere's box; a box crossing the near plane keeps the full screen.
+        glm::vec2 ndcMin{1.0F};
+        glm::vec2 ndcMax{-1.0F};
+        bool crossesNear = false;
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            const glm::vec3 offset{
+                (corner & 1) != 0 ? light.radius : -light.radius,
+                (corner & 2) != 0 ? light.radius : -light.radius,
+                (corner & 4) != 0 ? light.radius : -light.radius,
+            };
+            const glm::vec4 clip = viewProjection * glm::vec4{light.center + offset, 1.0F};
+            if (clip.w <= kNearDepth)
+            {
+                crossesNear = true;
+                break;
+            }
+            const glm::vec2 ndc = glm::vec2{clip.x, clip.y} / clip.w;
+            ndcMin = glm::min(ndcMin, ndc);
+            ndcMax = glm::max(ndcMax, ndc);
+        }
+        if (!crossesNear)
+        {
+            if (ndcMin.x > 1.0F || ndcMin.y > 1.0F || ndcMax.x < -1.0F || ndcMax.y < -1.0F)
+            {
+                continue; // off screen
+            }
+            range.minX = TileFromNdc(ndcMin.x, kClustersX);
+            range.maxX = TileFromNdc(ndcMax.x, kClustersX);
+            range.minY = TileFromNdc(ndcMin.y, kClustersY);
+            range.maxY = TileFromNdc(ndcMax.y, kClustersY);
+        }
+        m_ranges.push_back(range);
+    }
+    m_stats.lightsVisible = static_cast<std::uint32_t>(m_ranges.size());
+
+    // Each depth slice owns its clusters and index scratch, so slices bin without synchronization.
+    auto& jobSystem = engine::core::JobSystem::Instance();
+    engine::core::JobCounter binCounter;
+    jobSystem.ParallelFor(
+        static_cast<std::size_t>(kClustersZ),
+        1,
+        [this](std::size_t slice) { BinSlice(static_cast<int>(slice)); },
+        engine::core::JobPriority::High,
+        &binCounter
+    );
+    jobSystem.WaitForCounter(binCounter);
+
+    std::size_t totalIndices = 0;
+    for (const auto& sliceIndices : m_sliceIndices)
+    {
+        totalIndices += sliceIndices.size();
+    }
+    m_indices.resize(totalIndices);
+
+    std::uint32_t base = 0;
+    for (int slice = 0; slice < kClustersZ; ++slice)
+    {
+        const auto& sliceIndices = m_sliceIndices[static_cast<std::size_t>(slice)];
+        std::copy(sliceIndices.begin(), sliceIndices.end(), m_indices.begin() + base);
+        for (int i = 0; i < kSliceClusters; ++i)
+        {
+            Cluster& cluster = m_clusters[static_cast<std::size_t>(slice * kSliceClusters + i)];
+            cluster.offset += base;
+            if (cluster.count > 0)
+            {
+                ++m_stats.occupiedClusters;
+                m_stats.maxLightsInCluster = std::max(m_stats.maxLightsInCluster, cluster.count);
+            }
+        }
+        m_stats.overflowClusters += m_sliceOverflow[static_cast<std::size_t>(slice)];
+        base += static_cast<std::uint32_t>(sliceIndices.size());
+    }
+
+    m_stats.indices = static_cast<std::uint32_t>(m_indices.size());
+    m_stats.buildMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void LightClusters::BinSlice(int slice)
+{
+    Cluster* clusters = m_clusters.data() + static_cast<std::size_t>(slice * kSliceClusters);
+    std::vector<std::uint32_t>& indices = m_sliceIndices[static_cast<std::size_t>(slice)];
+    std::uint32_t overflow = 0;
+
+    // Pass 1: per-cluster counts (capped), then offsets within the slice.
+    std::array<bool, static_cast<std::size_t>(kSliceClusters)> overflowed{};
+    for (int i = 0; i < kSliceClusters; ++i)
+    {
+        clusters[i] = Cluster{};
+    }
+    for (const LightRange& range : m_ranges)
+    {
+        if (slice < range.minZ || slice > range.maxZ)
+        {
+            continue;
+        }
+        for (int y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int x = range.minX; x <= range.maxX; ++x)
+            {
+                const int local = y * kClustersX + x;
+                if (clusters[local].count < kMaxLightsPerCluster)
+                {
+                    ++clusters[local].count;
+                }
+                else if (!overflowed[static_cast<std::size_t>(local)])
+                {
+                    overflowed[static_cast<std::size_t>(local)] = true;
+                    ++overflow;
+                }
+            }
+        }
+    }
+
+    std::uint32_t running = 0;
+    for (int i = 0; i < kSliceClusters; ++i)
+    {
+        clusters[i].offset = running;
+        running += clusters[i].count;
+        clusters[i].count = 0;
+    }
+    indices.resize(running);
+
+    // Pass 2: same traversal order, so exactly the lights counted above are written.
+    for (const LightRange& range : m_ranges)
+    {
+        if (slice < range.minZ || slice > range.maxZ)
+        {
+            continue;
+        }
+        for (int y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int x = range.minX; x <= range.maxX; ++x)
+            {
+                Cluster& cluster = clusters[y * kClustersX + x];
+                if (cluster.count < kMaxLightsPerCluster)
+                {
+                    indices[cluster.offset + cluster.count] = range.light;
+                    ++cluster.count;
+                }
+            }
+        }
+    }
+    m_sliceOverflow[static_cast<std::size_t>(slice)] = overflow;
+}
+} // namespace engine::render
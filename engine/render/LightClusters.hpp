@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+namespace engine::render
+{
+/// Clustered forward light assignment. The view frustum is split into a froxel grid (screen tiles x
+/// exponential depth slices) and every light's bounding sphere is binned into the clusters it touches.
+/// Depth slices are binned in parallel on the JobSystem. Pure CPU: no GL, so it also runs headless.
+class LightClusters
+{
+public:
+    static constexpr int kClustersX = 16;
+    static constexpr int kClustersY = 9;
+    static constexpr int kClustersZ = 24;
+    static constexpr int kClusterCount = kClustersX * kClustersY * kClustersZ;
+    static constexpr std::uint32_t kMaxLightsPerCluster = 32;
+    static constexpr float kNearDepth = 0.1F;  // slice 0 covers everything closer than this
+    static constexpr float kFarDepth = 300.0F; // the last slice extends to infinity
+
+    /// Bounding sphere of one light. Cluster index lists refer to positions in the input vector.
+    struct LightBounds
+    {
+        glm::vec3 center{0.0F};
+        float radius = 0.0F;
+    };
+
+    struct Cluster
+    {
+        std::uint32_t offset = 0; // into LightIndices()
+        std::uint32_t count = 0;
+    };
+
+    struct Stats
+    {
+        std::uint32_t lights = 0;
+        std::uint32_t lightsVisible = 0;
+        std::uint32_t occupiedClusters = 0;
+        std::uint32_t indices = 0;
+        std::uint32_t maxLightsInCluster = 0;
+        std::uint32_t overflowClusters = 0; // clusters that dropped lights past kMaxLightsPerCluster
+        float buildMs = 0.0F;
+    };
+
+    /// Bins the lights for this view. viewProjection must map world space to GL clip space.
+    void Build(const glm::mat4& viewProjection, const std::vector<LightBounds>& lights);
+
+    /// Tight bounding sphere of a spot light cone (apex at position, outerCos = cosine of the half angle).
+    [[nodiscard]] static LightBounds SpotLightBounds(const glm::vec3& position, const glm::vec3& direction, float range, float outerCos);
+
+    /// Depth slice for a view depth (clip w); shaders use the same log(depth) * scale + bias mapping.
+    [[nodiscard]] static int DepthSlice(float viewDepth);
+    [[nodiscard]] static float DepthSliceScale();
+    [[nodiscard]] static float DepthSliceBias();
+    [[nodiscard]] static std::size_t ClusterIndex(int x, int y, int z)
+    {
+        return static_cast<std::size_t>((z * kClustersY + y) * kClustersX + x);
+    }
+    /// Cluster a shaded world point looks up, as the fragment shader would. False when the point is
+    /// behind the camera or off screen.
+    [[nodiscard]] static bool ClusterForPoint(const glm::mat4& viewProjection, const glm::vec3& point, std::size_t* outIndex);
+    [[nodiscard]] bool ClusterHasLight(std::size_t clusterIndex, std::uint32_t light) const;
+
+    [[nodiscard]] const std::vector<Cluster>& Clusters() const { return m_clusters; }
+    [[nodiscard]] const std::vector<std::uint32_t>& LightIndices() const { return m_indices; }
+    [[nodiscard]] const Cluster& ClusterAt(int x, int y, int z) const { return m_clusters[ClusterIndex(x, y, z)]; }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+
+private:
+    /// Inclusive cluster-space extent of one light.
+    struct LightRange
+    {
+        std::uint32_t light = 0;
+        int minX = 0;
+        int maxX = 0;
+        int minY = 0;
+        int maxY = 0;
+        int minZ = 0;
+        int maxZ = 0;
+    };
+
+    void BinSlice(int slice);
+
+    std::vector<LightRange> m_ranges;
+    std::vector<Cluster> m_clusters = std::vector<Cluster>(static_cast<std::size_t>(kClusterCount));
+    std::array<std::vector<std::uint32_t>, static_cast<std::size_t>(kClustersZ)> m_sliceIndices;
+    std::array<std::uint32_t, static_cast<std::size_t>(kClustersZ)> m_sliceOverflow{};
+    std::vector<std::uint32_t> m_indices;
+    Stats m_stats;
+};
+} // namespace engine::render
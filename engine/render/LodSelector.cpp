@@ -0,0 +1,50 @@
+#include "engine/render/LodSelector.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace engine::render
+{
+float LodSelector::ProjectionScale(const glm::mat4& projection, int viewportHeight)
+{
+    return 0.5F * static_cast<float>(std::max(1, viewportHeight)) * projection[1][1];
+}
+
+float LodSelector::ProjectionScaleFromFov(float fovYRadians, int viewportHeight)
+{
+    return 0.5F * static_cast<float>(std::max(1, viewportHeight)) / std::tan(0.5F * fovYRadians);
+}
+
+float LodSelector::ProjectedError(float worldError, float distance, float projectionScale)
+{
+    return worldError * projectionScale / std::max(distance, 1.0e-3F);
+}
+
+std::size_t LodSelector::Select(
+    const std::vector<float>& lodErrors,
+    float distance,
+    float projectionScale,
+    std::size_t currentLod,
+    const LodSelectionSettings& settings
+)
+{
+    if (lodErrors.empty())
+    {
+        return 0;
+    }
+
+    std::size_t lod = std::min(currentLod, lodErrors.size() - 1);
+    const auto pixels = [&](std::size_t level) { return ProjectedError(lodErrors[level], distance, projectionScale); };
+
+    while (lod > 0 && pixels(lod) > settings.maxPixelError)
+    {
+        --lod;
+    }
+    const float coarsenLimit = settings.maxPixelError * (1.0F - settings.hysteresis);
+    while (lod + 1 < lodErrors.size() && pixels(lod + 1) <= coarsenLimit)
+    {
+        ++lod;
+    }
+    return lod;
+}
+} // namespace engine::render
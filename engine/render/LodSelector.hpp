@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+
+namespace engine::render
+{
+struct LodSelectionSettings
+{
+    float maxPixelError = 1.0F;
+    float hysteresis = 0.3F; // coarsening needs the next level to be this much under the limit
+};
+
+/// Screen-space error LOD selection. A LOD is acceptable while its world-space error estimate
+/// (MeshLod::error, an RMS distance rather than a bound) projects to at most maxPixelError pixels; hysteresis keeps a mesh from flickering between two
+/// levels right at the threshold. Pure CPU.
+class LodSelector
+{
+public:
+    /// Pixels per world unit at distance 1 for a perspective projection (0.5 * height * cot(fovY / 2)).
+    [[nodiscard]] static float ProjectionScale(const glm::mat4& projection, int viewportHeight);
+    [[nodiscard]] static float ProjectionScaleFromFov(float fovYRadians, int viewportHeight);
+
+    [[nodiscard]] static float ProjectedError(float worldError, float distance, float projectionScale);
+
+    /// lodErrors[i] is the world-space error of LOD i (LOD 0 normally 0). Returns the coarsest
+    /// acceptable level, moving away from currentLod only when the threshold is clearly crossed.
+    [[nodiscard]] static std::size_t Select(
+        const std::vector<float>& lodErrors,
+        float distance,
+        float projectionScale,
+        std::size_t currentLod,
+        const LodSelectionSettings& settings = {}
+    );
+};
+} // namespace engine::render
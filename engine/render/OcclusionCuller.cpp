@@ -0,0 +1,477 @@
+#include "engine/render/OcclusionCuller.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+
+#include "engine/core/JobSystem.hpp"
+#include "engine/render/Frustum.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OCCLUSION_CULLER_SSE 1
+#include <emmintrin.h>
+#else
+#define OCCLUSION_CULLER_SSE 0
+#endif
+
+namespace engine::render
+{
+namespace
+{
+// Geometry is clipped against the GL near plane z = -w, pulled in slightly so w stays positive.
+constexpr float kNearEpsilon = 1.0e-5F;
+// Occluders smaller than this (largest face area / squared distance) cover too few pixels to matter.
+constexpr float kMinOccluderMetric = 1.0e-3F;
+// A box only counts as hidden when it is this much farther than the occluder depth; absorbs the
+// float error of the interpolated depth planes so boxes resting against a wall are not culled.
+constexpr float kDepthEpsilon = 1.0e-4F;
+
+float NearDistance(const glm::vec4& clip)
+{
+    return clip.z + clip.w;
+}
+
+glm::vec3 ToScreen(const glm::vec4& clip)
+{
+    const float invW = 1.0F / clip.w;
+    return glm::vec3{
+        (clip.x * invW * 0.5F + 0.5F) * static_cast<float>(OcclusionCuller::kWidth),
+        (clip.y * invW * 0.5F + 0.5F) * static_cast<float>(OcclusionCuller::kHeight),
+        glm::clamp(clip.z * invW * 0.5F + 0.5F, 0.0F, 1.0F),
+    };
+}
+} // namespace
+
+OcclusionCuller::OcclusionCuller()
+    : m_depth(static_cast<std::size_t>(kWidth * kHeight), 1.0F)
+{
+}
+
+void OcclusionCuller::SetOccluders(std::vector<Occluder> occluders)
+{
+    m_occluders = std::move(occluders);
+    m_active = false;
+}
+
+void OcclusionCuller::ClearOccluders()
+{
+    m_occluders.clear();
+    m_active = false;
+}
+
+void OcclusionCuller::Update(const glm::mat4& viewProjection, const glm::vec3& cameraPosition, const Frustum& frustum)
+{
+    m_tested.store(0, std::memory_order_relaxed);
+    m_culled.store(0, std::memory_order_relaxed);
+    m_frameStats = Stats{};
+    m_frameStats.candidates = static_cast<std::uint32_t>(m_occluders.size());
+    m_active = false;
+    if (!m_enabled || m_occluders.empty() || m_maxOccluders == 0)
+    {
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    m_viewProjection = viewProjection;
+
+    // Rank visible candidates by approximate screen coverage: largest face area over squared distance.
+    m_selection.clear();
+    for (std::size_t i = 0; i < m_occluders.size(); ++i)
+    {
+        const Occluder& occluder = m_occluders[i];
+        const glm::vec3 boxMin = occluder.center - occluder.halfExtents;
+        const glm::vec3 boxMax = occluder.center + occluder.halfExtents;
+        if (!frustum.IntersectsAABB(boxMin, boxMax))
+        {
+            continue;
+        }
+        const glm::vec3 closest = glm::clamp(cameraPosition, boxMin, boxMax);
+        const float distanceSq = glm::dot(cameraPosition - closest, cameraPosition - closest);
+        if (distanceSq < 0.01F)
+        {
+            continue; // camera inside or touching the box
+        }
+        const glm::vec3& h = occluder.halfExtents;
+        const float faceArea = 4.0F * std::max({h.x * h.y, h.x * h.z, h.y * h.z});
+        const float metric = faceArea / std::max(distanceSq, 1.0F);
+        if (metric >= kMinOccluderMetric)
+        {
+            m_selection.emplace_back(metric, static_cast<std::uint32_t>(i));
+        }
+    }
+    const std::size_t selectedCount = std::min(m_selection.size(), m_maxOccluders);
+    std::partial_sort(
+        m_selection.begin(),
+        m_selection.begin() + static_cast<std::ptrdiff_t>(selectedCount),
+        m_selection.end(),
+        [](const auto& a, const auto& b) { return a.first > b.first; }
+    );
+
+    m_triangles.clear();
+    for (std::size_t i = 0; i < selectedCount; ++i)
+    {
+        RasterizeOccluder(m_occluders[m_selection[i].second], cameraPosition);
+    }
+
+    // Bin triangles by screen tile; tiles own disjoint pixels, so they rasterize without locking.
+    for (auto& bin : m_tileBins)
+    {
+        bin.clear();
+    }
+    for (std::size_t i = 0; i < m_triangles.size(); ++i)
+    {
+        const ScreenTriangle& triangle = m_triangles[i];
+        for (int ty = triangle.minY / kTileHeight; ty <= triangle.maxY / kTileHeight; ++ty)
+        {
+            for (int tx = triangle.minX / kTileWidth; tx <= triangle.maxX / kTileWidth; ++tx)
+            {
+                m_tileBins[static_cast<std::size_t>(ty * kTilesX + tx)].push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+
+    auto& jobSystem = engine::core::JobSystem::Instance();
+    engine::core::JobCounter rasterCounter;
+    jobSystem.ParallelFor(
+        static_cast<std::size_t>(kTilesX * kTilesY),
+        1,
+        [this](std::size_t tile) { RasterizeTile(static_cast<int>(tile)); },
+        engine::core::JobPriority::High,
+        &rasterCounter
+    );
+    jobSystem.WaitForCounter(rasterCounter);
+
+    m_active = !m_triangles.empty();
+    m_frameStats.occludersRasterized = static_cast<std::uint32_t>(selectedCount);
+    m_frameStats.trianglesRasterized = static_cast<std::uint32_t>(m_triangles.size());
+    m_frameStats.rasterMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void OcclusionCuller::RasterizeOccluder(const Occluder& occluder, const glm::vec3& cameraPosition)
+{
+    // Corner i has +x when bit 0 is set, +y for bit 1, +z for bit 2.
+    std::array<glm::vec4, 8> clip{};
+    for (int i = 0; i < 8; ++i)
+    {
+        const glm::vec3 corner = occluder.center + occluder.halfExtents * glm::vec3{
+            (i & 1) != 0 ? 1.0F : -1.0F,
+            (i & 2) != 0 ? 1.0F : -1.0F,
+            (i & 4) != 0 ? 1.0F : -1.0F,
+        };
+        clip[static_cast<std::size_t>(i)] = m_viewProjection * glm::vec4{corner, 1.0F};
+    }
+
+    // Only faces turned towards the camera can be nearest; back faces would be overwritten anyway.
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const int u = (axis + 1) % 3;
+        const int v = (axis + 2) % 3;
+        for (int side = 0; side < 2; ++side)
+        {
+            const float facePlane = occluder.center[axis] + (side == 1 ? occluder.halfExtents[axis] : -occluder.halfExtents[axis]);
+            const float towardsCamera = cameraPosition[axis] - facePlane;
+            if ((side == 1 && towardsCamera <= 0.0F) || (side == 0 && towardsCamera >= 0.0F))
+            {
+                continue;
+            }
+
+            const int base = side << axis;
+            const std::array<int, 4> quad{
+                base,
+                base | (1 << u),
+                base | (1 << u) | (1 << v),
+                base | (1 << v),
+            };
+            // The shared diagonal is interior to the face; only the face outline gets inner coverage.
+            AddClipTriangle(clip[static_cast<std::size_t>(quad[0])], clip[static_cast<std::size_t>(quad[1])], clip[static_cast<std::size_t>(quad[2])], 0b011U);
+            AddClipTriangle(clip[static_cast<std::size_t>(quad[0])], clip[static_cast<std::size_t>(quad[2])], clip[static_cast<std::size_t>(quad[3])], 0b110U);
+        }
+    }
+}
+
+void OcclusionCuller::AddClipTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c, unsigned int outlineEdges)
+{
+    if (NearDistance(a) > kNearEpsilon && NearDistance(b) > kNearEpsilon && NearDistance(c) > kNearEpsilon)
+    {
+        AddScreenTriangle(ToScreen(a), ToScreen(b), ToScreen(c), outlineEdges);
+        return;
+    }
+
+    // Clip against the near plane. The dropped part lies in front of it, so the remainder still only
+    // writes depths of real occluder surface and its depth stays linear in screen space.
+    const std::array<glm::vec4, 3> input{a, b, c};
+    // outputOutline[i] flags the polygon edge starting at output vertex i; the cut along the near
+    // plane is an outline edge.
+    std::array<glm::vec4, 4> output{};
+    std::array<bool, 4> outputOutline{};
+    std::size_t outputCount = 0;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        const glm::vec4& current = input[i];
+        const glm::vec4& next = input[(i + 1) % 3];
+        const bool edgeOutline = (outlineEdges & (1U << i)) != 0U;
+        const float currentDistance = NearDistance(current) - kNearEpsilon;
+        const float nextDistance = NearDistance(next) - kNearEpsilon;
+        const bool currentInside = currentDistance > 0.0F;
+        const bool nextInside = nextDistance > 0.0F;
+        if (currentInside)
+        {
+            outputOutline[outputCount] = edgeOutline;
+            output[outputCount++] = current;
+        }
+        if (currentInside != nextInside)
+        {
+            const float t = currentDistance / (currentDistance - nextDistance);
+            outputOutline[outputCount] = currentInside ? true : edgeOutline;
+            output[outputCount++] = current + (next - current) * t;
+        }
+    }
+    for (std::size_t i = 2; i < outputCount; ++i)
+    {
+        // Fan diagonals are interior; the first and last fan edges are polygon edges.
+        unsigned int fanOutline = outputOutline[i - 1] ? 0b010U : 0U;
+        if (i == 2 && outputOutline[0])
+        {
+            fanOutline |= 0b001U;
+        }
+        if (i + 1 == outputCount && outputOutline[i])
+        {
+            fanOutline |= 0b100U;
+        }
+        AddScreenTriangle(ToScreen(output[0]), ToScreen(output[i - 1]), ToScreen(output[i]), fanOutline);
+    }
+}
+
+void OcclusionCuller::AddScreenTriangle(const glm::vec3& a, const glm::vec3& inB, const glm::vec3& inC, unsigned int outlineEdges)
+{
+    glm::vec3 b = inB;
+    glm::vec3 c = inC;
+    float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    if (std::abs(area) < 1.0e-6F)
+    {
+        return;
+    }
+    if (area < 0.0F)
+    {
+        // Reversing the winding turns edges (ab, bc, ca) into (ac, cb, ba).
+        std::swap(b, c);
+        area = -area;
+        outlineEdges = (outlineEdges & 0b010U) | ((outlineEdges & 0b001U) << 2U) | ((outlineEdges & 0b100U) >> 2U);
+    }
+
+    ScreenTriangle triangle;
+    triangle.minX = std::max(0, static_cast<int>(std::floor(std::min({a.x, b.x, c.x}))));
+    triangle.minY = std::max(0, static_cast<int>(std::floor(std::min({a.y, b.y, c.y}))));
+    triangle.maxX = std::min(kWidth - 1, static_cast<int>(std::ceil(std::max({a.x, b.x, c.x}))));
+    triangle.maxY = std::min(kHeight - 1, static_cast<int>(std::ceil(std::max({a.y, b.y, c.y}))));
+    if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+    {
+        return;
+    }
+
+    // Evaluating at integer (x, y) samples the pixel center (x + 0.5, y + 0.5). Outline edges use
+    // inner coverage: they are pulled in by their largest change across half a pixel, so a pixel
+    // passes only when the face covers all of it and partially covered pixels keep the far depth.
+    // Interior edges keep the center rule so the triangles of a face leave no gap between them.
+    const std::array<glm::vec3, 3> vertices{a, b, c};
+    for (std::size_t e = 0; e < 3; ++e)
+    {
+        const glm::vec3& v0 = vertices[e];
+        const glm::vec3& v1 = vertices[(e + 1) % 3];
+        const float edgeA = v0.y - v1.y;
+        const float edgeB = v1.x - v0.x;
+        triangle.edgeA[e] = edgeA;
+        triangle.edgeB[e] = edgeB;
+        const float inset = (outlineEdges & (1U << e)) != 0U ? 0.5F * (std::abs(edgeA) + std::abs(edgeB)) : 0.0F;
+        triangle.edgeC[e] = -(edgeA * v0.x + edgeB * v0.y) + 0.5F * (edgeA + edgeB) - inset;
+    }
+
+    const float invArea = 1.0F / area;
+    triangle.depthA = ((b.z - a.z) * (c.y - a.y) - (c.z - a.z) * (b.y - a.y)) * invArea;
+    triangle.depthB = ((c.z - a.z) * (b.x - a.x) - (b.z - a.z) * (c.x - a.x)) * invArea;
+    // Write the farthest depth the plane reaches inside the pixel rather than its center value.
+    triangle.depthC = a.z - triangle.depthA * a.x - triangle.depthB * a.y + 0.5F * (triangle.depthA + triangle.depthB) +
+                      0.5F * (std::abs(triangle.depthA) + std::abs(triangle.depthB));
+
+    m_triangles.push_back(triangle);
+}
+
+void OcclusionCuller::RasterizeTile(int tile)
+{
+    const int tileX0 = (tile % kTilesX) * kTileWidth;
+    const int tileY0 = (tile / kTilesX) * kTileHeight;
+    const int tileX1 = tileX0 + kTileWidth - 1;
+    const int tileY1 = tileY0 + kTileHeight - 1;
+
+    for (int y = tileY0; y <= tileY1; ++y)
+    {
+        std::fill_n(m_depth.begin() + y * kWidth + tileX0, kTileWidth, 1.0F);
+    }
+
+    for (const std::uint32_t index : m_tileBins[static_cast<std::size_t>(tile)])
+    {
+        const ScreenTriangle& tri = m_triangles[index];
+        // Tiles are a multiple of 4 wide, so a 4-aligned start never leaves the tile; pixels left of
+        // the triangle's bounds fail the edge tests.
+        const int minX = std::max(tri.minX, tileX0) & ~3;
+        const int maxX = std::min(tri.maxX, tileX1);
+        const int minY = std::max(tri.minY, tileY0);
+        const int maxY = std::min(tri.maxY, tileY1);
+
+        for (int y = minY; y <= maxY; ++y)
+        {
+            float* row = m_depth.data() + y * kWidth;
+            const float fy = static_cast<float>(y);
+#if OCCLUSION_CULLER_SSE
+            const __m128 xs = _mm_add_ps(_mm_set1_ps(static_cast<float>(minX)), _mm_setr_ps(0.0F, 1.0F, 2.0F, 3.0F));
+            __m128 e0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.edgeA[0]), xs), _mm_set1_ps(tri.edgeB[0] * fy + tri.edgeC[0]));
+            __m128 e1 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.edgeA[1]), xs), _mm_set1_ps(tri.edgeB[1] * fy + tri.edgeC[1]));
+            __m128 e2 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.edgeA[2]), xs), _mm_set1_ps(tri.edgeB[2] * fy + tri.edgeC[2]));
+            __m128 z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.depthA), xs), _mm_set1_ps(tri.depthB * fy + tri.depthC));
+            const __m128 step0 = _mm_set1_ps(tri.edgeA[0] * 4.0F);
+            const __m128 step1 = _mm_set1_ps(tri.edgeA[1] * 4.0F);
+            const __m128 step2 = _mm_set1_ps(tri.edgeA[2] * 4.0F);
+            const __m128 stepZ = _mm_set1_ps(tri.depthA * 4.0F);
+            const __m128 zero = _mm_setzero_ps();
+            for (int x = minX; x <= maxX; x += 4)
+            {
+                const __m128 inside = _mm_and_ps(
+                    _mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)),
+                    _mm_cmpge_ps(e2, zero)
+                );
+                if (_mm_movemask_ps(inside) != 0)
+                {
+                    const __m128 previous = _mm_loadu_ps(row + x);
+                    const __m128 nearest = _mm_min_ps(previous, z);
+                    _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, previous)));
+                }
+                e0 = _mm_add_ps(e0, step0);
+                e1 = _mm_add_ps(e1, step1);
+                e2 = _mm_add_ps(e2, step2);
+                z = _mm_add_ps(z, stepZ);
+            }
+#else
+            for (int x = minX; x <= maxX; ++x)
+            {
+                const float fx = static_cast<float>(x);
+                if (tri.edgeA[0] * fx + tri.edgeB[0] * fy + tri.edgeC[0] >= 0.0F &&
+                    tri.edgeA[1] * fx + tri.edgeB[1] * fy + tri.edgeC[1] >= 0.0F &&
+                    tri.edgeA[2] * fx + tri.edgeB[2] * fy + tri.edgeC[2] >= 0.0F)
+                {
+                    row[x] = std::min(row[x], tri.depthA * fx + tri.depthB * fy + tri.depthC);
+                }
+            }
+#endif
+        }
+    }
+
+    // Hierarchy: farthest occluder depth per 8x8 block, then per tile.
+    float tileMax = 0.0F;
+    for (int by = tileY0 / kBlockSize; by <= tileY1 / kBlockSize; ++by)
+    {
+        for (int bx = tileX0 / kBlockSize; bx <= tileX1 / kBlockSize; ++bx)
+        {
+            float blockMax = 0.0F;
+            for (int y = by * kBlockSize; y < (by + 1) * kBlockSize; ++y)
+            {
+                const float* row = m_depth.data() + y * kWidth + bx * kBlockSize;
+                blockMax = std::max(blockMax, *std::max_element(row, row + kBlockSize));
+            }
+            m_blockMaxDepth[static_cast<std::size_t>(by * kBlocksX + bx)] = blockMax;
+            tileMax = std::max(tileMax, blockMax);
+        }
+    }
+    m_tileMaxDepth[static_cast<std::size_t>(tile)] = tileMax;
+}
+
+bool OcclusionCuller::IsOccluded(const glm::vec3& min, const glm::vec3& max) const
+{
+    if (!m_active)
+    {
+        return false;
+    }
+    m_tested.fetch_add(1, std::memory_order_relaxed);
+
+    float screenMinX = std::numeric_limits<float>::max();
+    float screenMinY = std::numeric_limits<float>::max();
+    float screenMaxX = std::numeric_limits<float>::lowest();
+    float screenMaxY = std::numeric_limits<float>::lowest();
+    float nearestDepth = 1.0F;
+    for (int i = 0; i < 8; ++i)
+    {
+        const glm::vec4 corner{
+            (i & 1) != 0 ? max.x : min.x,
+            (i & 2) != 0 ? max.y : min.y,
+            (i & 4) != 0 ? max.z : min.z,
+            1.0F,
+        };
+        const glm::vec4 clip = m_viewProjection * corner;
+        if (NearDistance(clip) <= kNearEpsilon)
+        {
+            return false;
+        }
+        const glm::vec3 screen = ToScreen(clip);
+        screenMinX = std::min(screenMinX, screen.x);
+        screenMinY = std::min(screenMinY, screen.y);
+        screenMaxX = std::max(screenMaxX, screen.x);
+        screenMaxY = std::max(screenMaxY, screen.y);
+        nearestDepth = std::min(nearestDepth, screen.z);
+    }
+    if (nearestDepth <= 0.0F)
+    {
+        return false;
+    }
+
+    if (screenMaxX < 0.0F || screenMaxY < 0.0F || screenMinX >= static_cast<float>(kWidth) ||
+        screenMinY >= static_cast<float>(kHeight))
+    {
+        return false; // off screen: the frustum test owns this case
+    }
+    // Dilate the footprint by a pixel so rounding of the projected corners never skips a partially
+    // covered pixel along the box outline.
+    const int x0 = std::max(0, static_cast<int>(std::floor(screenMinX)) - 1);
+    const int y0 = std::max(0, static_cast<int>(std::floor(screenMinY)) - 1);
+    const int x1 = std::min(kWidth - 1, static_cast<int>(std::floor(screenMaxX)) + 1);
+    const int y1 = std::min(kHeight - 1, static_cast<int>(std::floor(screenMaxY)) + 1);
+    const float testDepth = nearestDepth - kDepthEpsilon;
+
+    // Coarse level first: one compare per covered tile usually settles large or clearly hidden boxes.
+    float coarseMax = 0.0F;
+    for (int ty = y0 / kTileHeight; ty <= y1 / kTileHeight; ++ty)
+    {
+        for (int tx = x0 / kTileWidth; tx <= x1 / kTileWidth; ++tx)
+        {
+            coarseMax = std::max(coarseMax, m_tileMaxDepth[static_cast<std::size_t>(ty * kTilesX + tx)]);
+        }
+    }
+    if (testDepth <= coarseMax)
+    {
+        for (int by = y0 / kBlockSize; by <= y1 / kBlockSize; ++by)
+        {
+            for (int bx = x0 / kBlockSize; bx <= x1 / kBlockSize; ++bx)
+            {
+                if (testDepth <= m_blockMaxDepth[static_cast<std::size_t>(by * kBlocksX + bx)])
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    m_culled.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+OcclusionCuller::Stats OcclusionCuller::GetStats() const
+{
+    Stats stats = m_frameStats;
+    stats.tested = m_tested.load(std::memory_order_relaxed);
+    stats.culled = m_culled.load(std::memory_order_relaxed);
+    return stats;
+}
+} // namespace engine::render
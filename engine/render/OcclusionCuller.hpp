@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+namespace engine::render
+{
+class Frustum;
+
+/// CPU software occlusion culling. The largest on-screen occluder boxes are rasterized into a
+/// low-resolution depth buffer (screen tiles in parallel on the JobSystem, 4 pixels per SIMD step),
+/// reduced into a two-level max-depth hierarchy, and bounding boxes are then tested against it.
+/// Occluders only write pixels they cover entirely, at the farthest depth inside the pixel.
+/// Pure CPU: no GL, so it also runs in headless builds.
+class OcclusionCuller
+{
+public:
+    static constexpr int kWidth = 256;
+    static constexpr int kHeight = 128;
+    static constexpr int kTileWidth = 64;
+    static constexpr int kTileHeight = 32;
+    static constexpr int kTilesX = kWidth / kTileWidth;
+    static constexpr int kTilesY = kHeight / kTileHeight;
+    static constexpr int kBlockSize = 8;
+    static constexpr int kBlocksX = kWidth / kBlockSize;
+    static constexpr int kBlocksY = kHeight / kBlockSize;
+
+    struct Occluder
+    {
+        glm::vec3 center{0.0F};
+        glm::vec3 halfExtents{0.0F};
+    };
+
+    struct Stats
+    {
+        std::uint32_t candidates = 0;
+        std::uint32_t occludersRasterized = 0;
+        std::uint32_t trianglesRasterized = 0;
+        std::uint32_t tested = 0;
+        std::uint32_t culled = 0;
+        float rasterMs = 0.0F;
+    };
+
+    OcclusionCuller();
+
+    /// Static occluder candidates (e.g. map walls). Rebuild when the map changes.
+    void SetOccluders(std::vector<Occluder> occluders);
+    void ClearOccluders();
+    [[nodiscard]] std::size_t OccluderCount() const { return m_occluders.size(); }
+
+    void SetEnabled(bool enabled) { m_enabled = enabled; }
+    [[nodiscard]] bool IsEnabled() const { return m_enabled; }
+    void SetMaxOccluders(std::size_t count) { m_maxOccluders = count; }
+
+    /// Selects this frame's occluders, rasterizes them and builds the depth hierarchy.
+    void Update(const glm::mat4& viewProjection, const glm::vec3& cameraPosition, const Frustum& frustum);
+
+    /// True when the box is hidden behind this frame's occluders. Conservative: the box footprint is
+    /// dilated by a pixel and must lie a depth epsilon behind fully covered pixels; boxes crossing
+    /// the near plane, or any test while disabled/empty, report visible. Thread-safe.
+    [[nodiscard]] bool IsOccluded(const glm::vec3& min, const glm::vec3& max) const;
+
+    [[nodiscard]] Stats GetStats() const;
+
+private:
+    struct ScreenTriangle
+    {
+        // Edge functions (>= 0 when the whole pixel is inside) and the depth plane (farthest depth
+        // within the pixel), evaluated at integer pixel coordinates.
+        std::array<float, 3> edgeA{};
+        std::array<float, 3> edgeB{};
+        std::array<float, 3> edgeC{};
+        float depthA = 0.0F;
+        float depthB = 0.0F;
+        float depthC = 0.0F;
+        int minX = 0;
+        int minY = 0;
+        int maxX = 0;
+        int maxY = 0;
+    };
+
+    void RasterizeOccluder(const Occluder& occluder, const glm::vec3& cameraPosition);
+    // outlineEdges bit i marks edge (v_i, v_i+1) as part of the face outline rather than a diagonal.
+    void AddClipTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c, unsigned int outlineEdges);
+    void AddScreenTriangle(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c, unsigned int outlineEdges);
+    void RasterizeTile(int tile);
+
+    std::vector<Occluder> m_occluders;
+    std::vector<std::pair<float, std::uint32_t>> m_selection;
+    std::vector<ScreenTriangle> m_triangles;
+    std::array<std::vector<std::uint32_t>, static_cast<std::size_t>(kTilesX * kTilesY)> m_tileBins;
+
+    std::vector<float> m_depth;                 // kWidth * kHeight, 0 = near plane, 1 = far / empty
+    std::array<float, static_cast<std::size_t>(kBlocksX * kBlocksY)> m_blockMaxDepth{};
+    std::array<float, static_cast<std::size_t>(kTilesX * kTilesY)> m_tileMaxDepth{};
+
+    glm::mat4 m_viewProjection{1.0F};
+    std::size_t m_maxOccluders = 48;
+    bool m_enabled = true;
+    bool m_active = false;                      // this frame has at least one occluder rasterized
+
+    Stats m_frameStats;
+    mutable std::atomic<std::uint32_t> m_tested{0};
+    mutable std::atomic<std::uint32_t> m_culled{0};
+};
+} // namespace engine::render
@@ -0,0 +1,73 @@
+#include "engine/render/RenderQueue.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace engine::render
+{
+std::uint64_t RenderQueue::MakeKey(
+    Pass pass,
+    std::uint32_t shader,
+    std::uint32_t texture,
+    std::uint32_t mesh,
+    float viewDepth,
+    float maxDepth
+)
+{
+    constexpr float kDepthSteps = static_cast<float>((1U << 24U) - 1U);
+    const float normalized = maxDepth > 0.0F ? std::clamp(viewDepth / maxDepth, 0.0F, 1.0F) : 0.0F;
+    const auto depth = static_cast<std::uint64_t>(std::lround(normalized * kDepthSteps));
+
+    return (static_cast<std::uint64_t>(static_cast<std::uint8_t>(pass) & 0xFU) << 60U) |
+           (static_cast<std::uint64_t>(shader & 0xFU) << 56U) |
+           (static_cast<std::uint64_t>(texture & 0xFFFFU) << 40U) |
+           (static_cast<std::uint64_t>(mesh & 0xFFFFU) << 24U) |
+           depth;
+}
+
+void RenderQueue::Sort()
+{
+    if (m_items.size() < 2)
+    {
+        return;
+    }
+
+    // Bytes that are identical across all keys carry no ordering information.
+    std::uint64_t orBits = 0;
+    std::uint64_t andBits = ~0ULL;
+    for (const Item& item : m_items)
+    {
+        orBits |= item.key;
+        andBits &= item.key;
+    }
+    const std::uint64_t varying = orBits ^ andBits;
+
+    m_scratch.resize(m_items.size());
+    for (unsigned shift = 0; shift < 64U; shift += 8U)
+    {
+        if (((varying >> shift) & 0xFFU) == 0U)
+        {
+            continue;
+        }
+
+        std::array<std::size_t, 256> offsets{};
+        for (const Item& item : m_items)
+        {
+            ++offsets[(item.key >> shift) & 0xFFU];
+        }
+        std::size_t running = 0;
+        for (std::size_t& offset : offsets)
+        {
+            const std::size_t count = offset;
+            offset = running;
+            running += count;
+        }
+        for (const Item& item : m_items)
+        {
+            m_scratch[offsets[(item.key >> shift) & 0xFFU]++] = item;
+        }
+        m_items.swap(m_scratch);
+    }
+}
+} // namespace engine::render
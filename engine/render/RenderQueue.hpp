@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace engine::render
+{
+/// Per-frame list of draw submissions ordered by a packed 64-bit key.
+/// Key layout (MSB first): pass 4 | shader 4 | texture 16 | mesh 16 | depth 24, so sorting groups
+/// draws by pass, then by the state that is most expensive to change, then front-to-back.
+class RenderQueue
+{
+public:
+    enum class Pass : std::uint8_t
+    {
+        Opaque = 0,
+        Textured = 1
+    };
+
+    struct Item
+    {
+        std::uint64_t key = 0;
+        std::uint32_t payload = 0; // owner-defined: what to draw (e.g. kind + index)
+    };
+
+    [[nodiscard]] static std::uint64_t MakeKey(
+        Pass pass,
+        std::uint32_t shader,
+        std::uint32_t texture,
+        std::uint32_t mesh,
+        float viewDepth,
+        float maxDepth
+    );
+
+    void Clear() { m_items.clear(); }
+    void Push(std::uint64_t key, std::uint32_t payload) { m_items.push_back(Item{key, payload}); }
+
+    /// Stable LSD radix sort on the key, 8 bits per pass; byte positions where every key agrees are skipped.
+    void Sort();
+
+    [[nodiscard]] const std::vector<Item>& Items() const { return m_items; }
+    [[nodiscard]] std::size_t Size() const { return m_items.size(); }
+    [[nodiscard]] bool Empty() const { return m_items.empty(); }
+
+private:
+    std::vector<Item> m_items;
+    std::vector<Item> m_scratch;
+};
+} // namespace engine::render
@@ -1,28 +1,65 @@
 #include "engine/render/RenderThread.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 
+#include <GLFW/glfw3.h>
+
+#include "engine/core/Profiler.hpp"
+
 namespace engine::render
 {
+namespace
+{
+float MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+} // namespace
 
-bool RenderThread::Initialize()
+std::uint32_t FrameArena::Allocate(std::size_t bytes, std::size_t alignment)
+{
+    const std::size_t offset = (m_used + alignment - 1U) & ~(alignment - 1U);
+    const std::size_t required = offset + bytes;
+    if (required > m_storage.size())
+    {
+        m_storage.resize(std::max<std::size_t>({required, m_storage.size() * 2U, 64U * 1024U}));
+    }
+    m_used = required;
+    return static_cast<std::uint32_t>(offset);
+}
+
+std::uint32_t FrameArena::Push(const void* data, std::size_t bytes)
+{
+    const std::uint32_t offset = Allocate(bytes);
+    if (bytes > 0)
+    {
+        std::memcpy(At(offset), data, bytes);
+    }
+    return offset;
+}
+
+bool RenderThread::Initialize(GLFWwindow* window)
 {
     if (m_initialized)
     {
         return true;
     }
 
+    m_window = window;
     m_shutdown = false;
-    m_framesSubmitted = 0;
-    m_framesDropped = 0;
-
-    while (!m_frameQueue.empty())
+    m_busy = false;
+    m_mainOwnsContext = true;
+    m_stats = Stats{};
+    if (m_window != nullptr)
     {
-        m_frameQueue.pop();
+        m_thread = std::thread(&RenderThread::ThreadMain, this);
     }
 
     m_initialized = true;
-    std::cout << "[RenderThread] Initialized (command buffer mode)\n";
+    std::cout << "[RenderThread] Initialized (" << (m_window != nullptr ? "threaded submission" : "inline only") << ")\n";
     return true;
 }
 
@@ -33,69 +70,128 @@ void RenderThread::Shutdown()
         return;
     }
 
-    m_shutdown = true;
-    m_submitCondition.notify_all();
-    m_completeCondition.notify_all();
-
-    while (!m_frameQueue.empty())
+    AcquireContext();
     {
-        m_frameQueue.pop();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_workCondition.notify_all();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
     }
 
+    m_window = nullptr;
     m_initialized = false;
     std::cout << "[RenderThread] Shutdown complete\n";
 }
 
-void RenderThread::BeginFrame()
+void RenderThread::Submit(const RenderCommandList& list, ExecuteFn execute, void* user)
 {
+    m_stats.lastCommandCount = list.commands.size();
+    m_stats.lastArenaBytes = list.arena.Used();
+    ++m_stats.listsSubmitted;
+
+    const bool threaded = m_initialized && m_enabled && m_threadedAllowed && m_window != nullptr && m_thread.joinable();
+    if (!threaded)
+    {
+        AcquireContext();
+        const auto start = std::chrono::steady_clock::now();
+        execute(user, list);
+        RecordTimings(MillisecondsSince(start), 0.0F, false);
+        return;
+    }
+
+    // Hand the context over (or queue behind the lists already running); the main thread must not
+    // touch GL until AcquireContext().
+    if (m_mainOwnsContext)
+    {
+        glfwMakeContextCurrent(nullptr);
+        m_mainOwnsContext = false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.push_back(PendingList{&list, execute, user});
+        m_busy = true;
+    }
+    m_workCondition.notify_one();
+    ++m_stats.listsThreaded;
 }
 
-void RenderThread::SubmitFrameData(const RenderFrameData& data)
+void RenderThread::AcquireContext()
 {
-    if (!m_initialized || !m_enabled)
+    if (m_mainOwnsContext)
     {
         return;
     }
 
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-
-    if (m_frameQueue.size() >= kMaxPendingFrames)
+    const auto start = std::chrono::steady_clock::now();
+    float executeMs = 0.0F;
     {
-        m_frameQueue.pop();
-        ++m_framesDropped;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneCondition.wait(lock, [this]() { return !m_busy; });
+        executeMs = m_threadExecuteMs;
+        m_threadExecuteMs = 0.0F;
     }
+    const float waitMs = MillisecondsSince(start);
 
-    m_frameQueue.push(data);
-    ++m_framesSubmitted;
-    m_submitCondition.notify_one();
+    glfwMakeContextCurrent(m_window);
+    m_mainOwnsContext = true;
+    RecordTimings(executeMs, waitMs, true);
 }
 
-void RenderThread::EndFrame()
+void RenderThread::ThreadMain()
 {
-    m_completeCondition.notify_all();
+    while (true)
+    {
+        PendingList pending;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_workCondition.wait(lock, [this]() { return m_shutdown || !m_pending.empty(); });
+            if (m_shutdown && m_pending.empty())
+            {
+                return;
+            }
+            pending = m_pending.front();
+            m_pending.pop_front();
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        glfwMakeContextCurrent(m_window);
+        pending.execute(pending.user, *pending.list);
+        glfwMakeContextCurrent(nullptr);
+        const float executeMs = MillisecondsSince(start);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_threadExecuteMs += executeMs;
+            m_busy = !m_pending.empty();
+        }
+        m_doneCondition.notify_all();
+    }
 }
 
-void RenderThread::WaitForSubmit()
+bool RenderThread::CallingThreadOwnsContext()
 {
-    std::unique_lock<std::mutex> lock(m_queueMutex);
-    m_completeCondition.wait(lock, [this]() {
-        return m_frameQueue.empty() || m_shutdown;
-    });
+    return glfwGetCurrentContext() != nullptr;
 }
 
-std::size_t RenderThread::PendingFrames() const
+void RenderThread::RecordTimings(float executeMs, float waitMs, bool threaded)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-    return m_frameQueue.size();
+    constexpr float kSmoothing = 0.1F;
+    m_stats.lastExecuteMs = executeMs;
+    m_stats.lastWaitMs = waitMs;
+    m_stats.avgExecuteMs += (executeMs - m_stats.avgExecuteMs) * kSmoothing;
+    m_stats.avgWaitMs += (waitMs - m_stats.avgWaitMs) * kSmoothing;
+
+    auto& stats = engine::core::Profiler::Instance().StatsMut();
+    stats.renderExecuteMs = executeMs;
+    stats.renderWaitMs = waitMs;
+    stats.renderSubmitThreaded = threaded;
 }
 
 RenderThread::Stats RenderThread::GetStats() const
 {
-    Stats stats;
-    stats.framesSubmitted = m_framesSubmitted.load();
-    stats.framesDropped = m_framesDropped.load();
-    stats.pendingFrames = PendingFrames();
-    return stats;
-}
-
+    return m_stats;
 }
+} // namespace engine::render
@@ -1,165 +1,182 @@
 #pragma once
 
-#include <glm/glm.hpp>
-#include <glm/gtc/quaternion.hpp>
-
 #include <atomic>
 #include <condition_variable>
-#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <mutex>
-#include <queue>
-#include <string>
 #include <thread>
-#include <unordered_map>
+#include <type_traits>
 #include <vector>
 
+struct GLFWwindow;
+
 namespace engine::render
 {
-
-struct RenderCommand
+/// Linear per-frame allocator. Reset() keeps the capacity, so a steady-state frame allocates nothing.
+/// Returned offsets (not pointers) stay valid if the storage grows while recording.
+class FrameArena
 {
-    enum class Type : std::uint8_t
-    {
-        Clear,
-        SetViewport,
-        SetViewProjection,
-        DrawLines,
-        DrawSolid,
-        DrawTextured,
-        SetLighting,
-        SetPointLights,
-        SetSpotLights,
-        SetEnvironment,
-        SetCameraPosition,
-        Custom
-    };
-
-    Type type = Type::Custom;
-    std::function<void()> customExecutor;
-};
+public:
+    void Reset() { m_used = 0; }
+    [[nodiscard]] std::uint32_t Allocate(std::size_t bytes, std::size_t alignment = 16);
+    [[nodiscard]] std::uint32_t Push(const void* data, std::size_t bytes);
 
-struct LineCommand
-{
-    std::vector<glm::vec3> positions;
-    std::vector<glm::vec3> colors;
-    bool overlay = false;
-};
+    [[nodiscard]] void* At(std::uint32_t offset) { return m_storage.data() + offset; }
+    [[nodiscard]] const void* At(std::uint32_t offset) const { return m_storage.data() + offset; }
+    [[nodiscard]] std::size_t Used() const { return m_used; }
+    [[nodiscard]] std::size_t Capacity() const { return m_storage.size(); }
 
-struct SolidCommand
-{
-    std::vector<float> vertices;
-    std::size_t vertexStride = 0;
-    std::size_t vertexCount = 0;
+private:
+    std::vector<std::byte> m_storage;
+    std::size_t m_used = 0;
 };
 
-struct TexturedCommand
+/// One recorded GL operation. Plain data only: payload bytes (vertices, instances, frame constants)
+/// live in the owning list's arena and are referenced by offset.
+struct RenderCommand
 {
-    std::vector<float> vertices;
-    std::size_t vertexStride = 0;
-    std::size_t firstVertex = 0;
-    std::size_t vertexCount = 0;
-    unsigned int textureId = 0;
-};
+    enum class Type : std::uint8_t
+    {
+        UploadBuffer,          // upload: buffer slot, arena offset, bytes
+        BindProgram,           // bind.id = program slot; the executor applies frame constants
+        BindVertexArray,       // bind.id = GL VAO name
+        BindTexture,           // bind.id = GL texture name (0 unbinds)
+        SetInstancedMode,      // bind.id = solid shader uInstanced value
+        SetVertexDecode,       // decode: compact mesh position scale/offset and octahedral normals
+        SetDepthTest,          // bind.id = 0/1
+        DrawArrays,            // draw
+        DrawElementsInstanced, // drawInstanced
+        MultiDrawArrays,       // multiDraw: firsts/counts arrays live in the arena
+        InvokePass             // invoke: caller GL pass run in list order with its arena payload
+    };
 
-struct PointLightData
-{
-    glm::vec3 position{0.0F};
-    float range = 10.0F;
-    glm::vec3 color{1.0F};
-    float intensity = 1.0F;
-};
+    struct Upload
+    {
+        std::uint32_t buffer;
+        std::uint32_t arenaOffset;
+        std::uint32_t bytes;
+        std::uint32_t destinationOffset;
+    };
+    struct Bind
+    {
+        std::uint32_t id;
+    };
+    struct VertexDecode
+    {
+        float scale[3];
+        float offset[3];
+        std::uint32_t octNormals;
+    };
+    struct Draw
+    {
+        std::uint32_t mode;
+        std::uint32_t first;
+        std::uint32_t count;
+    };
+    struct DrawInstanced
+    {
+        std::uint32_t indexCount;
+        std::uint32_t indexType;
+        std::uint32_t instanceCount;
+        std::uint32_t baseInstance;
+    };
+    struct MultiDraw
+    {
+        std::uint32_t mode;
+        std::uint32_t firstsOffset;
+        std::uint32_t countsOffset;
+        std::uint32_t drawCount;
+    };
+    struct Invoke
+    {
+        void (*fn)(void* user, const void* payload);
+        void* user;
+        std::uint32_t payloadOffset;
+    };
 
-struct SpotLightData
-{
-    glm::vec3 position{0.0F};
-    float range = 10.0F;
-    glm::vec3 direction{0.0F, -1.0F, 0.0F};
-    float innerCos = 0.9F;
-    glm::vec3 color{1.0F};
-    float intensity = 1.0F;
-    float outerCos = 0.7F;
+    Type type = Type::BindProgram;
+    union
+    {
+        Upload upload;
+        Bind bind;
+        VertexDecode decode;
+        Draw draw;
+        DrawInstanced drawInstanced;
+        MultiDraw multiDraw;
+        Invoke invoke;
+    };
 };
+static_assert(std::is_trivially_copyable_v<RenderCommand>, "render commands must stay plain data");
 
-struct EnvironmentData
+/// A frame's worth of commands plus the arena that backs their payloads.
+struct RenderCommandList
 {
-    glm::vec3 directionalLightDirection{0.3F, -0.8F, 0.5F};
-    glm::vec3 directionalLightColor{1.0F};
-    float directionalLightIntensity = 1.0F;
-    glm::vec3 fogColor{0.5F};
-    float fogDensity = 0.0F;
-    glm::vec3 skyTopColor{0.4F, 0.6F, 0.9F};
-    float fogStart = 50.0F;
-    glm::vec3 skyBottomColor{0.7F, 0.8F, 0.95F};
-    float fogEnd = 200.0F;
-    bool lightingEnabled = true;
-    bool fogEnabled = false;
-    bool skyEnabled = true;
-    bool cloudsEnabled = false;
-    float cloudCoverage = 0.5F;
-    float cloudDensity = 0.5F;
-    float cloudSpeed = 1.0F;
-};
+    FrameArena arena;
+    std::vector<RenderCommand> commands;
+    std::uint32_t constantsOffset = 0;
 
-struct RenderFrameData
-{
-    glm::mat4 viewProjection{1.0F};
-    glm::vec3 cameraPosition{0.0F};
-    glm::vec3 clearColor{0.06F, 0.07F, 0.08F};
-    int framebufferWidth = 1920;
-    int framebufferHeight = 1080;
-
-    std::vector<LineCommand> lines;
-    std::vector<LineCommand> overlayLines;
-    std::vector<SolidCommand> solids;
-    std::vector<TexturedCommand> textured;
-
-    std::vector<PointLightData> pointLights;
-    std::vector<SpotLightData> spotLights;
-    EnvironmentData environment;
-    bool lightingEnabled = true;
-
-    void Clear()
+    void Reset()
     {
-        lines.clear();
-        overlayLines.clear();
-        solids.clear();
-        textured.clear();
-        pointLights.clear();
-        spotLights.clear();
+        arena.Reset();
+        commands.clear();
+        constantsOffset = 0;
     }
+    void Push(const RenderCommand& command) { commands.push_back(command); }
 };
 
+/// Executes recorded command lists. When threaded submission is allowed for a frame, the GL context
+/// is handed to a dedicated thread that runs the lists in submission order while the main thread keeps
+/// building the frame; AcquireContext() takes the context back before the main thread issues its own GL
+/// calls. A submitted list must stay untouched until the next AcquireContext().
 class RenderThread
 {
 public:
+    using ExecuteFn = void (*)(void* user, const RenderCommandList& list);
+
     static RenderThread& Instance()
     {
         static RenderThread s_instance;
         return s_instance;
     }
 
-    bool Initialize();
+    bool Initialize(GLFWwindow* window);
     void Shutdown();
 
     [[nodiscard]] bool IsInitialized() const { return m_initialized; }
 
-    void BeginFrame();
-    void SubmitFrameData(const RenderFrameData& data);
-    void EndFrame();
+    void SetEnabled(bool enabled) { m_enabled = enabled; }
+    [[nodiscard]] bool IsEnabled() const { return m_enabled; }
 
-    void WaitForSubmit();
+    /// Per frame: whether the next Submit may run on the render thread. The caller guarantees no
+    /// main-thread GL until AcquireContext().
+    void SetThreadedSubmissionAllowed(bool allowed) { m_threadedAllowed = allowed; }
 
-    [[nodiscard]] std::size_t PendingFrames() const;
+    /// Runs the list on the render thread (context handed over) or inline on the caller. Lists submitted
+    /// while the render thread holds the context queue behind the ones already in flight.
+    void Submit(const RenderCommandList& list, ExecuteFn execute, void* user);
 
-    void SetEnabled(bool enabled) { m_enabled = enabled; }
-    [[nodiscard]] bool IsEnabled() const { return m_enabled; }
+    /// Blocks until the render thread is idle and makes the context current on the calling thread.
+    /// Cheap no-op when the main thread already owns it.
+    void AcquireContext();
+
+    [[nodiscard]] bool MainThreadOwnsContext() const { return m_mainOwnsContext; }
+
+    /// Whether the GL context is current on the calling thread. GL entry points that run outside the
+    /// recorded lists assert this.
+    [[nodiscard]] static bool CallingThreadOwnsContext();
 
     struct Stats
     {
-        std::size_t framesSubmitted = 0;
-        std::size_t framesDropped = 0;
-        std::size_t pendingFrames = 0;
-        float avgSubmitTimeMs = 0.0F;
+        std::size_t listsSubmitted = 0;
+        std::size_t listsThreaded = 0;
+        float lastExecuteMs = 0.0F;  // time spent executing the lists of the last hand-over
+        float lastWaitMs = 0.0F;     // main thread blocked in AcquireContext for the last list
+        float avgExecuteMs = 0.0F;
+        float avgWaitMs = 0.0F;
+        std::size_t lastCommandCount = 0;
+        std::size_t lastArenaBytes = 0;
     };
     [[nodiscard]] Stats GetStats() const;
 
@@ -170,18 +187,30 @@ private:
     RenderThread(const RenderThread&) = delete;
     RenderThread& operator=(const RenderThread&) = delete;
 
+    void ThreadMain();
+    void RecordTimings(float executeMs, float waitMs, bool threaded);
+
+    GLFWwindow* m_window = nullptr;
+    std::thread m_thread;
     std::atomic<bool> m_initialized{false};
     std::atomic<bool> m_enabled{true};
-    std::atomic<bool> m_shutdown{false};
+    bool m_threadedAllowed = false;
+    bool m_mainOwnsContext = true;
 
-    mutable std::mutex m_queueMutex;
-    std::queue<RenderFrameData> m_frameQueue;
-    std::condition_variable m_submitCondition;
-    std::condition_variable m_completeCondition;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_workCondition;
+    std::condition_variable m_doneCondition;
+    struct PendingList
+    {
+        const RenderCommandList* list = nullptr;
+        ExecuteFn execute = nullptr;
+        void* user = nullptr;
+    };
+    std::deque<PendingList> m_pending;
+    bool m_busy = false;
+    bool m_shutdown = false;
+    float m_threadExecuteMs = 0.0F;
 
-    static constexpr std::size_t kMaxPendingFrames = 2;
-    std::atomic<std::size_t> m_framesSubmitted{0};
-    std::atomic<std::size_t> m_framesDropped{0};
+    Stats m_stats;
 };
-
-}
+} // namespace engine::render
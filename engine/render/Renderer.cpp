@@ -2,24 +2,66 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
 #include <cmath>
+#include <cstring>
 #include <iostream>
+#include <utility>
 
 #include <glad/glad.h>
 
 #include <glm/common.hpp>
 #include <glm/geometric.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/packing.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
 #include "engine/core/Profiler.hpp"
+#include "engine/render/ShaderCache.hpp"
 
 namespace engine::render
 {
 namespace
 {
-constexpr int kMaxPointLights = 8;
-constexpr int kMaxSpotLights = 8;
+// Clustered shading bounds the per-fragment cost, so maps may carry hundreds of lights.
+constexpr int kMaxPointLights = 768;
+constexpr int kMaxSpotLights = 256;
+
+// Per-frame constants recorded once into the command list's arena. Lighting and fog live in the
+// shared uniform buffers instead (see FrameUniformBlock / LightUniformBlock).
+struct FrameConstants
+{
+    glm::mat4 viewProjection{1.0F};
+};
+
+// Uniform/storage buffer binding points; must match the `binding` qualifiers in the shaders below.
+constexpr GLuint kFrameUniformBinding = 0;
+constexpr GLuint kClusterLightBinding = 1;
+constexpr GLuint kClusterGridBinding = 2;
+constexpr GLuint kClusterIndexBinding = 3;
+static_assert(
+    LightClusters::kClustersX == 16 && LightClusters::kClustersY == 9 && LightClusters::kClustersZ == 24,
+    "cluster grid dimensions are hard-coded in the lit fragment shaders"
+);
+
+// Command list ids for the streamed vertex buffers and programs; the executor maps them to GL names.
+enum StreamBuffer : std::uint32_t
+{
+    kStreamSolid = 0,
+    kStreamTextured,
+    kStreamLine,
+    kStreamInstance,
+    kStreamFrameUniforms,
+    kStreamClusterLights,
+    kStreamClusterGrid,
+    kStreamClusterIndices
+};
+enum ProgramSlot : std::uint32_t
+{
+    kProgramSolid = 0,
+    kProgramTextured,
+    kProgramLine
+};
 
 constexpr const char* kLineVertexShader = R"(
 #version 450 core
@@ -54,22 +96,61 @@ layout (location = 0) in vec3 aPosition;
 layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec3 aColor;
 layout (location = 3) in vec4 aMaterial;
+// Instanced draws: per-instance 3x4 transform rows; unit boxes/capsules also take color (w = capsule
+// stretch) and material from the instance.
+layout (location = 4) in vec4 iModelRow0;
+layout (location = 5) in vec4 iModelRow1;
+layout (location = 6) in vec4 iModelRow2;
+layout (location = 7) in vec4 iColor;
+layout (location = 8) in vec4 iMaterial;
+layout (location = 9) in float aStretch;
 
 uniform mat4 uViewProjection;
 uniform mat4 uModel;
+// 0 = uModel, 1 = unit box/capsule instances, 2 = cached GPU mesh instances (vertex color/material).
+uniform int uInstanced = 0;
+// Compact GPU meshes: positions are unorm16 within the mesh bounds, normals octahedral.
+uniform vec3 uPositionScale = vec3(1.0);
+uniform vec3 uPositionOffset = vec3(0.0);
+uniform int uOctNormals = 0;
 
 out vec3 vNormal;
 out vec3 vColor;
 out vec3 vWorldPos;
 out vec4 vMaterial;
 
+vec3 OctDecode(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0)
+    {
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    }
+    return normalize(n);
+}
+
 void main()
 {
-    vec4 worldPos = uModel * vec4(aPosition, 1.0);
-    vWorldPos = worldPos.xyz;
-    vNormal = mat3(uModel) * aNormal;
+    vec3 localPos = aPosition * uPositionScale + uPositionOffset;
+    vec3 normal = uOctNormals != 0 ? OctDecode(aNormal.xy) : aNormal;
+    mat4 model = uModel;
     vColor = aColor;
     vMaterial = aMaterial;
+    if (uInstanced != 0)
+    {
+        model = transpose(mat4(iModelRow0, iModelRow1, iModelRow2, vec4(0.0, 0.0, 0.0, 1.0)));
+    }
+    if (uInstanced == 1)
+    {
+        localPos.y += aStretch * iColor.w;
+        vColor = iColor.rgb;
+        vMaterial = iMaterial;
+    }
+
+    vec4 worldPos = model * vec4(localPos, 1.0);
+    vWorldPos = worldPos.xyz;
+    // Box scale is per-axis but box normals are axis-aligned; the fragment shader renormalizes.
+    vNormal = mat3(model) * normal;
     gl_Position = uViewProjection * worldPos;
 }
 )";
@@ -82,24 +163,34 @@ in vec3 vWorldPos;
 in vec4 vMaterial;
 out vec4 FragColor;
 
-uniform vec3 uCameraPos;
-uniform int uLightingEnabled;
-uniform vec3 uLightDir;
-uniform vec3 uLightColor;
-uniform float uLightIntensity;
-uniform int uFogEnabled;
-uniform vec3 uFogColor;
-uniform float uFogDensity;
-uniform float uFogStart;
-uniform float uFogEnd;
-uniform int uPointLightCount;
-uniform vec4 uPointLightPosRange[8];
-uniform vec4 uPointLightColorIntensity[8];
-uniform int uSpotLightCount;
-uniform vec4 uSpotLightPosRange[8];
-uniform vec4 uSpotLightDirInnerCos[8];
-uniform vec4 uSpotLightColorIntensity[8];
-uniform float uSpotLightOuterCos[8];
+layout (std140, binding = 0) uniform FrameUniforms
+{
+    vec3 uCameraPos;
+    int uLightingEnabled;
+    vec3 uLightDir;
+    float uLightIntensity;
+    vec3 uLightColor;
+    int uFogEnabled;
+    vec3 uFogColor;
+    float uFogDensity;
+    float uFogStart;
+    float uFogEnd;
+    float uClusterDepthScale;
+    float uClusterDepthBias;
+    vec2 uClusterTileScale;
+};
+
+// Clustered lights: 16 x 9 screen tiles x 24 log depth slices (LightClusters on the CPU).
+struct ClusterLight
+{
+    vec4 posRange;
+    vec4 colorIntensity;
+    vec4 dirInnerCos;
+    vec4 params; // x = spot outer cos, y = is spot, z = diffuse weight, w = specular weight
+};
+layout (std430, binding = 1) readonly buffer ClusterLightBuffer { ClusterLight uLights[]; };
+layout (std430, binding = 2) readonly buffer ClusterGridBuffer { uvec2 uClusters[]; };
+layout (std430, binding = 3) readonly buffer ClusterIndexBuffer { uint uLightIndices[]; };
 
 void main()
 {
@@ -131,51 +222,36 @@ void main()
     lit *= mix(vec3(1.0), uLightColor, 0.65);
     lit += specColor * spec * (0.35 + uLightIntensity * 0.5);
 
-    for (int i = 0; i < uPointLightCount; ++i)
-    {
-        vec3 toLight = uPointLightPosRange[i].xyz - vWorldPos;
-        float distSq = dot(toLight, toLight);
-        float range = uPointLightPosRange[i].w;
-        if (distSq < range * range)
-        {
-            float invDist = inversesqrt(distSq);
-            float dist = distSq * invDist;
-            vec3 l = toLight * invDist;
-            float ndotl = max(dot(n, l), 0.0);
-            float attenuation = 1.0 - (dist / range);
-            attenuation *= attenuation;
-            vec3 lightColor = uPointLightColorIntensity[i].rgb;
-            float intensity = uPointLightColorIntensity[i].a;
-            vec3 pointHalf = normalize(l + viewDir);
-            float pointSpec = pow(max(dot(n, pointHalf), 0.0), shininess);
-            lit += diffuseColor * lightColor * (ndotl * attenuation * intensity * 0.85);
-            lit += specColor * lightColor * (pointSpec * attenuation * intensity * 0.45);
-        }
-    }
-
-    for (int i = 0; i < uSpotLightCount; ++i)
+    float viewDepth = 1.0 / gl_FragCoord.w;
+    ivec2 tile = clamp(ivec2(gl_FragCoord.xy * uClusterTileScale), ivec2(0), ivec2(15, 8));
+    int slice = clamp(int(floor(log(viewDepth) * uClusterDepthScale + uClusterDepthBias)), 0, 23);
+    uvec2 cluster = uClusters[(slice * 9 + tile.y) * 16 + tile.x];
+    for (uint k = 0u; k < cluster.y; ++k)
     {
-        vec3 toLight = uSpotLightPosRange[i].xyz - vWorldPos;
+        ClusterLight light = uLights[uLightIndices[cluster.x + k]];
+        vec3 toLight = light.posRange.xyz - vWorldPos;
         float distSq = dot(toLight, toLight);
-        float range = uSpotLightPosRange[i].w;
+        float range = light.posRange.w;
         if (distSq < range * range)
         {
             float invDist = inversesqrt(distSq);
             float dist = distSq * invDist;
             vec3 l = toLight * invDist;
-            float cosTheta = dot(-l, uSpotLightDirInnerCos[i].xyz);
-            float innerCos = uSpotLightDirInnerCos[i].w;
-            float outerCos = uSpotLightOuterCos[i];
-            float cone = smoothstep(outerCos, innerCos, cosTheta);
+            float cone = 1.0;
+            if (light.params.y > 0.5)
+            {
+                float cosTheta = dot(-l, light.dirInnerCos.xyz);
+                cone = smoothstep(light.params.x, light.dirInnerCos.w, cosTheta);
+            }
             float ndotl = max(dot(n, l), 0.0);
             float attenuation = 1.0 - (dist / range);
             attenuation *= attenuation;
-            vec3 lightColor = uSpotLightColorIntensity[i].rgb;
-            float intensity = uSpotLightColorIntensity[i].a;
-            vec3 spotHalf = normalize(l + viewDir);
-            float spotSpec = pow(max(dot(n, spotHalf), 0.0), shininess);
-            lit += diffuseColor * lightColor * (ndotl * attenuation * cone * intensity * 0.95);
-            lit += specColor * lightColor * (spotSpec * attenuation * cone * intensity * 0.5);
+            vec3 lightColor = light.colorIntensity.rgb;
+            float intensity = light.colorIntensity.a * cone;
+            vec3 lightHalf = normalize(l + viewDir);
+            float lightSpec = pow(max(dot(n, lightHalf), 0.0), shininess);
+            lit += diffuseColor * lightColor * (ndotl * attenuation * intensity * light.params.z);
+            lit += specColor * lightColor * (lightSpec * attenuation * intensity * light.params.w);
         }
     }
 
@@ -233,24 +309,34 @@ in vec4 vMaterial;
 out vec4 FragColor;
 
 uniform sampler2D uAlbedoTex;
-uniform vec3 uCameraPos;
-uniform int uLightingEnabled;
-uniform vec3 uLightDir;
-uniform vec3 uLightColor;
-uniform float uLightIntensity;
-uniform int uFogEnabled;
-uniform vec3 uFogColor;
-uniform float uFogDensity;
-uniform float uFogStart;
-uniform float uFogEnd;
-uniform int uPointLightCount;
-uniform vec4 uPointLightPosRange[8];
-uniform vec4 uPointLightColorIntensity[8];
-uniform int uSpotLightCount;
-uniform vec4 uSpotLightPosRange[8];
-uniform vec4 uSpotLightDirInnerCos[8];
-uniform vec4 uSpotLightColorIntensity[8];
-uniform float uSpotLightOuterCos[8];
+layout (std140, binding = 0) uniform FrameUniforms
+{
+    vec3 uCameraPos;
+    int uLightingEnabled;
+    vec3 uLightDir;
+    float uLightIntensity;
+    vec3 uLightColor;
+    int uFogEnabled;
+    vec3 uFogColor;
+    float uFogDensity;
+    float uFogStart;
+    float uFogEnd;
+    float uClusterDepthScale;
+    float uClusterDepthBias;
+    vec2 uClusterTileScale;
+};
+
+// Clustered lights: 16 x 9 screen tiles x 24 log depth slices (LightClusters on the CPU).
+struct ClusterLight
+{
+    vec4 posRange;
+    vec4 colorIntensity;
+    vec4 dirInnerCos;
+    vec4 params; // x = spot outer cos, y = is spot, z = diffuse weight, w = specular weight
+};
+layout (std430, binding = 1) readonly buffer ClusterLightBuffer { ClusterLight uLights[]; };
+layout (std430, binding = 2) readonly buffer ClusterGridBuffer { uvec2 uClusters[]; };
+layout (std430, binding = 3) readonly buffer ClusterIndexBuffer { uint uLightIndices[]; };
 
 void main()
 {
@@ -283,51 +369,36 @@ void main()
     lit *= mix(vec3(1.0), uLightColor, 0.65);
     lit += specColor * spec * (0.35 + uLightIntensity * 0.5);
 
-    for (int i = 0; i < uPointLightCount; ++i)
+    float viewDepth = 1.0 / gl_FragCoord.w;
+    ivec2 tile = clamp(ivec2(gl_FragCoord.xy * uClusterTileScale), ivec2(0), ivec2(15, 8));
+    int slice = clamp(int(floor(log(viewDepth) * uClusterDepthScale + uClusterDepthBias)), 0, 23);
+    uvec2 cluster = uClusters[(slice * 9 + tile.y) * 16 + tile.x];
+    for (uint k = 0u; k < cluster.y; ++k)
     {
-        vec3 toLight = uPointLightPosRange[i].xyz - vWorldPos;
+        ClusterLight light = uLights[uLightIndices[cluster.x + k]];
+        vec3 toLight = light.posRange.xyz - vWorldPos;
         float distSq = dot(toLight, toLight);
-        float range = uPointLightPosRange[i].w;
+        float range = light.posRange.w;
         if (distSq < range * range)
         {
             float invDist = inversesqrt(distSq);
             float dist = distSq * invDist;
             vec3 l = toLight * invDist;
+            float cone = 1.0;
+            if (light.params.y > 0.5)
+            {
+                float cosTheta = dot(-l, light.dirInnerCos.xyz);
+                cone = smoothstep(light.params.x, light.dirInnerCos.w, cosTheta);
+            }
             float ndotl = max(dot(n, l), 0.0);
             float attenuation = 1.0 - (dist / range);
             attenuation *= attenuation;
-            vec3 lightColor = uPointLightColorIntensity[i].rgb;
-            float intensity = uPointLightColorIntensity[i].a;
-            vec3 pointHalf = normalize(l + viewDir);
-            float pointSpec = pow(max(dot(n, pointHalf), 0.0), shininess);
-            lit += diffuseColor * lightColor * (ndotl * attenuation * intensity * 0.85);
-            lit += specColor * lightColor * (pointSpec * attenuation * intensity * 0.45);
-        }
-    }
-
-    for (int i = 0; i < uSpotLightCount; ++i)
-    {
-        vec3 toLight = uSpotLightPosRange[i].xyz - vWorldPos;
-        float distSq = dot(toLight, toLight);
-        float range = uSpotLightPosRange[i].w;
-        if (distSq < range * range)
-        {
-            float invDist = inversesqrt(distSq);
-            float dist = distSq * invDist;
-            vec3 l = toLight * invDist;
-            float cosTheta = dot(-l, uSpotLightDirInnerCos[i].xyz);
-            float innerCos = uSpotLightDirInnerCos[i].w;
-            float outerCos = uSpotLightOuterCos[i];
-            float cone = smoothstep(outerCos, innerCos, cosTheta);
-            float ndotl = max(dot(n, l), 0.0);
-            float attenuation = 1.0 - (dist / range);
-            attenuation *= attenuation;
-            vec3 lightColor = uSpotLightColorIntensity[i].rgb;
-            float intensity = uSpotLightColorIntensity[i].a;
-            vec3 spotHalf = normalize(l + viewDir);
-            float spotSpec = pow(max(dot(n, spotHalf), 0.0), shininess);
-            lit += diffuseColor * lightColor * (ndotl * attenuation * cone * intensity * 0.95);
-            lit += specColor * lightColor * (spotSpec * attenuation * cone * intensity * 0.5);
+            vec3 lightColor = light.colorIntensity.rgb;
+            float intensity = light.colorIntensity.a * cone;
+            vec3 lightHalf = normalize(l + viewDir);
+            float lightSpec = pow(max(dot(n, lightHalf), 0.0), shininess);
+            lit += diffuseColor * lightColor * (ndotl * attenuation * intensity * light.params.z);
+            lit += specColor * lightColor * (lightSpec * attenuation * intensity * light.params.w);
         }
     }
 
@@ -360,6 +431,7 @@ glm::mat3 RotationMatrixFromEulerDegrees(const glm::vec3& eulerDegrees)
 
 bool Renderer::Initialize(int framebufferWidth, int framebufferHeight)
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     glEnable(GL_DEPTH_TEST);
     // NOTE: GL_CULL_FACE intentionally NOT enabled — the geometry pipeline
     // (boxes, capsules, UI quads) has mixed CW/CCW winding order.
@@ -429,58 +501,59 @@ bool Renderer::Initialize(int framebufferWidth, int framebufferHeight)
     glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(TexturedVertex), reinterpret_cast<void*>(offsetof(TexturedVertex, material)));
     glEnableVertexAttribArray(4);
 
+    CreateUnitMeshes();
+
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
     m_lineViewProjLocation = glGetUniformLocation(m_lineProgram, "uViewProjection");
     m_solidViewProjLocation = glGetUniformLocation(m_solidProgram, "uViewProjection");
     m_solidModelLocation = glGetUniformLocation(m_solidProgram, "uModel");
-    m_solidCameraPosLocation = glGetUniformLocation(m_solidProgram, "uCameraPos");
-    m_solidLightingEnabledLocation = glGetUniformLocation(m_solidProgram, "uLightingEnabled");
-    m_solidLightDirLocation = glGetUniformLocation(m_solidProgram, "uLightDir");
-    m_solidLightColorLocation = glGetUniformLocation(m_solidProgram, "uLightColor");
-    m_solidLightIntensityLocation = glGetUniformLocation(m_solidProgram, "uLightIntensity");
-    m_solidFogEnabledLocation = glGetUniformLocation(m_solidProgram, "uFogEnabled");
-    m_solidFogColorLocation = glGetUniformLocation(m_solidProgram, "uFogColor");
-    m_solidFogDensityLocation = glGetUniformLocation(m_solidProgram, "uFogDensity");
-    m_solidFogStartLocation = glGetUniformLocation(m_solidProgram, "uFogStart");
-    m_solidFogEndLocation = glGetUniformLocation(m_solidProgram, "uFogEnd");
-    m_solidPointLightCountLocation = glGetUniformLocation(m_solidProgram, "uPointLightCount");
-    m_solidPointLightPosRangeLocation = glGetUniformLocation(m_solidProgram, "uPointLightPosRange");
-    m_solidPointLightColorIntensityLocation = glGetUniformLocation(m_solidProgram, "uPointLightColorIntensity");
-    m_solidSpotLightCountLocation = glGetUniformLocation(m_solidProgram, "uSpotLightCount");
-    m_solidSpotLightPosRangeLocation = glGetUniformLocation(m_solidProgram, "uSpotLightPosRange");
-    m_solidSpotLightDirInnerCosLocation = glGetUniformLocation(m_solidProgram, "uSpotLightDirInnerCos");
-    m_solidSpotLightColorIntensityLocation = glGetUniformLocation(m_solidProgram, "uSpotLightColorIntensity");
-    m_solidSpotLightOuterCosLocation = glGetUniformLocation(m_solidProgram, "uSpotLightOuterCos");
+    m_solidPositionScaleLocation = glGetUniformLocation(m_solidProgram, "uPositionScale");
+    m_solidPositionOffsetLocation = glGetUniformLocation(m_solidProgram, "uPositionOffset");
+    m_solidOctNormalsLocation = glGetUniformLocation(m_solidProgram, "uOctNormals");
+    m_solidInstancedLocation = glGetUniformLocation(m_solidProgram, "uInstanced");
     m_texturedViewProjLocation = glGetUniformLocation(m_texturedProgram, "uViewProjection");
-    m_texturedCameraPosLocation = glGetUniformLocation(m_texturedProgram, "uCameraPos");
-    m_texturedLightingEnabledLocation = glGetUniformLocation(m_texturedProgram, "uLightingEnabled");
-    m_texturedLightDirLocation = glGetUniformLocation(m_texturedProgram, "uLightDir");
-    m_texturedLightColorLocation = glGetUniformLocation(m_texturedProgram, "uLightColor");
-    m_texturedLightIntensityLocation = glGetUniformLocation(m_texturedProgram, "uLightIntensity");
-    m_texturedFogEnabledLocation = glGetUniformLocation(m_texturedProgram, "uFogEnabled");
-    m_texturedFogColorLocation = glGetUniformLocation(m_texturedProgram, "uFogColor");
-    m_texturedFogDensityLocation = glGetUniformLocation(m_texturedProgram, "uFogDensity");
-    m_texturedFogStartLocation = glGetUniformLocation(m_texturedProgram, "uFogStart");
-    m_texturedFogEndLocation = glGetUniformLocation(m_texturedProgram, "uFogEnd");
-    m_texturedPointLightCountLocation = glGetUniformLocation(m_texturedProgram, "uPointLightCount");
-    m_texturedPointLightPosRangeLocation = glGetUniformLocation(m_texturedProgram, "uPointLightPosRange");
-    m_texturedPointLightColorIntensityLocation = glGetUniformLocation(m_texturedProgram, "uPointLightColorIntensity");
-    m_texturedSpotLightCountLocation = glGetUniformLocation(m_texturedProgram, "uSpotLightCount");
-    m_texturedSpotLightPosRangeLocation = glGetUniformLocation(m_texturedProgram, "uSpotLightPosRange");
-    m_texturedSpotLightDirInnerCosLocation = glGetUniformLocation(m_texturedProgram, "uSpotLightDirInnerCos");
-    m_texturedSpotLightColorIntensityLocation = glGetUniformLocation(m_texturedProgram, "uSpotLightColorIntensity");
-    m_texturedSpotLightOuterCosLocation = glGetUniformLocation(m_texturedProgram, "uSpotLightOuterCos");
     m_texturedAlbedoSamplerLocation = glGetUniformLocation(m_texturedProgram, "uAlbedoTex");
 
+    // Camera/lighting/fog uniforms are shared by the solid and textured programs through one std140 block.
+    glGenBuffers(1, &m_frameUniformBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, m_frameUniformBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(sizeof(FrameUniformBlock)), nullptr, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, kFrameUniformBinding, m_frameUniformBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    m_frameUniformsUploaded = false;
+
+    // Clustered light storage. Start zero-filled so an unbuilt grid reads as "no lights".
+    const auto createStorageBuffer = [](unsigned int* buffer, std::size_t* capacity, std::size_t bytes, GLuint binding) {
+        const std::vector<std::byte> zeros(bytes);
+        glGenBuffers(1, buffer);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, *buffer);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(bytes), zeros.data(), GL_STREAM_DRAW);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, *buffer);
+        *capacity = bytes;
+    };
+    createStorageBuffer(&m_clusterLightBuffer, &m_clusterLightBufferCapacityBytes, 64U * sizeof(ClusterLightRecord), kClusterLightBinding);
+    createStorageBuffer(
+        &m_clusterGridBuffer,
+        &m_clusterGridBufferCapacityBytes,
+        static_cast<std::size_t>(LightClusters::kClusterCount) * sizeof(LightClusters::Cluster),
+        kClusterGridBinding
+    );
+    createStorageBuffer(&m_clusterIndexBuffer, &m_clusterIndexBufferCapacityBytes, 16U * 1024U * sizeof(std::uint32_t), kClusterIndexBinding);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    m_clusterLightsUploaded = false;
+    m_clusteredViewProjection = glm::mat4{0.0F};
+
     SetViewport(framebufferWidth, framebufferHeight);
     return true;
 }
 
 void Renderer::Shutdown()
 {
+    RenderThread::Instance().AcquireContext();
     FreeAllGpuMeshes();
+    DestroyUnitMeshes();
 
     if (m_lineVbo != 0)
     {
@@ -497,6 +570,21 @@ void Renderer::Shutdown()
         glDeleteBuffers(1, &m_texturedVbo);
         m_texturedVbo = 0;
     }
+    if (m_frameUniformBuffer != 0)
+    {
+        glDeleteBuffers(1, &m_frameUniformBuffer);
+        m_frameUniformBuffer = 0;
+    }
+    for (unsigned int* buffer : {&m_clusterLightBuffer, &m_clusterGridBuffer, &m_clusterIndexBuffer})
+    {
+        if (*buffer != 0)
+        {
+            glDeleteBuffers(1, buffer);
+            *buffer = 0;
+        }
+    }
+    m_frameUniformsUploaded = false;
+    m_clusterLightsUploaded = false;
 
     if (m_lineVao != 0)
     {
@@ -531,8 +619,11 @@ void Renderer::Shutdown()
     }
 }
 
-void Renderer::SetViewport(int framebufferWidth, int framebufferHeight) const
+void Renderer::SetViewport(int framebufferWidth, int framebufferHeight)
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
+    m_framebufferWidth = std::max(1, framebufferWidth);
+    m_framebufferHeight = std::max(1, framebufferHeight);
     glViewport(0, 0, framebufferWidth, framebufferHeight);
 }
 
@@ -611,12 +702,24 @@ void Renderer::SetCameraWorldPosition(const glm::vec3& position)
 
 void Renderer::BeginFrame(const glm::vec3& clearColor)
 {
+    // The previous frame's list may still own the context on the render thread.
+    RenderThread::Instance().AcquireContext();
+
     m_lineVertices.clear();
     m_overlayLineVertices.clear();
     m_solidVertices.clear();
     m_texturedVertices.clear();
     m_texturedBatches.clear();
     m_gpuMeshDraws.clear();
+    m_solidRangeDraws.clear();
+    m_solidRangeFirsts.clear();
+    m_solidRangeCounts.clear();
+    m_pendingPasses.clear();
+    m_passPayloads.clear();
+    for (auto& instances : m_solidInstances)
+    {
+        instances.clear();
+    }
 
     // Periodically reclaim excess transient buffer capacity (e.g. after leaving benchmark).
     // If capacity is >4× the last frame's usage or >256K, shrink to save RAM.
@@ -663,235 +766,630 @@ void Renderer::EndFrame(const glm::mat4& viewProjection)
 
     auto& profiler = engine::core::Profiler::Instance();
 
-    const auto ensureBufferCapacity = [](std::size_t* ioCapacityBytes, std::size_t requiredBytes) {
-        if (ioCapacityBytes == nullptr || requiredBytes == 0U)
+    // BeginFrame took the context back, so last frame's list has finished executing and is reused.
+    RenderCommandList& list = m_commandList;
+    list.Reset();
+
+    FrameConstants constants;
+    constants.viewProjection = viewProjection;
+    list.constantsOffset = list.arena.Push(&constants, sizeof(constants));
+
+    const auto pushUpload = [&list](StreamBuffer buffer, const void* data, std::size_t bytes) {
+        RenderCommand command;
+        command.type = RenderCommand::Type::UploadBuffer;
+        command.upload = RenderCommand::Upload{
+            static_cast<std::uint32_t>(buffer),
+            list.arena.Push(data, bytes),
+            static_cast<std::uint32_t>(bytes),
+            0,
+        };
+        list.Push(command);
+    };
+    const auto pushBind = [&list](RenderCommand::Type type, std::uint32_t id) {
+        RenderCommand command;
+        command.type = type;
+        command.bind = RenderCommand::Bind{id};
+        list.Push(command);
+    };
+    const auto pushDrawArrays = [&list](std::uint32_t mode, std::size_t first, std::size_t count) {
+        RenderCommand command;
+        command.type = RenderCommand::Type::DrawArrays;
+        command.draw = RenderCommand::Draw{mode, static_cast<std::uint32_t>(first), static_cast<std::uint32_t>(count)};
+        list.Push(command);
+    };
+    const auto pushDrawInstanced = [&list](std::uint32_t indexCount, std::uint32_t indexType, std::uint32_t instanceCount, std::uint32_t baseInstance) {
+        RenderCommand command;
+        command.type = RenderCommand::Type::DrawElementsInstanced;
+        command.drawInstanced = RenderCommand::DrawInstanced{indexCount, indexType, instanceCount, baseInstance};
+        list.Push(command);
+    };
+
+    // ─── Opaque + textured passes through the sorted render queue ───
+    // Keys order by pass, shader, texture, mesh and then front-to-back; runs of the same GPU mesh
+    // collapse into one instanced draw and redundant program/VAO/texture binds are skipped.
+    constexpr std::uint32_t kShaderSolid = 0;
+    constexpr std::uint32_t kShaderTextured = 1;
+    constexpr std::uint32_t kUnitMeshKeyBase = 0xFF00U;
+    constexpr float kQueueMaxDepth = 512.0F;
+
+    m_renderQueue.Clear();
+    if (!m_solidVertices.empty())
+    {
+        m_renderQueue.Push(
+            RenderQueue::MakeKey(RenderQueue::Pass::Opaque, kShaderSolid, 0, 0, 0.0F, kQueueMaxDepth),
+            PackQueuedDraw(QueuedDraw::ImmediateSolid, 0)
+        );
+    }
+    for (std::size_t mesh = 0; mesh < kUnitMeshCount; ++mesh)
+    {
+        if (!m_solidInstances[mesh].empty())
         {
-            return;
+            m_renderQueue.Push(
+                RenderQueue::MakeKey(RenderQueue::Pass::Opaque, kShaderSolid, 0, kUnitMeshKeyBase + static_cast<std::uint32_t>(mesh), 0.0F, kQueueMaxDepth),
+                PackQueuedDraw(QueuedDraw::UnitInstances, static_cast<std::uint32_t>(mesh))
+            );
         }
-        if (requiredBytes <= *ioCapacityBytes)
+    }
+    for (std::size_t i = 0; i < m_gpuMeshDraws.size(); ++i)
+    {
+        const GpuMeshDraw& draw = m_gpuMeshDraws[i];
+        const float depth = glm::length(glm::vec3{draw.modelMatrix[3]} - m_cameraWorldPosition);
+        m_renderQueue.Push(
+            RenderQueue::MakeKey(RenderQueue::Pass::Opaque, kShaderSolid, 0, draw.meshId, depth, kQueueMaxDepth),
+            PackQueuedDraw(QueuedDraw::GpuMesh, static_cast<std::uint32_t>(i))
+        );
+    }
+    for (std::size_t i = 0; i < m_texturedBatches.size(); ++i)
+    {
+        const TexturedBatch& batch = m_texturedBatches[i];
+        if (batch.textureId == 0 || batch.vertexCount == 0)
         {
-            // Orphan the existing buffer to avoid GPU sync stalls.
-            glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(*ioCapacityBytes), nullptr, GL_STREAM_DRAW);
-            return;
+            continue;
         }
+        m_renderQueue.Push(
+            RenderQueue::MakeKey(RenderQueue::Pass::Textured, kShaderTextured, batch.textureId, 0, 0.0F, kQueueMaxDepth),
+            PackQueuedDraw(QueuedDraw::TexturedBatch, static_cast<std::uint32_t>(i))
+        );
+    }
+    m_renderQueue.Sort();
 
-        std::size_t newCapacity = std::max<std::size_t>(*ioCapacityBytes, 1024U * 1024U);
-        while (newCapacity < requiredBytes)
+    // Resolve sorted items into batches and gather every instance into one upload.
+    m_instanceUpload.clear();
+    m_queuedBatches.clear();
+    std::uint32_t mergedMeshDraws = 0;
+    std::uint32_t unitInstanceCount = 0;
+    const auto& items = m_renderQueue.Items();
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+        const QueuedDraw kind = QueuedDrawKind(items[i].payload);
+        const std::uint32_t index = QueuedDrawIndex(items[i].payload);
+        QueuedBatch batch{kind, index, 0, 0};
+        if (kind == QueuedDraw::UnitInstances)
         {
-            newCapacity *= 2U;
+            const auto& instances = m_solidInstances[index];
+            batch.instanceBase = static_cast<std::uint32_t>(m_instanceUpload.size());
+            batch.instanceCount = static_cast<std::uint32_t>(instances.size());
+            m_instanceUpload.insert(m_instanceUpload.end(), instances.begin(), instances.end());
+            unitInstanceCount += batch.instanceCount;
         }
-        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(newCapacity), nullptr, GL_STREAM_DRAW);
-        *ioCapacityBytes = newCapacity;
+        else if (kind == QueuedDraw::GpuMesh)
+        {
+            const GpuMeshId meshId = m_gpuMeshDraws[index].meshId;
+            std::size_t runEnd = i + 1;
+            while (runEnd < items.size() && QueuedDrawKind(items[runEnd].payload) == QueuedDraw::GpuMesh &&
+                   m_gpuMeshDraws[QueuedDrawIndex(items[runEnd].payload)].meshId == meshId)
+            {
+                ++runEnd;
+            }
+            const auto it = m_gpuMeshes.find(meshId);
+            if (it != m_gpuMeshes.end() && it->second.indexCount > 0)
+            {
+                batch.index = meshId;
+                batch.instanceBase = static_cast<std::uint32_t>(m_instanceUpload.size());
+                batch.instanceCount = static_cast<std::uint32_t>(runEnd - i);
+                for (std::size_t run = i; run < runEnd; ++run)
+                {
+                    const glm::mat4& model = m_gpuMeshDraws[QueuedDrawIndex(items[run].payload)].modelMatrix;
+                    SolidInstance& instance = m_instanceUpload.emplace_back();
+                    instance.modelRow0 = glm::vec4{model[0][0], model[1][0], model[2][0], model[3][0]};
+                    instance.modelRow1 = glm::vec4{model[0][1], model[1][1], model[2][1], model[3][1]};
+                    instance.modelRow2 = glm::vec4{model[0][2], model[1][2], model[2][2], model[3][2]};
+                }
+                mergedMeshDraws += batch.instanceCount - 1;
+            }
+            i = runEnd - 1;
+            if (batch.instanceCount == 0)
+            {
+                continue;
+            }
+        }
+        m_queuedBatches.push_back(batch);
+    }
+
+    // ─── Frame uniform block (built ONCE, uploaded only when it differs from the last upload) ───
+    FrameUniformBlock frameUniforms;
+    frameUniforms.cameraPosition = m_cameraWorldPosition;
+    frameUniforms.lightingEnabled = m_lightingEnabled ? 1 : 0;
+    frameUniforms.lightDirection = glm::normalize(m_environment.directionalLightDirection);
+    frameUniforms.lightColor = m_environment.directionalLightColor;
+    frameUniforms.lightIntensity = m_environment.directionalLightIntensity;
+    frameUniforms.fogEnabled = m_environment.fogEnabled ? 1 : 0;
+    frameUniforms.fogColor = m_environment.fogColor;
+    frameUniforms.fogDensity = m_environment.fogDensity;
+    frameUniforms.fogStart = m_environment.fogStart;
+    frameUniforms.fogEnd = m_environment.fogEnd;
+    frameUniforms.clusterDepthScale = LightClusters::DepthSliceScale();
+    frameUniforms.clusterDepthBias = LightClusters::DepthSliceBias();
+    frameUniforms.clusterTileScale = glm::vec2{
+        static_cast<float>(LightClusters::kClustersX) / static_cast<float>(m_framebufferWidth),
+        static_cast<float>(LightClusters::kClustersY) / static_cast<float>(m_framebufferHeight),
     };
 
-    // ─── Build light uniform arrays ONCE (shared by solid + textured) ───
-    const glm::vec3 normalizedLightDir = glm::normalize(m_environment.directionalLightDirection);
-
-    std::array<glm::vec4, static_cast<std::size_t>(kMaxPointLights)> pointPosRange{};
-    std::array<glm::vec4, static_cast<std::size_t>(kMaxPointLights)> pointColorIntensity{};
-    const int pointCount = std::min(static_cast<int>(m_pointLights.size()), kMaxPointLights);
-    for (int i = 0; i < pointCount; ++i)
+    std::uint32_t uniformUploads = 0;
+    if (!m_frameUniformsUploaded || std::memcmp(&frameUniforms, &m_uploadedFrameUniforms, sizeof(FrameUniformBlock)) != 0)
     {
-        const PointLight& light = m_pointLights[static_cast<std::size_t>(i)];
-        pointPosRange[static_cast<std::size_t>(i)] =
-            glm::vec4{light.position.x, light.position.y, light.position.z, glm::max(0.001F, light.range)};
-        pointColorIntensity[static_cast<std::size_t>(i)] =
-            glm::vec4{light.color.x, light.color.y, light.color.z, glm::max(0.0F, light.intensity)};
+        pushUpload(kStreamFrameUniforms, &frameUniforms, sizeof(FrameUniformBlock));
+        m_uploadedFrameUniforms = frameUniforms;
+        m_frameUniformsUploaded = true;
+        ++uniformUploads;
     }
 
-    std::array<glm::vec4, static_cast<std::size_t>(kMaxSpotLights)> spotPosRange{};
-    std::array<glm::vec4, static_cast<std::size_t>(kMaxSpotLights)> spotDirInnerCos{};
-    std::array<glm::vec4, static_cast<std::size_t>(kMaxSpotLights)> spotColorIntensity{};
-    std::array<float, static_cast<std::size_t>(kMaxSpotLights)> spotOuterCos{};
-    const int spotCount = std::min(static_cast<int>(m_spotLights.size()), kMaxSpotLights);
-    for (int i = 0; i < spotCount; ++i)
+    // ─── Clustered lights: records + bounding spheres, then the froxel grid on the JobSystem ───
+    m_clusterLights.clear();
+    m_clusterLightBounds.clear();
+    for (const PointLight& light : m_pointLights)
+    {
+        ClusterLightRecord record;
+        record.posRange = glm::vec4{light.position, glm::max(0.001F, light.range)};
+        record.colorIntensity = glm::vec4{light.color, glm::max(0.0F, light.intensity)};
+        record.params = glm::vec4{-1.0F, 0.0F, 0.85F, 0.45F};
+        m_clusterLights.push_back(record);
+        m_clusterLightBounds.push_back(LightClusters::LightBounds{light.position, record.posRange.w});
+    }
+    for (const SpotLight& light : m_spotLights)
     {
-        const SpotLight& light = m_spotLights[static_cast<std::size_t>(i)];
         const glm::vec3 dir = glm::length(light.direction) > 1.0e-6F ? glm::normalize(light.direction) : glm::vec3{0.0F, -1.0F, 0.0F};
-        spotPosRange[static_cast<std::size_t>(i)] =
-            glm::vec4{light.position.x, light.position.y, light.position.z, glm::max(0.001F, light.range)};
-        spotDirInnerCos[static_cast<std::size_t>(i)] =
-            glm::vec4{dir.x, dir.y, dir.z, glm::clamp(light.innerCos, -1.0F, 1.0F)};
-        spotColorIntensity[static_cast<std::size_t>(i)] =
-            glm::vec4{light.color.x, light.color.y, light.color.z, glm::max(0.0F, light.intensity)};
-        spotOuterCos[static_cast<std::size_t>(i)] = glm::clamp(light.outerCos, -1.0F, 1.0F);
-    }
-
-    // Lambda to upload shared light uniforms to any program.
-    const auto uploadLightUniforms = [&](
-        int lightDirLoc, int lightColorLoc, int lightIntensityLoc,
-        int cameraPosLoc, int lightingEnabledLoc,
-        int fogEnabledLoc, int fogColorLoc, int fogDensityLoc, int fogStartLoc, int fogEndLoc,
-        int pointCountLoc, int pointPosRangeLoc, int pointColorIntensityLoc,
-        int spotCountLoc, int spotPosRangeLoc, int spotDirInnerCosLoc, int spotColorIntensityLoc, int spotOuterCosLoc)
-    {
-        glUniform3fv(cameraPosLoc, 1, glm::value_ptr(m_cameraWorldPosition));
-        glUniform1i(lightingEnabledLoc, m_lightingEnabled ? 1 : 0);
-        glUniform3fv(lightDirLoc, 1, glm::value_ptr(normalizedLightDir));
-        glUniform3fv(lightColorLoc, 1, glm::value_ptr(m_environment.directionalLightColor));
-        glUniform1f(lightIntensityLoc, m_environment.directionalLightIntensity);
-        glUniform1i(fogEnabledLoc, m_environment.fogEnabled ? 1 : 0);
-        glUniform3fv(fogColorLoc, 1, glm::value_ptr(m_environment.fogColor));
-        glUniform1f(fogDensityLoc, m_environment.fogDensity);
-        glUniform1f(fogStartLoc, m_environment.fogStart);
-        glUniform1f(fogEndLoc, m_environment.fogEnd);
-        glUniform1i(pointCountLoc, pointCount);
-        glUniform4fv(pointPosRangeLoc, kMaxPointLights, glm::value_ptr(pointPosRange[0]));
-        glUniform4fv(pointColorIntensityLoc, kMaxPointLights, glm::value_ptr(pointColorIntensity[0]));
-        glUniform1i(spotCountLoc, spotCount);
-        glUniform4fv(spotPosRangeLoc, kMaxSpotLights, glm::value_ptr(spotPosRange[0]));
-        glUniform4fv(spotDirInnerCosLoc, kMaxSpotLights, glm::value_ptr(spotDirInnerCos[0]));
-        glUniform4fv(spotColorIntensityLoc, kMaxSpotLights, glm::value_ptr(spotColorIntensity[0]));
-        glUniform1fv(spotOuterCosLoc, kMaxSpotLights, spotOuterCos.data());
-    };
+        ClusterLightRecord record;
+        record.posRange = glm::vec4{light.position, glm::max(0.001F, light.range)};
+        record.colorIntensity = glm::vec4{light.color, glm::max(0.0F, light.intensity)};
+        record.dirInnerCos = glm::vec4{dir, glm::clamp(light.innerCos, -1.0F, 1.0F)};
+        record.params = glm::vec4{glm::clamp(light.outerCos, -1.0F, 1.0F), 1.0F, 0.95F, 0.5F};
+        m_clusterLights.push_back(record);
+        m_clusterLightBounds.push_back(LightClusters::SpotLightBounds(light.position, dir, record.posRange.w, record.params.x));
+    }
 
-    // ─── Solid pass ───
-    if (!m_solidVertices.empty())
+    const bool lightsChanged = !m_clusterLightsUploaded ||
+                               m_clusterLights.size() != m_uploadedClusterLights.size() ||
+                               (!m_clusterLights.empty() &&
+                                std::memcmp(m_clusterLights.data(), m_uploadedClusterLights.data(), m_clusterLights.size() * sizeof(ClusterLightRecord)) != 0);
+    if (lightsChanged && !m_clusterLights.empty())
     {
-        glUseProgram(m_solidProgram);
-        glUniformMatrix4fv(m_solidViewProjLocation, 1, GL_FALSE, glm::value_ptr(viewProjection));
-        const glm::mat4 identity{1.0F};
-        glUniformMatrix4fv(m_solidModelLocation, 1, GL_FALSE, glm::value_ptr(identity));
-        uploadLightUniforms(
-            m_solidLightDirLocation, m_solidLightColorLocation, m_solidLightIntensityLocation,
-            m_solidCameraPosLocation, m_solidLightingEnabledLocation,
-            m_solidFogEnabledLocation, m_solidFogColorLocation, m_solidFogDensityLocation,
-            m_solidFogStartLocation, m_solidFogEndLocation,
-            m_solidPointLightCountLocation, m_solidPointLightPosRangeLocation, m_solidPointLightColorIntensityLocation,
-            m_solidSpotLightCountLocation, m_solidSpotLightPosRangeLocation, m_solidSpotLightDirInnerCosLocation,
-            m_solidSpotLightColorIntensityLocation, m_solidSpotLightOuterCosLocation
-        );
+        pushUpload(kStreamClusterLights, m_clusterLights.data(), m_clusterLights.size() * sizeof(ClusterLightRecord));
+        ++uniformUploads;
+    }
+    if (lightsChanged)
+    {
+        m_uploadedClusterLights = m_clusterLights;
+        m_clusterLightsUploaded = true;
+    }
 
-        glBindVertexArray(m_solidVao);
-        glBindBuffer(GL_ARRAY_BUFFER, m_solidVbo);
-        const std::size_t solidBytes = m_solidVertices.size() * sizeof(SolidVertex);
-        ensureBufferCapacity(&m_solidVboCapacityBytes, solidBytes);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(solidBytes), m_solidVertices.data());
-
-        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(m_solidVertices.size()));
-        profiler.RecordDrawCall(static_cast<std::uint32_t>(m_solidVertices.size()), static_cast<std::uint32_t>(m_solidVertices.size() / 3));
-        profiler.StatsMut().solidVboBytes = solidBytes;
-    }
-
-    // ─── GPU-cached mesh pass (uses same solid shader with per-draw model matrix) ───
-    if (!m_gpuMeshDraws.empty())
-    {
-        // Ensure solid shader is bound with correct shared uniforms.
-        const bool solidWasActive = !m_solidVertices.empty(); // shader already set up
-        if (!solidWasActive)
-        {
-            glUseProgram(m_solidProgram);
-            glUniformMatrix4fv(m_solidViewProjLocation, 1, GL_FALSE, glm::value_ptr(viewProjection));
-            uploadLightUniforms(
-                m_solidLightDirLocation, m_solidLightColorLocation, m_solidLightIntensityLocation,
-                m_solidCameraPosLocation, m_solidLightingEnabledLocation,
-                m_solidFogEnabledLocation, m_solidFogColorLocation, m_solidFogDensityLocation,
-                m_solidFogStartLocation, m_solidFogEndLocation,
-                m_solidPointLightCountLocation, m_solidPointLightPosRangeLocation, m_solidPointLightColorIntensityLocation,
-                m_solidSpotLightCountLocation, m_solidSpotLightPosRangeLocation, m_solidSpotLightDirInnerCosLocation,
-                m_solidSpotLightColorIntensityLocation, m_solidSpotLightOuterCosLocation
-            );
-        }
+    const bool viewChanged = viewProjection != m_clusteredViewProjection || frameUniforms.clusterTileScale != m_clusteredTileScale;
+    if (lightsChanged || viewChanged)
+    {
+        m_lightClusters.Build(viewProjection, m_clusterLightBounds);
+        m_clusteredViewProjection = viewProjection;
+        m_clusteredTileScale = frameUniforms.clusterTileScale;
 
-        for (const GpuMeshDraw& draw : m_gpuMeshDraws)
+        const auto& clusters = m_lightClusters.Clusters();
+        pushUpload(kStreamClusterGrid, clusters.data(), clusters.size() * sizeof(LightClusters::Cluster));
+        const auto& indices = m_lightClusters.LightIndices();
+        if (!indices.empty())
         {
-            const auto it = m_gpuMeshes.find(draw.meshId);
-            if (it == m_gpuMeshes.end() || it->second.vertexCount == 0)
-            {
-                continue;
-            }
-            glUniformMatrix4fv(m_solidModelLocation, 1, GL_FALSE, glm::value_ptr(draw.modelMatrix));
-            glBindVertexArray(it->second.vao);
-            glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(it->second.vertexCount));
-            profiler.RecordDrawCall(it->second.vertexCount, it->second.vertexCount / 3);
-        }
-
-        // Reset model matrix back to identity for subsequent passes.
-        const glm::mat4 identity{1.0F};
-        glUniformMatrix4fv(m_solidModelLocation, 1, GL_FALSE, glm::value_ptr(identity));
-    }
-
-    // ─── Textured pass ───
-    if (!m_texturedVertices.empty() && !m_texturedBatches.empty())
-    {
-        glUseProgram(m_texturedProgram);
-        glUniformMatrix4fv(m_texturedViewProjLocation, 1, GL_FALSE, glm::value_ptr(viewProjection));
-        uploadLightUniforms(
-            m_texturedLightDirLocation, m_texturedLightColorLocation, m_texturedLightIntensityLocation,
-            m_texturedCameraPosLocation, m_texturedLightingEnabledLocation,
-            m_texturedFogEnabledLocation, m_texturedFogColorLocation, m_texturedFogDensityLocation,
-            m_texturedFogStartLocation, m_texturedFogEndLocation,
-            m_texturedPointLightCountLocation, m_texturedPointLightPosRangeLocation, m_texturedPointLightColorIntensityLocation,
-            m_texturedSpotLightCountLocation, m_texturedSpotLightPosRangeLocation, m_texturedSpotLightDirInnerCosLocation,
-            m_texturedSpotLightColorIntensityLocation, m_texturedSpotLightOuterCosLocation
-        );
+            pushUpload(kStreamClusterIndices, indices.data(), indices.size() * sizeof(std::uint32_t));
+        }
+    }
 
-        glBindVertexArray(m_texturedVao);
-        glBindBuffer(GL_ARRAY_BUFFER, m_texturedVbo);
+    // Stream uploads first: vertex/instance data is copied into the arena, so the CPU-side vectors
+    // can be cleared by the next BeginFrame while the list is still executing.
+    auto& frameStats = profiler.StatsMut();
+    frameStats.uniformBlockUploads = uniformUploads;
+    const LightClusters::Stats& clusterStats = m_lightClusters.GetStats();
+    frameStats.lightClusterLights = clusterStats.lightsVisible;
+    frameStats.lightClusterIndices = clusterStats.indices;
+    frameStats.lightClusterMaxPerCluster = clusterStats.maxLightsInCluster;
+    frameStats.lightClusterOverflow = clusterStats.overflowClusters;
+    frameStats.lightClusterBuildMs = (lightsChanged || viewChanged) ? clusterStats.buildMs : 0.0F;
+    const std::size_t instanceBytes = m_instanceUpload.size() * sizeof(SolidInstance);
+    if (instanceBytes > 0)
+    {
+        pushUpload(kStreamInstance, m_instanceUpload.data(), instanceBytes);
+    }
+    if (!m_solidVertices.empty())
+    {
+        const std::size_t solidBytes = m_solidVertices.size() * sizeof(SolidVertex);
+        pushUpload(kStreamSolid, m_solidVertices.data(), solidBytes);
+        frameStats.solidVboBytes = solidBytes;
+    }
+    if (!m_texturedBatches.empty() && !m_texturedVertices.empty())
+    {
         const std::size_t texturedBytes = m_texturedVertices.size() * sizeof(TexturedVertex);
-        ensureBufferCapacity(&m_texturedVboCapacityBytes, texturedBytes);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(texturedBytes), m_texturedVertices.data());
+        pushUpload(kStreamTextured, m_texturedVertices.data(), texturedBytes);
+        frameStats.texturedVboBytes = texturedBytes;
+    }
+
+    std::uint32_t boundProgram = ~0U;
+    unsigned int boundVao = 0;
+    unsigned int boundTexture = 0;
+    std::uint32_t instancedMode = 0;
+    bool compactBound = false;
+    std::uint32_t stateChanges = 0;
+
+    const auto useProgram = [&](std::uint32_t program) {
+        if (boundProgram != program)
+        {
+            boundProgram = program;
+            ++stateChanges;
+            pushBind(RenderCommand::Type::BindProgram, program);
+        }
+    };
+    const auto bindVao = [&](unsigned int vao) {
+        if (boundVao != vao)
+        {
+            boundVao = vao;
+            ++stateChanges;
+            pushBind(RenderCommand::Type::BindVertexArray, vao);
+        }
+    };
+    const auto setInstancedMode = [&](std::uint32_t mode) {
+        if (instancedMode != mode)
+        {
+            instancedMode = mode;
+            ++stateChanges;
+            pushBind(RenderCommand::Type::SetInstancedMode, mode);
+        }
+    };
+    const auto setVertexDecode = [&](const GpuMeshInfo* info) {
+        const bool compact = info != nullptr && info->compact;
+        if (!compact && !compactBound)
+        {
+            return;
+        }
+        ++stateChanges;
+        const glm::vec3 scale = compact ? info->positionScale : glm::vec3{1.0F};
+        const glm::vec3 offset = compact ? info->positionOffset : glm::vec3{0.0F};
+        RenderCommand command;
+        command.type = RenderCommand::Type::SetVertexDecode;
+        command.decode = RenderCommand::VertexDecode{{scale.x, scale.y, scale.z}, {offset.x, offset.y, offset.z}, compact ? 1U : 0U};
+        list.Push(command);
+        compactBound = compact;
+    };
 
-        glActiveTexture(GL_TEXTURE0);
-        glUniform1i(m_texturedAlbedoSamplerLocation, 0);
-        for (const TexturedBatch& batch : m_texturedBatches)
+    // Caller-owned multi-draws (static batch) go first, after the uniform and light uploads above.
+    for (const SolidRangeDraw& draw : m_solidRangeDraws)
+    {
+        useProgram(kProgramSolid);
+        setInstancedMode(0);
+        setVertexDecode(nullptr);
+        bindVao(draw.vao);
+        RenderCommand command;
+        command.type = RenderCommand::Type::MultiDrawArrays;
+        command.multiDraw = RenderCommand::MultiDraw{
+            GL_TRIANGLES,
+            list.arena.Push(m_solidRangeFirsts.data() + draw.firstRange, draw.rangeCount * sizeof(int)),
+            list.arena.Push(m_solidRangeCounts.data() + draw.firstRange, draw.rangeCount * sizeof(int)),
+            static_cast<std::uint32_t>(draw.rangeCount),
+        };
+        list.Push(command);
+    }
+
+    for (const QueuedBatch& batch : m_queuedBatches)
+    {
+        switch (batch.kind)
         {
-            if (batch.textureId == 0 || batch.vertexCount == 0)
+            case QueuedDraw::ImmediateSolid:
             {
-                continue;
+                useProgram(kProgramSolid);
+                setInstancedMode(0);
+                setVertexDecode(nullptr);
+                bindVao(m_solidVao);
+                pushDrawArrays(GL_TRIANGLES, 0, m_solidVertices.size());
+                profiler.RecordDrawCall(static_cast<std::uint32_t>(m_solidVertices.size()), static_cast<std::uint32_t>(m_solidVertices.size() / 3));
+                break;
+            }
+            case QueuedDraw::UnitInstances:
+            {
+                const UnitMesh& unit = m_unitMeshes[batch.index];
+                if (unit.indexCount == 0)
+                {
+                    break;
+                }
+                useProgram(kProgramSolid);
+                setInstancedMode(1);
+                setVertexDecode(nullptr);
+                bindVao(unit.vao);
+                pushDrawInstanced(unit.indexCount, GL_UNSIGNED_SHORT, batch.instanceCount, batch.instanceBase);
+                profiler.RecordDrawCall(unit.vertexCount * batch.instanceCount, unit.indexCount / 3 * batch.instanceCount);
+                break;
+            }
+            case QueuedDraw::GpuMesh:
+            {
+                const GpuMeshInfo& info = m_gpuMeshes.at(batch.index);
+                useProgram(kProgramSolid);
+                setInstancedMode(2);
+                setVertexDecode(&info);
+                bindVao(info.vao);
+                pushDrawInstanced(info.indexCount, info.indexType, batch.instanceCount, batch.instanceBase);
+                profiler.RecordDrawCall(info.vertexCount * batch.instanceCount, info.indexCount / 3 * batch.instanceCount);
+                break;
+            }
+            case QueuedDraw::TexturedBatch:
+            {
+                const TexturedBatch& textured = m_texturedBatches[batch.index];
+                useProgram(kProgramTextured);
+                bindVao(m_texturedVao);
+                if (boundTexture != textured.textureId)
+                {
+                    boundTexture = textured.textureId;
+                    ++stateChanges;
+                    pushBind(RenderCommand::Type::BindTexture, textured.textureId);
+                }
+                pushDrawArrays(GL_TRIANGLES, textured.firstVertex, textured.vertexCount);
+                profiler.RecordDrawCall(static_cast<std::uint32_t>(textured.vertexCount), static_cast<std::uint32_t>(textured.vertexCount / 3));
+                break;
             }
-            glBindTexture(GL_TEXTURE_2D, batch.textureId);
-            glDrawArrays(GL_TRIANGLES, static_cast<GLint>(batch.firstVertex), static_cast<GLsizei>(batch.vertexCount));
-            profiler.RecordDrawCall(static_cast<std::uint32_t>(batch.vertexCount), static_cast<std::uint32_t>(batch.vertexCount / 3));
         }
-        glBindTexture(GL_TEXTURE_2D, 0);
-        profiler.StatsMut().texturedVboBytes = texturedBytes;
     }
 
+    // Leave the solid program in its default (non-instanced, float vertex) state for other users.
+    if (instancedMode != 0 || compactBound)
+    {
+        useProgram(kProgramSolid);
+        setInstancedMode(0);
+        setVertexDecode(nullptr);
+    }
+    if (boundTexture != 0)
+    {
+        pushBind(RenderCommand::Type::BindTexture, 0);
+    }
+
+    frameStats.solidInstances = unitInstanceCount;
+    frameStats.instanceVboBytes = instanceBytes;
+    frameStats.gpuMeshBytes = m_gpuMeshBytes;
+    frameStats.gpuMeshUnweldedBytes = m_gpuMeshUnweldedBytes;
+    frameStats.renderQueueItems = static_cast<std::uint32_t>(m_renderQueue.Size());
+    frameStats.renderStateChanges = stateChanges;
+    frameStats.instancedDrawsMerged = mergedMeshDraws;
+
     // ─── Line pass (combined: lines + overlay lines in single buffer) ───
     const bool hasLines = !m_lineVertices.empty();
     const bool hasOverlay = !m_overlayLineVertices.empty();
     if (hasLines || hasOverlay)
     {
-        glUseProgram(m_lineProgram);
-        glUniformMatrix4fv(m_lineViewProjLocation, 1, GL_FALSE, glm::value_ptr(viewProjection));
-        glBindVertexArray(m_lineVao);
-        glBindBuffer(GL_ARRAY_BUFFER, m_lineVbo);
-
         const std::size_t lineBytes = m_lineVertices.size() * sizeof(LineVertex);
         const std::size_t overlayBytes = m_overlayLineVertices.size() * sizeof(LineVertex);
-        const std::size_t totalBytes = lineBytes + overlayBytes;
 
-        // Single orphan + upload for both line arrays.
-        ensureBufferCapacity(&m_lineVboCapacityBytes, totalBytes);
+        // Single orphan + upload for both line arrays: they are laid out back to back in the arena.
+        RenderCommand upload;
+        upload.type = RenderCommand::Type::UploadBuffer;
+        upload.upload = RenderCommand::Upload{
+            kStreamLine,
+            list.arena.Allocate(lineBytes + overlayBytes),
+            static_cast<std::uint32_t>(lineBytes + overlayBytes),
+            0,
+        };
+        auto* lineData = static_cast<std::byte*>(list.arena.At(upload.upload.arenaOffset));
         if (hasLines)
         {
-            glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(lineBytes), m_lineVertices.data());
+            std::memcpy(lineData, m_lineVertices.data(), lineBytes);
         }
         if (hasOverlay)
         {
-            glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(lineBytes), static_cast<GLsizeiptr>(overlayBytes), m_overlayLineVertices.data());
+            std::memcpy(lineData + lineBytes, m_overlayLineVertices.data(), overlayBytes);
         }
+        list.Push(upload);
 
+        pushBind(RenderCommand::Type::BindProgram, kProgramLine);
+        pushBind(RenderCommand::Type::BindVertexArray, m_lineVao);
         if (hasLines)
         {
-            glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(m_lineVertices.size()));
+            pushDrawArrays(GL_LINES, 0, m_lineVertices.size());
             profiler.RecordDrawCall(static_cast<std::uint32_t>(m_lineVertices.size()), 0);
-            profiler.StatsMut().lineVboBytes = lineBytes;
+            frameStats.lineVboBytes = lineBytes;
         }
         if (hasOverlay)
         {
-            glDisable(GL_DEPTH_TEST);
-            glDrawArrays(GL_LINES, static_cast<GLint>(m_lineVertices.size()), static_cast<GLsizei>(m_overlayLineVertices.size()));
+            pushBind(RenderCommand::Type::SetDepthTest, 0);
+            pushDrawArrays(GL_LINES, m_lineVertices.size(), m_overlayLineVertices.size());
             profiler.RecordDrawCall(static_cast<std::uint32_t>(m_overlayLineVertices.size()), 0);
-            glEnable(GL_DEPTH_TEST);
+            pushBind(RenderCommand::Type::SetDepthTest, 1);
         }
     }
 
-    // No glBindBuffer(0)/glBindVertexArray(0)/glUseProgram(0) cleanup needed —
-    // next frame's BeginFrame/EndFrame will set fresh state.
+    // ─── Caller passes (e.g. the wraith cloak) read the finished backbuffer, so they go last ───
+    for (const PendingPass& pass : m_pendingPasses)
+    {
+        RenderCommand command;
+        command.type = RenderCommand::Type::InvokePass;
+        command.invoke = RenderCommand::Invoke{
+            pass.fn,
+            pass.user,
+            list.arena.Push(m_passPayloads.data() + pass.payloadOffset, pass.payloadBytes),
+        };
+        list.Push(command);
+    }
 
     m_lastFrameSolidCount = m_solidVertices.size();
+
+    RenderThread::Instance().Submit(list, &Renderer::ExecuteCommandListThunk, this);
+}
+
+void Renderer::ExecuteCommandListThunk(void* user, const RenderCommandList& list)
+{
+    static_cast<Renderer*>(user)->ExecuteCommandList(list);
+}
+
+void Renderer::ExecuteCommandList(const RenderCommandList& list)
+{
+    const auto& constants = *static_cast<const FrameConstants*>(list.arena.At(list.constantsOffset));
+
+    const auto ensureBufferCapacity = [](GLenum target, std::size_t* ioCapacityBytes, std::size_t requiredBytes) {
+        if (ioCapacityBytes == nullptr || requiredBytes == 0U)
+        {
+            return;
+        }
+        if (requiredBytes <= *ioCapacityBytes)
+        {
+            // Orphan the existing buffer to avoid GPU sync stalls.
+            glBufferData(target, static_cast<GLsizeiptr>(*ioCapacityBytes), nullptr, GL_STREAM_DRAW);
+            return;
+        }
+
+        std::size_t newCapacity = std::max<std::size_t>(*ioCapacityBytes, 1024U * 1024U);
+        while (newCapacity < requiredBytes)
+        {
+            newCapacity *= 2U;
+        }
+        glBufferData(target, static_cast<GLsizeiptr>(newCapacity), nullptr, GL_STREAM_DRAW);
+        *ioCapacityBytes = newCapacity;
+    };
+
+    for (const RenderCommand& command : list.commands)
+    {
+        switch (command.type)
+        {
+            case RenderCommand::Type::UploadBuffer:
+            {
+                const RenderCommand::Upload& upload = command.upload;
+                if (upload.buffer == kStreamFrameUniforms)
+                {
+                    // Fixed-size block: overwrite in place, no orphaning or growth.
+                    glBindBuffer(GL_UNIFORM_BUFFER, m_frameUniformBuffer);
+                    glBufferSubData(GL_UNIFORM_BUFFER, 0, static_cast<GLsizeiptr>(upload.bytes), list.arena.At(upload.arenaOffset));
+                    break;
+                }
+                unsigned int buffer = m_solidVbo;
+                std::size_t* capacity = &m_solidVboCapacityBytes;
+                GLenum target = GL_ARRAY_BUFFER;
+                switch (upload.buffer)
+                {
+                    case kStreamTextured:
+                        buffer = m_texturedVbo;
+                        capacity = &m_texturedVboCapacityBytes;
+                        break;
+                    case kStreamLine:
+                        buffer = m_lineVbo;
+                        capacity = &m_lineVboCapacityBytes;
+                        break;
+                    case kStreamInstance:
+                        buffer = m_instanceVbo;
+                        capacity = &m_instanceVboCapacityBytes;
+                        break;
+                    case kStreamClusterLights:
+                        buffer = m_clusterLightBuffer;
+                        capacity = &m_clusterLightBufferCapacityBytes;
+                        target = GL_SHADER_STORAGE_BUFFER;
+                        break;
+                    case kStreamClusterGrid:
+                        buffer = m_clusterGridBuffer;
+                        capacity = &m_clusterGridBufferCapacityBytes;
+                        target = GL_SHADER_STORAGE_BUFFER;
+                        break;
+                    case kStreamClusterIndices:
+                        buffer = m_clusterIndexBuffer;
+                        capacity = &m_clusterIndexBufferCapacityBytes;
+                        target = GL_SHADER_STORAGE_BUFFER;
+                        break;
+                    default: break;
+                }
+                glBindBuffer(target, buffer);
+                if (upload.destinationOffset == 0)
+                {
+                    ensureBufferCapacity(target, capacity, upload.bytes);
+                }
+                glBufferSubData(
+                    target,
+                    static_cast<GLintptr>(upload.destinationOffset),
+                    static_cast<GLsizeiptr>(upload.bytes),
+                    list.arena.At(upload.arenaOffset)
+                );
+                break;
+            }
+            case RenderCommand::Type::BindProgram:
+            {
+                if (command.bind.id == kProgramSolid)
+                {
+                    glUseProgram(m_solidProgram);
+                    glUniformMatrix4fv(m_solidViewProjLocation, 1, GL_FALSE, glm::value_ptr(constants.viewProjection));
+                    const glm::mat4 identity{1.0F};
+                    glUniformMatrix4fv(m_solidModelLocation, 1, GL_FALSE, glm::value_ptr(identity));
+                }
+                else if (command.bind.id == kProgramTextured)
+                {
+                    glUseProgram(m_texturedProgram);
+                    glUniformMatrix4fv(m_texturedViewProjLocation, 1, GL_FALSE, glm::value_ptr(constants.viewProjection));
+                    glActiveTexture(GL_TEXTURE0);
+                    glUniform1i(m_texturedAlbedoSamplerLocation, 0);
+                }
+                else
+                {
+                    glUseProgram(m_lineProgram);
+                    glUniformMatrix4fv(m_lineViewProjLocation, 1, GL_FALSE, glm::value_ptr(constants.viewProjection));
+                }
+                break;
+            }
+            case RenderCommand::Type::BindVertexArray:
+                glBindVertexArray(command.bind.id);
+                break;
+            case RenderCommand::Type::BindTexture:
+                glBindTexture(GL_TEXTURE_2D, command.bind.id);
+                break;
+            case RenderCommand::Type::SetInstancedMode:
+                glUniform1i(m_solidInstancedLocation, static_cast<GLint>(command.bind.id));
+                break;
+            case RenderCommand::Type::SetVertexDecode:
+                glUniform3fv(m_solidPositionScaleLocation, 1, command.decode.scale);
+                glUniform3fv(m_solidPositionOffsetLocation, 1, command.decode.offset);
+                glUniform1i(m_solidOctNormalsLocation, static_cast<GLint>(command.decode.octNormals));
+                break;
+            case RenderCommand::Type::SetDepthTest:
+                if (command.bind.id != 0)
+                {
+                    glEnable(GL_DEPTH_TEST);
+                }
+                else
+                {
+                    glDisable(GL_DEPTH_TEST);
+                }
+                break;
+            case RenderCommand::Type::DrawArrays:
+                glDrawArrays(command.draw.mode, static_cast<GLint>(command.draw.first), static_cast<GLsizei>(command.draw.count));
+                break;
+            case RenderCommand::Type::DrawElementsInstanced:
+                glDrawElementsInstancedBaseInstance(
+                    GL_TRIANGLES,
+                    static_cast<GLsizei>(command.drawInstanced.indexCount),
+                    command.drawInstanced.indexType,
+                    nullptr,
+                    static_cast<GLsizei>(command.drawInstanced.instanceCount),
+                    command.drawInstanced.baseInstance
+                );
+                break;
+            case RenderCommand::Type::InvokePass:
+                command.invoke.fn(command.invoke.user, list.arena.At(command.invoke.payloadOffset));
+                break;
+            case RenderCommand::Type::MultiDrawArrays:
+                glMultiDrawArrays(
+                    command.multiDraw.mode,
+                    static_cast<const GLint*>(list.arena.At(command.multiDraw.firstsOffset)),
+                    static_cast<const GLsizei*>(list.arena.At(command.multiDraw.countsOffset)),
+                    static_cast<GLsizei>(command.multiDraw.drawCount)
+                );
+                break;
+        }
+    }
+
+    // No glBindBuffer(0)/glBindVertexArray(0)/glUseProgram(0) cleanup needed —
+    // next frame's BeginFrame/EndFrame will set fresh state.
 }
 
 void Renderer::DrawLine(const glm::vec3& from, const glm::vec3& to, const glm::vec3& color)
@@ -919,7 +1417,7 @@ void Renderer::DrawBox(
     }
     else
     {
-        AddSolidBox(center, halfExtents, color, material);
+        PushSolidInstance(kUnitBoxMesh, glm::mat3{1.0F}, halfExtents, center, color, 0.0F, material);
     }
 }
 
@@ -937,7 +1435,7 @@ void Renderer::DrawOrientedBox(
     }
     else
     {
-        AddSolidOrientedBox(center, halfExtents, rotationEulerDegrees, color, material);
+        PushSolidInstance(kUnitBoxMesh, RotationMatrixFromEulerDegrees(rotationEulerDegrees), halfExtents, center, color, 0.0F, material);
     }
 }
 
@@ -955,26 +1453,27 @@ void Renderer::DrawCapsule(
     }
     else
     {
-        // Distance-based LOD for capsule tessellation.
+        if (radius <= 1.0e-6F)
+        {
+            return;
+        }
+        // Distance-based LOD: pick one of the cached unit capsule tessellations.
         const float distSq = glm::dot(center - m_cameraWorldPosition, center - m_cameraWorldPosition);
-        int segments = 16;
-        int hemiRings = 6;
+        std::size_t lod = 0;
         if (distSq > 900.0F)       // > 30m
         {
-            segments = 6;
-            hemiRings = 2;
+            lod = 3;
         }
         else if (distSq > 225.0F)  // > 15m
         {
-            segments = 8;
-            hemiRings = 3;
+            lod = 2;
         }
         else if (distSq > 64.0F)   // > 8m
         {
-            segments = 12;
-            hemiRings = 4;
+            lod = 1;
         }
-        AddSolidCapsule(center, height, radius, color, material, segments, hemiRings);
+        const float halfCylinder = std::max(0.0F, height * 0.5F - radius);
+        PushSolidInstance(kUnitCapsuleMesh + lod, glm::mat3{1.0F}, glm::vec3{radius}, center, color, halfCylinder / radius, material);
     }
 }
 
@@ -1191,10 +1690,13 @@ void Renderer::DrawGrid(int halfSize, float step, const glm::vec3& majorColor, c
     
     if (m_renderMode == RenderMode::Filled && filledColor.a > 0.0F)
     {
-        AddSolidBox(
-            glm::vec3{0.0F, -0.01F, 0.0F},
+        PushSolidInstance(
+            kUnitBoxMesh,
+            glm::mat3{1.0F},
             glm::vec3{range, 0.005F, range},
+            glm::vec3{0.0F, -0.01F, 0.0F},
             glm::vec3{filledColor.r, filledColor.g, filledColor.b},
+            0.0F,
             MaterialParams{}
         );
     }
@@ -1300,8 +1802,14 @@ void Renderer::DrawBillboards(
 
 // ─── GPU Mesh Cache ─────────────────────────────────────────────────────────
 
-Renderer::GpuMeshId Renderer::UploadMesh(const MeshGeometry& mesh, const glm::vec3& color, const MaterialParams& material)
+Renderer::GpuMeshId Renderer::UploadMesh(
+    const MeshGeometry& mesh,
+    const glm::vec3& color,
+    const MaterialParams& material,
+    GpuVertexFormat format
+)
 {
+    RenderThread::Instance().AcquireContext();
     if (mesh.positions.empty())
     {
         return kInvalidGpuMesh;
@@ -1315,7 +1823,36 @@ Renderer::GpuMeshId Renderer::UploadMesh(const MeshGeometry& mesh, const glm::ve
         material.unlit ? 1.0F : 0.0F,
     };
 
+    // Weld identical corners: key on the exact bytes of the baked vertex.
+    struct VertexKeyHash
+    {
+        std::size_t operator()(const std::array<std::uint32_t, 9>& key) const
+        {
+            std::size_t hash = 1469598103934665603ULL;
+            for (const std::uint32_t word : key)
+            {
+                hash = (hash ^ word) * 1099511628211ULL;
+            }
+            return hash;
+        }
+    };
+    std::unordered_map<std::array<std::uint32_t, 9>, std::uint32_t, VertexKeyHash> welded;
     std::vector<SolidVertex> vertices;
+    std::vector<std::uint32_t> indices;
+
+    auto emitCorner = [&](const glm::vec3& position, const glm::vec3& normal, const glm::vec3& cornerColor) {
+        std::array<std::uint32_t, 9> key{};
+        const float values[9] = {
+            position.x, position.y, position.z, normal.x, normal.y, normal.z, cornerColor.r, cornerColor.g, cornerColor.b
+        };
+        std::memcpy(key.data(), values, sizeof(values));
+        const auto [it, inserted] = welded.try_emplace(key, static_cast<std::uint32_t>(vertices.size()));
+        if (inserted)
+        {
+            vertices.push_back(SolidVertex{position, normal, cornerColor, packedMaterial});
+        }
+        indices.push_back(it->second);
+    };
 
     auto emitTri = [&](std::uint32_t ia, std::uint32_t ib, std::uint32_t ic) {
         if (ia >= mesh.positions.size() || ib >= mesh.positions.size() || ic >= mesh.positions.size())
@@ -1342,14 +1879,15 @@ Renderer::GpuMeshId Renderer::UploadMesh(const MeshGeometry& mesh, const glm::ve
         const glm::vec3 cB = glm::clamp(ib < mesh.colors.size() ? color * mesh.colors[ib] : color, glm::vec3{0.0F}, glm::vec3{1.0F});
         const glm::vec3 cC = glm::clamp(ic < mesh.colors.size() ? color * mesh.colors[ic] : color, glm::vec3{0.0F}, glm::vec3{1.0F});
 
-        vertices.push_back(SolidVertex{a, nA, cA, packedMaterial});
-        vertices.push_back(SolidVertex{b, nB, cB, packedMaterial});
-        vertices.push_back(SolidVertex{c, nC, cC, packedMaterial});
+        emitCorner(a, nA, cA);
+        emitCorner(b, nB, cB);
+        emitCorner(c, nC, cC);
     };
 
     if (!mesh.indices.empty())
     {
-        vertices.reserve(mesh.indices.size());
+        indices.reserve(mesh.indices.size());
+        welded.reserve(mesh.positions.size());
         for (std::size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
         {
             emitTri(mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2]);
@@ -1357,42 +1895,156 @@ Renderer::GpuMeshId Renderer::UploadMesh(const MeshGeometry& mesh, const glm::ve
     }
     else
     {
-        vertices.reserve(mesh.positions.size());
+        indices.reserve(mesh.positions.size());
+        welded.reserve(mesh.positions.size());
         for (std::uint32_t i = 0; i + 2 < static_cast<std::uint32_t>(mesh.positions.size()); i += 3)
         {
             emitTri(i, i + 1, i + 2);
         }
     }
 
-    if (vertices.empty())
+    if (indices.empty())
     {
         return kInvalidGpuMesh;
     }
 
-    unsigned int vao = 0;
-    unsigned int vbo = 0;
-    glGenVertexArrays(1, &vao);
-    glGenBuffers(1, &vbo);
+    GpuMeshInfo info;
+    info.vertexCount = static_cast<std::uint32_t>(vertices.size());
+    info.indexCount = static_cast<std::uint32_t>(indices.size());
+    info.compact = format == GpuVertexFormat::Compact;
+    info.unweldedBytes = indices.size() * sizeof(SolidVertex);
 
-    glBindVertexArray(vao);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertices.size() * sizeof(SolidVertex)), vertices.data(), GL_STATIC_DRAW);
+    glGenVertexArrays(1, &info.vao);
+    glGenBuffers(1, &info.vbo);
+    glGenBuffers(1, &info.ebo);
 
-    constexpr GLsizei stride = sizeof(SolidVertex);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(SolidVertex, position)));
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(SolidVertex, normal)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(SolidVertex, color)));
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(SolidVertex, material)));
-    glEnableVertexAttribArray(3);
+    glBindVertexArray(info.vao);
+    glBindBuffer(GL_ARRAY_BUFFER, info.vbo);
+
+    if (info.compact)
+    {
+        struct CompactVertex
+        {
+            std::uint16_t position[4];
+            std::int16_t normal[2];
+            std::uint8_t color[4];
+            std::uint16_t material[4];
+        };
+        static_assert(sizeof(CompactVertex) == 24, "compact vertex must stay 24 bytes");
+
+        glm::vec3 boundsMin = vertices.front().position;
+        glm::vec3 boundsMax = boundsMin;
+        for (const SolidVertex& vertex : vertices)
+        {
+            boundsMin = glm::min(boundsMin, vertex.position);
+            boundsMax = glm::max(boundsMax, vertex.position);
+        }
+        const glm::vec3 extent = glm::max(boundsMax - boundsMin, glm::vec3{1.0e-6F});
+        info.positionScale = extent;
+        info.positionOffset = boundsMin;
+
+        auto toUnorm16 = [](float value) {
+            return static_cast<std::uint16_t>(std::lround(glm::clamp(value, 0.0F, 1.0F) * 65535.0F));
+        };
+        auto toSnorm16 = [](float value) {
+            return static_cast<std::int16_t>(std::lround(glm::clamp(value, -1.0F, 1.0F) * 32767.0F));
+        };
+        auto octEncode = [](glm::vec3 n) {
+            const float sum = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+            if (sum < 1.0e-6F)
+            {
+                return glm::vec2{0.0F, 0.0F};
+            }
+            n /= sum;
+            glm::vec2 e{n.x, n.y};
+            if (n.z < 0.0F)
+            {
+                e = glm::vec2{
+                    (1.0F - std::abs(n.y)) * (n.x >= 0.0F ? 1.0F : -1.0F),
+                    (1.0F - std::abs(n.x)) * (n.y >= 0.0F ? 1.0F : -1.0F),
+                };
+            }
+            return e;
+        };
+
+        std::vector<CompactVertex> compact(vertices.size());
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+        {
+            const SolidVertex& source = vertices[i];
+            CompactVertex& out = compact[i];
+            const glm::vec3 local = (source.position - boundsMin) / extent;
+            out.position[0] = toUnorm16(local.x);
+            out.position[1] = toUnorm16(local.y);
+            out.position[2] = toUnorm16(local.z);
+            out.position[3] = 0;
+            const glm::vec2 oct = octEncode(source.normal);
+            out.normal[0] = toSnorm16(oct.x);
+            out.normal[1] = toSnorm16(oct.y);
+            for (int c = 0; c < 3; ++c)
+            {
+                out.color[c] = static_cast<std::uint8_t>(std::lround(glm::clamp(source.color[c], 0.0F, 1.0F) * 255.0F));
+            }
+            out.color[3] = 255;
+            for (int m = 0; m < 4; ++m)
+            {
+                out.material[m] = static_cast<std::uint16_t>(glm::packHalf1x16(source.material[m]));
+            }
+        }
+
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(compact.size() * sizeof(CompactVertex)), compact.data(), GL_STATIC_DRAW);
+        constexpr GLsizei stride = sizeof(CompactVertex);
+        glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, stride, reinterpret_cast<void*>(offsetof(CompactVertex, position)));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, stride, reinterpret_cast<void*>(offsetof(CompactVertex, normal)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 3, GL_UNSIGNED_BYTE, GL_TRUE, stride, reinterpret_cast<void*>(offsetof(CompactVertex, color)));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(3, 4, GL_HALF_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(CompactVertex, material)));
+        glEnableVertexAttribArray(3);
+        info.gpuBytes = compact.size() * sizeof(CompactVertex);
+    }
+    else
+    {
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertices.size() * sizeof(SolidVertex)), vertices.data(), GL_STATIC_DRAW);
+        constexpr GLsizei stride = sizeof(SolidVertex);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(SolidVertex, position)));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(SolidVertex, normal)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(SolidVertex, color)));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(SolidVertex, material)));
+        glEnableVertexAttribArray(3);
+        info.gpuBytes = vertices.size() * sizeof(SolidVertex);
+    }
+
+    // Draws go through the render queue as instanced batches of model transforms.
+    BindInstanceAttributes();
+
+    // The element buffer binding is VAO state, so bind it while the VAO is still bound.
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, info.ebo);
+    if (vertices.size() <= 0xFFFFU)
+    {
+        std::vector<std::uint16_t> shortIndices(indices.begin(), indices.end());
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(shortIndices.size() * sizeof(std::uint16_t)), shortIndices.data(), GL_STATIC_DRAW);
+        info.indexType = GL_UNSIGNED_SHORT;
+        info.gpuBytes += shortIndices.size() * sizeof(std::uint16_t);
+    }
+    else
+    {
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(std::uint32_t)), indices.data(), GL_STATIC_DRAW);
+        info.indexType = GL_UNSIGNED_INT;
+        info.gpuBytes += indices.size() * sizeof(std::uint32_t);
+    }
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
+    m_gpuMeshBytes += info.gpuBytes;
+    m_gpuMeshUnweldedBytes += info.unweldedBytes;
     const GpuMeshId id = m_nextGpuMeshId++;
-    m_gpuMeshes[id] = GpuMeshInfo{vao, vbo, static_cast<std::uint32_t>(vertices.size())};
+    m_gpuMeshes[id] = info;
     return id;
 }
 
@@ -1405,12 +2057,39 @@ void Renderer::DrawGpuMesh(GpuMeshId id, const glm::mat4& modelMatrix)
     m_gpuMeshDraws.push_back(GpuMeshDraw{id, modelMatrix});
 }
 
+void Renderer::DrawSolidRanges(unsigned int vao, const int* firsts, const int* counts, std::size_t rangeCount)
+{
+    if (vao == 0 || rangeCount == 0)
+    {
+        return;
+    }
+    m_solidRangeDraws.push_back(SolidRangeDraw{vao, m_solidRangeFirsts.size(), rangeCount});
+    m_solidRangeFirsts.insert(m_solidRangeFirsts.end(), firsts, firsts + rangeCount);
+    m_solidRangeCounts.insert(m_solidRangeCounts.end(), counts, counts + rangeCount);
+}
+
+void Renderer::RecordPass(PassFn fn, void* user, const void* payload, std::size_t bytes)
+{
+    if (fn == nullptr)
+    {
+        return;
+    }
+    const std::size_t offset = m_passPayloads.size();
+    m_passPayloads.resize(offset + bytes);
+    if (bytes > 0)
+    {
+        std::memcpy(m_passPayloads.data() + offset, payload, bytes);
+    }
+    m_pendingPasses.push_back(PendingPass{fn, user, offset, bytes});
+}
+
 void Renderer::FreeGpuMesh(GpuMeshId id)
 {
     if (id == kInvalidGpuMesh)
     {
         return;
     }
+    RenderThread::Instance().AcquireContext();
     const auto it = m_gpuMeshes.find(id);
     if (it == m_gpuMeshes.end())
     {
@@ -1420,27 +2099,40 @@ void Renderer::FreeGpuMesh(GpuMeshId id)
     {
         glDeleteBuffers(1, &it->second.vbo);
     }
+    if (it->second.ebo != 0)
+    {
+        glDeleteBuffers(1, &it->second.ebo);
+    }
     if (it->second.vao != 0)
     {
         glDeleteVertexArrays(1, &it->second.vao);
     }
+    m_gpuMeshBytes -= std::min(m_gpuMeshBytes, it->second.gpuBytes);
+    m_gpuMeshUnweldedBytes -= std::min(m_gpuMeshUnweldedBytes, it->second.unweldedBytes);
     m_gpuMeshes.erase(it);
 }
 
 void Renderer::FreeAllGpuMeshes()
 {
+    RenderThread::Instance().AcquireContext();
     for (auto& [id, info] : m_gpuMeshes)
     {
         if (info.vbo != 0)
         {
             glDeleteBuffers(1, &info.vbo);
         }
+        if (info.ebo != 0)
+        {
+            glDeleteBuffers(1, &info.ebo);
+        }
         if (info.vao != 0)
         {
             glDeleteVertexArrays(1, &info.vao);
         }
     }
     m_gpuMeshes.clear();
+    m_gpuMeshBytes = 0;
+    m_gpuMeshUnweldedBytes = 0;
 }
 
 unsigned int Renderer::CompileShader(unsigned int type, const char* source)
@@ -1466,6 +2158,13 @@ unsigned int Renderer::CompileShader(unsigned int type, const char* source)
 }
 
 unsigned int Renderer::CreateProgram(const char* vertexSource, const char* fragmentSource)
+{
+    return ShaderCache::CreateProgram(vertexSource, fragmentSource, [vertexSource, fragmentSource] {
+        return CompileProgram(vertexSource, fragmentSource);
+    });
+}
+
+unsigned int Renderer::CompileProgram(const char* vertexSource, const char* fragmentSource)
 {
     const unsigned int vertexShader = CompileShader(GL_VERTEX_SHADER, vertexSource);
     const unsigned int fragmentShader = CompileShader(GL_FRAGMENT_SHADER, fragmentSource);
@@ -1485,6 +2184,7 @@ unsigned int Renderer::CreateProgram(const char* vertexSource, const char* fragm
     const unsigned int program = glCreateProgram();
     glAttachShader(program, vertexShader);
     glAttachShader(program, fragmentShader);
+    ShaderCache::PrepareForStore(program);
     glLinkProgram(program);
 
     int success = 0;
@@ -1528,56 +2228,204 @@ void Renderer::AddWireBox(const glm::vec3& center, const glm::vec3& halfExtents,
     edge(0, 4); edge(1, 5); edge(2, 6); edge(3, 7);
 }
 
-void Renderer::AddSolidBox(
+void Renderer::CreateUnitMeshes()
+{
+    glGenBuffers(1, &m_instanceVbo);
+    glBindBuffer(GL_ARRAY_BUFFER, m_instanceVbo);
+    m_instanceVboCapacityBytes = 256U * 1024U;
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_instanceVboCapacityBytes), nullptr, GL_STREAM_DRAW);
+
+    const auto upload = [this](UnitMesh& unit, const std::vector<UnitMeshVertex>& vertices, const std::vector<std::uint16_t>& indices) {
+        glGenVertexArrays(1, &unit.vao);
+        glGenBuffers(1, &unit.vbo);
+        glGenBuffers(1, &unit.ebo);
+        glBindVertexArray(unit.vao);
+
+        glBindBuffer(GL_ARRAY_BUFFER, unit.vbo);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertices.size() * sizeof(UnitMeshVertex)), vertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(UnitMeshVertex), reinterpret_cast<void*>(offsetof(UnitMeshVertex, position)));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(UnitMeshVertex), reinterpret_cast<void*>(offsetof(UnitMeshVertex, normal)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(9, 1, GL_FLOAT, GL_FALSE, sizeof(UnitMeshVertex), reinterpret_cast<void*>(offsetof(UnitMeshVertex, stretch)));
+        glEnableVertexAttribArray(9);
+
+        BindInstanceAttributes();
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, unit.ebo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(std::uint16_t)), indices.data(), GL_STATIC_DRAW);
+        glBindVertexArray(0);
+
+        unit.vertexCount = static_cast<std::uint32_t>(vertices.size());
+        unit.indexCount = static_cast<std::uint32_t>(indices.size());
+    };
+
+    std::vector<UnitMeshVertex> vertices;
+    std::vector<std::uint16_t> indices;
+
+    // Unit box: [-1, 1]^3, four vertices per face so each face keeps its flat normal.
+    {
+        const std::array<glm::vec3, 8> c{
+            glm::vec3{-1.0F, -1.0F, -1.0F}, glm::vec3{+1.0F, -1.0F, -1.0F},
+            glm::vec3{+1.0F, -1.0F, +1.0F}, glm::vec3{-1.0F, -1.0F, +1.0F},
+            glm::vec3{-1.0F, +1.0F, -1.0F}, glm::vec3{+1.0F, +1.0F, -1.0F},
+            glm::vec3{+1.0F, +1.0F, +1.0F}, glm::vec3{-1.0F, +1.0F, +1.0F},
+        };
+        const auto face = [&](int a, int b, int d, int e, const glm::vec3& normal) {
+            const auto base = static_cast<std::uint16_t>(vertices.size());
+            for (const int corner : {a, b, d, e})
+            {
+                vertices.push_back(UnitMeshVertex{c[static_cast<std::size_t>(corner)], normal, 0.0F});
+            }
+            for (const int offset : {0, 1, 2, 0, 2, 3})
+            {
+                indices.push_back(static_cast<std::uint16_t>(base + offset));
+            }
+        };
+        face(0, 3, 2, 1, glm::vec3{0.0F, -1.0F, 0.0F});
+        face(4, 5, 6, 7, glm::vec3{0.0F, 1.0F, 0.0F});
+        face(0, 1, 5, 4, glm::vec3{0.0F, 0.0F, -1.0F});
+        face(3, 7, 6, 2, glm::vec3{0.0F, 0.0F, 1.0F});
+        face(0, 4, 7, 3, glm::vec3{-1.0F, 0.0F, 0.0F});
+        face(1, 2, 6, 5, glm::vec3{1.0F, 0.0F, 0.0F});
+        upload(m_unitMeshes[kUnitBoxMesh], vertices, indices);
+    }
+
+    // Unit capsules (radius 1, hemisphere centers at the origin): cap vertices carry stretch +/-1 so the
+    // shader can open the cylinder to any height without re-tessellating.
+    constexpr std::array<std::pair<int, int>, kCapsuleLodCount> kCapsuleLods{{{16, 6}, {12, 4}, {8, 3}, {6, 2}}};
+    const float twoPi = 6.2831853F;
+    const float halfPi = 1.5707963F;
+    for (std::size_t lod = 0; lod < kCapsuleLodCount; ++lod)
+    {
+        const int segments = kCapsuleLods[lod].first;
+        const int hemiRings = kCapsuleLods[lod].second;
+        const int ringStride = segments + 1;
+        vertices.clear();
+        indices.clear();
+
+        // Rings 0..hemiRings for the top cap, then the same for the bottom cap.
+        for (const float ySign : {1.0F, -1.0F})
+        {
+            for (int ring = 0; ring <= hemiRings; ++ring)
+            {
+                const float phi = static_cast<float>(ring) / static_cast<float>(hemiRings) * halfPi;
+                for (int i = 0; i <= segments; ++i)
+                {
+                    const float t = static_cast<float>(i) / static_cast<float>(segments) * twoPi;
+                    const glm::vec3 n{std::cos(t) * std::cos(phi), std::sin(phi) * ySign, std::sin(t) * std::cos(phi)};
+                    vertices.push_back(UnitMeshVertex{n, n, ySign});
+                }
+            }
+        }
+
+        const int bottomBase = (hemiRings + 1) * ringStride;
+        const auto vertexIndex = [&](int hemiBase, int ring, int i) {
+            return static_cast<std::uint16_t>(hemiBase + ring * ringStride + i);
+        };
+
+        // Cylinder body between the two equator rings.
+        for (int i = 0; i < segments; ++i)
+        {
+            const std::uint16_t b0 = vertexIndex(bottomBase, 0, i);
+            const std::uint16_t b1 = vertexIndex(bottomBase, 0, i + 1);
+            const std::uint16_t t0 = vertexIndex(0, 0, i);
+            const std::uint16_t t1 = vertexIndex(0, 0, i + 1);
+            indices.insert(indices.end(), {b0, t0, t1, b0, t1, b1});
+        }
+
+        for (int ring = 0; ring < hemiRings; ++ring)
+        {
+            for (int i = 0; i < segments; ++i)
+            {
+                const std::uint16_t top00 = vertexIndex(0, ring, i);
+                const std::uint16_t top01 = vertexIndex(0, ring, i + 1);
+                const std::uint16_t top10 = vertexIndex(0, ring + 1, i);
+                const std::uint16_t top11 = vertexIndex(0, ring + 1, i + 1);
+                indices.insert(indices.end(), {top00, top10, top11, top00, top11, top01});
+
+                const std::uint16_t bot00 = vertexIndex(bottomBase, ring, i);
+                const std::uint16_t bot01 = vertexIndex(bottomBase, ring, i + 1);
+                const std::uint16_t bot10 = vertexIndex(bottomBase, ring + 1, i);
+                const std::uint16_t bot11 = vertexIndex(bottomBase, ring + 1, i + 1);
+                indices.insert(indices.end(), {bot00, bot11, bot10, bot00, bot01, bot11});
+            }
+        }
+        upload(m_unitMeshes[kUnitCapsuleMesh + lod], vertices, indices);
+    }
+}
+
+void Renderer::BindInstanceAttributes() const
+{
+    // Instance attributes all come from the shared per-frame buffer; base instance selects the range.
+    glBindBuffer(GL_ARRAY_BUFFER, m_instanceVbo);
+    const std::array<std::size_t, 5> offsets{
+        offsetof(SolidInstance, modelRow0),
+        offsetof(SolidInstance, modelRow1),
+        offsetof(SolidInstance, modelRow2),
+        offsetof(SolidInstance, color),
+        offsetof(SolidInstance, material),
+    };
+    for (std::size_t i = 0; i < offsets.size(); ++i)
+    {
+        const auto location = static_cast<GLuint>(4 + i);
+        glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(SolidInstance), reinterpret_cast<void*>(offsets[i]));
+        glEnableVertexAttribArray(location);
+        glVertexAttribDivisor(location, 1);
+    }
+}
+
+void Renderer::DestroyUnitMeshes()
+{
+    for (UnitMesh& unit : m_unitMeshes)
+    {
+        if (unit.ebo != 0)
+        {
+            glDeleteBuffers(1, &unit.ebo);
+        }
+        if (unit.vbo != 0)
+        {
+            glDeleteBuffers(1, &unit.vbo);
+        }
+        if (unit.vao != 0)
+        {
+            glDeleteVertexArrays(1, &unit.vao);
+        }
+        unit = UnitMesh{};
+    }
+    if (m_instanceVbo != 0)
+    {
+        glDeleteBuffers(1, &m_instanceVbo);
+        m_instanceVbo = 0;
+    }
+    m_instanceVboCapacityBytes = 0;
+}
+
+void Renderer::PushSolidInstance(
+    std::size_t unitMesh,
+    const glm::mat3& rotation,
+    const glm::vec3& scale,
     const glm::vec3& center,
-    const glm::vec3& halfExtents,
     const glm::vec3& color,
+    float stretch,
     const MaterialParams& material
 )
 {
-    const glm::vec3 c0 = center + glm::vec3{-halfExtents.x, -halfExtents.y, -halfExtents.z};
-    const glm::vec3 c1 = center + glm::vec3{+halfExtents.x, -halfExtents.y, -halfExtents.z};
-    const glm::vec3 c2 = center + glm::vec3{+halfExtents.x, -halfExtents.y, +halfExtents.z};
-    const glm::vec3 c3 = center + glm::vec3{-halfExtents.x, -halfExtents.y, +halfExtents.z};
-    const glm::vec3 c4 = center + glm::vec3{-halfExtents.x, +halfExtents.y, -halfExtents.z};
-    const glm::vec3 c5 = center + glm::vec3{+halfExtents.x, +halfExtents.y, -halfExtents.z};
-    const glm::vec3 c6 = center + glm::vec3{+halfExtents.x, +halfExtents.y, +halfExtents.z};
-    const glm::vec3 c7 = center + glm::vec3{-halfExtents.x, +halfExtents.y, +halfExtents.z};
-
-    const glm::vec4 mat{
+    const glm::vec3 axisX = rotation[0] * scale.x;
+    const glm::vec3 axisY = rotation[1] * scale.y;
+    const glm::vec3 axisZ = rotation[2] * scale.z;
+
+    SolidInstance& instance = m_solidInstances[unitMesh].emplace_back();
+    instance.modelRow0 = glm::vec4{axisX.x, axisY.x, axisZ.x, center.x};
+    instance.modelRow1 = glm::vec4{axisX.y, axisY.y, axisZ.y, center.y};
+    instance.modelRow2 = glm::vec4{axisX.z, axisY.z, axisZ.z, center.z};
+    instance.color = glm::vec4{color, stretch};
+    instance.material = glm::vec4{
         glm::clamp(material.roughness, 0.0F, 1.0F),
         glm::clamp(material.metallic, 0.0F, 1.0F),
         glm::max(0.0F, material.emissive),
         material.unlit ? 1.0F : 0.0F,
     };
-
-    // Pre-size to avoid internal reallocations.
-    auto& v = m_solidVertices;
-
-    // Bottom  (normal: 0,-1,0)
-    const glm::vec3 nBot{0,-1,0};
-    v.push_back({c0,nBot,color,mat}); v.push_back({c2,nBot,color,mat}); v.push_back({c1,nBot,color,mat});
-    v.push_back({c0,nBot,color,mat}); v.push_back({c3,nBot,color,mat}); v.push_back({c2,nBot,color,mat});
-    // Top     (normal: 0,+1,0)
-    const glm::vec3 nTop{0,1,0};
-    v.push_back({c4,nTop,color,mat}); v.push_back({c5,nTop,color,mat}); v.push_back({c6,nTop,color,mat});
-    v.push_back({c4,nTop,color,mat}); v.push_back({c6,nTop,color,mat}); v.push_back({c7,nTop,color,mat});
-    // Front   (normal: 0,0,-1)
-    const glm::vec3 nFront{0,0,-1};
-    v.push_back({c0,nFront,color,mat}); v.push_back({c1,nFront,color,mat}); v.push_back({c5,nFront,color,mat});
-    v.push_back({c0,nFront,color,mat}); v.push_back({c5,nFront,color,mat}); v.push_back({c4,nFront,color,mat});
-    // Back    (normal: 0,0,+1)
-    const glm::vec3 nBack{0,0,1};
-    v.push_back({c3,nBack,color,mat}); v.push_back({c7,nBack,color,mat}); v.push_back({c6,nBack,color,mat});
-    v.push_back({c3,nBack,color,mat}); v.push_back({c6,nBack,color,mat}); v.push_back({c2,nBack,color,mat});
-    // Left    (normal: -1,0,0)
-    const glm::vec3 nLeft{-1,0,0};
-    v.push_back({c0,nLeft,color,mat}); v.push_back({c4,nLeft,color,mat}); v.push_back({c7,nLeft,color,mat});
-    v.push_back({c0,nLeft,color,mat}); v.push_back({c7,nLeft,color,mat}); v.push_back({c3,nLeft,color,mat});
-    // Right   (normal: +1,0,0)
-    const glm::vec3 nRight{1,0,0};
-    v.push_back({c1,nRight,color,mat}); v.push_back({c2,nRight,color,mat}); v.push_back({c6,nRight,color,mat});
-    v.push_back({c1,nRight,color,mat}); v.push_back({c6,nRight,color,mat}); v.push_back({c5,nRight,color,mat});
 }
 
 void Renderer::AddWireOrientedBox(
@@ -1611,54 +2459,6 @@ void Renderer::AddWireOrientedBox(
     edge(0, 4); edge(1, 5); edge(2, 6); edge(3, 7);
 }
 
-void Renderer::AddSolidOrientedBox(
-    const glm::vec3& center,
-    const glm::vec3& halfExtents,
-    const glm::vec3& rotationEulerDegrees,
-    const glm::vec3& color,
-    const MaterialParams& material
-)
-{
-    const glm::mat3 rotation = RotationMatrixFromEulerDegrees(rotationEulerDegrees);
-    const glm::vec3 c0 = center + rotation * glm::vec3{-halfExtents.x, -halfExtents.y, -halfExtents.z};
-    const glm::vec3 c1 = center + rotation * glm::vec3{+halfExtents.x, -halfExtents.y, -halfExtents.z};
-    const glm::vec3 c2 = center + rotation * glm::vec3{+halfExtents.x, -halfExtents.y, +halfExtents.z};
-    const glm::vec3 c3 = center + rotation * glm::vec3{-halfExtents.x, -halfExtents.y, +halfExtents.z};
-    const glm::vec3 c4 = center + rotation * glm::vec3{-halfExtents.x, +halfExtents.y, -halfExtents.z};
-    const glm::vec3 c5 = center + rotation * glm::vec3{+halfExtents.x, +halfExtents.y, -halfExtents.z};
-    const glm::vec3 c6 = center + rotation * glm::vec3{+halfExtents.x, +halfExtents.y, +halfExtents.z};
-    const glm::vec3 c7 = center + rotation * glm::vec3{-halfExtents.x, +halfExtents.y, +halfExtents.z};
-
-    const glm::vec4 mat{
-        glm::clamp(material.roughness, 0.0F, 1.0F),
-        glm::clamp(material.metallic, 0.0F, 1.0F),
-        glm::max(0.0F, material.emissive),
-        material.unlit ? 1.0F : 0.0F,
-    };
-
-    // Rotated face normals (cheaper than per-tri cross product).
-    const glm::vec3 nBot   = rotation * glm::vec3{0,-1, 0};
-    const glm::vec3 nTop   = rotation * glm::vec3{0, 1, 0};
-    const glm::vec3 nFront = rotation * glm::vec3{0, 0,-1};
-    const glm::vec3 nBack  = rotation * glm::vec3{0, 0, 1};
-    const glm::vec3 nLeft  = rotation * glm::vec3{-1,0, 0};
-    const glm::vec3 nRight = rotation * glm::vec3{1, 0, 0};
-
-    auto& v = m_solidVertices;
-    v.push_back({c0,nBot,color,mat});   v.push_back({c2,nBot,color,mat});   v.push_back({c1,nBot,color,mat});
-    v.push_back({c0,nBot,color,mat});   v.push_back({c3,nBot,color,mat});   v.push_back({c2,nBot,color,mat});
-    v.push_back({c4,nTop,color,mat});   v.push_back({c5,nTop,color,mat});   v.push_back({c6,nTop,color,mat});
-    v.push_back({c4,nTop,color,mat});   v.push_back({c6,nTop,color,mat});   v.push_back({c7,nTop,color,mat});
-    v.push_back({c0,nFront,color,mat}); v.push_back({c1,nFront,color,mat}); v.push_back({c5,nFront,color,mat});
-    v.push_back({c0,nFront,color,mat}); v.push_back({c5,nFront,color,mat}); v.push_back({c4,nFront,color,mat});
-    v.push_back({c3,nBack,color,mat});  v.push_back({c7,nBack,color,mat});  v.push_back({c6,nBack,color,mat});
-    v.push_back({c3,nBack,color,mat});  v.push_back({c6,nBack,color,mat});  v.push_back({c2,nBack,color,mat});
-    v.push_back({c0,nLeft,color,mat});  v.push_back({c4,nLeft,color,mat});  v.push_back({c7,nLeft,color,mat});
-    v.push_back({c0,nLeft,color,mat});  v.push_back({c7,nLeft,color,mat});  v.push_back({c3,nLeft,color,mat});
-    v.push_back({c1,nRight,color,mat}); v.push_back({c2,nRight,color,mat}); v.push_back({c6,nRight,color,mat});
-    v.push_back({c1,nRight,color,mat}); v.push_back({c6,nRight,color,mat}); v.push_back({c5,nRight,color,mat});
-}
-
 void Renderer::AddWireCapsule(const glm::vec3& center, float height, float radius, const glm::vec3& color)
 {
     constexpr int segments = 16;
@@ -1680,103 +2480,6 @@ void Renderer::AddWireCapsule(const glm::vec3& center, float height, float radiu
     }
 }
 
-void Renderer::AddSolidCapsule(
-    const glm::vec3& center,
-    float height,
-    float radius,
-    const glm::vec3& color,
-    const MaterialParams& material,
-    int segments,
-    int hemiRings
-)
-{
-    const float halfCylinder = std::max(0.0F, height * 0.5F - radius);
-    const glm::vec3 topCenter = center + glm::vec3{0.0F, halfCylinder, 0.0F};
-    const glm::vec3 bottomCenter = center - glm::vec3{0.0F, halfCylinder, 0.0F};
-
-    const glm::vec4 mat{
-        glm::clamp(material.roughness, 0.0F, 1.0F),
-        glm::clamp(material.metallic, 0.0F, 1.0F),
-        glm::max(0.0F, material.emissive),
-        material.unlit ? 1.0F : 0.0F,
-    };
-
-    auto& v = m_solidVertices;
-    const float twoPi = 6.2831853F;
-    const float halfPi = 1.5707963F;
-
-    // Pre-compute sin/cos per segment.
-    const int maxSegs = std::min(segments, 64);
-    float cosTable[65], sinTable[65]; // +1 for wrap
-    for (int i = 0; i <= maxSegs; ++i)
-    {
-        const float t = static_cast<float>(i) / static_cast<float>(maxSegs) * twoPi;
-        cosTable[i] = std::cos(t);
-        sinTable[i] = std::sin(t);
-    }
-
-    // Cylinder body — normals point radially outward (no Y component).
-    for (int i = 0; i < maxSegs; ++i)
-    {
-        const glm::vec3 ring0{cosTable[i] * radius, 0.0F, sinTable[i] * radius};
-        const glm::vec3 ring1{cosTable[i + 1] * radius, 0.0F, sinTable[i + 1] * radius};
-        const glm::vec3 n0 = glm::vec3{cosTable[i], 0.0F, sinTable[i]};
-        const glm::vec3 n1 = glm::vec3{cosTable[i + 1], 0.0F, sinTable[i + 1]};
-
-        const glm::vec3 b0 = bottomCenter + ring0;
-        const glm::vec3 b1 = bottomCenter + ring1;
-        const glm::vec3 t0 = topCenter + ring0;
-        const glm::vec3 t1 = topCenter + ring1;
-
-        v.push_back({b0, n0, color, mat}); v.push_back({t0, n0, color, mat}); v.push_back({t1, n1, color, mat});
-        v.push_back({b0, n0, color, mat}); v.push_back({t1, n1, color, mat}); v.push_back({b1, n1, color, mat});
-    }
-
-    // Hemisphere with analytically-computed normals.
-    auto addHemisphere = [&](const glm::vec3& hemiCenter, float ySign) {
-        for (int ring = 0; ring < hemiRings; ++ring)
-        {
-            const float phi0 = static_cast<float>(ring) / static_cast<float>(hemiRings) * halfPi;
-            const float phi1 = static_cast<float>(ring + 1) / static_cast<float>(hemiRings) * halfPi;
-            const float r0 = std::cos(phi0) * radius;
-            const float r1 = std::cos(phi1) * radius;
-            const float y0 = std::sin(phi0) * radius * ySign;
-            const float y1 = std::sin(phi1) * radius * ySign;
-            const float ny0 = std::sin(phi0) * ySign;
-            const float ny1 = std::sin(phi1) * ySign;
-            const float nr0 = std::cos(phi0);
-            const float nr1 = std::cos(phi1);
-
-            for (int i = 0; i < maxSegs; ++i)
-            {
-                const glm::vec3 v00 = hemiCenter + glm::vec3{cosTable[i] * r0, y0, sinTable[i] * r0};
-                const glm::vec3 v01 = hemiCenter + glm::vec3{cosTable[i + 1] * r0, y0, sinTable[i + 1] * r0};
-                const glm::vec3 v10 = hemiCenter + glm::vec3{cosTable[i] * r1, y1, sinTable[i] * r1};
-                const glm::vec3 v11 = hemiCenter + glm::vec3{cosTable[i + 1] * r1, y1, sinTable[i + 1] * r1};
-
-                const glm::vec3 n00{cosTable[i] * nr0, ny0, sinTable[i] * nr0};
-                const glm::vec3 n01{cosTable[i + 1] * nr0, ny0, sinTable[i + 1] * nr0};
-                const glm::vec3 n10{cosTable[i] * nr1, ny1, sinTable[i] * nr1};
-                const glm::vec3 n11{cosTable[i + 1] * nr1, ny1, sinTable[i + 1] * nr1};
-
-                if (ySign > 0.0F)
-                {
-                    v.push_back({v00, n00, color, mat}); v.push_back({v10, n10, color, mat}); v.push_back({v11, n11, color, mat});
-                    v.push_back({v00, n00, color, mat}); v.push_back({v11, n11, color, mat}); v.push_back({v01, n01, color, mat});
-                }
-                else
-                {
-                    v.push_back({v00, n00, color, mat}); v.push_back({v11, n11, color, mat}); v.push_back({v10, n10, color, mat});
-                    v.push_back({v00, n00, color, mat}); v.push_back({v01, n01, color, mat}); v.push_back({v11, n11, color, mat});
-                }
-            }
-        }
-    };
-
-    addHemisphere(topCenter, 1.0F);
-    addHemisphere(bottomCenter, -1.0F);
-}
-
 void Renderer::AddSolidTriangle(
     const glm::vec3& a,
     const glm::vec3& b,
@@ -1,15 +1,21 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <unordered_map>
 #include <vector>
 
+#include <glm/mat3x3.hpp>
 #include <glm/mat4x4.hpp>
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
 
 #include "engine/render/Frustum.hpp"
+#include "engine/render/LightClusters.hpp"
+#include "engine/render/RenderQueue.hpp"
+#include "engine/render/RenderThread.hpp"
 
 namespace engine::render
 {
@@ -83,7 +89,8 @@ public:
     bool Initialize(int framebufferWidth, int framebufferHeight);
     void Shutdown();
 
-    void SetViewport(int framebufferWidth, int framebufferHeight) const;
+    void SetViewport(int framebufferWidth, int framebufferHeight);
+    [[nodiscard]] int FramebufferHeight() const { return m_framebufferHeight; }
 
     void SetRenderMode(RenderMode mode);
     void ToggleRenderMode();
@@ -172,20 +179,51 @@ public:
     using GpuMeshId = std::uint32_t;
     static constexpr GpuMeshId kInvalidGpuMesh = 0;
 
+    /// Standard: 52-byte float vertex. Compact: 24 bytes — unorm16 position within the mesh bounds,
+    /// octahedral snorm16 normal, RGBA8 color, half-float material.
+    enum class GpuVertexFormat
+    {
+        Standard,
+        Compact
+    };
+
     struct GpuMeshInfo
     {
         unsigned int vao = 0;
         unsigned int vbo = 0;
+        unsigned int ebo = 0;
         std::uint32_t vertexCount = 0;
+        std::uint32_t indexCount = 0;
+        unsigned int indexType = 0; // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+        bool compact = false;
+        glm::vec3 positionScale{1.0F};
+        glm::vec3 positionOffset{0.0F};
+        std::size_t gpuBytes = 0;
+        std::size_t unweldedBytes = 0; // what one Standard vertex per triangle corner would cost
     };
 
-    /// Upload a MeshGeometry to a persistent GPU VBO.  Returns a handle for DrawGpuMesh.
-    /// Vertex data is baked in object-space (position, normal, single color, material).
-    GpuMeshId UploadMesh(const MeshGeometry& mesh, const glm::vec3& color, const MaterialParams& material = {});
+    /// Upload a MeshGeometry to a persistent indexed GPU buffer.  Returns a handle for DrawGpuMesh.
+    /// Vertex data is baked in object-space (position, normal, single color, material); identical
+    /// corners are welded so shared vertices are stored and shaded once.
+    GpuMeshId UploadMesh(
+        const MeshGeometry& mesh,
+        const glm::vec3& color,
+        const MaterialParams& material = {},
+        GpuVertexFormat format = GpuVertexFormat::Standard
+    );
 
     /// Draw a previously-uploaded GPU mesh with a model matrix (position/rotation/scale).
     void DrawGpuMesh(GpuMeshId id, const glm::mat4& modelMatrix);
 
+    /// Multi-draw solid triangles from a caller-owned VAO (solid vertex layout, identity model).
+    /// The ranges are copied and recorded in EndFrame after the frame's uniform and light uploads.
+    void DrawSolidRanges(unsigned int vao, const int* firsts, const int* counts, std::size_t rangeCount);
+
+    /// Caller GL pass recorded at the end of this frame's command list, so it runs in order on
+    /// whichever thread executes the list. payload is copied; user must outlive the frame.
+    using PassFn = void (*)(void* user, const void* payload);
+    void RecordPass(PassFn fn, void* user, const void* payload, std::size_t bytes);
+
     /// Free a GPU mesh (VBO + VAO).  Safe to call with kInvalidGpuMesh.
     void FreeGpuMesh(GpuMeshId id);
 
@@ -193,6 +231,7 @@ public:
     void FreeAllGpuMeshes();
 
     [[nodiscard]] int GetSolidModelLocation() const { return m_solidModelLocation; }
+    [[nodiscard]] std::size_t GpuMeshBytes() const { return m_gpuMeshBytes; }
 
 private:
     struct LineVertex
@@ -223,29 +262,90 @@ private:
         std::size_t vertexCount = 0;
     };
 
+    /// Per-instance data for the cached unit box/capsule meshes: a 3x4 affine transform stored as rows,
+    /// color (w = capsule cylinder half-length in radii) and material.
+    struct SolidInstance
+    {
+        glm::vec4 modelRow0{1.0F, 0.0F, 0.0F, 0.0F};
+        glm::vec4 modelRow1{0.0F, 1.0F, 0.0F, 0.0F};
+        glm::vec4 modelRow2{0.0F, 0.0F, 1.0F, 0.0F};
+        glm::vec4 color{1.0F, 1.0F, 1.0F, 0.0F};
+        glm::vec4 material{0.55F, 0.0F, 0.0F, 0.0F};
+    };
+    /// Unit mesh vertex. stretch moves capsule cap vertices along Y by the instance's cylinder half-length.
+    struct UnitMeshVertex
+    {
+        glm::vec3 position{0.0F};
+        glm::vec3 normal{0.0F, 1.0F, 0.0F};
+        float stretch = 0.0F;
+    };
+    struct UnitMesh
+    {
+        unsigned int vao = 0;
+        unsigned int vbo = 0;
+        unsigned int ebo = 0;
+        std::uint32_t vertexCount = 0;
+        std::uint32_t indexCount = 0;
+    };
+
+    // Unit box, then the capsule tessellation LODs from finest to coarsest.
+    static constexpr std::size_t kUnitBoxMesh = 0;
+    static constexpr std::size_t kUnitCapsuleMesh = 1;
+    static constexpr std::size_t kCapsuleLodCount = 4;
+    static constexpr std::size_t kUnitMeshCount = kUnitCapsuleMesh + kCapsuleLodCount;
+
+    /// std140 mirror of the FrameUniforms shader block (binding 0). Padding is explicit so a memcmp
+    /// against the last uploaded copy is exact.
+    struct FrameUniformBlock
+    {
+        glm::vec3 cameraPosition{0.0F};
+        int lightingEnabled = 1;
+        glm::vec3 lightDirection{0.0F, -1.0F, 0.0F};
+        float lightIntensity = 1.0F;
+        glm::vec3 lightColor{1.0F};
+        int fogEnabled = 0;
+        glm::vec3 fogColor{0.0F};
+        float fogDensity = 0.0F;
+        float fogStart = 0.0F;
+        float fogEnd = 0.0F;
+        float clusterDepthScale = 0.0F;   // slice = log(view depth) * scale + bias
+        float clusterDepthBias = 0.0F;
+        glm::vec2 clusterTileScale{0.0F}; // clusters per framebuffer pixel
+        float padding[2]{};
+    };
+    static_assert(sizeof(FrameUniformBlock) == 96 && offsetof(FrameUniformBlock, clusterTileScale) == 80, "FrameUniforms std140 layout");
+
+    /// One point or spot light in the clustered light buffer (std430, binding 1).
+    /// params: x = spot outer cosine, y = 1 for spot lights, z/w = diffuse/specular weights.
+    struct ClusterLightRecord
+    {
+        glm::vec4 posRange{0.0F};
+        glm::vec4 colorIntensity{0.0F};
+        glm::vec4 dirInnerCos{0.0F, -1.0F, 0.0F, 1.0F};
+        glm::vec4 params{0.0F};
+    };
+
     static unsigned int CompileShader(unsigned int type, const char* source);
+    /// Through ShaderCache: a cached program binary when available, else CompileProgram.
     static unsigned int CreateProgram(const char* vertexSource, const char* fragmentSource);
-
-    void AddWireBox(const glm::vec3& center, const glm::vec3& halfExtents, const glm::vec3& color);
-    void AddSolidBox(const glm::vec3& center, const glm::vec3& halfExtents, const glm::vec3& color, const MaterialParams& material);
-    void AddWireOrientedBox(const glm::vec3& center, const glm::vec3& halfExtents, const glm::vec3& rotationEulerDegrees, const glm::vec3& color);
-    void AddSolidOrientedBox(
+    static unsigned int CompileProgram(const char* vertexSource, const char* fragmentSource);
+
+    void CreateUnitMeshes();
+    void BindInstanceAttributes() const;
+    void DestroyUnitMeshes();
+    void PushSolidInstance(
+        std::size_t unitMesh,
+        const glm::mat3& rotation,
+        const glm::vec3& scale,
         const glm::vec3& center,
-        const glm::vec3& halfExtents,
-        const glm::vec3& rotationEulerDegrees,
         const glm::vec3& color,
+        float stretch,
         const MaterialParams& material
     );
+
+    void AddWireBox(const glm::vec3& center, const glm::vec3& halfExtents, const glm::vec3& color);
+    void AddWireOrientedBox(const glm::vec3& center, const glm::vec3& halfExtents, const glm::vec3& rotationEulerDegrees, const glm::vec3& color);
     void AddWireCapsule(const glm::vec3& center, float height, float radius, const glm::vec3& color);
-    void AddSolidCapsule(
-        const glm::vec3& center,
-        float height,
-        float radius,
-        const glm::vec3& color,
-        const MaterialParams& material,
-        int segments = 16,
-        int hemiRings = 6
-    );
     void AddSolidTriangle(
         const glm::vec3& a,
         const glm::vec3& b,
@@ -272,43 +372,7 @@ private:
 
     int m_lineViewProjLocation = -1;
     int m_solidViewProjLocation = -1;
-    int m_solidCameraPosLocation = -1;
-    int m_solidLightingEnabledLocation = -1;
-    int m_solidLightDirLocation = -1;
-    int m_solidLightColorLocation = -1;
-    int m_solidLightIntensityLocation = -1;
-    int m_solidFogEnabledLocation = -1;
-    int m_solidFogColorLocation = -1;
-    int m_solidFogDensityLocation = -1;
-    int m_solidFogStartLocation = -1;
-    int m_solidFogEndLocation = -1;
-    int m_solidPointLightCountLocation = -1;
-    int m_solidPointLightPosRangeLocation = -1;
-    int m_solidPointLightColorIntensityLocation = -1;
-    int m_solidSpotLightCountLocation = -1;
-    int m_solidSpotLightPosRangeLocation = -1;
-    int m_solidSpotLightDirInnerCosLocation = -1;
-    int m_solidSpotLightColorIntensityLocation = -1;
-    int m_solidSpotLightOuterCosLocation = -1;
     int m_texturedViewProjLocation = -1;
-    int m_texturedCameraPosLocation = -1;
-    int m_texturedLightingEnabledLocation = -1;
-    int m_texturedLightDirLocation = -1;
-    int m_texturedLightColorLocation = -1;
-    int m_texturedLightIntensityLocation = -1;
-    int m_texturedFogEnabledLocation = -1;
-    int m_texturedFogColorLocation = -1;
-    int m_texturedFogDensityLocation = -1;
-    int m_texturedFogStartLocation = -1;
-    int m_texturedFogEndLocation = -1;
-    int m_texturedPointLightCountLocation = -1;
-    int m_texturedPointLightPosRangeLocation = -1;
-    int m_texturedPointLightColorIntensityLocation = -1;
-    int m_texturedSpotLightCountLocation = -1;
-    int m_texturedSpotLightPosRangeLocation = -1;
-    int m_texturedSpotLightDirInnerCosLocation = -1;
-    int m_texturedSpotLightColorIntensityLocation = -1;
-    int m_texturedSpotLightOuterCosLocation = -1;
     int m_texturedAlbedoSamplerLocation = -1;
 
     std::vector<LineVertex> m_lineVertices;
@@ -326,11 +390,17 @@ private:
     float m_postFxPulseIntensity = 0.0F;
     Frustum m_frustum{};
     int m_solidModelLocation = -1;
+    int m_solidPositionScaleLocation = -1;
+    int m_solidPositionOffsetLocation = -1;
+    int m_solidOctNormalsLocation = -1;
+    int m_solidInstancedLocation = -1;
     std::size_t m_lastFrameSolidCount = 0;  // For transient buffer shrink heuristic.
 
     // GPU mesh cache
     GpuMeshId m_nextGpuMeshId = 1;
     std::unordered_map<GpuMeshId, GpuMeshInfo> m_gpuMeshes;
+    std::size_t m_gpuMeshBytes = 0;
+    std::size_t m_gpuMeshUnweldedBytes = 0;
 
     // Pending GPU mesh draws for the current frame (rendered in EndFrame after immediate-mode solid pass).
     struct GpuMeshDraw
@@ -339,5 +409,91 @@ private:
         glm::mat4 modelMatrix{1.0F};
     };
     std::vector<GpuMeshDraw> m_gpuMeshDraws;
+
+    // Pending DrawSolidRanges calls; firsts/counts of every call are stored back to back.
+    struct SolidRangeDraw
+    {
+        unsigned int vao = 0;
+        std::size_t firstRange = 0;
+        std::size_t rangeCount = 0;
+    };
+    std::vector<SolidRangeDraw> m_solidRangeDraws;
+    std::vector<int> m_solidRangeFirsts;
+    std::vector<int> m_solidRangeCounts;
+
+    // Pending RecordPass calls; payloads are stored back to back and copied into the list arena.
+    struct PendingPass
+    {
+        PassFn fn = nullptr;
+        void* user = nullptr;
+        std::size_t payloadOffset = 0;
+        std::size_t payloadBytes = 0;
+    };
+    std::vector<PendingPass> m_pendingPasses;
+    std::vector<std::byte> m_passPayloads;
+
+    // Instanced boxes/capsules: one SolidInstance per Draw* call, one draw per unit mesh in EndFrame.
+    std::array<UnitMesh, kUnitMeshCount> m_unitMeshes{};
+    std::array<std::vector<SolidInstance>, kUnitMeshCount> m_solidInstances;
+    std::vector<SolidInstance> m_instanceUpload;
+    unsigned int m_instanceVbo = 0;
+    std::size_t m_instanceVboCapacityBytes = 0;
+
+    // Render queue payload: draw kind in the top 4 bits, index into the kind's list below that.
+    enum class QueuedDraw : std::uint32_t
+    {
+        ImmediateSolid,
+        UnitInstances,
+        GpuMesh,
+        TexturedBatch
+    };
+    [[nodiscard]] static std::uint32_t PackQueuedDraw(QueuedDraw kind, std::uint32_t index)
+    {
+        return (static_cast<std::uint32_t>(kind) << 28U) | (index & 0x0FFFFFFFU);
+    }
+    [[nodiscard]] static QueuedDraw QueuedDrawKind(std::uint32_t payload) { return static_cast<QueuedDraw>(payload >> 28U); }
+    [[nodiscard]] static std::uint32_t QueuedDrawIndex(std::uint32_t payload) { return payload & 0x0FFFFFFFU; }
+
+    /// One GL draw after sorting: index is the unit mesh, GpuMeshId or textured batch.
+    struct QueuedBatch
+    {
+        QueuedDraw kind = QueuedDraw::ImmediateSolid;
+        std::uint32_t index = 0;
+        std::uint32_t instanceBase = 0;
+        std::uint32_t instanceCount = 0;
+    };
+    RenderQueue m_renderQueue;
+    std::vector<QueuedBatch> m_queuedBatches;
+
+    // One list is enough: the render thread only runs it between EndFrame and the next
+    // AcquireContext (Swap or BeginFrame), which waits for it to finish.
+    void ExecuteCommandList(const RenderCommandList& list);
+    static void ExecuteCommandListThunk(void* user, const RenderCommandList& list);
+    RenderCommandList m_commandList;
+
+    // Shared frame uniform buffer; the last uploaded contents are kept on the recording side so an
+    // unchanged camera/environment skips the upload entirely.
+    unsigned int m_frameUniformBuffer = 0;
+    FrameUniformBlock m_uploadedFrameUniforms{};
+    bool m_frameUniformsUploaded = false;
+
+    // Clustered forward lighting: light records, per-cluster (offset, count) and the light index list
+    // live in shader storage buffers. Records upload only when lights change; the grid is rebuilt when
+    // the lights or the view change.
+    LightClusters m_lightClusters;
+    std::vector<LightClusters::LightBounds> m_clusterLightBounds;
+    std::vector<ClusterLightRecord> m_clusterLights;
+    std::vector<ClusterLightRecord> m_uploadedClusterLights;
+    glm::mat4 m_clusteredViewProjection{0.0F};
+    glm::vec2 m_clusteredTileScale{0.0F};
+    bool m_clusterLightsUploaded = false;
+    unsigned int m_clusterLightBuffer = 0;
+    unsigned int m_clusterGridBuffer = 0;
+    unsigned int m_clusterIndexBuffer = 0;
+    std::size_t m_clusterLightBufferCapacityBytes = 0;
+    std::size_t m_clusterGridBufferCapacityBytes = 0;
+    std::size_t m_clusterIndexBufferCapacityBytes = 0;
+    int m_framebufferWidth = 1;
+    int m_framebufferHeight = 1;
 };
 } // namespace engine::render
@@ -0,0 +1,161 @@
+// Headless builds (asym_server, asym_net_soak) link this instead of the GL renderer sources.
+// Gameplay code still references the scene-submission API from its client-side render paths, which
+// never run without a window; these definitions only satisfy the link and never touch GL.
+
+#include "engine/render/Renderer.hpp"
+#include "engine/render/StaticBatcher.hpp"
+
+#include <utility>
+
+namespace engine::render
+{
+void Renderer::SetRenderMode(RenderMode mode)
+{
+    m_renderMode = mode;
+}
+
+void Renderer::ToggleRenderMode()
+{
+    m_renderMode = m_renderMode == RenderMode::Wireframe ? RenderMode::Filled : RenderMode::Wireframe;
+}
+
+void Renderer::SetEnvironmentSettings(const EnvironmentSettings& settings)
+{
+    m_environment = settings;
+}
+
+void Renderer::SetPointLights(const std::vector<PointLight>& lights)
+{
+    m_pointLights = lights;
+}
+
+void Renderer::SetPointLights(std::vector<PointLight>&& lights)
+{
+    m_pointLights = std::move(lights);
+}
+
+void Renderer::SetSpotLights(const std::vector<SpotLight>& lights)
+{
+    m_spotLights = lights;
+}
+
+void Renderer::SetSpotLights(std::vector<SpotLight>&& lights)
+{
+    m_spotLights = std::move(lights);
+}
+
+void Renderer::SetPostFxPulse(const glm::vec3& color, float intensity)
+{
+    m_postFxPulseColor = color;
+    m_postFxPulseIntensity = intensity;
+}
+
+void Renderer::SetLightingEnabled(bool enabled)
+{
+    m_lightingEnabled = enabled;
+}
+
+void Renderer::SetCameraWorldPosition(const glm::vec3& position)
+{
+    m_cameraWorldPosition = position;
+}
+
+void Renderer::DrawLine(const glm::vec3&, const glm::vec3&, const glm::vec3&)
+{
+}
+
+void Renderer::DrawOverlayLine(const glm::vec3&, const glm::vec3&, const glm::vec3&)
+{
+}
+
+void Renderer::DrawBox(const glm::vec3&, const glm::vec3&, const glm::vec3&, const MaterialParams&)
+{
+}
+
+void Renderer::DrawOrientedBox(const glm::vec3&, const glm::vec3&, const glm::vec3&, const glm::vec3&, const MaterialParams&)
+{
+}
+
+void Renderer::DrawCapsule(const glm::vec3&, float, float, const glm::vec3&, const MaterialParams&)
+{
+}
+
+void Renderer::DrawMesh(const MeshGeometry&, const glm::vec3&, const glm::vec3&, const glm::vec3&, const glm::vec3&, const MaterialParams&)
+{
+}
+
+void Renderer::DrawTexturedMesh(
+    const MeshGeometry&,
+    const glm::vec3&,
+    const glm::vec3&,
+    const glm::vec3&,
+    const glm::vec3&,
+    const MaterialParams&,
+    unsigned int
+)
+{
+}
+
+void Renderer::DrawGrid(int, float, const glm::vec3&, const glm::vec3&, const glm::vec4&)
+{
+}
+
+void Renderer::DrawCircle(const glm::vec3&, float, int, const glm::vec3&, bool)
+{
+}
+
+void Renderer::DrawBillboards(const BillboardData*, std::size_t, const glm::vec3&)
+{
+}
+
+Renderer::GpuMeshId Renderer::UploadMesh(const MeshGeometry&, const glm::vec3&, const MaterialParams&, GpuVertexFormat)
+{
+    return kInvalidGpuMesh;
+}
+
+void Renderer::DrawGpuMesh(GpuMeshId, const glm::mat4&)
+{
+}
+
+void Renderer::DrawSolidRanges(unsigned int, const int*, const int*, std::size_t)
+{
+}
+
+void Renderer::RecordPass(PassFn, void*, const void*, std::size_t)
+{
+}
+
+void Renderer::FreeGpuMesh(GpuMeshId)
+{
+}
+
+void Renderer::FreeAllGpuMeshes()
+{
+}
+
+StaticBatcher::StaticBatcher() = default;
+
+StaticBatcher::~StaticBatcher() = default;
+
+void StaticBatcher::BeginBuild()
+{
+}
+
+void StaticBatcher::AddBox(const glm::vec3&, const glm::vec3&, const glm::vec3&)
+{
+}
+
+void StaticBatcher::EndBuild()
+{
+    m_built = true;
+}
+
+void StaticBatcher::Render(Renderer&, const Frustum&, const OcclusionCuller*)
+{
+}
+
+void StaticBatcher::Clear()
+{
+    m_built = false;
+}
+} // namespace engine::render
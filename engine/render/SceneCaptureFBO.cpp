@@ -1,4 +1,6 @@
 #include "SceneCaptureFBO.hpp"
+#include "RenderThread.hpp"
+#include <cassert>
 #include <cstdio>
 
 namespace engine::render
@@ -6,6 +8,7 @@ namespace engine::render
 
 void SceneCaptureFBO::Create(int w, int h)
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     if (valid)
     {
         Destroy();
@@ -64,6 +67,7 @@ void SceneCaptureFBO::AttachTextures()
 
 void SceneCaptureFBO::Destroy()
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     if (colorTex != 0)
     {
         glDeleteTextures(1, &colorTex);
@@ -86,6 +90,7 @@ void SceneCaptureFBO::Destroy()
 
 void SceneCaptureFBO::Resize(int w, int h)
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     if (w == width && h == height && valid)
     {
         return;
@@ -122,17 +127,20 @@ void SceneCaptureFBO::Resize(int w, int h)
 
 void SceneCaptureFBO::Bind() const
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     glBindFramebuffer(GL_FRAMEBUFFER, fbo);
     glViewport(0, 0, width, height);
 }
 
 void SceneCaptureFBO::Unbind() const
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
 void SceneCaptureFBO::BlitToScreen(int screenW, int screenH) const
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
     glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
     glBlitFramebuffer(0, 0, width, height, 0, 0, screenW, screenH, GL_COLOR_BUFFER_BIT, GL_LINEAR);
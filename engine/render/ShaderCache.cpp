@@ -0,0 +1,235 @@
+#include "engine/render/ShaderCache.hpp"
+
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "engine/assets/ContentHash.hpp"
+#include "engine/assets/MappedFile.hpp"
+#include "engine/render/RenderThread.hpp"
+
+namespace engine::render
+{
+namespace
+{
+constexpr std::uint32_t kCacheVersion = 1;
+
+struct BinaryHeader
+{
+    char magic[4] = {'G', 'L', 'P', 'B'};
+    std::uint32_t version = kCacheVersion;
+    std::uint32_t format = 0;
+    std::uint32_t size = 0;
+    std::uint64_t key = 0;
+};
+
+struct CacheState
+{
+    bool enabled = false;
+    std::uint64_t driverHash = 0;
+    std::filesystem::path directory;
+    ShaderCache::Stats stats;
+};
+
+CacheState& State()
+{
+    static CacheState state;
+    return state;
+}
+
+std::filesystem::path UserCacheDirectory()
+{
+#if defined(_WIN32)
+    if (const char* localAppData = std::getenv("LOCALAPPDATA"); localAppData != nullptr && *localAppData != '\0')
+    {
+        return std::filesystem::path(localAppData) / "AsymHorror" / "shader_cache";
+    }
+#else
+    if (const char* xdgCache = std::getenv("XDG_CACHE_HOME"); xdgCache != nullptr && *xdgCache != '\0')
+    {
+        return std::filesystem::path(xdgCache) / "asym_horror" / "shader_cache";
+    }
+    if (const char* home = std::getenv("HOME"); home != nullptr && *home != '\0')
+    {
+        return std::filesystem::path(home) / ".cache" / "asym_horror" / "shader_cache";
+    }
+#endif
+    return std::filesystem::path("cache") / "shader_cache";
+}
+
+std::string GlString(GLenum name)
+{
+    const GLubyte* value = glGetString(name);
+    return value != nullptr ? reinterpret_cast<const char*>(value) : "";
+}
+
+std::uint64_t ProgramKey(const char* vertexSource, const char* fragmentSource)
+{
+    std::uint64_t hash = engine::assets::ContentHash(&State().driverHash, sizeof(std::uint64_t));
+    hash = engine::assets::ContentHash(vertexSource, std::strlen(vertexSource) + 1, hash);
+    return engine::assets::ContentHash(fragmentSource, std::strlen(fragmentSource) + 1, hash);
+}
+
+std::filesystem::path EntryPath(std::uint64_t key)
+{
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << key << ".glbin";
+    return State().directory / name.str();
+}
+
+unsigned int LoadProgram(std::uint64_t key)
+{
+    const std::filesystem::path path = EntryPath(key);
+    engine::assets::MappedFile file;
+    if (!file.Open(path) || file.Size() < sizeof(BinaryHeader))
+    {
+        return 0;
+    }
+    BinaryHeader header;
+    std::memcpy(&header, file.Data(), sizeof(header));
+    const BinaryHeader expected;
+    if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 || header.version != kCacheVersion ||
+        header.key != key || header.size != file.Size() - sizeof(BinaryHeader))
+    {
+        return 0;
+    }
+
+    const GLuint program = glCreateProgram();
+    glProgramBinary(program, header.format, file.Data() + sizeof(BinaryHeader), static_cast<GLsizei>(header.size));
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (linked == GL_TRUE)
+    {
+        return program;
+    }
+
+    // The driver refused the binary (e.g. an update kept the version string); recompile and replace it.
+    glDeleteProgram(program);
+    file.Close();
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    return 0;
+}
+
+void StoreProgram(unsigned int program, std::uint64_t key)
+{
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+    {
+        return;
+    }
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0)
+    {
+        return;
+    }
+
+    BinaryHeader header;
+    header.format = format;
+    header.size = static_cast<std::uint32_t>(written);
+    header.key = key;
+    const std::filesystem::path path = EntryPath(key);
+    const std::filesystem::path tempPath = path.string() + ".tmp";
+    {
+        std::ofstream stream(tempPath, std::ios::binary | std::ios::trunc);
+        if (!stream.is_open())
+        {
+            return;
+        }
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(binary.data(), written);
+        if (!stream)
+        {
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempPath, ec);
+    }
+}
+} // namespace
+
+void ShaderCache::Initialize()
+{
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
+    CacheState& state = State();
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if (formatCount <= 0)
+    {
+        std::cout << "[SHADER CACHE] Driver exposes no program binary formats; shaders compile from source\n";
+        return;
+    }
+
+    const std::string driver = GlString(GL_VENDOR) + "|" + GlString(GL_RENDERER) + "|" + GlString(GL_VERSION) + "|" +
+                               GlString(GL_SHADING_LANGUAGE_VERSION);
+    state.driverHash = engine::assets::ContentHash(driver.data(), driver.size());
+    state.directory = UserCacheDirectory();
+    std::error_code ec;
+    std::filesystem::create_directories(state.directory, ec);
+    state.enabled = !ec;
+    std::cout << "[SHADER CACHE] " << (state.enabled ? "Using " : "Cannot create ") << state.directory.generic_string() << "\n";
+}
+
+unsigned int ShaderCache::CreateProgram(
+    const char* vertexSource,
+    const char* fragmentSource,
+    const std::function<unsigned int()>& compileFromSource)
+{
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
+    CacheState& state = State();
+    const auto start = std::chrono::steady_clock::now();
+    const std::uint64_t key = state.enabled ? ProgramKey(vertexSource, fragmentSource) : 0;
+
+    unsigned int program = state.enabled ? LoadProgram(key) : 0;
+    if (program != 0)
+    {
+        ++state.stats.cacheHits;
+    }
+    else
+    {
+        program = compileFromSource();
+        if (program != 0)
+        {
+            ++state.stats.compiled;
+            if (state.enabled)
+            {
+                StoreProgram(program, key);
+            }
+        }
+    }
+    state.stats.milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return program;
+}
+
+void ShaderCache::PrepareForStore(unsigned int program)
+{
+    if (State().enabled)
+    {
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+}
+
+ShaderCache::Stats ShaderCache::GetStats()
+{
+    return State().stats;
+}
+} // namespace engine::render
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <functional>
+
+namespace engine::render
+{
+/// On-disk cache of linked GL program binaries (glGetProgramBinary / glProgramBinary). Entries are
+/// keyed by the driver identity (GL vendor, renderer, version) and the shader sources, and live in the
+/// user cache directory: %LOCALAPPDATA%/AsymHorror/shader_cache on Windows, otherwise
+/// $XDG_CACHE_HOME/asym_horror/shader_cache (~/.cache/...). A miss, a driver update or a binary the
+/// driver rejects falls back to compiling from source and refreshes the entry.
+class ShaderCache
+{
+public:
+    struct Stats
+    {
+        int cacheHits = 0;
+        int compiled = 0;
+        double milliseconds = 0.0; // total time spent creating programs, cached or compiled
+    };
+
+    /// Reads the driver identity and creates the cache directory. Call once the GL context is current;
+    /// until then (or if the driver exposes no binary formats) every program compiles from source.
+    static void Initialize();
+
+    /// Linked program for this source pair, from the cache when possible. compileFromSource is the
+    /// caller's usual compile + link path; it should call PrepareForStore before glLinkProgram.
+    [[nodiscard]] static unsigned int CreateProgram(
+        const char* vertexSource,
+        const char* fragmentSource,
+        const std::function<unsigned int()>& compileFromSource);
+
+    /// Asks the driver to keep the program binary retrievable; a no-op when caching is off.
+    static void PrepareForStore(unsigned int program);
+
+    [[nodiscard]] static Stats GetStats();
+};
+} // namespace engine::render
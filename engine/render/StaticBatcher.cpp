@@ -1,16 +1,17 @@
 #include "engine/render/StaticBatcher.hpp"
-#include "engine/core/JobSystem.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <cmath>
-#include <atomic>
 
 #include <glad/glad.h>
 
 #include <glm/common.hpp>
-#include <glm/gtc/type_ptr.hpp>
 
 #include "engine/core/Profiler.hpp"
+#include "engine/render/OcclusionCuller.hpp"
+#include "engine/render/RenderThread.hpp"
+#include "engine/render/Renderer.hpp"
 
 namespace engine::render
 {
@@ -24,18 +25,36 @@ StaticBatcher::~StaticBatcher()
 void StaticBatcher::BeginBuild()
 {
     m_buildVertices.clear();
-    m_chunks.clear();
+    m_pendingBoxes.clear();
+    m_clusters.clear();
+    m_groups.clear();
+    m_clusterBounds.Clear();
+    m_clusterVisible.clear();
+    m_lastClusterVisible.clear();
     m_cachedFirsts.clear();
     m_cachedCounts.clear();
     m_built = false;
     m_vertexCount = 0;
     m_visibleCount = 0;
+    m_visibleClusters = 0;
 }
 
 void StaticBatcher::AddBox(const glm::vec3& center, const glm::vec3& halfExtents, const glm::vec3& color)
 {
-    const glm::vec3 min = center - halfExtents;
-    const glm::vec3 max = center + halfExtents;
+    PendingBox box;
+    box.center = center;
+    box.halfExtents = halfExtents;
+    box.color = color;
+    box.cellX = static_cast<int>(std::floor(center.x / kClusterSize));
+    box.cellZ = static_cast<int>(std::floor(center.z / kClusterSize));
+    m_pendingBoxes.push_back(box);
+}
+
+void StaticBatcher::EmitBox(const PendingBox& box)
+{
+    const glm::vec3 min = box.center - box.halfExtents;
+    const glm::vec3 max = box.center + box.halfExtents;
+    const glm::vec3& color = box.color;
 
     const glm::vec3 c000 = min;
     const glm::vec3 c001 = glm::vec3{min.x, min.y, max.z};
@@ -85,23 +104,90 @@ void StaticBatcher::AddBox(const glm::vec3& center, const glm::vec3& halfExtents
 
     emitTri(c010, c011, c111, glm::vec3{0.0F, 1.0F, 0.0F});
     emitTri(c010, c111, c110, glm::vec3{0.0F, 1.0F, 0.0F});
-
-    BatchChunk chunk;
-    chunk.firstVertex = m_chunks.empty() ? 0 : (m_chunks.back().firstVertex + m_chunks.back().vertexCount);
-    chunk.vertexCount = kVerticesPerBox;
-    chunk.boundsMin = min;
-    chunk.boundsMax = max;
-    m_chunks.push_back(chunk);
 }
 
 void StaticBatcher::EndBuild()
 {
-    if (m_buildVertices.empty())
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
+    if (m_pendingBoxes.empty())
     {
         m_built = true;
         return;
     }
 
+    // Order boxes by group, then cluster, so both levels are contiguous vertex ranges.
+    auto floorDiv = [](int value, int divisor) {
+        return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+    };
+    std::stable_sort(m_pendingBoxes.begin(), m_pendingBoxes.end(), [&](const PendingBox& a, const PendingBox& b) {
+        const int agx = floorDiv(a.cellX, kGroupCells);
+        const int agz = floorDiv(a.cellZ, kGroupCells);
+        const int bgx = floorDiv(b.cellX, kGroupCells);
+        const int bgz = floorDiv(b.cellZ, kGroupCells);
+        if (agx != bgx)
+        {
+            return agx < bgx;
+        }
+        if (agz != bgz)
+        {
+            return agz < bgz;
+        }
+        if (a.cellX != b.cellX)
+        {
+            return a.cellX < b.cellX;
+        }
+        return a.cellZ < b.cellZ;
+    });
+
+    m_buildVertices.reserve(m_pendingBoxes.size() * kVerticesPerBox * 13);
+    for (std::size_t i = 0; i < m_pendingBoxes.size(); ++i)
+    {
+        const PendingBox& box = m_pendingBoxes[i];
+        const glm::vec3 boxMin = box.center - box.halfExtents;
+        const glm::vec3 boxMax = box.center + box.halfExtents;
+        const bool newCluster = i == 0 || box.cellX != m_pendingBoxes[i - 1].cellX || box.cellZ != m_pendingBoxes[i - 1].cellZ;
+        const bool newGroup = i == 0 ||
+                              floorDiv(box.cellX, kGroupCells) != floorDiv(m_pendingBoxes[i - 1].cellX, kGroupCells) ||
+                              floorDiv(box.cellZ, kGroupCells) != floorDiv(m_pendingBoxes[i - 1].cellZ, kGroupCells);
+
+        if (newGroup)
+        {
+            ClusterGroup group;
+            group.firstCluster = m_clusters.size();
+            group.boundsMin = boxMin;
+            group.boundsMax = boxMax;
+            m_groups.push_back(group);
+        }
+        if (newCluster)
+        {
+            Cluster cluster;
+            cluster.firstVertex = m_buildVertices.size() / 13;
+            cluster.boundsMin = boxMin;
+            cluster.boundsMax = boxMax;
+            m_clusters.push_back(cluster);
+            ++m_groups.back().clusterCount;
+        }
+
+        EmitBox(box);
+        Cluster& cluster = m_clusters.back();
+        cluster.vertexCount += kVerticesPerBox;
+        cluster.boundsMin = glm::min(cluster.boundsMin, boxMin);
+        cluster.boundsMax = glm::max(cluster.boundsMax, boxMax);
+        ClusterGroup& group = m_groups.back();
+        group.boundsMin = glm::min(group.boundsMin, boxMin);
+        group.boundsMax = glm::max(group.boundsMax, boxMax);
+    }
+    m_pendingBoxes.clear();
+    m_pendingBoxes.shrink_to_fit();
+    m_clusterBounds.Clear();
+    m_clusterBounds.Reserve(m_clusters.size());
+    for (const Cluster& cluster : m_clusters)
+    {
+        m_clusterBounds.Add(cluster.boundsMin, cluster.boundsMax);
+    }
+    m_clusterVisible.assign(m_clusters.size(), 0);
+    m_lastClusterVisible.clear();
+
     if (m_vao == 0)
     {
         glGenVertexArrays(1, &m_vao);
@@ -137,100 +223,105 @@ void StaticBatcher::EndBuild()
     m_built = true;
 }
 
-void StaticBatcher::Render(
-    const glm::mat4& viewProjection,
-    const Frustum& frustum,
-    unsigned int shaderProgram,
-    int viewProjLocation,
-    int modelLocation
-)
+void StaticBatcher::RebuildDrawRanges()
 {
-    if (!m_built || m_vao == 0 || m_chunks.empty())
+    m_cachedFirsts.clear();
+    m_cachedCounts.clear();
+    m_visibleCount = 0;
+    m_visibleClusters = 0;
+
+    std::size_t previousEnd = static_cast<std::size_t>(-1);
+    for (std::size_t i = 0; i < m_clusters.size(); ++i)
+    {
+        if (m_clusterVisible[i] == 0)
+        {
+            continue;
+        }
+
+        const Cluster& cluster = m_clusters[i];
+        if (cluster.firstVertex == previousEnd)
+        {
+            m_cachedCounts.back() += static_cast<int>(cluster.vertexCount);
+        }
+        else
+        {
+            m_cachedFirsts.push_back(static_cast<int>(cluster.firstVertex));
+            m_cachedCounts.push_back(static_cast<int>(cluster.vertexCount));
+        }
+        previousEnd = cluster.firstVertex + cluster.vertexCount;
+        m_visibleCount += cluster.vertexCount;
+        ++m_visibleClusters;
+    }
+}
+
+void StaticBatcher::Render(Renderer& renderer, const Frustum& frustum, const OcclusionCuller* occlusion)
+{
+    if (!m_built || m_vao == 0 || m_clusters.empty())
     {
         return;
     }
 
-    m_visibleCount = 0;
-    m_cachedFirsts.clear();
-    m_cachedCounts.clear();
-    m_cachedFirsts.reserve(m_chunks.size());
-    m_cachedCounts.reserve(m_chunks.size());
-
-    // Use parallel culling for large chunk counts
-    const std::size_t chunkCount = m_chunks.size();
-    auto& jobSystem = engine::core::JobSystem::Instance();
-    
-    if (jobSystem.IsInitialized() && jobSystem.IsEnabled() && chunkCount > 256)
+    // Two-level cull: a group fully inside or outside decides all of its clusters at once; the
+    // clusters of straddling groups are batch-tested. Occlusion follows the same hierarchy: a hidden
+    // group hides all of its clusters.
+    std::fill(m_clusterVisible.begin(), m_clusterVisible.end(), std::uint8_t{0});
+    m_visibleScratch.clear();
+    for (const ClusterGroup& group : m_groups)
     {
-        // Parallel culling
-        std::vector<std::int8_t> visibleFlags(chunkCount, 0);
-        engine::core::JobCounter cullCounter;
-        
-        jobSystem.ParallelFor(chunkCount, 64, [&frustum, &visibleFlags, this](std::size_t idx) {
-            const auto& chunk = m_chunks[idx];
-            if (frustum.IntersectsAABB(chunk.boundsMin, chunk.boundsMax))
-            {
-                visibleFlags[idx] = 1;
-            }
-        }, engine::core::JobPriority::High, &cullCounter);
-        
-        jobSystem.WaitForCounter(cullCounter);
-        
-        // Collect visible chunks
-        for (std::size_t i = 0; i < chunkCount; ++i)
+        Frustum::Containment containment = frustum.ClassifyAABB(group.boundsMin, group.boundsMax);
+        if (containment != Frustum::Containment::Outside && occlusion != nullptr &&
+            occlusion->IsOccluded(group.boundsMin, group.boundsMax))
+        {
+            containment = Frustum::Containment::Outside;
+        }
+        if (containment == Frustum::Containment::Inside)
         {
-            if (visibleFlags[i])
+            for (std::size_t c = group.firstCluster; c < group.firstCluster + group.clusterCount; ++c)
             {
-                m_cachedFirsts.push_back(static_cast<GLint>(m_chunks[i].firstVertex));
-                m_cachedCounts.push_back(static_cast<GLsizei>(m_chunks[i].vertexCount));
-                m_visibleCount += m_chunks[i].vertexCount;
+                m_visibleScratch.push_back(static_cast<std::uint32_t>(c));
             }
         }
+        else if (containment == Frustum::Containment::Intersecting)
+        {
+            frustum.CullBatch(m_clusterBounds, m_visibleScratch, group.firstCluster, group.firstCluster + group.clusterCount);
+        }
     }
-    else
+    for (const std::uint32_t c : m_visibleScratch)
     {
-        // Sequential culling (fallback)
-        for (const auto& chunk : m_chunks)
+        const Cluster& cluster = m_clusters[c];
+        if (occlusion == nullptr || !occlusion->IsOccluded(cluster.boundsMin, cluster.boundsMax))
         {
-            if (frustum.IntersectsAABB(chunk.boundsMin, chunk.boundsMax))
-            {
-                m_cachedFirsts.push_back(static_cast<GLint>(chunk.firstVertex));
-                m_cachedCounts.push_back(static_cast<GLsizei>(chunk.vertexCount));
-                m_visibleCount += chunk.vertexCount;
-            }
+            m_clusterVisible[c] = 1;
         }
     }
 
-    if (m_cachedFirsts.empty())
+    // Camera moved within the same visible cluster set: keep last frame's ranges.
+    const bool reused = m_clusterVisible == m_lastClusterVisible;
+    if (!reused)
     {
-        return;
+        RebuildDrawRanges();
+        m_lastClusterVisible = m_clusterVisible;
     }
 
-    glUseProgram(shaderProgram);
-    glUniformMatrix4fv(viewProjLocation, 1, GL_FALSE, glm::value_ptr(viewProjection));
-    if (modelLocation >= 0)
+    auto& profiler = engine::core::Profiler::Instance();
+    profiler.StatsMut().staticBatchChunksVisible = static_cast<std::uint32_t>(m_visibleClusters);
+    profiler.StatsMut().staticBatchChunksTotal = static_cast<std::uint32_t>(m_clusters.size());
+    profiler.StatsMut().staticBatchDrawRanges = static_cast<std::uint32_t>(m_cachedFirsts.size());
+    profiler.StatsMut().staticBatchRangesReused = reused;
+
+    if (m_cachedFirsts.empty())
     {
-        const glm::mat4 identity{1.0F};
-        glUniformMatrix4fv(modelLocation, 1, GL_FALSE, glm::value_ptr(identity));
+        return;
     }
 
-    glBindVertexArray(m_vao);
-    glMultiDrawArrays(
-        GL_TRIANGLES,
-        m_cachedFirsts.data(),
-        m_cachedCounts.data(),
-        static_cast<GLsizei>(m_cachedFirsts.size())
-    );
-
-    // Record stats in profiler.
-    auto& profiler = engine::core::Profiler::Instance();
+    // Recorded by the renderer so the draw sees this frame's uniform and light uploads.
+    renderer.DrawSolidRanges(m_vao, m_cachedFirsts.data(), m_cachedCounts.data(), m_cachedFirsts.size());
     profiler.RecordDrawCall(static_cast<std::uint32_t>(m_visibleCount), static_cast<std::uint32_t>(m_visibleCount / 3));
-    profiler.StatsMut().staticBatchChunksVisible = static_cast<std::uint32_t>(m_cachedFirsts.size());
-    profiler.StatsMut().staticBatchChunksTotal = static_cast<std::uint32_t>(m_chunks.size());
 }
 
 void StaticBatcher::Clear()
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     if (m_vbo != 0)
     {
         glDeleteBuffers(1, &m_vbo);
@@ -242,11 +333,17 @@ void StaticBatcher::Clear()
         m_vao = 0;
     }
     m_buildVertices.clear();
-    m_chunks.clear();
+    m_pendingBoxes.clear();
+    m_clusters.clear();
+    m_groups.clear();
+    m_clusterBounds.Clear();
+    m_clusterVisible.clear();
+    m_lastClusterVisible.clear();
     m_cachedFirsts.clear();
     m_cachedCounts.clear();
     m_vertexCount = 0;
     m_visibleCount = 0;
+    m_visibleClusters = 0;
     m_built = false;
 }
 }
@@ -3,17 +3,19 @@
 #include <cstdint>
 #include <vector>
 
-#include <glm/mat4x4.hpp>
 #include <glm/vec3.hpp>
 
-#include <glad/glad.h>
-
 #include "engine/render/Frustum.hpp"
 
 namespace engine::render
 {
+class OcclusionCuller;
+class Renderer;
 struct SolidVertex;
 
+/// Static world boxes merged into one VBO. Boxes are grouped into XZ grid clusters (one map tile)
+/// and clusters into groups of kGroupCells x kGroupCells; both are contiguous in the buffer, so a
+/// visible group or run of clusters is a single multi-draw range.
 class StaticBatcher
 {
 public:
@@ -24,15 +26,28 @@ public:
     void AddBox(const glm::vec3& center, const glm::vec3& halfExtents, const glm::vec3& color);
     void EndBuild();
 
-    void Render(const glm::mat4& viewProjection, const Frustum& frustum, unsigned int shaderProgram, int viewProjLocation, int modelLocation = -1);
+    /// Culls against the frustum and queues the visible ranges on the renderer for this frame.
+    /// occlusion (optional) additionally hides groups and clusters behind this frame's occluders.
+    void Render(Renderer& renderer, const Frustum& frustum, const OcclusionCuller* occlusion = nullptr);
     void Clear();
 
     [[nodiscard]] bool IsBuilt() const { return m_built; }
     [[nodiscard]] std::size_t VertexCount() const { return m_vertexCount; }
     [[nodiscard]] std::size_t VisibleCount() const { return m_visibleCount; }
+    [[nodiscard]] std::size_t ClusterCount() const { return m_clusters.size(); }
+    [[nodiscard]] std::size_t DrawRangeCount() const { return m_cachedFirsts.size(); }
 
 private:
-    struct BatchChunk
+    struct PendingBox
+    {
+        glm::vec3 center{};
+        glm::vec3 halfExtents{};
+        glm::vec3 color{};
+        int cellX = 0;
+        int cellZ = 0;
+    };
+
+    struct Cluster
     {
         std::size_t firstVertex = 0;
         std::size_t vertexCount = 0;
@@ -40,16 +55,37 @@ private:
         glm::vec3 boundsMax{};
     };
 
+    struct ClusterGroup
+    {
+        std::size_t firstCluster = 0;
+        std::size_t clusterCount = 0;
+        glm::vec3 boundsMin{};
+        glm::vec3 boundsMax{};
+    };
+
+    void EmitBox(const PendingBox& box);
+    void RebuildDrawRanges();
+
     unsigned int m_vao = 0;
     unsigned int m_vbo = 0;
     std::vector<float> m_buildVertices;
-    std::vector<BatchChunk> m_chunks;
-    std::vector<GLint> m_cachedFirsts;
-    std::vector<GLsizei> m_cachedCounts;
+    std::vector<PendingBox> m_pendingBoxes;
+    std::vector<Cluster> m_clusters;
+    std::vector<ClusterGroup> m_groups;
+    AabbBatch m_clusterBounds;                     // cluster bounds in SoA form for Frustum::CullBatch
+    std::vector<std::uint32_t> m_visibleScratch;
+    // Per-cluster visibility of the last frame; the draw ranges are only rebuilt when it changes.
+    std::vector<std::uint8_t> m_clusterVisible;
+    std::vector<std::uint8_t> m_lastClusterVisible;
+    std::vector<int> m_cachedFirsts;   // glMultiDrawArrays firsts/counts
+    std::vector<int> m_cachedCounts;
     std::size_t m_vertexCount = 0;
     std::size_t m_visibleCount = 0;
+    std::size_t m_visibleClusters = 0;
     bool m_built = false;
 
     static constexpr std::size_t kVerticesPerBox = 36;
+    static constexpr float kClusterSize = 16.0F; // one generated map tile
+    static constexpr int kGroupCells = 4;
 };
 }
@@ -1,5 +1,8 @@
 #include "WraithCloakRenderer.hpp"
+#include "RenderThread.hpp"
+#include "ShaderCache.hpp"
 #include <glm/gtc/type_ptr.hpp>
+#include <cassert>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
@@ -149,6 +152,7 @@ void main()
 
 bool WraithCloakRenderer::Initialize()
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     if (m_initialized)
     {
         return true;
@@ -236,6 +240,7 @@ bool WraithCloakRenderer::Initialize()
 
 void WraithCloakRenderer::Shutdown()
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     if (m_program != 0)
     {
         glDeleteProgram(m_program);
@@ -277,22 +282,25 @@ void WraithCloakRenderer::Shutdown()
 
 bool WraithCloakRenderer::CreateShader()
 {
-    const GLuint vs = CompileShader(GL_VERTEX_SHADER, kWraithCloakVertexShader);
-    if (vs == 0)
-    {
-        return false;
-    }
+    m_program = ShaderCache::CreateProgram(kWraithCloakVertexShader, kWraithCloakFragmentShader, [this]() -> unsigned int {
+        const GLuint vs = CompileShader(GL_VERTEX_SHADER, kWraithCloakVertexShader);
+        if (vs == 0)
+        {
+            return 0;
+        }
 
-    const GLuint fs = CompileShader(GL_FRAGMENT_SHADER, kWraithCloakFragmentShader);
-    if (fs == 0)
-    {
-        glDeleteShader(vs);
-        return false;
-    }
+        const GLuint fs = CompileShader(GL_FRAGMENT_SHADER, kWraithCloakFragmentShader);
+        if (fs == 0)
+        {
+            glDeleteShader(vs);
+            return 0;
+        }
 
-    m_program = LinkProgram(vs, fs);
-    glDeleteShader(vs);
-    glDeleteShader(fs);
+        const GLuint program = LinkProgram(vs, fs);
+        glDeleteShader(vs);
+        glDeleteShader(fs);
+        return program;
+    });
 
     if (m_program == 0)
     {
@@ -348,6 +356,7 @@ GLuint WraithCloakRenderer::LinkProgram(GLuint vs, GLuint fs) const
     const GLuint program = glCreateProgram();
     glAttachShader(program, vs);
     glAttachShader(program, fs);
+    ShaderCache::PrepareForStore(program);
     glLinkProgram(program);
 
     GLint success = 0;
@@ -442,6 +451,7 @@ bool WraithCloakRenderer::CreateSceneTexture()
 
 void WraithCloakRenderer::CaptureBackbuffer()
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     if (m_sceneTex == 0 || m_screenW <= 0 || m_screenH <= 0)
     {
         return;
@@ -454,8 +464,13 @@ void WraithCloakRenderer::CaptureBackbuffer()
 
 void WraithCloakRenderer::SetScreenSize(int w, int h)
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     m_screenW = w;
     m_screenH = h;
+    if (!m_initialized)
+    {
+        return; // Initialize creates the scene texture at this size
+    }
 
     // Recreate scene texture if size changed
     if (m_sceneTex != 0)
@@ -468,6 +483,7 @@ void WraithCloakRenderer::SetScreenSize(int w, int h)
 
 void WraithCloakRenderer::Render(const glm::mat4& viewProj, const glm::mat4& model, const glm::vec3& cameraPos, const glm::vec3& wraithPos, float capsuleHeight, float capsuleRadius, const WraithCloakParams& params)
 {
+    assert(RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     if (!m_initialized || params.cloakAmount <= 0.001F)
     {
         return;
@@ -321,7 +321,31 @@ void ProfilerOverlay::DrawRenderStats([[maybe_unused]] engine::core::Profiler& p
     ImGui::TextColored(ImVec4(0.8F, 0.8F, 1.0F, 1.0F), "Culling & Batching");
     ImGui::Separator();
     
-    ImGui::Text("Static Batch Chunks: %u / %u visible", stats.staticBatchChunksVisible, stats.staticBatchChunksTotal);
+    ImGui::Text("Static Batch Clusters: %u / %u visible", stats.staticBatchChunksVisible, stats.staticBatchChunksTotal);
+    ImGui::Text("Static Batch Draw Ranges: %u%s", stats.staticBatchDrawRanges, stats.staticBatchRangesReused ? " (reused)" : "");
+    ImGui::Text("Occlusion: %u occluders (%u tris, %.2f ms), %u / %u culled",
+                stats.occlusionOccluders, stats.occlusionTriangles, stats.occlusionRasterMs,
+                stats.occlusionCulled, stats.occlusionTested);
+    ImGui::Text("Mesh LODs: %u full, %u reduced, %u boxes",
+                stats.meshLodFullDraws, stats.meshLodReducedDraws, stats.meshLodImpostors);
+    ImGui::Text("Mesh Uploads: %u done, %u queued (%.2f ms)",
+                stats.meshUploadsDone, stats.meshUploadsQueued, stats.meshUploadMs);
+    ImGui::Text("Assets: meshes %.1f MB (%u), textures %.1f MB (%u), %u pinned",
+                static_cast<double>(stats.assetMeshBytes) / (1024.0 * 1024.0), stats.assetMeshCount,
+                static_cast<double>(stats.assetTextureBytes) / (1024.0 * 1024.0), stats.assetTextureCount,
+                stats.assetReferencedCount);
+    ImGui::Text("Asset Budget: %.1f / %.0f MB, %u evicted",
+                static_cast<double>(stats.assetMeshBytes + stats.assetTextureBytes) / (1024.0 * 1024.0),
+                static_cast<double>(stats.assetBudgetBytes) / (1024.0 * 1024.0), stats.assetEvictedTotal);
+    ImGui::Text("Solid Instances: %u", stats.solidInstances);
+    ImGui::Text("Render Queue: %u items, %u state changes, %u draws merged",
+                stats.renderQueueItems, stats.renderStateChanges, stats.instancedDrawsMerged);
+    ImGui::Text("Uniform Blocks: %u / 2 uploaded", stats.uniformBlockUploads);
+    ImGui::Text("Light Clusters: %u lights, %u indices (max %u, %u full), %.2f ms",
+                stats.lightClusterLights, stats.lightClusterIndices, stats.lightClusterMaxPerCluster,
+                stats.lightClusterOverflow, stats.lightClusterBuildMs);
+    ImGui::Text("Render Execute: %.2f ms (%s), main wait %.2f ms",
+                stats.renderExecuteMs, stats.renderSubmitThreaded ? "render thread" : "inline", stats.renderWaitMs);
     if (stats.staticBatchChunksTotal > 0)
     {
         float visPct = (static_cast<float>(stats.staticBatchChunksVisible) / static_cast<float>(stats.staticBatchChunksTotal)) * 100.0F;
@@ -355,6 +379,10 @@ void ProfilerOverlay::DrawRenderStats([[maybe_unused]] engine::core::Profiler& p
     ImGui::Text("Lines:    %zu KB (%.1f%%)", stats.lineVboBytes / 1024,
                 100.0F * static_cast<float>(stats.lineVboBytes) / totalMemF);
     ImGui::Unindent();
+    ImGui::Text("GPU Meshes: %zu KB indexed (%zu KB as per-corner vertices)",
+                stats.gpuMeshBytes / 1024,
+                stats.gpuMeshUnweldedBytes / 1024);
+    ImGui::Text("Instance Buffer: %zu KB", stats.instanceVboBytes / 1024);
 #endif
 }
 
@@ -558,6 +586,8 @@ void ProfilerOverlay::DrawSystemTimings([[maybe_unused]] engine::core::Profiler&
 
         ImGui::EndTable();
     }
+    ImGui::Text("  Audio voices: %u active, %u virtual, %u stolen",
+                stats.audioVoicesActive, stats.audioVoicesVirtual, stats.audioVoicesStolen);
 
     ImGui::Separator();
     ImGui::TextColored(ImVec4(0.6F, 0.8F, 1.0F, 1.0F), "Profiled Sections (%zu):", sections.size());
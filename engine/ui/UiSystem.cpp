@@ -2,9 +2,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
 #include <cctype>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 
@@ -13,6 +15,7 @@
 #include <nlohmann/json.hpp>
 
 #include "engine/platform/Input.hpp"
+#include "engine/render/ShaderCache.hpp"
 
 #define STB_TRUETYPE_IMPLEMENTATION
 #include "external/stb/stb_truetype.h"
@@ -102,6 +105,7 @@ unsigned int CreateProgram(const char* vsSource, const char* fsSource)
     const unsigned int program = glCreateProgram();
     glAttachShader(program, vs);
     glAttachShader(program, fs);
+    engine::render::ShaderCache::PrepareForStore(program);
     glLinkProgram(program);
     glDeleteShader(vs);
     glDeleteShader(fs);
@@ -118,6 +122,28 @@ unsigned int CreateProgram(const char* vsSource, const char* fsSource)
     return 0;
 }
 
+// Recorded UI frame: the header sits at the list's constants offset, followed by one clip per
+// non-empty batch; vertices of all batches are packed back to back.
+struct UiFrameHeader
+{
+    int screenWidth = 0;
+    int screenHeight = 0;
+    unsigned int fontTexture = 0;
+    std::uint32_t verticesOffset = 0;
+    std::uint32_t vertexBytes = 0;
+    std::uint32_t clipsOffset = 0;
+    std::uint32_t clipCount = 0;
+};
+
+struct UiFrameClip
+{
+    int x = 0;
+    int y = 0;
+    int w = 0;
+    int h = 0;
+    std::uint32_t vertexCount = 0;
+};
+
 glm::vec4 JsonColor(const json& root, const char* key, const glm::vec4& fallback)
 {
     if (!root.contains(key) || !root[key].is_array() || root[key].size() != 4)
@@ -149,7 +175,10 @@ void UiSystem::Shutdown()
 
 bool UiSystem::InitializeRenderer()
 {
-    m_program = CreateProgram(kUiVertexShader, kUiFragmentShader);
+    assert(engine::render::RenderThread::CallingThreadOwnsContext() && "UI GL call without the context");
+    m_program = engine::render::ShaderCache::CreateProgram(kUiVertexShader, kUiFragmentShader, [] {
+        return CreateProgram(kUiVertexShader, kUiFragmentShader);
+    });
     if (m_program == 0)
     {
         return false;
@@ -176,6 +205,7 @@ bool UiSystem::InitializeRenderer()
 
 void UiSystem::ShutdownRenderer()
 {
+    assert(engine::render::RenderThread::CallingThreadOwnsContext() && "UI GL call without the context");
     if (m_fontTexture != 0)
     {
         glDeleteTextures(1, &m_fontTexture);
@@ -218,6 +248,7 @@ std::vector<std::string> UiSystem::CandidateFontPaths(const std::string& request
 
 bool UiSystem::LoadFontFromPath(const std::string& path)
 {
+    assert(engine::render::RenderThread::CallingThreadOwnsContext() && "UI GL call without the context");
     std::ifstream stream(path, std::ios::binary);
     if (!stream.is_open())
     {
@@ -523,55 +554,82 @@ void UiSystem::BeginFrame(const BeginFrameArgs& args)
 
 void UiSystem::EndFrame()
 {
+    m_renderList.Reset();
+
+    std::size_t totalVertices = 0;
+    std::uint32_t clipCount = 0;
+    for (const DrawBatch& batch : m_batches)
+    {
+        totalVertices += batch.vertices.size();
+        clipCount += batch.vertices.empty() ? 0U : 1U;
+    }
+
+    UiFrameHeader header;
+    header.screenWidth = m_screenWidth;
+    header.screenHeight = m_screenHeight;
+    header.fontTexture = m_fontTexture;
+    header.vertexBytes = static_cast<std::uint32_t>(totalVertices * sizeof(QuadVertex));
+    header.verticesOffset = m_renderList.arena.Allocate(header.vertexBytes);
+    header.clipsOffset = m_renderList.arena.Allocate(clipCount * sizeof(UiFrameClip));
+    header.clipCount = clipCount;
+
+    auto* vertices = static_cast<std::byte*>(m_renderList.arena.At(header.verticesOffset));
+    auto* clips = static_cast<UiFrameClip*>(m_renderList.arena.At(header.clipsOffset));
+    for (const DrawBatch& batch : m_batches)
+    {
+        if (batch.vertices.empty())
+        {
+            continue;
+        }
+        const std::size_t bytes = batch.vertices.size() * sizeof(QuadVertex);
+        std::memcpy(vertices, batch.vertices.data(), bytes);
+        vertices += bytes;
+        *clips++ = UiFrameClip{batch.clip.x, batch.clip.y, batch.clip.w, batch.clip.h, static_cast<std::uint32_t>(batch.vertices.size())};
+    }
+    m_renderList.constantsOffset = m_renderList.arena.Push(&header, sizeof(header));
+
+    engine::render::RenderThread::Instance().Submit(m_renderList, &UiSystem::ExecuteRenderListThunk, this);
+
+    m_lastFrameFocusOrder = m_focusOrder;
+}
+
+void UiSystem::ExecuteRenderListThunk(void* user, const engine::render::RenderCommandList& list)
+{
+    static_cast<const UiSystem*>(user)->ExecuteRenderList(list);
+}
+
+void UiSystem::ExecuteRenderList(const engine::render::RenderCommandList& list) const
+{
+    const auto& header = *static_cast<const UiFrameHeader*>(list.arena.At(list.constantsOffset));
+
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glDisable(GL_DEPTH_TEST);
 
     glUseProgram(m_program);
-    glUniform2f(m_uniformScreenSize, static_cast<float>(m_screenWidth), static_cast<float>(m_screenHeight));
+    glUniform2f(m_uniformScreenSize, static_cast<float>(header.screenWidth), static_cast<float>(header.screenHeight));
     glUniform1i(m_uniformFontTexture, 0);
     glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, m_fontTexture);
+    glBindTexture(GL_TEXTURE_2D, header.fontTexture);
     glBindVertexArray(m_vao);
     glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
 
-    // Consolidate all batch vertices into one upload to reduce driver overhead.
-    std::size_t totalVertices = 0;
-    for (const DrawBatch& batch : m_batches)
+    if (header.vertexBytes > 0)
     {
-        totalVertices += batch.vertices.size();
-    }
-    if (totalVertices > 0)
-    {
-        // Upload all vertices in one glBufferData call.
-        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(totalVertices * sizeof(QuadVertex)), nullptr, GL_DYNAMIC_DRAW);
-        GLintptr offset = 0;
-        for (const DrawBatch& batch : m_batches)
-        {
-            if (!batch.vertices.empty())
-            {
-                glBufferSubData(GL_ARRAY_BUFFER, offset, static_cast<GLsizeiptr>(batch.vertices.size() * sizeof(QuadVertex)), batch.vertices.data());
-                offset += static_cast<GLintptr>(batch.vertices.size() * sizeof(QuadVertex));
-            }
-        }
+        // All batches were packed into one block at record time: a single upload per frame.
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(header.vertexBytes), list.arena.At(header.verticesOffset), GL_DYNAMIC_DRAW);
 
         // Draw each batch as a sub-range with its scissor rect.
+        const auto* clips = static_cast<const UiFrameClip*>(list.arena.At(header.clipsOffset));
         GLint vertexOffset = 0;
-        for (const DrawBatch& batch : m_batches)
+        for (std::uint32_t i = 0; i < header.clipCount; ++i)
         {
-            if (batch.vertices.empty())
-            {
-                continue;
-            }
-            const int sx = batch.clip.x;
-            const int syTop = batch.clip.y;
-            const int sw = batch.clip.w;
-            const int sh = batch.clip.h;
-            const int sy = m_screenHeight - (syTop + sh);
+            const UiFrameClip& clip = clips[i];
+            const int sy = header.screenHeight - (clip.y + clip.h);
             glEnable(GL_SCISSOR_TEST);
-            glScissor(sx, std::max(0, sy), sw, sh);
-            glDrawArrays(GL_TRIANGLES, vertexOffset, static_cast<GLsizei>(batch.vertices.size()));
-            vertexOffset += static_cast<GLint>(batch.vertices.size());
+            glScissor(clip.x, std::max(0, sy), clip.w, clip.h);
+            glDrawArrays(GL_TRIANGLES, vertexOffset, static_cast<GLsizei>(clip.vertexCount));
+            vertexOffset += static_cast<GLint>(clip.vertexCount);
         }
     }
 
@@ -581,8 +639,6 @@ void UiSystem::EndFrame()
     glBindTexture(GL_TEXTURE_2D, 0);
     glUseProgram(0);
     glEnable(GL_DEPTH_TEST);
-
-    m_lastFrameFocusOrder = m_focusOrder;
 }
 
 bool UiSystem::WantsInputCapture() const
@@ -10,6 +10,8 @@
 #include <glm/vec2.hpp>
 #include <glm/vec4.hpp>
 
+#include "engine/render/RenderThread.hpp"
+
 namespace engine::platform
 {
 class Input;
@@ -75,6 +77,8 @@ public:
     void Shutdown();
 
     void BeginFrame(const BeginFrameArgs& args);
+    /// Records the frame's batches and submits them after the scene; in threaded frames they draw on
+    /// the render thread.
     void EndFrame();
 
     [[nodiscard]] bool WantsInputCapture() const;
@@ -130,6 +134,9 @@ public:
     [[nodiscard]] float LineHeight(float fontScale = 1.0F) const;
 
 private:
+    static void ExecuteRenderListThunk(void* user, const engine::render::RenderCommandList& list);
+    void ExecuteRenderList(const engine::render::RenderCommandList& list) const;
+
     struct QuadVertex
     {
         float x = 0.0F;
@@ -277,6 +284,7 @@ private:
     bool m_mouseReleaseConsumed = false;
 
     std::vector<DrawBatch> m_batches;
+    engine::render::RenderCommandList m_renderList; // untouched until the next AcquireContext()
 
     unsigned int m_program = 0;
     unsigned int m_vbo = 0;
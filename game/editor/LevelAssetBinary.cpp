@@ -0,0 +1,728 @@
+#include "game/editor/LevelAssetBinary.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <span>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/assets/AssetPack.hpp"
+#include "engine/assets/MappedFile.hpp"
+
+namespace game::editor
+{
+namespace
+{
+constexpr std::uint32_t kMaxCount = 1U << 24U; // sanity cap for counts read from disk
+
+enum class BinaryKind : std::uint32_t
+{
+    Loop = 1,
+    Map = 2,
+    Prefab = 3,
+    Material = 4
+};
+
+struct FileHeader
+{
+    char magic[4] = {'L', 'V', 'L', 'B'};
+    std::uint32_t schemaVersion = LevelAssetBinary::kSchemaVersion;
+    std::uint32_t kind = 0;
+    std::int32_t assetVersion = kEditorAssetVersion;
+    std::uint64_t jsonHash = 0;
+};
+
+constexpr std::uint8_t kFlagLocked = 1U << 0U;
+constexpr std::uint8_t kFlagSolid = 1U << 1U;
+constexpr std::uint8_t kFlagAnimationLoop = 1U << 2U;
+constexpr std::uint8_t kFlagAnimationAutoplay = 1U << 3U;
+constexpr std::uint8_t kFlagManualBounds = 1U << 4U;
+constexpr std::uint8_t kFlagManualFootprint = 1U << 5U;
+constexpr std::uint8_t kFlagEnabled = 1U << 6U;
+
+// Strings are stored as indices into the file's string table.
+struct PropRecord
+{
+    std::uint32_t name = 0;
+    std::uint32_t meshAsset = 0;
+    std::uint32_t materialAsset = 0;
+    std::uint32_t prefabSource = 0;
+    std::uint32_t prefabInstance = 0;
+    std::uint32_t animationClip = 0;
+    std::uint8_t type = 0;
+    std::uint8_t colliderType = 0;
+    std::uint8_t flags = 0;
+    std::uint8_t reserved = 0;
+    float position[3] = {};
+    float halfExtents[3] = {};
+    float rotation[3] = {}; // pitch, yaw, roll degrees
+    float animationSpeed = 1.0F;
+    float colliderOffset[3] = {};
+    float colliderHalfExtents[3] = {};
+    float colliderRadius = 0.0F;
+    float colliderHeight = 0.0F;
+};
+
+struct LightRecord
+{
+    std::uint32_t name = 0;
+    std::uint8_t type = 0;
+    std::uint8_t flags = 0;
+    std::uint16_t reserved = 0;
+    float position[3] = {};
+    float rotationEuler[3] = {};
+    float color[3] = {};
+    float intensity = 0.0F;
+    float range = 0.0F;
+    float spotInnerAngle = 0.0F;
+    float spotOuterAngle = 0.0F;
+};
+
+struct PlacementRecord
+{
+    std::uint32_t loopId = 0;
+    std::int32_t tileX = 0;
+    std::int32_t tileY = 0;
+    std::int32_t rotationDegrees = 0;
+    std::uint32_t flags = 0;
+};
+
+struct LoopElementRecord
+{
+    std::uint32_t name = 0;
+    std::uint32_t markerTag = 0;
+    std::uint8_t type = 0;
+    std::uint8_t flags = 0;
+    std::uint16_t reserved = 0;
+    float position[3] = {};
+    float halfExtents[3] = {};
+    float rotation[3] = {};
+};
+
+struct LoopRecord
+{
+    std::uint32_t id = 0;
+    std::uint32_t displayName = 0;
+    std::uint32_t mesh = 0;
+    std::int32_t footprintWidth = 1;
+    std::int32_t footprintHeight = 1;
+    std::uint32_t flags = 0;
+    float boundsMin[3] = {};
+    float boundsMax[3] = {};
+    std::uint32_t elementCount = 0;
+};
+
+struct MapRecord
+{
+    std::uint32_t name = 0;
+    std::uint32_t environmentAssetId = 0;
+    std::int32_t width = 0;
+    std::int32_t height = 0;
+    float tileSize = 0.0F;
+    float survivorSpawn[3] = {};
+    float killerSpawn[3] = {};
+    std::uint32_t lightCount = 0;
+    std::uint32_t placementCount = 0;
+    std::uint32_t propCount = 0;
+};
+
+struct PrefabRecord
+{
+    std::uint32_t id = 0;
+    std::uint32_t displayName = 0;
+    std::uint32_t propCount = 0;
+};
+
+struct MaterialRecord
+{
+    std::uint32_t id = 0;
+    std::uint32_t displayName = 0;
+    std::uint32_t albedoTexture = 0;
+    std::uint32_t normalTexture = 0;
+    std::uint32_t ormTexture = 0;
+    std::uint32_t shaderType = 0;
+    float baseColor[4] = {};
+    float roughness = 0.0F;
+    float metallic = 0.0F;
+    float emissiveStrength = 0.0F;
+};
+
+static_assert(std::is_trivially_copyable_v<PropRecord> && std::is_trivially_copyable_v<LightRecord> &&
+              std::is_trivially_copyable_v<MaterialRecord> && std::is_trivially_copyable_v<LoopElementRecord>);
+
+void Store(float (&out)[3], const glm::vec3& value)
+{
+    out[0] = value.x;
+    out[1] = value.y;
+    out[2] = value.z;
+}
+
+glm::vec3 Load(const float (&value)[3])
+{
+    return glm::vec3{value[0], value[1], value[2]};
+}
+
+class BlobWriter
+{
+public:
+    template <typename T>
+    void Pod(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        m_bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    void Array(const std::vector<T>& values)
+    {
+        Pod(static_cast<std::uint32_t>(values.size()));
+        m_bytes.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    std::uint32_t String(const std::string& value)
+    {
+        const auto [it, inserted] = m_stringIndex.emplace(value, static_cast<std::uint32_t>(m_strings.size()));
+        if (inserted)
+        {
+            m_strings.push_back(value);
+        }
+        return it->second;
+    }
+
+    /// String table goes last: count, offsets[count + 1], characters.
+    [[nodiscard]] std::string Finish()
+    {
+        std::vector<std::uint32_t> offsets;
+        offsets.reserve(m_strings.size() + 1);
+        std::string characters;
+        for (const std::string& value : m_strings)
+        {
+            offsets.push_back(static_cast<std::uint32_t>(characters.size()));
+            characters += value;
+        }
+        offsets.push_back(static_cast<std::uint32_t>(characters.size()));
+        Pod(static_cast<std::uint32_t>(m_strings.size()));
+        m_bytes.append(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(std::uint32_t));
+        m_bytes += characters;
+        return std::move(m_bytes);
+    }
+
+private:
+    std::string m_bytes;
+    std::vector<std::string> m_strings;
+    std::unordered_map<std::string, std::uint32_t> m_stringIndex;
+};
+
+/// Bounds-checked cursor over the companion; every failed read poisons the reader.
+class BlobReader
+{
+public:
+    explicit BlobReader(std::span<const std::uint8_t> bytes) : m_bytes(bytes) {}
+
+    template <typename T>
+    bool Pod(T& value)
+    {
+        return Bytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    bool Array(std::vector<T>& values)
+    {
+        std::uint32_t count = 0;
+        if (!Pod(count) || count > kMaxCount || count * sizeof(T) > Remaining())
+        {
+            m_ok = false;
+            return false;
+        }
+        values.resize(count);
+        return Bytes(values.data(), count * sizeof(T));
+    }
+
+    bool Strings()
+    {
+        std::uint32_t count = 0;
+        std::vector<std::uint32_t> offsets;
+        if (!Pod(count) || count > kMaxCount || (count + 1ULL) * sizeof(std::uint32_t) > Remaining())
+        {
+            m_ok = false;
+            return false;
+        }
+        offsets.resize(count + 1ULL);
+        if (!Bytes(offsets.data(), offsets.size() * sizeof(std::uint32_t)))
+        {
+            return false;
+        }
+        const auto* characters = reinterpret_cast<const char*>(m_bytes.data() + m_offset);
+        m_strings.reserve(count);
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            if (offsets[i] > offsets[i + 1] || offsets[i + 1] > Remaining())
+            {
+                m_ok = false;
+                return false;
+            }
+            m_strings.emplace_back(characters + offsets[i], offsets[i + 1] - offsets[i]);
+        }
+        m_offset += offsets[count];
+        return true;
+    }
+
+    /// Resolves a string index; an out-of-range index poisons the reader.
+    std::string String(std::uint32_t index)
+    {
+        if (index >= m_strings.size())
+        {
+            m_ok = false;
+            return {};
+        }
+        return m_strings[index];
+    }
+
+    [[nodiscard]] bool Ok() const { return m_ok; }
+
+private:
+    [[nodiscard]] std::size_t Remaining() const { return m_bytes.size() - std::min(m_offset, m_bytes.size()); }
+
+    bool Bytes(void* out, std::size_t size)
+    {
+        if (!m_ok || size > Remaining())
+        {
+            m_ok = false;
+            return false;
+        }
+        if (size > 0)
+        {
+            std::memcpy(out, m_bytes.data() + m_offset, size);
+        }
+        m_offset += size;
+        return true;
+    }
+
+    std::span<const std::uint8_t> m_bytes;
+    std::size_t m_offset = 0;
+    std::vector<std::string> m_strings;
+    bool m_ok = true;
+};
+
+PropRecord WriteProp(BlobWriter& writer, const PropInstance& prop)
+{
+    PropRecord record;
+    record.name = writer.String(prop.name);
+    record.meshAsset = writer.String(prop.meshAsset);
+    record.materialAsset = writer.String(prop.materialAsset);
+    record.prefabSource = writer.String(prop.prefabSourceId);
+    record.prefabInstance = writer.String(prop.prefabInstanceId);
+    record.animationClip = writer.String(prop.animationClip);
+    record.type = static_cast<std::uint8_t>(prop.type);
+    record.colliderType = static_cast<std::uint8_t>(prop.colliderType);
+    record.flags = static_cast<std::uint8_t>((prop.transformLocked ? kFlagLocked : 0U) | (prop.solid ? kFlagSolid : 0U) |
+                                             (prop.animationLoop ? kFlagAnimationLoop : 0U) |
+                                             (prop.animationAutoplay ? kFlagAnimationAutoplay : 0U));
+    Store(record.position, prop.position);
+    Store(record.halfExtents, prop.halfExtents);
+    Store(record.rotation, glm::vec3{prop.pitchDegrees, prop.yawDegrees, prop.rollDegrees});
+    record.animationSpeed = prop.animationSpeed;
+    Store(record.colliderOffset, prop.colliderOffset);
+    Store(record.colliderHalfExtents, prop.colliderHalfExtents);
+    record.colliderRadius = prop.colliderRadius;
+    record.colliderHeight = prop.colliderHeight;
+    return record;
+}
+
+bool ReadProps(BlobReader& reader, const std::vector<PropRecord>& records, std::vector<PropInstance>& outProps)
+{
+    outProps.clear();
+    outProps.reserve(records.size());
+    for (const PropRecord& record : records)
+    {
+        if (record.type > static_cast<std::uint8_t>(PropType::MeshAsset) ||
+            record.colliderType > static_cast<std::uint8_t>(ColliderType::Capsule))
+        {
+            return false;
+        }
+        PropInstance& prop = outProps.emplace_back();
+        prop.name = reader.String(record.name);
+        prop.meshAsset = reader.String(record.meshAsset);
+        prop.materialAsset = reader.String(record.materialAsset);
+        prop.prefabSourceId = reader.String(record.prefabSource);
+        prop.prefabInstanceId = reader.String(record.prefabInstance);
+        prop.animationClip = reader.String(record.animationClip);
+        prop.type = static_cast<PropType>(record.type);
+        prop.colliderType = static_cast<ColliderType>(record.colliderType);
+        prop.transformLocked = (record.flags & kFlagLocked) != 0;
+        prop.solid = (record.flags & kFlagSolid) != 0;
+        prop.animationLoop = (record.flags & kFlagAnimationLoop) != 0;
+        prop.animationAutoplay = (record.flags & kFlagAnimationAutoplay) != 0;
+        prop.position = Load(record.position);
+        prop.halfExtents = Load(record.halfExtents);
+        prop.pitchDegrees = record.rotation[0];
+        prop.yawDegrees = record.rotation[1];
+        prop.rollDegrees = record.rotation[2];
+        prop.animationSpeed = record.animationSpeed;
+        prop.colliderOffset = Load(record.colliderOffset);
+        prop.colliderHalfExtents = Load(record.colliderHalfExtents);
+        prop.colliderRadius = record.colliderRadius;
+        prop.colliderHeight = record.colliderHeight;
+    }
+    return reader.Ok();
+}
+
+bool WriteFile(const std::filesystem::path& binaryPath, BinaryKind kind, std::uint64_t jsonHash, BlobWriter& body)
+{
+    FileHeader header;
+    header.kind = static_cast<std::uint32_t>(kind);
+    header.jsonHash = jsonHash;
+    const std::string bytes = body.Finish();
+
+    // Temporary per thread: the save thread and a load on the main thread may write the same companion.
+    const std::filesystem::path tempPath =
+        binaryPath.string() + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+    {
+        std::ofstream stream(tempPath, std::ios::binary | std::ios::trunc);
+        if (!stream.is_open())
+        {
+            return false;
+        }
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        if (!stream)
+        {
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tempPath, binaryPath, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    // The fresh companion replaces a stale packed one for the rest of the session.
+    engine::assets::AssetPack::Instance().MarkLooseOverride(binaryPath);
+    return true;
+}
+
+/// Maps the companion (or finds it in the asset pack), checks the header and runs parse over the body.
+template <typename Parse>
+bool ReadFile(const std::filesystem::path& binaryPath, BinaryKind kind, std::uint64_t jsonHash, Parse&& parse)
+{
+    engine::assets::MappedFile file;
+    std::span<const std::uint8_t> bytes;
+    if (const auto packed = engine::assets::AssetPack::Instance().Find(binaryPath))
+    {
+        bytes = *packed;
+    }
+    else if (file.Open(binaryPath))
+    {
+        bytes = std::span<const std::uint8_t>(file.Data(), file.Size());
+    }
+
+    FileHeader header;
+    const FileHeader expected;
+    if (bytes.size() < sizeof(FileHeader))
+    {
+        return false;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 ||
+        header.schemaVersion != LevelAssetBinary::kSchemaVersion || header.kind != static_cast<std::uint32_t>(kind) ||
+        header.assetVersion != kEditorAssetVersion || header.jsonHash != jsonHash)
+    {
+        return false;
+    }
+    BlobReader reader(bytes.subspan(sizeof(FileHeader)));
+    return parse(reader) && reader.Ok();
+}
+} // namespace
+
+std::filesystem::path LevelAssetBinary::PathFor(const std::filesystem::path& jsonPath)
+{
+    return jsonPath.string() + ".abin";
+}
+
+bool LevelAssetBinary::Write(const std::filesystem::path& binaryPath, const LoopAsset& asset, std::uint64_t jsonHash)
+{
+    BlobWriter writer;
+    LoopRecord record;
+    record.id = writer.String(asset.id);
+    record.displayName = writer.String(asset.displayName);
+    record.mesh = writer.String(asset.mesh);
+    record.footprintWidth = asset.footprintWidth;
+    record.footprintHeight = asset.footprintHeight;
+    record.flags = (asset.manualBounds ? kFlagManualBounds : 0U) | (asset.manualFootprint ? kFlagManualFootprint : 0U);
+    Store(record.boundsMin, asset.boundsMin);
+    Store(record.boundsMax, asset.boundsMax);
+
+    std::vector<LoopElementRecord> elements;
+    elements.reserve(asset.elements.size());
+    for (const LoopElement& element : asset.elements)
+    {
+        LoopElementRecord& out = elements.emplace_back();
+        out.name = writer.String(element.name);
+        out.markerTag = writer.String(element.markerTag);
+        out.type = static_cast<std::uint8_t>(element.type);
+        out.flags = element.transformLocked ? kFlagLocked : 0U;
+        Store(out.position, element.position);
+        Store(out.halfExtents, element.halfExtents);
+        Store(out.rotation, glm::vec3{element.pitchDegrees, element.yawDegrees, element.rollDegrees});
+    }
+    writer.Pod(record);
+    writer.Array(elements);
+    return WriteFile(binaryPath, BinaryKind::Loop, jsonHash, writer);
+}
+
+bool LevelAssetBinary::Read(const std::filesystem::path& binaryPath, std::uint64_t jsonHash, LoopAsset& outAsset)
+{
+    return ReadFile(binaryPath, BinaryKind::Loop, jsonHash, [&outAsset](BlobReader& reader) {
+        LoopRecord record;
+        std::vector<LoopElementRecord> elements;
+        if (!reader.Pod(record) || !reader.Array(elements) || !reader.Strings())
+        {
+            return false;
+        }
+        LoopAsset asset;
+        asset.id = reader.String(record.id);
+        asset.displayName = reader.String(record.displayName);
+        asset.mesh = reader.String(record.mesh);
+        asset.footprintWidth = record.footprintWidth;
+        asset.footprintHeight = record.footprintHeight;
+        asset.manualBounds = (record.flags & kFlagManualBounds) != 0;
+        asset.manualFootprint = (record.flags & kFlagManualFootprint) != 0;
+        asset.boundsMin = Load(record.boundsMin);
+        asset.boundsMax = Load(record.boundsMax);
+        asset.elements.reserve(elements.size());
+        for (const LoopElementRecord& in : elements)
+        {
+            if (in.type > static_cast<std::uint8_t>(LoopElementType::Marker))
+            {
+                return false;
+            }
+            LoopElement& element = asset.elements.emplace_back();
+            element.type = static_cast<LoopElementType>(in.type);
+            element.name = reader.String(in.name);
+            element.markerTag = reader.String(in.markerTag);
+            element.transformLocked = (in.flags & kFlagLocked) != 0;
+            element.position = Load(in.position);
+            element.halfExtents = Load(in.halfExtents);
+            element.pitchDegrees = in.rotation[0];
+            element.yawDegrees = in.rotation[1];
+            element.rollDegrees = in.rotation[2];
+        }
+        if (!reader.Ok())
+        {
+            return false;
+        }
+        outAsset = std::move(asset);
+        return true;
+    });
+}
+
+bool LevelAssetBinary::Write(const std::filesystem::path& binaryPath, const MapAsset& asset, std::uint64_t jsonHash)
+{
+    BlobWriter writer;
+    MapRecord record;
+    record.name = writer.String(asset.name);
+    record.environmentAssetId = writer.String(asset.environmentAssetId);
+    record.width = asset.width;
+    record.height = asset.height;
+    record.tileSize = asset.tileSize;
+    Store(record.survivorSpawn, asset.survivorSpawn);
+    Store(record.killerSpawn, asset.killerSpawn);
+
+    std::vector<LightRecord> lights;
+    lights.reserve(asset.lights.size());
+    for (const LightInstance& light : asset.lights)
+    {
+        LightRecord& out = lights.emplace_back();
+        out.name = writer.String(light.name);
+        out.type = static_cast<std::uint8_t>(light.type);
+        out.flags = light.enabled ? kFlagEnabled : 0U;
+        Store(out.position, light.position);
+        Store(out.rotationEuler, light.rotationEuler);
+        Store(out.color, light.color);
+        out.intensity = light.intensity;
+        out.range = light.range;
+        out.spotInnerAngle = light.spotInnerAngle;
+        out.spotOuterAngle = light.spotOuterAngle;
+    }
+
+    std::vector<PlacementRecord> placements;
+    placements.reserve(asset.placements.size());
+    for (const LoopPlacement& placement : asset.placements)
+    {
+        PlacementRecord& out = placements.emplace_back();
+        out.loopId = writer.String(placement.loopId);
+        out.tileX = placement.tileX;
+        out.tileY = placement.tileY;
+        out.rotationDegrees = placement.rotationDegrees;
+        out.flags = placement.transformLocked ? kFlagLocked : 0U;
+    }
+
+    std::vector<PropRecord> props;
+    props.reserve(asset.props.size());
+    for (const PropInstance& prop : asset.props)
+    {
+        props.push_back(WriteProp(writer, prop));
+    }
+
+    writer.Pod(record);
+    writer.Array(lights);
+    writer.Array(placements);
+    writer.Array(props);
+    return WriteFile(binaryPath, BinaryKind::Map, jsonHash, writer);
+}
+
+bool LevelAssetBinary::Read(const std::filesystem::path& binaryPath, std::uint64_t jsonHash, MapAsset& outAsset)
+{
+    return ReadFile(binaryPath, BinaryKind::Map, jsonHash, [&outAsset](BlobReader& reader) {
+        MapRecord record;
+        std::vector<LightRecord> lights;
+        std::vector<PlacementRecord> placements;
+        std::vector<PropRecord> props;
+        if (!reader.Pod(record) || !reader.Array(lights) || !reader.Array(placements) || !reader.Array(props) ||
+            !reader.Strings())
+        {
+            return false;
+        }
+        MapAsset asset;
+        asset.name = reader.String(record.name);
+        asset.environmentAssetId = reader.String(record.environmentAssetId);
+        asset.width = record.width;
+        asset.height = record.height;
+        asset.tileSize = record.tileSize;
+        asset.survivorSpawn = Load(record.survivorSpawn);
+        asset.killerSpawn = Load(record.killerSpawn);
+
+        asset.lights.reserve(lights.size());
+        for (const LightRecord& in : lights)
+        {
+            if (in.type > static_cast<std::uint8_t>(LightType::Spot))
+            {
+                return false;
+            }
+            LightInstance& light = asset.lights.emplace_back();
+            light.name = reader.String(in.name);
+            light.type = static_cast<LightType>(in.type);
+            light.enabled = (in.flags & kFlagEnabled) != 0;
+            light.position = Load(in.position);
+            light.rotationEuler = Load(in.rotationEuler);
+            light.color = Load(in.color);
+            light.intensity = in.intensity;
+            light.range = in.range;
+            light.spotInnerAngle = in.spotInnerAngle;
+            light.spotOuterAngle = in.spotOuterAngle;
+        }
+
+        asset.placements.reserve(placements.size());
+        for (const PlacementRecord& in : placements)
+        {
+            LoopPlacement& placement = asset.placements.emplace_back();
+            placement.loopId = reader.String(in.loopId);
+            placement.tileX = in.tileX;
+            placement.tileY = in.tileY;
+            placement.rotationDegrees = in.rotationDegrees;
+            placement.transformLocked = (in.flags & kFlagLocked) != 0;
+        }
+
+        if (!ReadProps(reader, props, asset.props))
+        {
+            return false;
+        }
+        outAsset = std::move(asset);
+        return true;
+    });
+}
+
+bool LevelAssetBinary::Write(const std::filesystem::path& binaryPath, const PrefabAsset& asset, std::uint64_t jsonHash)
+{
+    BlobWriter writer;
+    PrefabRecord record;
+    record.id = writer.String(asset.id);
+    record.displayName = writer.String(asset.displayName);
+    std::vector<PropRecord> props;
+    props.reserve(asset.props.size());
+    for (const PropInstance& prop : asset.props)
+    {
+        props.push_back(WriteProp(writer, prop));
+    }
+    writer.Pod(record);
+    writer.Array(props);
+    return WriteFile(binaryPath, BinaryKind::Prefab, jsonHash, writer);
+}
+
+bool LevelAssetBinary::Read(const std::filesystem::path& binaryPath, std::uint64_t jsonHash, PrefabAsset& outAsset)
+{
+    return ReadFile(binaryPath, BinaryKind::Prefab, jsonHash, [&outAsset](BlobReader& reader) {
+        PrefabRecord record;
+        std::vector<PropRecord> props;
+        if (!reader.Pod(record) || !reader.Array(props) || !reader.Strings())
+        {
+            return false;
+        }
+        PrefabAsset asset;
+        asset.id = reader.String(record.id);
+        asset.displayName = reader.String(record.displayName);
+        if (!ReadProps(reader, props, asset.props))
+        {
+            return false;
+        }
+        outAsset = std::move(asset);
+        return true;
+    });
+}
+
+bool LevelAssetBinary::Write(const std::filesystem::path& binaryPath, const MaterialAsset& asset, std::uint64_t jsonHash)
+{
+    BlobWriter writer;
+    MaterialRecord record;
+    record.id = writer.String(asset.id);
+    record.displayName = writer.String(asset.displayName);
+    record.albedoTexture = writer.String(asset.albedoTexture);
+    record.normalTexture = writer.String(asset.normalTexture);
+    record.ormTexture = writer.String(asset.ormTexture);
+    record.shaderType = static_cast<std::uint32_t>(asset.shaderType);
+    record.baseColor[0] = asset.baseColor.r;
+    record.baseColor[1] = asset.baseColor.g;
+    record.baseColor[2] = asset.baseColor.b;
+    record.baseColor[3] = asset.baseColor.a;
+    record.roughness = asset.roughness;
+    record.metallic = asset.metallic;
+    record.emissiveStrength = asset.emissiveStrength;
+    writer.Pod(record);
+    return WriteFile(binaryPath, BinaryKind::Material, jsonHash, writer);
+}
+
+bool LevelAssetBinary::Read(const std::filesystem::path& binaryPath, std::uint64_t jsonHash, MaterialAsset& outAsset)
+{
+    return ReadFile(binaryPath, BinaryKind::Material, jsonHash, [&outAsset](BlobReader& reader) {
+        MaterialRecord record;
+        if (!reader.Pod(record) || !reader.Strings() || record.shaderType > static_cast<std::uint32_t>(MaterialShaderType::Unlit))
+        {
+            return false;
+        }
+        MaterialAsset asset;
+        asset.id = reader.String(record.id);
+        asset.displayName = reader.String(record.displayName);
+        asset.albedoTexture = reader.String(record.albedoTexture);
+        asset.normalTexture = reader.String(record.normalTexture);
+        asset.ormTexture = reader.String(record.ormTexture);
+        asset.shaderType = static_cast<MaterialShaderType>(record.shaderType);
+        asset.baseColor = glm::vec4{record.baseColor[0], record.baseColor[1], record.baseColor[2], record.baseColor[3]};
+        asset.roughness = record.roughness;
+        asset.metallic = record.metallic;
+        asset.emissiveStrength = record.emissiveStrength;
+        if (!reader.Ok())
+        {
+            return false;
+        }
+        outAsset = std::move(asset);
+        return true;
+    });
+}
+} // namespace game::editor
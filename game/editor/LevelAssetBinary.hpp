@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+#include "game/editor/LevelAssets.hpp"
+
+namespace game::editor
+{
+/// Binary companions of the editor JSON assets (<file>.json.abin). The JSON stays the interchange and
+/// diff format; the companion is a schema-versioned snapshot of the parsed asset, valid only while
+/// the FNV-1a hash of the JSON bytes matches. Records are fixed-layout PODs that reference a shared
+/// string table, so a map with thousands of props loads with a few bounds-checked memcpys.
+class LevelAssetBinary
+{
+public:
+    static constexpr std::uint32_t kSchemaVersion = 1;
+
+    [[nodiscard]] static std::filesystem::path PathFor(const std::filesystem::path& jsonPath);
+
+    static bool Write(const std::filesystem::path& binaryPath, const LoopAsset& asset, std::uint64_t jsonHash);
+    static bool Write(const std::filesystem::path& binaryPath, const MapAsset& asset, std::uint64_t jsonHash);
+    static bool Write(const std::filesystem::path& binaryPath, const PrefabAsset& asset, std::uint64_t jsonHash);
+    static bool Write(const std::filesystem::path& binaryPath, const MaterialAsset& asset, std::uint64_t jsonHash);
+
+    [[nodiscard]] static bool Read(const std::filesystem::path& binaryPath, std::uint64_t jsonHash, LoopAsset& outAsset);
+    [[nodiscard]] static bool Read(const std::filesystem::path& binaryPath, std::uint64_t jsonHash, MapAsset& outAsset);
+    [[nodiscard]] static bool Read(const std::filesystem::path& binaryPath, std::uint64_t jsonHash, PrefabAsset& outAsset);
+    [[nodiscard]] static bool Read(const std::filesystem::path& binaryPath, std::uint64_t jsonHash, MaterialAsset& outAsset);
+};
+} // namespace game::editor
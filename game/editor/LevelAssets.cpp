@@ -1,16 +1,24 @@
 #include "game/editor/LevelAssets.hpp"
 
 #include <algorithm>
+#include <any>
 #include <array>
 #include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 #include <glm/common.hpp>
 #include <glm/geometric.hpp>
@@ -19,6 +27,11 @@
 
 #include <nlohmann/json.hpp>
 
+#include "engine/assets/AssetPack.hpp"
+#include "engine/assets/ContentHash.hpp"
+#include "engine/assets/MappedFile.hpp"
+#include "game/editor/LevelAssetBinary.hpp"
+
 namespace game::editor
 {
 namespace
@@ -181,6 +194,8 @@ glm::vec4 Vec4FromJson(const json& value, const glm::vec4& fallback)
 
 bool WriteJsonFile(const std::filesystem::path& path, const json& value, std::string* outError)
 {
+    // The saved copy replaces any packed one for the rest of the session.
+    engine::assets::AssetPack::Instance().MarkLooseOverride(path);
     std::ofstream stream(path);
     if (!stream.is_open())
     {
@@ -196,10 +211,10 @@ bool WriteJsonFile(const std::filesystem::path& path, const json& value, std::st
     return true;
 }
 
-bool ReadJsonFile(const std::filesystem::path& path, json* outValue, std::string* outError)
+bool ReadJsonFile(const std::filesystem::path& path, json* outValue, std::string* outError, std::uint64_t* outHash = nullptr)
 {
-    std::ifstream stream(path);
-    if (!stream.is_open())
+    std::string text;
+    if (!engine::assets::AssetPack::ReadFile(path, text))
     {
         if (outError != nullptr)
         {
@@ -207,10 +222,14 @@ bool ReadJsonFile(const std::filesystem::path& path, json* outValue, std::string
         }
         return false;
     }
+    if (outHash != nullptr)
+    {
+        *outHash = engine::assets::ContentHash(text.data(), text.size());
+    }
 
     try
     {
-        stream >> *outValue;
+        *outValue = json::parse(text);
     }
     catch (const std::exception& ex)
     {
@@ -223,6 +242,274 @@ bool ReadJsonFile(const std::filesystem::path& path, json* outValue, std::string
     return true;
 }
 
+bool RemoveJsonFile(const std::filesystem::path& path, std::error_code& ec)
+{
+    engine::assets::AssetPack& pack = engine::assets::AssetPack::Instance();
+    const std::filesystem::path binaryPath = LevelAssetBinary::PathFor(path);
+    pack.MarkLooseOverride(path);
+    pack.MarkLooseOverride(binaryPath);
+    std::error_code ignored;
+    std::filesystem::remove(binaryPath, ignored);
+    return std::filesystem::remove(path, ec);
+}
+
+/// Hash of the JSON bytes that a binary companion must match; packed files use the hash stored in the pack.
+bool HashAssetFile(const std::filesystem::path& path, std::uint64_t* outHash)
+{
+    if (engine::assets::AssetPack::Instance().FindHash(path, *outHash))
+    {
+        return true;
+    }
+    engine::assets::MappedFile file;
+    if (!file.Open(path))
+    {
+        return false;
+    }
+    *outHash = engine::assets::ContentHash(file.Data(), file.Size());
+    return true;
+}
+
+/// Cheap change detector for a cached parse: the pack's content hash for packed files, otherwise
+/// the loose file's modification time and size.
+bool FileStamp(const std::filesystem::path& path, std::uint64_t* outStamp)
+{
+    if (engine::assets::AssetPack::Instance().FindHash(path, *outStamp))
+    {
+        return true;
+    }
+    std::error_code ec;
+    const auto modified = std::filesystem::last_write_time(path, ec);
+    if (ec)
+    {
+        return false;
+    }
+    const std::uintmax_t size = std::filesystem::file_size(path, ec);
+    if (ec)
+    {
+        return false;
+    }
+    const std::uint64_t parts[2] = {static_cast<std::uint64_t>(modified.time_since_epoch().count()), static_cast<std::uint64_t>(size)};
+    *outStamp = engine::assets::ContentHash(parts, sizeof(parts));
+    return true;
+}
+
+/// Fills outAsset from the binary companion if it was written from the JSON bytes currently on disk.
+template <typename Asset>
+bool LoadBinaryCompanion(const std::filesystem::path& jsonPath, Asset* outAsset)
+{
+    std::uint64_t jsonHash = 0;
+    return HashAssetFile(jsonPath, &jsonHash) &&
+           LevelAssetBinary::Read(LevelAssetBinary::PathFor(jsonPath), jsonHash, *outAsset);
+}
+
+std::string SaveKey(const std::filesystem::path& path)
+{
+    return path.lexically_normal().generic_string();
+}
+
+thread_local bool t_onSaveThread = false;
+
+/// Background writer for editor saves. Jobs are keyed by target path: a newer save of the same
+/// file replaces the queued one, and loads of a path wait until its pending save has landed.
+class SaveQueue
+{
+public:
+    static SaveQueue& Instance()
+    {
+        static SaveQueue instance;
+        return instance;
+    }
+
+    ~SaveQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    /// pending holds a std::shared_ptr<const Asset> to the asset as a load would read it back once
+    /// written (empty if unknown); loads of path are served from it while the save is queued or
+    /// being written.
+    void Enqueue(const std::filesystem::path& path, std::string label, std::any pending, std::function<bool(std::string*)> save)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const std::string key = SaveKey(path);
+            const auto queued = std::find_if(m_jobs.begin(), m_jobs.end(), [&key](const Job& job) { return job.key == key; });
+            if (queued != m_jobs.end())
+            {
+                queued->label = std::move(label);
+                queued->pending = std::move(pending);
+                queued->save = std::move(save);
+            }
+            else
+            {
+                m_jobs.push_back(Job{key, std::move(label), std::move(pending), std::move(save)});
+            }
+            if (!m_thread.joinable())
+            {
+                m_thread = std::thread([this] { Run(); });
+            }
+        }
+        m_wake.notify_one();
+    }
+
+    /// Blocks while a save of path is queued or being written. Only needed when FindPending has no
+    /// copy to serve. No-op on the save thread itself.
+    void WaitFor(const std::filesystem::path& path)
+    {
+        if (t_onSaveThread)
+        {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_jobs.empty() && m_inFlight.empty())
+        {
+            return;
+        }
+        const std::string key = SaveKey(path);
+        m_idle.wait(lock, [this, &key] {
+            return m_inFlight != key &&
+                   std::none_of(m_jobs.begin(), m_jobs.end(), [&key](const Job& job) { return job.key == key; });
+        });
+    }
+
+    /// Copy of the asset a queued or in-flight save of path will write. Never blocks on the write.
+    template <typename Asset>
+    bool FindPending(const std::filesystem::path& path, Asset* outAsset)
+    {
+        if (t_onSaveThread)
+        {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_jobs.empty() && m_inFlight.empty())
+        {
+            return false;
+        }
+        const std::string key = SaveKey(path);
+        const auto queued = std::find_if(m_jobs.begin(), m_jobs.end(), [&key](const Job& job) { return job.key == key; });
+        const std::any* pending = queued != m_jobs.end() ? &queued->pending : (m_inFlight == key ? &m_inFlightPending : nullptr);
+        const auto* asset = pending != nullptr ? std::any_cast<std::shared_ptr<const Asset>>(pending) : nullptr;
+        if (asset == nullptr || *asset == nullptr)
+        {
+            return false;
+        }
+        *outAsset = **asset;
+        return true;
+    }
+
+    /// For a synchronous write or delete of path on the calling thread: drops a queued save it makes
+    /// obsolete and waits only if that file is being written right now. No-op on the save thread.
+    void Supersede(const std::filesystem::path& path)
+    {
+        if (t_onSaveThread)
+        {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        const std::string key = SaveKey(path);
+        std::erase_if(m_jobs, [&key](const Job& job) { return job.key == key; });
+        m_idle.wait(lock, [this, &key] { return m_inFlight != key; });
+    }
+
+    void Flush()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idle.wait(lock, [this] { return m_jobs.empty() && m_inFlight.empty(); });
+    }
+
+    std::vector<AssetSaveResult> TakeResults()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return std::exchange(m_results, {});
+    }
+
+private:
+    struct Job
+    {
+        std::string key;
+        std::string label;
+        std::any pending;
+        std::function<bool(std::string*)> save;
+    };
+
+    SaveQueue() = default;
+
+    void Run()
+    {
+        t_onSaveThread = true;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true)
+        {
+            m_wake.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+            if (m_jobs.empty())
+            {
+                return; // stopping and drained
+            }
+            Job job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+            m_inFlight = job.key;
+            m_inFlightPending = std::move(job.pending);
+            lock.unlock();
+
+            AssetSaveResult result;
+            result.label = std::move(job.label);
+            result.ok = job.save(&result.error);
+
+            lock.lock();
+            m_inFlight.clear();
+            m_inFlightPending.reset();
+            m_results.push_back(std::move(result));
+            m_idle.notify_all();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_idle;
+    std::deque<Job> m_jobs;
+    std::string m_inFlight;
+    std::any m_inFlightPending;
+    std::vector<AssetSaveResult> m_results;
+    std::thread m_thread;
+    bool m_stop = false;
+};
+
+/// Parsed loops by sanitized id. Every placement of a map resolves its loop and the editor does so
+/// each frame, so a loop is parsed once and then served from here while its file stamp (see
+/// FileStamp) is unchanged; external edits or a checkout are picked up on the next load.
+struct LoopCache
+{
+    struct Entry
+    {
+        LoopAsset asset;
+        std::uint64_t stamp = 0;
+    };
+
+    std::mutex mutex;
+    std::unordered_map<std::string, Entry> loops;
+};
+
+LoopCache& Loops()
+{
+    static LoopCache cache;
+    return cache;
+}
+
+void ForgetCachedLoop(const std::string& loopId)
+{
+    LoopCache& cache = Loops();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.loops.erase(loopId);
+}
+
 std::filesystem::path LoopPathFromId(const std::string& loopId)
 {
     return kLoopDir / (loopId + ".json");
@@ -253,32 +540,13 @@ std::filesystem::path PrefabPathFromId(const std::string& prefabId)
     return kPrefabDir / (prefabId + ".json");
 }
 
-std::string StemName(const std::filesystem::directory_entry& entry)
-{
-    return entry.path().stem().string();
-}
-
 std::vector<std::string> ListJsonAssetNames(const std::filesystem::path& root)
 {
     std::vector<std::string> result;
-    if (!std::filesystem::exists(root))
+    for (const std::string& fileName : engine::assets::AssetPack::ListFiles(root, ".json"))
     {
-        return result;
+        result.push_back(std::filesystem::path(fileName).stem().string());
     }
-
-    for (const auto& entry : std::filesystem::directory_iterator(root))
-    {
-        if (!entry.is_regular_file())
-        {
-            continue;
-        }
-        if (entry.path().extension() != ".json")
-        {
-            continue;
-        }
-        result.push_back(StemName(entry));
-    }
-    std::sort(result.begin(), result.end());
     return result;
 }
 
@@ -376,13 +644,17 @@ std::string LevelAssetIO::SanitizeName(const std::string& value)
 
 void LevelAssetIO::EnsureAssetDirectories()
 {
-    std::error_code ec;
-    std::filesystem::create_directories(kLoopDir, ec);
-    std::filesystem::create_directories(kMapDir, ec);
-    std::filesystem::create_directories(kMaterialDir, ec);
-    std::filesystem::create_directories(kAnimationDir, ec);
-    std::filesystem::create_directories(kEnvironmentDir, ec);
-    std::filesystem::create_directories(kPrefabDir, ec);
+    // Called before every load/save; the directories only need creating once per run.
+    static std::once_flag once;
+    std::call_once(once, [] {
+        std::error_code ec;
+        std::filesystem::create_directories(kLoopDir, ec);
+        std::filesystem::create_directories(kMapDir, ec);
+        std::filesystem::create_directories(kMaterialDir, ec);
+        std::filesystem::create_directories(kAnimationDir, ec);
+        std::filesystem::create_directories(kEnvironmentDir, ec);
+        std::filesystem::create_directories(kPrefabDir, ec);
+    });
 }
 
 std::vector<std::string> LevelAssetIO::ListLoopIds()
@@ -421,17 +693,39 @@ std::vector<std::string> LevelAssetIO::ListPrefabIds()
     return ListJsonAssetNames(kPrefabDir);
 }
 
-bool LevelAssetIO::SaveLoop(const LoopAsset& asset, std::string* outError)
+LoopAsset LevelAssetIO::NormalizedLoop(LoopAsset asset)
 {
-    EnsureAssetDirectories();
-
-    LoopAsset copy = asset;
-    copy.assetVersion = kEditorAssetVersion;
-    copy.id = SanitizeName(copy.id.empty() ? copy.displayName : copy.id);
-    if (copy.displayName.empty())
+    asset.assetVersion = kEditorAssetVersion;
+    asset.id = SanitizeName(asset.id.empty() ? asset.displayName : asset.id);
+    if (asset.displayName.empty())
     {
-        copy.displayName = copy.id;
+        asset.displayName = asset.id;
     }
+    asset.footprintWidth = std::max(1, asset.footprintWidth);
+    asset.footprintHeight = std::max(1, asset.footprintHeight);
+    return asset;
+}
+
+MapAsset LevelAssetIO::NormalizedMap(MapAsset asset)
+{
+    asset.assetVersion = kEditorAssetVersion;
+    asset.name = SanitizeName(asset.name);
+    asset.width = std::max(1, asset.width);
+    asset.height = std::max(1, asset.height);
+    asset.tileSize = std::max(1.0F, asset.tileSize);
+    asset.environmentAssetId =
+        SanitizeName(asset.environmentAssetId.empty() ? "default_environment" : asset.environmentAssetId);
+    for (LoopPlacement& placement : asset.placements)
+    {
+        placement.loopId = SanitizeName(placement.loopId);
+        placement.rotationDegrees = NormalizeRightAngle(placement.rotationDegrees);
+    }
+    return asset;
+}
+
+nlohmann::json LevelAssetIO::LoopToJson(const LoopAsset& asset)
+{
+    const LoopAsset copy = NormalizedLoop(asset);
 
     json root;
     root["asset_version"] = copy.assetVersion;
@@ -446,8 +740,8 @@ bool LevelAssetIO::SaveLoop(const LoopAsset& asset, std::string* outError)
         {"max", Vec3ToJson(copy.boundsMax)},
     };
     root["footprint"] = {
-        {"width", std::max(1, copy.footprintWidth)},
-        {"height", std::max(1, copy.footprintHeight)},
+        {"width", copy.footprintWidth},
+        {"height", copy.footprintHeight},
     };
     root["manual_bounds"] = copy.manualBounds;
     root["manual_footprint"] = copy.manualFootprint;
@@ -468,7 +762,19 @@ bool LevelAssetIO::SaveLoop(const LoopAsset& asset, std::string* outError)
         });
     }
 
-    return WriteJsonFile(LoopPathFromId(copy.id), root, outError);
+    return root;
+}
+
+bool LevelAssetIO::SaveLoop(const LoopAsset& asset, std::string* outError)
+{
+    EnsureAssetDirectories();
+    const json root = LoopToJson(asset);
+    const std::string id = root["id"].get<std::string>();
+    const std::filesystem::path path = LoopPathFromId(id);
+    SaveQueue::Instance().Supersede(path);
+    const bool written = WriteJsonFile(path, root, outError);
+    ForgetCachedLoop(id);
+    return written;
 }
 
 bool LevelAssetIO::LoadLoop(const std::string& loopId, LoopAsset* outAsset, std::string* outError)
@@ -485,12 +791,54 @@ bool LevelAssetIO::LoadLoop(const std::string& loopId, LoopAsset* outAsset, std:
     EnsureAssetDirectories();
 
     const std::string sanitized = SanitizeName(loopId);
-    json root;
-    if (!ReadJsonFile(LoopPathFromId(sanitized), &root, outError))
+    const std::filesystem::path path = LoopPathFromId(sanitized);
+    if (SaveQueue::Instance().FindPending(path, outAsset))
     {
-        return false;
+        return true;
+    }
+    SaveQueue::Instance().WaitFor(path);
+    LoopCache& cache = Loops();
+    std::uint64_t stamp = 0;
+    const bool stamped = FileStamp(path, &stamp);
+    if (stamped)
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        const auto cached = cache.loops.find(sanitized);
+        if (cached != cache.loops.end() && cached->second.stamp == stamp)
+        {
+            *outAsset = cached->second.asset;
+            return true;
+        }
     }
 
+    LoopAsset result;
+    if (!LoadBinaryCompanion(path, &result))
+    {
+        json root;
+        std::uint64_t jsonHash = 0;
+        if (!ReadJsonFile(path, &root, outError, &jsonHash))
+        {
+            return false;
+        }
+        if (!LoopFromJson(root, sanitized, &result, outError))
+        {
+            return false;
+        }
+        LevelAssetBinary::Write(LevelAssetBinary::PathFor(path), result, jsonHash);
+    }
+    std::cout << "[LOOP_LOAD] Loaded loop '" << result.id << "' with mesh: '" << result.mesh << "'\n";
+
+    if (stamped)
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.loops[sanitized] = LoopCache::Entry{result, stamp};
+    }
+    *outAsset = std::move(result);
+    return true;
+}
+
+bool LevelAssetIO::LoopFromJson(const nlohmann::json& root, const std::string& fallbackId, LoopAsset* outAsset, std::string* outError)
+{
     const int version = root.value("asset_version", -1);
     if (version != kEditorAssetVersion)
     {
@@ -505,10 +853,9 @@ bool LevelAssetIO::LoadLoop(const std::string& loopId, LoopAsset* outAsset, std:
 
     LoopAsset result;
     result.assetVersion = version;
-    result.id = SanitizeName(root.value("id", sanitized));
+    result.id = SanitizeName(root.value("id", fallbackId));
     result.displayName = root.value("display_name", result.id);
     result.mesh = root.value("mesh", std::string{});  // Load optional mesh path
-    std::cout << "[LOOP_LOAD] Loaded loop '" << result.id << "' with mesh: '" << result.mesh << "'\n";
     result.manualBounds = root.value("manual_bounds", false);
     result.manualFootprint = root.value("manual_footprint", false);
 
@@ -547,7 +894,11 @@ bool LevelAssetIO::DeleteLoop(const std::string& loopId, std::string* outError)
 {
     EnsureAssetDirectories();
     std::error_code ec;
-    const bool removed = std::filesystem::remove(LoopPathFromId(SanitizeName(loopId)), ec);
+    const std::string sanitized = SanitizeName(loopId);
+    const std::filesystem::path path = LoopPathFromId(sanitized);
+    SaveQueue::Instance().Supersede(path);
+    const bool removed = RemoveJsonFile(path, ec);
+    ForgetCachedLoop(sanitized);
     if (ec && outError != nullptr)
     {
         *outError = "Failed to delete loop: " + ec.message();
@@ -555,16 +906,9 @@ bool LevelAssetIO::DeleteLoop(const std::string& loopId, std::string* outError)
     return removed && !ec;
 }
 
-bool LevelAssetIO::SaveMap(const MapAsset& asset, std::string* outError)
+nlohmann::json LevelAssetIO::MapToJson(const MapAsset& asset)
 {
-    EnsureAssetDirectories();
-
-    MapAsset copy = asset;
-    copy.assetVersion = kEditorAssetVersion;
-    copy.name = SanitizeName(copy.name);
-    copy.width = std::max(1, copy.width);
-    copy.height = std::max(1, copy.height);
-    copy.tileSize = std::max(1.0F, copy.tileSize);
+    const MapAsset copy = NormalizedMap(asset);
 
     json root;
     root["asset_version"] = copy.assetVersion;
@@ -578,7 +922,7 @@ bool LevelAssetIO::SaveMap(const MapAsset& asset, std::string* outError)
         {"survivor", Vec3ToJson(copy.survivorSpawn)},
         {"killer", Vec3ToJson(copy.killerSpawn)},
     };
-    root["environment_asset"] = SanitizeName(copy.environmentAssetId.empty() ? "default_environment" : copy.environmentAssetId);
+    root["environment_asset"] = copy.environmentAssetId;
     root["lights"] = json::array();
     for (const LightInstance& light : copy.lights)
     {
@@ -600,9 +944,9 @@ bool LevelAssetIO::SaveMap(const MapAsset& asset, std::string* outError)
     for (const LoopPlacement& placement : copy.placements)
     {
         root["placements"].push_back({
-            {"loop_id", SanitizeName(placement.loopId)},
+            {"loop_id", placement.loopId},
             {"tile", json::array({placement.tileX, placement.tileY})},
-            {"rotation_degrees", NormalizeRightAngle(placement.rotationDegrees)},
+            {"rotation_degrees", placement.rotationDegrees},
             {"transform_locked", placement.transformLocked},
         });
     }
@@ -638,7 +982,16 @@ bool LevelAssetIO::SaveMap(const MapAsset& asset, std::string* outError)
         });
     }
 
-    return WriteJsonFile(MapPathFromName(copy.name), root, outError);
+    return root;
+}
+
+bool LevelAssetIO::SaveMap(const MapAsset& asset, std::string* outError)
+{
+    EnsureAssetDirectories();
+    const json root = MapToJson(asset);
+    const std::filesystem::path path = MapPathFromName(root["name"].get<std::string>());
+    SaveQueue::Instance().Supersede(path);
+    return WriteJsonFile(path, root, outError);
 }
 
 bool LevelAssetIO::LoadMap(const std::string& mapName, MapAsset* outAsset, std::string* outError)
@@ -659,13 +1012,34 @@ bool LevelAssetIO::LoadMap(const std::string& mapName, MapAsset* outAsset, std::
     {
         path = MapPathFromName(SanitizeName(mapName));
     }
+    if (SaveQueue::Instance().FindPending(path, outAsset))
+    {
+        return true;
+    }
+    SaveQueue::Instance().WaitFor(path);
+    if (LoadBinaryCompanion(path, outAsset))
+    {
+        return true;
+    }
 
     json root;
-    if (!ReadJsonFile(path, &root, outError))
+    std::uint64_t jsonHash = 0;
+    if (!ReadJsonFile(path, &root, outError, &jsonHash))
     {
         return false;
     }
+    MapAsset map;
+    if (!MapFromJson(root, path.stem().string(), &map, outError))
+    {
+        return false;
+    }
+    LevelAssetBinary::Write(LevelAssetBinary::PathFor(path), map, jsonHash);
+    *outAsset = std::move(map);
+    return true;
+}
 
+bool LevelAssetIO::MapFromJson(const nlohmann::json& root, const std::string& fallbackName, MapAsset* outAsset, std::string* outError)
+{
     const int version = root.value("asset_version", -1);
     if (version != kEditorAssetVersion)
     {
@@ -680,7 +1054,7 @@ bool LevelAssetIO::LoadMap(const std::string& mapName, MapAsset* outAsset, std::
 
     MapAsset map;
     map.assetVersion = version;
-    map.name = SanitizeName(root.value("name", path.stem().string()));
+    map.name = SanitizeName(root.value("name", fallbackName));
     const json grid = root.value("grid", json::object());
     map.width = std::max(1, grid.value("width", 64));
     map.height = std::max(1, grid.value("height", 64));
@@ -772,7 +1146,9 @@ bool LevelAssetIO::DeleteMap(const std::string& mapName, std::string* outError)
 {
     EnsureAssetDirectories();
     std::error_code ec;
-    const bool removed = std::filesystem::remove(MapPathFromName(SanitizeName(mapName)), ec);
+    const std::filesystem::path path = MapPathFromName(SanitizeName(mapName));
+    SaveQueue::Instance().Supersede(path);
+    const bool removed = RemoveJsonFile(path, ec);
     if (ec && outError != nullptr)
     {
         *outError = "Failed to delete map: " + ec.message();
@@ -825,12 +1201,30 @@ bool LevelAssetIO::LoadMaterial(const std::string& materialId, MaterialAsset* ou
 
     EnsureAssetDirectories();
     const std::string sanitized = SanitizeName(materialId);
+    const std::filesystem::path path = MaterialPathFromId(sanitized);
+    if (LoadBinaryCompanion(path, outAsset))
+    {
+        return true;
+    }
+
     json root;
-    if (!ReadJsonFile(MaterialPathFromId(sanitized), &root, outError))
+    std::uint64_t jsonHash = 0;
+    if (!ReadJsonFile(path, &root, outError, &jsonHash))
     {
         return false;
     }
+    MaterialAsset asset;
+    if (!MaterialFromJson(root, sanitized, &asset, outError))
+    {
+        return false;
+    }
+    LevelAssetBinary::Write(LevelAssetBinary::PathFor(path), asset, jsonHash);
+    *outAsset = std::move(asset);
+    return true;
+}
 
+bool LevelAssetIO::MaterialFromJson(const nlohmann::json& root, const std::string& fallbackId, MaterialAsset* outAsset, std::string* outError)
+{
     const int version = root.value("asset_version", -1);
     if (version != kEditorAssetVersion)
     {
@@ -843,7 +1237,7 @@ bool LevelAssetIO::LoadMaterial(const std::string& materialId, MaterialAsset* ou
 
     MaterialAsset asset;
     asset.assetVersion = version;
-    asset.id = SanitizeName(root.value("id", sanitized));
+    asset.id = SanitizeName(root.value("id", fallbackId));
     asset.displayName = root.value("display_name", asset.id);
     asset.shaderType = MaterialShaderTypeFromString(root.value("shader_type", "lit"));
     asset.baseColor = Vec4FromJson(root.value("base_color", json::array()), glm::vec4{0.8F, 0.82F, 0.88F, 1.0F});
@@ -864,7 +1258,7 @@ bool LevelAssetIO::DeleteMaterial(const std::string& materialId, std::string* ou
 {
     EnsureAssetDirectories();
     std::error_code ec;
-    const bool removed = std::filesystem::remove(MaterialPathFromId(SanitizeName(materialId)), ec);
+    const bool removed = RemoveJsonFile(MaterialPathFromId(SanitizeName(materialId)), ec);
     if (ec && outError != nullptr)
     {
         *outError = "Failed to delete material: " + ec.message();
@@ -970,7 +1364,7 @@ bool LevelAssetIO::DeleteAnimationClip(const std::string& clipId, std::string* o
 {
     EnsureAssetDirectories();
     std::error_code ec;
-    const bool removed = std::filesystem::remove(AnimationPathFromId(SanitizeName(clipId)), ec);
+    const bool removed = RemoveJsonFile(AnimationPathFromId(SanitizeName(clipId)), ec);
     if (ec && outError != nullptr)
     {
         *outError = "Failed to delete animation clip: " + ec.message();
@@ -1098,7 +1492,7 @@ bool LevelAssetIO::DeleteEnvironment(const std::string& environmentId, std::stri
 {
     EnsureAssetDirectories();
     std::error_code ec;
-    const bool removed = std::filesystem::remove(EnvironmentPathFromId(SanitizeName(environmentId)), ec);
+    const bool removed = RemoveJsonFile(EnvironmentPathFromId(SanitizeName(environmentId)), ec);
     if (ec && outError != nullptr)
     {
         *outError = "Failed to delete environment: " + ec.message();
@@ -1166,12 +1560,30 @@ bool LevelAssetIO::LoadPrefab(const std::string& prefabId, PrefabAsset* outAsset
 
     EnsureAssetDirectories();
     const std::string sanitized = SanitizeName(prefabId);
+    const std::filesystem::path path = PrefabPathFromId(sanitized);
+    if (LoadBinaryCompanion(path, outAsset))
+    {
+        return true;
+    }
+
     json root;
-    if (!ReadJsonFile(PrefabPathFromId(sanitized), &root, outError))
+    std::uint64_t jsonHash = 0;
+    if (!ReadJsonFile(path, &root, outError, &jsonHash))
     {
         return false;
     }
+    PrefabAsset prefab;
+    if (!PrefabFromJson(root, sanitized, &prefab, outError))
+    {
+        return false;
+    }
+    LevelAssetBinary::Write(LevelAssetBinary::PathFor(path), prefab, jsonHash);
+    *outAsset = std::move(prefab);
+    return true;
+}
 
+bool LevelAssetIO::PrefabFromJson(const nlohmann::json& root, const std::string& fallbackId, PrefabAsset* outAsset, std::string* outError)
+{
     const int version = root.value("asset_version", -1);
     if (version != kEditorAssetVersion)
     {
@@ -1184,7 +1596,7 @@ bool LevelAssetIO::LoadPrefab(const std::string& prefabId, PrefabAsset* outAsset
 
     PrefabAsset prefab;
     prefab.assetVersion = version;
-    prefab.id = SanitizeName(root.value("id", sanitized));
+    prefab.id = SanitizeName(root.value("id", fallbackId));
     prefab.displayName = root.value("display_name", prefab.id);
 
     const json props = root.value("props", json::array());
@@ -1225,7 +1637,7 @@ bool LevelAssetIO::DeletePrefab(const std::string& prefabId, std::string* outErr
 {
     EnsureAssetDirectories();
     std::error_code ec;
-    const bool removed = std::filesystem::remove(PrefabPathFromId(SanitizeName(prefabId)), ec);
+    const bool removed = RemoveJsonFile(PrefabPathFromId(SanitizeName(prefabId)), ec);
     if (ec && outError != nullptr)
     {
         *outError = "Failed to delete prefab: " + ec.message();
@@ -1233,6 +1645,42 @@ bool LevelAssetIO::DeletePrefab(const std::string& prefabId, std::string* outErr
     return removed && !ec;
 }
 
+void LevelAssetIO::SaveLoopAsync(const LoopAsset& asset)
+{
+    EnsureAssetDirectories();
+    // One normalized snapshot is both what loads are served until the write lands and what the save
+    // thread serializes, so the caller only pays for the copy.
+    auto snapshot = std::make_shared<const LoopAsset>(NormalizedLoop(asset));
+    const std::string id = snapshot->id;
+    const std::filesystem::path path = LoopPathFromId(id);
+    SaveQueue::Instance().Enqueue(path, "loop " + id, snapshot, [snapshot, path, id](std::string* outError) {
+        const bool written = WriteJsonFile(path, LoopToJson(*snapshot), outError);
+        ForgetCachedLoop(id);
+        return written;
+    });
+}
+
+void LevelAssetIO::SaveMapAsync(const MapAsset& asset)
+{
+    EnsureAssetDirectories();
+    auto snapshot = std::make_shared<const MapAsset>(NormalizedMap(asset));
+    const std::string name = snapshot->name;
+    const std::filesystem::path path = MapPathFromName(name);
+    SaveQueue::Instance().Enqueue(path, "map " + name, snapshot, [snapshot, path](std::string* outError) {
+        return WriteJsonFile(path, MapToJson(*snapshot), outError);
+    });
+}
+
+std::vector<AssetSaveResult> LevelAssetIO::TakeFinishedSaves()
+{
+    return SaveQueue::Instance().TakeResults();
+}
+
+void LevelAssetIO::FlushSaves()
+{
+    SaveQueue::Instance().Flush();
+}
+
 std::vector<std::string> LevelAssetIO::ValidateLoop(const LoopAsset& asset)
 {
     std::vector<std::string> issues;
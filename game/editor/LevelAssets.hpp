@@ -8,6 +8,8 @@
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
 
+#include <nlohmann/json_fwd.hpp>
+
 #include "game/maps/TileGenerator.hpp"
 
 namespace game::editor
@@ -216,6 +218,14 @@ struct MapAsset
     std::vector<PropInstance> props;
 };
 
+/// Outcome of a background save, reported back to the editor on a later frame.
+struct AssetSaveResult
+{
+    std::string label; // e.g. "map main_map"
+    bool ok = false;
+    std::string error;
+};
+
 class LevelAssetIO
 {
 public:
@@ -252,6 +262,14 @@ public:
     [[nodiscard]] static bool LoadPrefab(const std::string& prefabId, PrefabAsset* outAsset, std::string* outError = nullptr);
     [[nodiscard]] static bool DeletePrefab(const std::string& prefabId, std::string* outError = nullptr);
 
+    /// Queue a save on the background save thread; a newer save of the same asset replaces a queued one.
+    /// Until the write lands, loads of that asset return the queued copy instead of touching the file.
+    static void SaveLoopAsync(const LoopAsset& asset);
+    static void SaveMapAsync(const MapAsset& asset);
+    [[nodiscard]] static std::vector<AssetSaveResult> TakeFinishedSaves();
+    /// Blocks until every queued save has been written.
+    static void FlushSaves();
+
     [[nodiscard]] static std::vector<std::string> ValidateLoop(const LoopAsset& asset);
 
     [[nodiscard]] static bool BuildGeneratedMapFromAsset(const MapAsset& mapAsset, maps::GeneratedMap* outMap, std::string* outError = nullptr);
@@ -259,5 +277,17 @@ public:
 
 private:
     [[nodiscard]] static std::string SanitizeName(const std::string& value);
+
+    // The asset exactly as the *ToJson writers save it and a load would read it back.
+    [[nodiscard]] static LoopAsset NormalizedLoop(LoopAsset asset);
+    [[nodiscard]] static MapAsset NormalizedMap(MapAsset asset);
+    // Asset -> JSON (normalized as saved), shared by the sync and background saves.
+    [[nodiscard]] static nlohmann::json LoopToJson(const LoopAsset& asset);
+    [[nodiscard]] static nlohmann::json MapToJson(const MapAsset& asset);
+    // JSON -> asset, shared by the loaders and the binary companion rebuild.
+    static bool LoopFromJson(const nlohmann::json& root, const std::string& fallbackId, LoopAsset* outAsset, std::string* outError);
+    static bool MapFromJson(const nlohmann::json& root, const std::string& fallbackName, MapAsset* outAsset, std::string* outError);
+    static bool MaterialFromJson(const nlohmann::json& root, const std::string& fallbackId, MaterialAsset* outAsset, std::string* outError);
+    static bool PrefabFromJson(const nlohmann::json& root, const std::string& fallbackId, PrefabAsset* outAsset, std::string* outError);
 };
 } // namespace game::editor
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
 #include <cctype>
 #include <cstdint>
 #include <cstring>
@@ -25,6 +26,8 @@
 #include <glm/trigonometric.hpp>
 #include <nlohmann/json.hpp>
 
+#include "engine/assets/ContentHash.hpp"
+
 #if BUILD_WITH_IMGUI
 #include <glad/glad.h>
 #include <imgui.h>
@@ -4082,6 +4085,7 @@ void LevelEditor::RefreshContentBrowser()
 
 void LevelEditor::ClearContentPreviewCache()
 {
+    assert(engine::render::RenderThread::CallingThreadOwnsContext() && "GL call without the context");
 #if BUILD_WITH_IMGUI
     for (auto& [_, preview] : m_contentPreviews)
     {
@@ -4096,23 +4100,29 @@ void LevelEditor::ClearContentPreviewCache()
     m_contentPreviewLru.clear();
 }
 
-unsigned int LevelEditor::GetOrCreateMeshSurfaceAlbedoTexture(
-    const std::string& meshPath,
+engine::assets::TextureHandle LevelEditor::GetOrCreateMeshSurfaceAlbedoTexture(
+    std::uint64_t meshContentHash,
     std::size_t surfaceIndex,
     const engine::assets::MeshSurfaceData& surface
 ) const
 {
+    assert(engine::render::RenderThread::CallingThreadOwnsContext() && "GL call without the context");
 #if BUILD_WITH_IMGUI
     if (surface.albedoPixels.empty() || surface.albedoWidth <= 0 || surface.albedoHeight <= 0 || surface.albedoChannels <= 0)
     {
-        return 0;
+        return nullptr;
     }
 
-    const std::string key = meshPath + "#" + std::to_string(surfaceIndex);
-    const auto existing = m_meshAlbedoTextures.find(key);
-    if (existing != m_meshAlbedoTextures.end())
+    // Content-addressed: the mesh's source hash plus the surface index, or the pixels themselves when
+    // the mesh could not be hashed.
+    std::uint64_t key = meshContentHash != 0
+                            ? engine::assets::ContentHash(&surfaceIndex, sizeof(surfaceIndex), meshContentHash)
+                            : engine::assets::ContentHash(surface.albedoPixels.data(), surface.albedoPixels.size());
+    key = engine::assets::ContentHash(&surface.albedoWidth, sizeof(surface.albedoWidth), key);
+    auto& assets = engine::assets::AssetManager::Instance();
+    if (engine::assets::TextureHandle existing = assets.FindTexture(key))
     {
-        return existing->second;
+        return existing;
     }
 
     const int width = surface.albedoWidth;
@@ -4137,7 +4147,7 @@ unsigned int LevelEditor::GetOrCreateMeshSurfaceAlbedoTexture(
     glGenTextures(1, &texture);
     if (texture == 0)
     {
-        return 0;
+        return nullptr;
     }
     glBindTexture(GL_TEXTURE_2D, texture);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
@@ -4159,15 +4169,44 @@ unsigned int LevelEditor::GetOrCreateMeshSurfaceAlbedoTexture(
         GL_RGBA,
         GL_UNSIGNED_BYTE,
         rgba.data());
-    glGenerateMipmap(GL_TEXTURE_2D);
+    if (channels == 4 && !surface.albedoMips.empty())
+    {
+        // Cooked meshes carry a gamma-correct mip chain; upload it instead of regenerating.
+        int levelWidth = width;
+        int levelHeight = height;
+        for (std::size_t level = 0; level < surface.albedoMips.size(); ++level)
+        {
+            levelWidth = glm::max(1, levelWidth / 2);
+            levelHeight = glm::max(1, levelHeight / 2);
+            glTexImage2D(
+                GL_TEXTURE_2D,
+                static_cast<GLint>(level + 1),
+                GL_SRGB8_ALPHA8,
+                levelWidth,
+                levelHeight,
+                0,
+                GL_RGBA,
+                GL_UNSIGNED_BYTE,
+                surface.albedoMips[level].data());
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(surface.albedoMips.size()));
+    }
+    else
+    {
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
     glBindTexture(GL_TEXTURE_2D, 0);
-    m_meshAlbedoTextures.emplace(key, texture);
-    return texture;
+    // RGBA8 with a full mip chain: 4/3 of level 0.
+    const std::size_t bytes = static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4U * 4U / 3U;
+    return assets.AddTexture(key, texture, bytes, [](unsigned int id) {
+        GLuint glTex = static_cast<GLuint>(id);
+        glDeleteTextures(1, &glTex);
+    });
 #else
-    (void)meshPath;
+    (void)meshContentHash;
     (void)surfaceIndex;
     (void)surface;
-    return 0;
+    return nullptr;
 #endif
 }
 
@@ -4313,10 +4352,11 @@ bool LevelEditor::EnsureCachedMeshAssetEntry(
     {
         std::string loadError;
         const std::filesystem::path absolute = m_assetRegistry.AbsolutePath(meshAsset);
-        entry.meshData = m_meshLibrary.LoadMesh(absolute, &loadError);
+        entry.meshHandle = engine::assets::AssetManager::Instance().Meshes().AcquireMesh(absolute);
+        entry.meshData = &entry.meshHandle->Data();
         entry.initialized = true;
-        entry.loadFailed = (entry.meshData == nullptr) || !entry.meshData->loaded;
-        entry.loadError = loadError;
+        entry.loadFailed = !entry.meshData->loaded;
+        entry.loadError = entry.meshData->error;
 
         if (!entry.loadFailed && entry.meshData != nullptr)
         {
@@ -4327,7 +4367,8 @@ bool LevelEditor::EnsureCachedMeshAssetEntry(
                 {
                     const auto& surface = entry.meshData->surfaces[surfaceIndex];
                     CachedMeshSurface& cachedSurface = entry.surfaces[surfaceIndex];
-                    cachedSurface.albedoTexture = GetOrCreateMeshSurfaceAlbedoTexture(meshAsset, surfaceIndex, surface);
+                    cachedSurface.albedoHandle = GetOrCreateMeshSurfaceAlbedoTexture(entry.meshHandle->ContentHash(), surfaceIndex, surface);
+                    cachedSurface.albedoTexture = cachedSurface.albedoHandle != nullptr ? cachedSurface.albedoHandle->id : 0U;
                     cachedSurface.textured = cachedSurface.albedoTexture != 0;
                 }
             }
@@ -4378,21 +4419,11 @@ void LevelEditor::ReleaseCachedMeshAssets(engine::render::Renderer& renderer) co
 
 void LevelEditor::ClearMeshAlbedoTextureCache() const
 {
+    // Dropping the handles leaves the textures cached in the AssetManager until the budget needs room.
     if (m_cachedMeshRenderer != nullptr)
     {
         ReleaseCachedMeshAssets(*m_cachedMeshRenderer);
     }
-#if BUILD_WITH_IMGUI
-    for (auto& [_, texture] : m_meshAlbedoTextures)
-    {
-        if (texture != 0)
-        {
-            GLuint glTex = static_cast<GLuint>(texture);
-            glDeleteTextures(1, &glTex);
-        }
-    }
-#endif
-    m_meshAlbedoTextures.clear();
 }
 
 void LevelEditor::TouchContentPreviewLru(const std::string& key)
@@ -4412,6 +4443,7 @@ void LevelEditor::TouchContentPreviewLru(const std::string& key)
 
 void LevelEditor::EnforceContentPreviewLru()
 {
+    assert(engine::render::RenderThread::CallingThreadOwnsContext() && "GL call without the context");
     if (m_contentPreviewLruCapacity == 0)
     {
         m_contentPreviewLruCapacity = 64;
@@ -5718,7 +5750,7 @@ void LevelEditor::PlaceImportedAssetAtHovered(const std::string& relativeAssetPa
     prop.halfExtents = glm::vec3{0.8F, 0.8F, 0.8F};
     std::string meshLoadError;
     if (const engine::assets::MeshData* meshData =
-            m_meshLibrary.LoadMesh(m_assetRegistry.AbsolutePath(relativeAssetPath), &meshLoadError);
+            engine::assets::AssetManager::Instance().Meshes().LoadMesh(m_assetRegistry.AbsolutePath(relativeAssetPath), &meshLoadError);
         meshData != nullptr && meshData->loaded)
     {
         const glm::vec3 boundsSize = glm::max(glm::vec3{0.1F}, meshData->boundsMax - meshData->boundsMin);
@@ -11255,17 +11287,23 @@ void LevelEditor::DrawUi(
     m_sceneViewportRectMax = glm::vec2{0.0F};
     m_contentBrowserHovered = false;
 
-    auto saveCurrentLoop = [this]() {
-        std::string error;
-        if (LevelAssetIO::SaveLoop(m_loop, &error))
+    for (const AssetSaveResult& saved : LevelAssetIO::TakeFinishedSaves())
+    {
+        if (saved.ok)
         {
-            m_statusLine = "Saved loop " + m_loop.id;
+            m_statusLine = "Saved " + saved.label;
             RefreshLibraries();
         }
         else
         {
-            m_statusLine = "Save failed: " + error;
+            m_statusLine = "Save " + saved.label + " failed: " + saved.error;
         }
+    }
+
+    // Loop/map writes go to the background save thread; the result lands in the status line above.
+    auto saveCurrentLoop = [this]() {
+        LevelAssetIO::SaveLoopAsync(m_loop);
+        m_statusLine = "Saving loop " + m_loop.id + "...";
     };
 
     auto saveCurrentMap = [this]() {
@@ -11280,15 +11318,8 @@ void LevelEditor::DrawUi(
             return;
         }
         m_map.environmentAssetId = m_environmentEditing.id;
-        if (LevelAssetIO::SaveMap(m_map, &error))
-        {
-            m_statusLine = "Saved map " + m_map.name;
-            RefreshLibraries();
-        }
-        else
-        {
-            m_statusLine = "Save map failed: " + error;
-        }
+        LevelAssetIO::SaveMapAsync(m_map);
+        m_statusLine = "Saving map " + m_map.name + "...";
     };
 
     ImGuiViewport* viewport = ImGui::GetMainViewport();
@@ -13423,7 +13454,7 @@ void LevelEditor::DrawUi(
             else if (entry.kind == engine::assets::AssetKind::Mesh)
             {
                 std::string meshError;
-                if (const engine::assets::MeshData* meshData = m_meshLibrary.LoadMesh(absolute, &meshError);
+                if (const engine::assets::MeshData* meshData = engine::assets::AssetManager::Instance().Meshes().LoadMesh(absolute, &meshError);
                     meshData != nullptr && meshData->loaded)
                 {
                     width = 96;
@@ -13721,7 +13752,7 @@ void LevelEditor::DrawUi(
             if (kind == engine::assets::AssetKind::Mesh)
             {
                 std::string err;
-                const engine::assets::MeshData* md = m_meshLibrary.LoadMesh(m_assetRegistry.AbsolutePath(m_selectedContentPath), &err);
+                const engine::assets::MeshData* md = engine::assets::AssetManager::Instance().Meshes().LoadMesh(m_assetRegistry.AbsolutePath(m_selectedContentPath), &err);
                 if (md != nullptr && md->loaded)
                 {
                     const glm::vec3 size = md->boundsMax - md->boundsMin;
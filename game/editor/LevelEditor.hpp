@@ -14,6 +14,7 @@
 #include <glm/vec3.hpp>
 
 #include "engine/assets/AssetRegistry.hpp"
+#include "engine/assets/AssetManager.hpp"
 #include "engine/assets/MeshLibrary.hpp"
 #include "engine/fx/FxSystem.hpp"
 #include "engine/platform/Input.hpp"
@@ -392,8 +393,8 @@ private:
     void ClearContentPreviewCache();
     void TouchContentPreviewLru(const std::string& key);
     void EnforceContentPreviewLru();
-    unsigned int GetOrCreateMeshSurfaceAlbedoTexture(
-        const std::string& meshPath,
+    [[nodiscard]] engine::assets::TextureHandle GetOrCreateMeshSurfaceAlbedoTexture(
+        std::uint64_t meshContentHash,
         std::size_t surfaceIndex,
         const engine::assets::MeshSurfaceData& surface
     ) const;
@@ -416,6 +417,7 @@ private:
     {
         engine::render::Renderer::GpuMeshId gpuMeshId = engine::render::Renderer::kInvalidGpuMesh;
         unsigned int albedoTexture = 0;
+        engine::assets::TextureHandle albedoHandle; // keeps albedoTexture resident in the AssetManager
         bool textured = false;
     };
     struct CachedMeshAssetEntry
@@ -424,6 +426,7 @@ private:
         bool loadFailed = false;
         std::string loadError;
         engine::assets::MeshData const* meshData = nullptr;
+        engine::assets::MeshHandle meshHandle; // pins meshData in the shared mesh cache
         std::vector<CachedMeshSurface> surfaces;
     };
     [[nodiscard]] bool EnsureCachedMeshAssetEntry(
@@ -601,7 +604,6 @@ private:
     std::unordered_map<std::string, ContentPreviewTexture> m_contentPreviews;
     std::vector<std::string> m_contentPreviewLru;
     std::size_t m_contentPreviewLruCapacity = 192;
-    mutable std::unordered_map<std::string, unsigned int> m_meshAlbedoTextures;
     mutable std::unordered_map<std::string, CachedMeshAssetEntry> m_cachedMeshAssets;
     mutable std::unordered_map<std::string, engine::render::Renderer::GpuMeshId> m_cachedMeshSurfaceVariants;
     mutable engine::render::Renderer* m_cachedMeshRenderer = nullptr;
@@ -630,7 +632,6 @@ private:
     std::string m_animationPreviewClip;
     mutable std::unordered_map<std::string, MaterialAsset> m_materialCache;
     mutable std::unordered_map<std::string, AnimationClipAsset> m_animationCache;
-    mutable engine::assets::MeshLibrary m_meshLibrary;
     engine::fx::FxSystem m_fxPreviewSystem{};
     std::vector<std::string> m_fxLibrary;
     int m_selectedFxIndex = -1;
@@ -8,6 +8,7 @@
 #include <array>
 #include <cassert>
 #include <cctype>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
@@ -31,7 +32,9 @@
 #include <tiny_gltf.h>
 
 #include "engine/platform/Input.hpp"
+#include "engine/render/LodSelector.hpp"
 #include "engine/render/Renderer.hpp"
+#include "engine/assets/AssetManager.hpp"
 #include "engine/assets/MeshLibrary.hpp"
 #include "engine/core/Profiler.hpp"
 #include "engine/physics/ColliderGen_WallBoxes.hpp"
@@ -45,6 +48,7 @@ namespace
 constexpr float kGravity = -20.0F;
 constexpr float kPi = 3.1415926535F;
 constexpr float kPovLodBufferScale = 1.10F; // Dynamic actor edge buffer for low-LOD fallback
+constexpr float kMeshUploadBudgetMs = 2.0F;  // Per-frame main-thread budget for async mesh uploads
 
 engine::scene::Entity SpawnActor(
     engine::scene::World& world,
@@ -874,10 +878,20 @@ GameplaySystems::GameplaySystems()
 {
 }
 
+void GameplaySystems::PreloadAssets()
+{
+    m_fxSystem.Initialize("assets/fx");
+    m_loadoutCatalogLoaded = m_loadoutCatalog.Initialize("assets");
+    m_assetsPreloaded = true;
+}
+
 void GameplaySystems::Initialize(engine::core::EventBus& eventBus)
 {
     m_eventBus = &eventBus;
-    m_fxSystem.Initialize("assets/fx");
+    if (!m_assetsPreloaded)
+    {
+        PreloadAssets();
+    }
     m_fxSystem.SetSpawnCallback([this](const engine::fx::FxSpawnEvent& event) {
         if (m_fxReplicationCallback)
         {
@@ -1063,6 +1077,8 @@ void GameplaySystems::FixedUpdate(float fixedDt, const engine::platform::Input&
     (void)input;
     (void)controlsEnabled;
 
+    ++m_serverTick;
+
     // Rebuild physics only when world geometry changed (pallet drop/break, trap placement, etc.).
     // For the killer chase trigger (which moves every tick), update its position in-place.
     if (m_physicsDirty)
@@ -1085,7 +1101,12 @@ void GameplaySystems::FixedUpdate(float fixedDt, const engine::platform::Input&
     RoleCommand survivorCommand = m_localSurvivorCommand;
     RoleCommand killerCommand = m_localKillerCommand;
 
-    if (m_networkAuthorityMode)
+    if (m_dedicatedServerMode)
+    {
+        survivorCommand = m_remoteSurvivorCommand.value_or(RoleCommand{});
+        killerCommand = m_remoteKillerCommand.value_or(RoleCommand{});
+    }
+    else if (m_networkAuthorityMode)
     {
         if (m_controlledRole == ControlledRole::Survivor)
         {
@@ -1361,7 +1382,7 @@ void GameplaySystems::FixedUpdate(float fixedDt, const engine::platform::Input&
         if (survivorActorIt != m_world.Actors().end())
         {
             const RoleCommand* command = nullptr;
-            if (m_controlledRole == ControlledRole::Survivor)
+            if (m_controlledRole == ControlledRole::Survivor && !m_dedicatedServerMode)
             {
                 command = &m_localSurvivorCommand;
             }
@@ -1384,6 +1405,8 @@ void GameplaySystems::FixedUpdate(float fixedDt, const engine::platform::Input&
         UpdateBloodPools(fixedDt, survivorPos, survivorInjuredOrDowned, survivorMoving);
     }
 
+    RecordLagCompensationFrame();
+
     m_localSurvivorCommand.lookDelta = glm::vec2{0.0F};
     m_localSurvivorCommand.interactPressed = false;
     m_localSurvivorCommand.jumpPressed = false;
@@ -1582,11 +1605,23 @@ void GameplaySystems::Render(engine::render::Renderer& renderer, float aspectRat
     if (!m_selectedSurvivorCharacterId.empty())
     {
         (void)EnsureSurvivorCharacterMeshLoaded(m_selectedSurvivorCharacterId);
+    }
+    {
+        // Meshes decoded on workers are uploaded here within a small per-frame budget.
+        const auto uploadStart = std::chrono::steady_clock::now();
+        auto& uploadStats = engine::core::Profiler::Instance().StatsMut();
+        uploadStats.meshUploadsDone = static_cast<std::uint32_t>(m_meshUploads.Drain(renderer, kMeshUploadBudgetMs));
+        uploadStats.meshUploadsQueued = static_cast<std::uint32_t>(m_meshUploads.PendingCount());
+        uploadStats.meshUploadMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - uploadStart).count();
+    }
+    if (!m_selectedSurvivorCharacterId.empty())
+    {
         RefreshAnimatedSurvivorMeshIfNeeded(m_selectedSurvivorCharacterId);
     }
 
     const glm::mat4 viewProjection = BuildViewProjection(aspectRatio);
     m_frustum.Extract(viewProjection);
+    m_occlusionCuller.Update(viewProjection, m_cameraPosition, m_frustum);
 
     glm::vec3 postFxColor = m_fxSystem.PostFxPulseColor();
     float postFxIntensity = m_fxSystem.PostFxPulseIntensity();
@@ -1754,15 +1789,16 @@ void GameplaySystems::Render(engine::render::Renderer& renderer, float aspectRat
         EdgeLow
     };
 
-    // Helper: test if an AABB at (center ± halfExtents) is inside frustum.
+    // Helper: test if an AABB at (center ± halfExtents) is inside frustum and not hidden behind walls.
     const auto isVisible = [this](const glm::vec3& center, const glm::vec3& halfExtents) -> bool {
-        return m_frustum.IntersectsAABB(center - halfExtents, center + halfExtents);
+        return m_frustum.IntersectsAABB(center - halfExtents, center + halfExtents) &&
+               !m_occlusionCuller.IsOccluded(center - halfExtents, center + halfExtents);
     };
 
     const auto classifyVisibility = [this](const glm::vec3& center, const glm::vec3& halfExtents) -> VisibilityLod {
         if (m_frustum.IntersectsAABB(center - halfExtents, center + halfExtents))
         {
-            return VisibilityLod::Full;
+            return m_occlusionCuller.IsOccluded(center - halfExtents, center + halfExtents) ? VisibilityLod::Culled : VisibilityLod::Full;
         }
 
         const glm::vec3 expandedHalfExtents = halfExtents * kPovLodBufferScale;
@@ -1776,13 +1812,7 @@ void GameplaySystems::Render(engine::render::Renderer& renderer, float aspectRat
 
     if (m_staticBatcher.IsBuilt())
     {
-        m_staticBatcher.Render(
-            viewProjection,
-            m_frustum,
-            renderer.GetSolidShaderProgram(),
-            renderer.GetSolidViewProjLocation(),
-            renderer.GetSolidModelLocation()
-        );
+        m_staticBatcher.Render(renderer, m_frustum, &m_occlusionCuller);
     }
 
     for (const auto& [entity, window] : m_world.Windows())
@@ -1938,18 +1968,28 @@ void GameplaySystems::Render(engine::render::Renderer& renderer, float aspectRat
     // Render imported test survivor models (spawn_test_models / spawn_test_models_here).
     if (m_testModels.spawned)
     {
+        // Placeholder boxes stand in while the meshes are still loading.
+        const glm::vec3 placeholderHalfExtents{0.3F, 0.9F, 0.3F};
         if (m_testModelMeshes.maleBody != engine::render::Renderer::kInvalidGpuMesh)
         {
             const glm::vec3 modelPos = m_testModels.malePosition + glm::vec3{0.0F, m_testModelMeshes.maleFeetOffset, 0.0F};
             const glm::mat4 modelMatrix = glm::translate(glm::mat4{1.0F}, modelPos);
             renderer.DrawGpuMesh(m_testModelMeshes.maleBody, modelMatrix);
         }
+        else if (m_testModelMeshes.malePending != nullptr)
+        {
+            renderer.DrawBox(m_testModels.malePosition + glm::vec3{0.0F, placeholderHalfExtents.y, 0.0F}, placeholderHalfExtents, glm::vec3{0.23F, 0.51F, 0.96F} * 0.5F);
+        }
         if (m_testModelMeshes.femaleBody != engine::render::Renderer::kInvalidGpuMesh)
         {
             const glm::vec3 modelPos = m_testModels.femalePosition + glm::vec3{0.0F, m_testModelMeshes.femaleFeetOffset, 0.0F};
             const glm::mat4 modelMatrix = glm::translate(glm::mat4{1.0F}, modelPos);
             renderer.DrawGpuMesh(m_testModelMeshes.femaleBody, modelMatrix);
         }
+        else if (m_testModelMeshes.femalePending != nullptr)
+        {
+            renderer.DrawBox(m_testModels.femalePosition + glm::vec3{0.0F, placeholderHalfExtents.y, 0.0F}, placeholderHalfExtents, glm::vec3{0.93F, 0.27F, 0.60F} * 0.5F);
+        }
     }
 
     // Render debug static boxes (test models, etc.)
@@ -2022,7 +2062,13 @@ void GameplaySystems::Render(engine::render::Renderer& renderer, float aspectRat
             continue;
         }
 
-        if (!isVisible(transformIt->second.position, generator.halfExtents))
+        // Revealed generators show an aura through walls, so only the frustum may cull them.
+        const auto revealIt = m_mapRevealGenerators.find(entity);
+        const bool revealed = revealIt != m_mapRevealGenerators.end() && revealIt->second > 0.0F;
+        const bool generatorVisible = revealed
+                                          ? m_frustum.IntersectsAABB(transformIt->second.position - generator.halfExtents, transformIt->second.position + generator.halfExtents)
+                                          : isVisible(transformIt->second.position, generator.halfExtents);
+        if (!generatorVisible)
         {
             ++dynamicCulled;
             continue;
@@ -2042,8 +2088,7 @@ void GameplaySystems::Render(engine::render::Renderer& renderer, float aspectRat
 
         renderer.DrawBox(transformIt->second.position, generator.halfExtents, generatorColor);
 
-        const auto revealIt = m_mapRevealGenerators.find(entity);
-        if (revealIt != m_mapRevealGenerators.end() && revealIt->second > 0.0F)
+        if (revealed)
         {
             const float alpha = glm::clamp(revealIt->second / std::max(0.01F, m_tuning.mapRevealDurationSeconds), 0.0F, 1.0F);
             const glm::vec3 auraColor = glm::vec3{0.35F, 0.95F, 1.0F} * (0.5F + 0.5F * alpha);
@@ -2565,6 +2610,12 @@ void GameplaySystems::Render(engine::render::Renderer& renderer, float aspectRat
     RenderBloodPools(renderer, localIsKiller);
 
     // High-poly meshes for GPU stress testing (benchmark map)
+    {
+        auto& lodStats = engine::core::Profiler::Instance().StatsMut();
+        lodStats.meshLodFullDraws = 0;
+        lodStats.meshLodReducedDraws = 0;
+        lodStats.meshLodImpostors = 0;
+    }
     RenderHighPolyMeshes(renderer);
 
     // Custom loop meshes
@@ -2588,21 +2639,31 @@ void GameplaySystems::Render(engine::render::Renderer& renderer, float aspectRat
     auto& profStats = engine::core::Profiler::Instance().StatsMut();
     profStats.dynamicObjectsDrawn = dynamicDrawn;
     profStats.dynamicObjectsCulled = dynamicCulled;
+    const engine::render::OcclusionCuller::Stats occlusionStats = m_occlusionCuller.GetStats();
+    profStats.occlusionOccluders = occlusionStats.occludersRasterized;
+    profStats.occlusionTriangles = occlusionStats.trianglesRasterized;
+    profStats.occlusionTested = occlusionStats.tested;
+    profStats.occlusionCulled = occlusionStats.culled;
+    profStats.occlusionRasterMs = occlusionStats.rasterMs;
 }
 
 glm::mat4 GameplaySystems::BuildViewProjection(float aspectRatio) const
 {
     const glm::mat4 view = glm::lookAt(m_cameraPosition, m_cameraTarget, glm::vec3{0.0F, 1.0F, 0.0F});
-    float fovDeg = 60.0F;
+    const glm::mat4 projection = glm::perspective(glm::radians(CameraFovDegrees()), aspectRatio > 0.0F ? aspectRatio : (16.0F / 9.0F), 0.05F, 400.0F);
+    return projection * view;
+}
+
+float GameplaySystems::CameraFovDegrees() const
+{
     if (m_controlledRole == ControlledRole::Survivor &&
         m_survivorLoadout.itemId == "flashlight" &&
         m_survivorItemState.active &&
         m_survivorItemState.charges > 0.0F)
     {
-        fovDeg = 48.0F;
+        return 48.0F;
     }
-    const glm::mat4 projection = glm::perspective(glm::radians(fovDeg), aspectRatio > 0.0F ? aspectRatio : (16.0F / 9.0F), 0.05F, 400.0F);
-    return projection * view;
+    return 60.0F;
 }
 
 HudState GameplaySystems::BuildHudState() const
@@ -3397,6 +3458,7 @@ HudState GameplaySystems::BuildHudState() const
 void GameplaySystems::LoadMap(const std::string& mapName)
 {
     m_staticBatcher.Clear();
+    m_occlusionCuller.ClearOccluders();
 
     if (mapName == "test")
     {
@@ -3556,8 +3618,7 @@ void GameplaySystems::SpawnWindow(std::optional<float> yawDegrees)
     // Try to read mesh bounds so we can place bottom vertices exactly on floor.
     float meshMinY = -kWindowHalfExtents.y;
     {
-        static engine::assets::MeshLibrary fallbackMeshLibrary;
-        engine::assets::MeshLibrary* meshLibrary = (m_meshLibrary != nullptr) ? m_meshLibrary : &fallbackMeshLibrary;
+        engine::assets::MeshLibrary* meshLibrary = &MeshLibraryForLoads();
 
         std::error_code ec;
         std::filesystem::path meshPath = std::filesystem::current_path(ec) / kWindowMeshPath;
@@ -4092,6 +4153,7 @@ void GameplaySystems::ApplyGameplayTuning(const GameplayTuning& tuning)
 
     m_tuning.serverTickRate = (m_tuning.serverTickRate <= 30) ? 30 : 60;
     m_tuning.interpolationBufferMs = glm::clamp(m_tuning.interpolationBufferMs, 50, 1000);
+    m_tuning.lagCompensationMaxMs = glm::clamp(m_tuning.lagCompensationMaxMs, 0, 1000);
 
     // Keep survivor capsule auto-fit in sync with the latest gameplay tuning caps.
     RefreshSurvivorModelCapsuleOverride();
@@ -4198,6 +4260,16 @@ void GameplaySystems::SetNetworkAuthorityMode(bool enabled)
     }
 }
 
+void GameplaySystems::SetDedicatedServerMode(bool enabled)
+{
+    m_dedicatedServerMode = enabled;
+    if (enabled)
+    {
+        m_headless = true;
+        SetNetworkAuthorityMode(true);
+    }
+}
+
 void GameplaySystems::SetRemoteRoleCommand(engine::scene::Role role, const RoleCommand& command)
 {
     if (role == engine::scene::Role::Survivor)
@@ -4216,6 +4288,90 @@ void GameplaySystems::ClearRemoteRoleCommands()
     m_remoteKillerCommand.reset();
 }
 
+std::uint32_t GameplaySystems::ClientViewTick() const
+{
+    if (m_clientLatestServerTick == 0)
+    {
+        return 0;
+    }
+    const auto lag = static_cast<std::uint32_t>(std::lround(m_clientViewLagTicks));
+    return m_clientLatestServerTick > lag ? m_clientLatestServerTick - lag : 1U;
+}
+
+void GameplaySystems::RecordLagCompensationFrame()
+{
+    LagCompensationFrame& frame = m_lagCompHistory[m_serverTick % kLagCompensationHistory];
+    frame.tick = m_serverTick;
+    frame.positions.clear();
+    for (const auto& [entity, actor] : m_world.Actors())
+    {
+        (void)actor;
+        const auto transformIt = m_world.Transforms().find(entity);
+        if (transformIt != m_world.Transforms().end())
+        {
+            frame.positions.emplace_back(entity, transformIt->second.position);
+        }
+    }
+}
+
+int GameplaySystems::KillerRewindTicks()
+{
+    // Only a remote killer sees the world late; local input is judged against the present.
+    const bool killerIsRemote = m_networkAuthorityMode &&
+                                (m_dedicatedServerMode || m_controlledRole == ControlledRole::Survivor);
+    if (!killerIsRemote || !m_remoteKillerCommand.has_value() || m_remoteKillerCommand->viewTick == 0)
+    {
+        m_lagCompStats.lastRewindTicks = 0;
+        m_lagCompStats.lastRewindMs = 0.0F;
+        return 0;
+    }
+
+    const int tickRate = std::max(1, m_tuning.serverTickRate);
+    const int windowTicks = std::min(
+        static_cast<int>(kLagCompensationHistory) - 1,
+        (m_tuning.lagCompensationMaxMs * tickRate + 999) / 1000
+    );
+    const std::uint32_t viewTick = m_remoteKillerCommand->viewTick;
+    int rewind = viewTick < m_serverTick ? static_cast<int>(std::min<std::uint32_t>(m_serverTick - viewTick, 0x7FFFFFFFU)) : 0;
+    if (rewind > windowTicks)
+    {
+        rewind = windowTicks;
+        ++m_lagCompStats.clampedChecks;
+    }
+
+    m_lagCompStats.windowTicks = windowTicks;
+    m_lagCompStats.lastRewindTicks = rewind;
+    m_lagCompStats.lastRewindMs = static_cast<float>(rewind) * 1000.0F / static_cast<float>(tickRate);
+    m_lagCompStats.maxRewindTicks = std::max(m_lagCompStats.maxRewindTicks, rewind);
+    ++m_lagCompStats.rewoundChecks;
+    return rewind;
+}
+
+glm::vec3 GameplaySystems::RewoundPosition(engine::scene::Entity entity, int rewindTicks) const
+{
+    const auto transformIt = m_world.Transforms().find(entity);
+    const glm::vec3 current = transformIt != m_world.Transforms().end() ? transformIt->second.position : glm::vec3{0.0F};
+    if (rewindTicks <= 0 || static_cast<std::uint32_t>(rewindTicks) >= m_serverTick)
+    {
+        return current;
+    }
+
+    const std::uint32_t tick = m_serverTick - static_cast<std::uint32_t>(rewindTicks);
+    const LagCompensationFrame& frame = m_lagCompHistory[tick % kLagCompensationHistory];
+    if (frame.tick != tick)
+    {
+        return current;
+    }
+    for (const auto& [frameEntity, position] : frame.positions)
+    {
+        if (frameEntity == entity)
+        {
+            return position;
+        }
+    }
+    return current;
+}
+
 GameplaySystems::Snapshot GameplaySystems::BuildSnapshot() const
 {
     Snapshot snapshot;
@@ -4231,7 +4387,7 @@ GameplaySystems::Snapshot GameplaySystems::BuildSnapshot() const
     snapshot.killerPowerId = m_killerLoadout.powerId;
     snapshot.killerPowerAddonA = m_killerLoadout.addonAId;
     snapshot.killerPowerAddonB = m_killerLoadout.addonBId;
-    snapshot.survivorState = static_cast<std::uint8_t>(m_survivorState);
+    snapshot.serverTick = m_serverTick;
     snapshot.killerAttackState = static_cast<std::uint8_t>(m_killerAttackState);
     snapshot.killerAttackStateTimer = m_killerAttackStateTimer;
     snapshot.killerLungeCharge = m_killerLungeChargeSeconds;
@@ -4259,7 +4415,8 @@ GameplaySystems::Snapshot GameplaySystems::BuildSnapshot() const
     snapshot.blinkChargeRegenTimer = m_killerPowerState.blinkChargeRegenTimer;
     snapshot.blinkTargetPosition = m_killerPowerState.blinkTargetPosition;
 
-    auto fillActor = [&](engine::scene::Entity entity, ActorSnapshot& outActor) {
+    auto fillActor = [&](engine::scene::Role role, std::uint8_t slot) {
+        const engine::scene::Entity entity = ActorEntityForSlot(role, slot);
         const auto transformIt = m_world.Transforms().find(entity);
         const auto actorIt = m_world.Actors().find(entity);
         if (transformIt == m_world.Transforms().end() || actorIt == m_world.Actors().end())
@@ -4267,15 +4424,24 @@ GameplaySystems::Snapshot GameplaySystems::BuildSnapshot() const
             return;
         }
 
-        outActor.position = transformIt->second.position;
-        outActor.forward = transformIt->second.forward;
-        outActor.velocity = actorIt->second.velocity;
-        outActor.yaw = transformIt->second.rotationEuler.y;
-        outActor.pitch = transformIt->second.rotationEuler.x;
+        ActorSnapshot actor;
+        actor.role = role;
+        actor.slot = slot;
+        actor.healthState = role == engine::scene::Role::Survivor ? static_cast<std::uint8_t>(m_survivorState) : 0U;
+        actor.position = transformIt->second.position;
+        actor.forward = transformIt->second.forward;
+        actor.velocity = actorIt->second.velocity;
+        actor.yaw = transformIt->second.rotationEuler.y;
+        actor.pitch = transformIt->second.rotationEuler.x;
+        snapshot.actors.push_back(actor);
     };
 
-    fillActor(m_survivor, snapshot.survivor);
-    fillActor(m_killer, snapshot.killer);
+    snapshot.actors.reserve(1 + kMaxReplicatedSurvivors);
+    fillActor(engine::scene::Role::Killer, 0);
+    for (std::uint8_t slot = 0; slot < kMaxReplicatedSurvivors; ++slot)
+    {
+        fillActor(engine::scene::Role::Survivor, slot);
+    }
 
     snapshot.pallets.reserve(m_world.Pallets().size());
     for (const auto& [entity, pallet] : m_world.Pallets())
@@ -4333,11 +4499,161 @@ GameplaySystems::Snapshot GameplaySystems::BuildSnapshot() const
         snapshot.groundItems.push_back(itemSnapshot);
     }
 
+    snapshot.scratchMarks.reserve(kScratchMarkPoolSize);
+    for (const ScratchMark& mark : m_scratchMarks)
+    {
+        if (!mark.active)
+        {
+            continue;
+        }
+        ScratchMarkSnapshot markSnapshot;
+        markSnapshot.position = mark.position;
+        markSnapshot.yawDeg = mark.yawDeg;
+        markSnapshot.age = mark.age;
+        markSnapshot.lifetime = mark.lifetime;
+        markSnapshot.size = mark.size;
+        snapshot.scratchMarks.push_back(markSnapshot);
+    }
+
     return snapshot;
 }
 
+GameplaySystems::Snapshot GameplaySystems::FilterSnapshotForViewer(const Snapshot& full, const ReplicationViewer& viewer) const
+{
+    const ReplicationRelevancy& relevancy = m_replicationRelevancy;
+
+    Snapshot filtered = full;
+    filtered.actors.clear();
+    filtered.pallets.clear();
+    filtered.traps.clear();
+    filtered.groundItems.clear();
+    filtered.scratchMarks.clear();
+    filtered.relevancyRadius = relevancy.maxRadius;
+
+    const auto findActor = [&](engine::scene::Role role, std::uint8_t slot) {
+        return std::find_if(full.actors.begin(), full.actors.end(), [&](const ActorSnapshot& actor) {
+            return actor.role == role && actor.slot == slot;
+        });
+    };
+    auto viewerIt = findActor(viewer.role, viewer.slot);
+    if (viewerIt == full.actors.end() && viewer.slot != 0)
+    {
+        // Spectating slots have no pawn; their camera follows the role's pawn, which the client
+        // also uses as the center when culling.
+        viewerIt = findActor(viewer.role, 0);
+    }
+    if (viewerIt == full.actors.end())
+    {
+        // Nothing spawned to center on yet: public state only. Traps, ground items and scratch
+        // marks are withheld and the client keeps whatever it already has.
+        filtered.actors = full.actors;
+        filtered.pallets = full.pallets;
+        filtered.relevancyRadius = kRelevancyPublicOnly;
+        return filtered;
+    }
+
+    // Gameplay simulates one pawn per role, so only slot 0 actors exist (see ActorEntityForSlot).
+    assert(viewerIt->slot == 0 && "relevancy center must be a spawned pawn");
+    const std::uint8_t centerSlot = viewerIt->slot;
+    const glm::vec3 viewerPosition = viewerIt->position;
+    const engine::scene::Entity viewerEntity = ActorEntityForSlot(viewer.role, centerSlot);
+    const auto eyeOffsetFor = [&](engine::scene::Role role, std::uint8_t slot) {
+        const auto actorIt = m_world.Actors().find(ActorEntityForSlot(role, slot));
+        return glm::vec3{0.0F, actorIt != m_world.Actors().end() ? actorIt->second.eyeHeight : 1.5F, 0.0F};
+    };
+    const glm::vec3 viewerEye = viewerPosition + eyeOffsetFor(viewer.role, centerSlot);
+    const float fullRateRadiusSq = relevancy.fullRateRadius * relevancy.fullRateRadius;
+    const float maxRadiusSq = relevancy.maxRadius * relevancy.maxRadius;
+    const auto withinSq = [&](const glm::vec3& position, float radiusSq) {
+        const glm::vec3 delta = position - viewerPosition;
+        return glm::dot(delta, delta) <= radiusSq;
+    };
+    const bool reducedRateTick =
+        relevancy.reducedRateInterval <= 1 || (viewer.sequence % static_cast<std::uint32_t>(relevancy.reducedRateInterval)) == 0U;
+
+    for (const ActorSnapshot& actor : full.actors)
+    {
+        const bool isViewer = actor.role == viewer.role && actor.slot == centerSlot;
+        if (isViewer || withinSq(actor.position, fullRateRadiusSq))
+        {
+            filtered.actors.push_back(actor);
+            continue;
+        }
+
+        // Actors are never fully dropped (terror radius, auras and HUD read them), but far and
+        // occluded ones fall back to a reduced update rate.
+        const glm::vec3 targetEye = actor.position + eyeOffsetFor(actor.role, actor.slot);
+        if (reducedRateTick || m_physics.HasLineOfSight(viewerEye, targetEye, viewerEntity))
+        {
+            filtered.actors.push_back(actor);
+        }
+    }
+
+    for (const PalletSnapshot& pallet : full.pallets)
+    {
+        if (withinSq(pallet.position, maxRadiusSq))
+        {
+            filtered.pallets.push_back(pallet);
+        }
+    }
+
+    // Role rule: the killer always tracks every placed trap; survivors only nearby ones.
+    const bool viewerIsKiller = viewer.role == engine::scene::Role::Killer;
+    for (const TrapSnapshot& trap : full.traps)
+    {
+        if (viewerIsKiller || withinSq(trap.position, maxRadiusSq))
+        {
+            filtered.traps.push_back(trap);
+        }
+    }
+
+    for (const GroundItemSnapshot& item : full.groundItems)
+    {
+        if (withinSq(item.position, maxRadiusSq))
+        {
+            filtered.groundItems.push_back(item);
+        }
+    }
+
+    // Role rule: scratch marks are killer information unless the profile lets survivors see them.
+    if (CanSeeScratchMarks(viewerIsKiller))
+    {
+        for (const ScratchMarkSnapshot& mark : full.scratchMarks)
+        {
+            if (withinSq(mark.position, maxRadiusSq))
+            {
+                filtered.scratchMarks.push_back(mark);
+            }
+        }
+    }
+
+    return filtered;
+}
+
+engine::scene::Entity GameplaySystems::ActorEntityForSlot(engine::scene::Role role, std::uint8_t slot) const
+{
+    if (role == engine::scene::Role::Killer)
+    {
+        return slot == 0 ? m_killer : 0;
+    }
+    return slot == 0 ? m_survivor : 0;
+}
+
 void GameplaySystems::ApplySnapshot(const Snapshot& snapshot, float blendAlpha)
 {
+    if (snapshot.serverTick > m_clientLatestServerTick)
+    {
+        if (m_clientLatestServerTick != 0)
+        {
+            const float gap = static_cast<float>(snapshot.serverTick - m_clientLatestServerTick);
+            m_clientSnapshotTickGap = glm::mix(m_clientSnapshotTickGap, glm::min(gap, 60.0F), 0.1F);
+        }
+        m_clientLatestServerTick = snapshot.serverTick;
+        // Exponential blending trails the target by (1 - a) / a updates on average.
+        const float alpha = glm::clamp(blendAlpha, 0.01F, 1.0F);
+        m_clientViewLagTicks = (1.0F - alpha) / alpha * m_clientSnapshotTickGap;
+    }
+
     // Apply perk loadouts if different
     if (snapshot.survivorPerkIds != m_survivorPerks.perkIds)
     {
@@ -4407,17 +4723,23 @@ void GameplaySystems::ApplySnapshot(const Snapshot& snapshot, float blendAlpha)
     m_chase.timeInChase = snapshot.chaseTimeInChase;
     m_bloodlust.tier = static_cast<int>(snapshot.bloodlustTier);
 
-    const SurvivorHealthState nextState = static_cast<SurvivorHealthState>(
-        glm::clamp(static_cast<int>(snapshot.survivorState), 0, static_cast<int>(SurvivorHealthState::Dead))
-    );
-    m_survivorState = nextState;
+    for (const ActorSnapshot& actorSnapshot : snapshot.actors)
+    {
+        if (actorSnapshot.role == engine::scene::Role::Survivor && actorSnapshot.slot == 0)
+        {
+            m_survivorState = static_cast<SurvivorHealthState>(
+                glm::clamp(static_cast<int>(actorSnapshot.healthState), 0, static_cast<int>(SurvivorHealthState::Dead))
+            );
+        }
+    }
     m_killerAttackState = static_cast<KillerAttackState>(
         glm::clamp(static_cast<int>(snapshot.killerAttackState), 0, static_cast<int>(KillerAttackState::Recovering))
     );
     m_killerAttackStateTimer = snapshot.killerAttackStateTimer;
     m_killerLungeChargeSeconds = snapshot.killerLungeCharge;
 
-    auto applyActor = [&](engine::scene::Entity entity, const ActorSnapshot& actorSnapshot) {
+    auto applyActor = [&](const ActorSnapshot& actorSnapshot) {
+        const engine::scene::Entity entity = ActorEntityForSlot(actorSnapshot.role, actorSnapshot.slot);
         auto transformIt = m_world.Transforms().find(entity);
         auto actorIt = m_world.Actors().find(entity);
         if (transformIt == m_world.Transforms().end() || actorIt == m_world.Actors().end())
@@ -4435,8 +4757,36 @@ void GameplaySystems::ApplySnapshot(const Snapshot& snapshot, float blendAlpha)
         actorIt->second.carried = (entity == m_survivor && m_survivorState == SurvivorHealthState::Carried);
     };
 
-    applyActor(m_survivor, snapshot.survivor);
-    applyActor(m_killer, snapshot.killer);
+    for (const ActorSnapshot& actorSnapshot : snapshot.actors)
+    {
+        applyActor(actorSnapshot);
+    }
+
+    // Entities outside a partial snapshot's radius were simply not sent; only cull what the
+    // host would have included for us.
+    const glm::vec3 localPosition = [&]() {
+        const auto transformIt = m_world.Transforms().find(ControlledEntity());
+        return transformIt != m_world.Transforms().end() ? transformIt->second.position : glm::vec3{0.0F};
+    }();
+    // Only cull well inside the radius: near the edge our position and the host's center differ
+    // slightly, so an entity there may legitimately have been left out of this snapshot.
+    constexpr float kRelevancyCullMargin = 0.9F;
+    const auto coveredBySnapshot = [&](engine::scene::Entity entity) {
+        if (snapshot.relevancyRadius == kRelevancyPublicOnly)
+        {
+            return false;
+        }
+        if (snapshot.relevancyRadius <= 0.0F)
+        {
+            return true;
+        }
+        const auto transformIt = m_world.Transforms().find(entity);
+        if (transformIt == m_world.Transforms().end())
+        {
+            return true;
+        }
+        return glm::distance(transformIt->second.position, localPosition) <= snapshot.relevancyRadius * kRelevancyCullMargin;
+    };
 
     for (const PalletSnapshot& palletSnapshot : snapshot.pallets)
     {
@@ -4494,7 +4844,7 @@ void GameplaySystems::ApplySnapshot(const Snapshot& snapshot, float blendAlpha)
     removeTraps.reserve(m_world.BearTraps().size());
     for (const auto& [entity, _] : m_world.BearTraps())
     {
-        if (!seenTraps.contains(entity))
+        if (!seenTraps.contains(entity) && coveredBySnapshot(entity))
         {
             removeTraps.push_back(entity);
         }
@@ -4540,7 +4890,7 @@ void GameplaySystems::ApplySnapshot(const Snapshot& snapshot, float blendAlpha)
     removeGroundItems.reserve(m_world.GroundItems().size());
     for (const auto& [entity, _] : m_world.GroundItems())
     {
-        if (!seenGroundItems.contains(entity))
+        if (!seenGroundItems.contains(entity) && coveredBySnapshot(entity))
         {
             removeGroundItems.push_back(entity);
         }
@@ -4550,6 +4900,34 @@ void GameplaySystems::ApplySnapshot(const Snapshot& snapshot, float blendAlpha)
         DestroyEntity(entity);
     }
 
+    // Host only sends scratch marks to viewers allowed to see them; mirror its pool verbatim.
+    // A public-only snapshot withheld the list, so keep the marks we already have.
+    if (snapshot.relevancyRadius == kRelevancyPublicOnly)
+    {
+        RebuildPhysicsWorld();
+        return;
+    }
+    for (ScratchMark& mark : m_scratchMarks)
+    {
+        mark.active = false;
+    }
+    const std::size_t markCount = std::min<std::size_t>(snapshot.scratchMarks.size(), kScratchMarkPoolSize);
+    for (std::size_t i = 0; i < markCount; ++i)
+    {
+        const ScratchMarkSnapshot& markSnapshot = snapshot.scratchMarks[i];
+        ScratchMark& mark = m_scratchMarks[i];
+        const float yawRad = glm::radians(markSnapshot.yawDeg);
+        mark.active = true;
+        mark.position = markSnapshot.position;
+        mark.yawDeg = markSnapshot.yawDeg;
+        mark.direction = glm::vec3{std::sin(yawRad), 0.0F, std::cos(yawRad)};
+        mark.perpOffset = ComputePerpendicular(mark.direction);
+        mark.age = markSnapshot.age;
+        mark.lifetime = markSnapshot.lifetime;
+        mark.size = markSnapshot.size;
+    }
+    m_scratchMarkHead = static_cast<int>(markCount % kScratchMarkPoolSize);
+
     RebuildPhysicsWorld();
 }
 
@@ -4692,8 +5070,7 @@ void GameplaySystems::LoadTestModelMeshes()
         return;
     }
 
-    static engine::assets::MeshLibrary fallbackMeshLibrary;
-    engine::assets::MeshLibrary& meshLibrary = (m_meshLibrary != nullptr) ? *m_meshLibrary : fallbackMeshLibrary;
+    engine::assets::MeshLibrary& meshLibrary = MeshLibraryForLoads();
 
     const auto resolveMeshPath = [](const std::string& fileName) {
         std::error_code ec;
@@ -4715,48 +5092,64 @@ void GameplaySystems::LoadTestModelMeshes()
         return std::filesystem::absolute(relative, ec);
     };
 
-    const auto uploadMesh = [&](const char* label,
-                                const std::string& fileName,
-                                const glm::vec3& color,
-                                engine::render::Renderer::GpuMeshId* outGpuId,
-                                float* outFeetOffset) {
-        if (outGpuId == nullptr || *outGpuId != engine::render::Renderer::kInvalidGpuMesh)
+    // Decoded on workers; Render() draws placeholders until the upload queue reaches them.
+    const auto requestMesh = [&](const char* label,
+                                 const std::string& fileName,
+                                 const glm::vec3& color,
+                                 engine::render::Renderer::GpuMeshId* outGpuId,
+                                 float* outFeetOffset,
+                                 engine::assets::MeshHandle* pending,
+                                 bool* failed) {
+        if (*outGpuId != engine::render::Renderer::kInvalidGpuMesh || *pending != nullptr || *failed)
         {
             return;
         }
 
         const std::filesystem::path meshPath = resolveMeshPath(fileName);
-        std::string error;
-        const engine::assets::MeshData* meshData = meshLibrary.LoadMesh(meshPath, &error);
-        if (meshData == nullptr || !meshData->loaded)
-        {
-            std::cout << "[TEST_MODELS] Failed to load " << label << " mesh from "
-                      << meshPath.string() << ": " << error << "\n";
-            return;
-        }
-
-        const engine::render::MaterialParams material{};
-        *outGpuId = m_rendererPtr->UploadMesh(meshData->geometry, color, material);
-        if (outFeetOffset != nullptr)
-        {
-            *outFeetOffset = -meshData->boundsMin.y;
-        }
-        std::cout << "[TEST_MODELS] Loaded " << label << " mesh from " << meshPath.string() << "\n";
+        *pending = meshLibrary.LoadMeshAsync(meshPath);
+        const engine::assets::MeshHandle handle = *pending;
+        m_meshUploads.Enqueue(
+            handle,
+            [label, color, outGpuId, outFeetOffset, pending, handle, meshPath](engine::render::Renderer& renderer, const engine::assets::MeshData& meshData) {
+                if (*pending != handle)
+                {
+                    return;
+                }
+                pending->reset();
+                const engine::render::MaterialParams material{};
+                *outGpuId = renderer.UploadMesh(meshData.geometry, color, material);
+                *outFeetOffset = -meshData.boundsMin.y;
+                std::cout << "[TEST_MODELS] Loaded " << label << " mesh from " << meshPath.string() << "\n";
+            },
+            [label, pending, failed, handle, meshPath](const std::string& error) {
+                if (*pending != handle)
+                {
+                    return;
+                }
+                pending->reset();
+                *failed = true;
+                std::cout << "[TEST_MODELS] Failed to load " << label << " mesh from "
+                          << meshPath.string() << ": " << error << "\n";
+            });
     };
 
-    uploadMesh(
+    requestMesh(
         "male",
         "survivor_male_blocky.glb",
         glm::vec3{0.23F, 0.51F, 0.96F},
         &m_testModelMeshes.maleBody,
-        &m_testModelMeshes.maleFeetOffset
+        &m_testModelMeshes.maleFeetOffset,
+        &m_testModelMeshes.malePending,
+        &m_testModelMeshes.maleFailed
     );
-    uploadMesh(
+    requestMesh(
         "female",
         "survivor_female_blocky.glb",
         glm::vec3{0.93F, 0.27F, 0.60F},
         &m_testModelMeshes.femaleBody,
-        &m_testModelMeshes.femaleFeetOffset
+        &m_testModelMeshes.femaleFeetOffset,
+        &m_testModelMeshes.femalePending,
+        &m_testModelMeshes.femaleFailed
     );
 }
 
@@ -4931,6 +5324,11 @@ void GameplaySystems::BuildSceneFromGeneratedMap(
     m_localKillerCommand = RoleCommand{};
     m_remoteSurvivorCommand.reset();
     m_remoteKillerCommand.reset();
+    m_lagCompHistory = {};
+    m_lagCompStats = LagCompensationStats{};
+    m_clientLatestServerTick = 0;
+    m_clientSnapshotTickGap = 1.0F;
+    m_clientViewLagTicks = 0.0F;
     m_killerAttackState = KillerAttackState::Idle;
     m_killerAttackStateTimer = 0.0F;
     m_killerLungeChargeSeconds = 0.0F;
@@ -4967,12 +5365,15 @@ void GameplaySystems::BuildSceneFromGeneratedMap(
     {
         for (auto& mesh : m_highPolyMeshes)
         {
-            m_rendererPtr->FreeGpuMesh(mesh.gpuFullLod);
-            m_rendererPtr->FreeGpuMesh(mesh.gpuMediumLod);
+            for (const auto gpuLod : mesh.gpuLods)
+            {
+                m_rendererPtr->FreeGpuMesh(gpuLod);
+            }
         }
     }
     // Swap-to-empty to actually release RAM (clear() only resets size, not capacity).
     { std::vector<HighPolyMesh> empty; m_highPolyMeshes.swap(empty); }
+    m_highPolyBounds.Clear();
     m_highPolyMeshesGenerated = false;
     m_highPolyMeshesUploaded = false;
 
@@ -4999,12 +5400,28 @@ void GameplaySystems::BuildSceneFromGeneratedMap(
         m_world.StaticBoxes()[wallEntity] = engine::scene::StaticBoxComponent{wall.halfExtents, true};
     }
 
-    m_staticBatcher.BeginBuild();
+    // Occluder candidates: walls with a face of at least 1 m^2; the culler picks the largest on screen per frame.
+    std::vector<engine::render::OcclusionCuller::Occluder> occluders;
+    occluders.reserve(generated.walls.size());
     for (const auto& wall : generated.walls)
     {
-        m_staticBatcher.AddBox(wall.center, wall.halfExtents, glm::vec3{0.58F, 0.62F, 0.68F});
+        const glm::vec3& h = wall.halfExtents;
+        if (4.0F * std::max({h.x * h.y, h.x * h.z, h.y * h.z}) >= 1.0F)
+        {
+            occluders.push_back(engine::render::OcclusionCuller::Occluder{wall.center, wall.halfExtents});
+        }
+    }
+    m_occlusionCuller.SetOccluders(std::move(occluders));
+
+    if (!m_headless)
+    {
+        m_staticBatcher.BeginBuild();
+        for (const auto& wall : generated.walls)
+        {
+            m_staticBatcher.AddBox(wall.center, wall.halfExtents, glm::vec3{0.58F, 0.62F, 0.68F});
+        }
+        m_staticBatcher.EndBuild();
     }
-    m_staticBatcher.EndBuild();
 
     // Store loop mesh placements for later loading and rendering
     m_loopMeshes.clear();
@@ -5182,7 +5599,15 @@ void GameplaySystems::BuildSceneFromGeneratedMap(
     if (!generated.highPolyMeshes.empty())
     {
         m_highPolyMeshes.reserve(generated.highPolyMeshes.size());
-        
+
+        // Source geometry and its simplified LOD chain are built once per (type, detail level).
+        struct GeneratedHighPoly
+        {
+            engine::render::MeshGeometry geometry;
+            std::shared_ptr<const std::vector<engine::assets::MeshLod>> lodChain;
+        };
+        std::unordered_map<int, GeneratedHighPoly> generatedByKind;
+
         for (const auto& meshSpawn : generated.highPolyMeshes)
         {
             HighPolyMesh mesh;
@@ -5190,46 +5615,51 @@ void GameplaySystems::BuildSceneFromGeneratedMap(
             mesh.rotation = meshSpawn.rotation;
             mesh.scale = meshSpawn.scale;
             mesh.color = meshSpawn.color;
-            
-            // Generate geometry based on type
-            switch (meshSpawn.type)
+
+            const int kindKey = static_cast<int>(meshSpawn.type) * 64 + meshSpawn.detailLevel;
+            auto kindIt = generatedByKind.find(kindKey);
+            if (kindIt == generatedByKind.end())
             {
-                case maps::HighPolyMeshSpawn::Type::IcoSphere:
-                    mesh.geometry = GenerateIcoSphere(meshSpawn.detailLevel);
-                    mesh.mediumLodGeometry = GenerateIcoSphere(std::max(1, meshSpawn.detailLevel - 2));
-                    break;
-                case maps::HighPolyMeshSpawn::Type::Torus:
-                    mesh.geometry = GenerateTorus(
-                        1.0F, 0.4F, 
-                        16 + meshSpawn.detailLevel * 8, 
-                        8 + meshSpawn.detailLevel * 4
-                    );
-                    mesh.mediumLodGeometry = GenerateTorus(
-                        1.0F,
-                        0.4F,
-                        std::max(10, 10 + meshSpawn.detailLevel * 3),
-                        std::max(6, 6 + meshSpawn.detailLevel * 2)
-                    );
-                    break;
-                case maps::HighPolyMeshSpawn::Type::GridPlane:
-                    mesh.geometry = GenerateGridPlane(2 << meshSpawn.detailLevel, 2 << meshSpawn.detailLevel);
-                    mesh.mediumLodGeometry = GenerateGridPlane(
-                        2 << std::max(2, meshSpawn.detailLevel - 2),
-                        2 << std::max(2, meshSpawn.detailLevel - 2)
-                    );
-                    break;
-                case maps::HighPolyMeshSpawn::Type::SpiralStair:
-                    mesh.geometry = GenerateSpiralStair(32 + meshSpawn.detailLevel * 8, 16);
-                    mesh.mediumLodGeometry = GenerateSpiralStair(
-                        std::max(18, 16 + meshSpawn.detailLevel * 3),
-                        12
-                    );
-                    break;
+                GeneratedHighPoly kind;
+
+                // Generate geometry based on type
+                switch (meshSpawn.type)
+                {
+                    case maps::HighPolyMeshSpawn::Type::IcoSphere:
+                        kind.geometry = GenerateIcoSphere(meshSpawn.detailLevel);
+                        break;
+                    case maps::HighPolyMeshSpawn::Type::Torus:
+                        kind.geometry = GenerateTorus(
+                            1.0F, 0.4F,
+                            16 + meshSpawn.detailLevel * 8,
+                            8 + meshSpawn.detailLevel * 4
+                        );
+                        break;
+                    case maps::HighPolyMeshSpawn::Type::GridPlane:
+                        kind.geometry = GenerateGridPlane(2 << meshSpawn.detailLevel, 2 << meshSpawn.detailLevel);
+                        break;
+                    case maps::HighPolyMeshSpawn::Type::SpiralStair:
+                        kind.geometry = GenerateSpiralStair(32 + meshSpawn.detailLevel * 8, 16);
+                        break;
+                }
+                kind.lodChain = std::make_shared<const std::vector<engine::assets::MeshLod>>(
+                    engine::assets::MeshSimplifier::BuildLodChain(kind.geometry));
+                kindIt = generatedByKind.emplace(kindKey, std::move(kind)).first;
             }
-            
+
+            mesh.geometry = kindIt->second.geometry;
+            mesh.lodChain = kindIt->second.lodChain;
+
             // Compute bounding box for frustum culling
             mesh.halfExtents = ComputeMeshBounds(mesh.geometry) * mesh.scale;
-            
+
+            const float maxScale = std::max({std::abs(mesh.scale.x), std::abs(mesh.scale.y), std::abs(mesh.scale.z)});
+            mesh.lodErrors.push_back(0.0F);
+            for (const auto& lod : *mesh.lodChain)
+            {
+                mesh.lodErrors.push_back(lod.error * maxScale);
+            }
+
             m_highPolyMeshes.push_back(std::move(mesh));
         }
     }
@@ -6146,7 +6576,7 @@ bool GameplaySystems::ResolveKillerAttackHit(float range, float halfAngleRadians
     m_lastHitConnected = false;
 
     const float cosThreshold = std::cos(halfAngleRadians);
-    const glm::vec3 survivorPoint = survivorTransformIt->second.position + glm::vec3{0.0F, 0.55F, 0.0F};
+    const glm::vec3 survivorPoint = RewoundPosition(m_survivor, KillerRewindTicks()) + glm::vec3{0.0F, 0.55F, 0.0F};
     const glm::vec3 toSurvivor = survivorPoint - attackOrigin;
     const float distanceToSurvivor = glm::length(toSurvivor);
     if (distanceToSurvivor > range + survivorActorIt->second.capsuleRadius || distanceToSurvivor < 1.0e-5F)
@@ -9205,70 +9635,68 @@ void GameplaySystems::RenderHighPolyMeshes(engine::render::Renderer& renderer)
         {
             if (!mesh.geometry.positions.empty())
             {
-                mesh.gpuFullLod = renderer.UploadMesh(mesh.geometry, mesh.color);
+                mesh.gpuLods.push_back(renderer.UploadMesh(
+                    mesh.geometry, mesh.color, engine::render::MaterialParams{}, engine::render::Renderer::GpuVertexFormat::Compact));
                 // Free CPU-side geometry data after GPU upload.
                 mesh.geometry = {};
             }
-            if (!mesh.mediumLodGeometry.positions.empty())
+            if (mesh.lodChain != nullptr && !mesh.gpuLods.empty())
             {
-                mesh.gpuMediumLod = renderer.UploadMesh(mesh.mediumLodGeometry, mesh.color * 0.96F, engine::render::MaterialParams{0.65F, 0.0F, 0.0F, false});
-                mesh.mediumLodGeometry = {};
+                for (const auto& lod : *mesh.lodChain)
+                {
+                    mesh.gpuLods.push_back(renderer.UploadMesh(
+                        lod.geometry, mesh.color, engine::render::MaterialParams{}, engine::render::Renderer::GpuVertexFormat::Compact));
+                }
             }
+            mesh.lodChain.reset();
+            mesh.lodErrors.resize(mesh.gpuLods.size());
+        }
+
+        // Bounds never move after map load; keep them in SoA form for Frustum::CullBatch.
+        m_highPolyBounds.Clear();
+        m_highPolyBounds.Reserve(m_highPolyMeshes.size());
+        for (const auto& mesh : m_highPolyMeshes)
+        {
+            m_highPolyBounds.Add(mesh.position - mesh.halfExtents, mesh.position + mesh.halfExtents);
         }
         m_highPolyMeshesUploaded = true;
     }
 
-    // Frustum culling helper
-    auto isVisible = [this](const glm::vec3& center, const glm::vec3& halfExtents) -> bool {
-        const glm::vec3 mins = center - halfExtents;
-        const glm::vec3 maxs = center + halfExtents;
-        return m_frustum.IntersectsAABB(mins, maxs);
+    // Batch frustum cull (SIMD over the SoA bounds), then occlusion-test the survivors. Very large
+    // sets are culled in chunks on the JobSystem (IsOccluded is safe from workers).
+    const auto isOccluded = [this](std::uint32_t idx) {
+        const auto& mesh = m_highPolyMeshes[idx];
+        return m_occlusionCuller.IsOccluded(mesh.position - mesh.halfExtents, mesh.position + mesh.halfExtents);
     };
 
-    // Parallel culling - determine which meshes are visible
     const std::size_t meshCount = m_highPolyMeshes.size();
-    std::vector<std::size_t> visibleMeshes;
+    std::vector<std::uint32_t> visibleMeshes;
     visibleMeshes.reserve(meshCount);
 
-    // Use JobSystem for parallel culling if available
+    constexpr std::size_t kCullChunk = 4096;
     auto& jobSystem = engine::core::JobSystem::Instance();
-    if (jobSystem.IsInitialized() && jobSystem.IsEnabled() && meshCount > 256)
+    if (jobSystem.IsInitialized() && jobSystem.IsEnabled() && meshCount > kCullChunk * 2)
     {
-        // Parallel culling using workers
-        // Pre-allocate results
-        std::vector<std::int8_t> visibilityFlags(meshCount, 0);
+        const std::size_t chunkCount = (meshCount + kCullChunk - 1) / kCullChunk;
+        std::vector<std::vector<std::uint32_t>> chunkVisible(chunkCount);
         engine::core::JobCounter cullCounter;
-        
-        jobSystem.ParallelFor(meshCount, 64, [&](std::size_t idx) {
-            const auto& mesh = m_highPolyMeshes[idx];
-            if (isVisible(mesh.position, mesh.halfExtents))
-            {
-                visibilityFlags[idx] = 1;
-            }
+
+        jobSystem.ParallelFor(chunkCount, 1, [&](std::size_t chunk) {
+            std::vector<std::uint32_t>& out = chunkVisible[chunk];
+            m_frustum.CullBatch(m_highPolyBounds, out, chunk * kCullChunk, (chunk + 1) * kCullChunk);
+            std::erase_if(out, isOccluded);
         }, engine::core::JobPriority::High, &cullCounter);
-        
+
         jobSystem.WaitForCounter(cullCounter);
-        
-        // Collect visible mesh indices
-        for (std::size_t i = 0; i < meshCount; ++i)
+        for (const auto& chunk : chunkVisible)
         {
-            if (visibilityFlags[i] == 1)
-            {
-                visibleMeshes.push_back(i);
-            }
+            visibleMeshes.insert(visibleMeshes.end(), chunk.begin(), chunk.end());
         }
     }
     else
     {
-        // Sequential culling (fallback for small mesh counts or disabled JobSystem)
-        for (std::size_t i = 0; i < meshCount; ++i)
-        {
-            const auto& mesh = m_highPolyMeshes[i];
-            if (isVisible(mesh.position, mesh.halfExtents))
-            {
-                visibleMeshes.push_back(i);
-            }
-        }
+        m_frustum.CullBatch(m_highPolyBounds, visibleMeshes);
+        std::erase_if(visibleMeshes, isOccluded);
     }
 
     if (visibleMeshes.empty())
@@ -9276,24 +9704,10 @@ void GameplaySystems::RenderHighPolyMeshes(engine::render::Renderer& renderer)
         return;
     }
 
-    constexpr float kHighPolyFullDetailDistance = 72.0F;
-    constexpr float kHighPolyFullDetailDistanceSq = kHighPolyFullDetailDistance * kHighPolyFullDetailDistance;
-    constexpr float kHighPolyMediumDetailDistance = 140.0F;
-    constexpr float kHighPolyMediumDetailDistanceSq = kHighPolyMediumDetailDistance * kHighPolyMediumDetailDistance;
-    constexpr std::size_t kMaxFullDetailMeshes = 8;
-
-    std::vector<std::pair<std::size_t, float>> sortedVisible;
-    sortedVisible.reserve(visibleMeshes.size());
-    for (const std::size_t idx : visibleMeshes)
-    {
-        const auto& mesh = m_highPolyMeshes[idx];
-        const glm::vec3 toCamera = mesh.position - m_cameraPosition;
-        const float distanceSq = glm::dot(toCamera, toCamera);
-        sortedVisible.emplace_back(idx, distanceSq);
-    }
-    std::sort(sortedVisible.begin(), sortedVisible.end(), [](const auto& a, const auto& b) {
-        return a.second < b.second;
-    });
+    // LOD by projected geometric error (LodSelector); only meshes a few pixels across become boxes.
+    constexpr float kImpostorPixelRadius = 3.0F;
+    const float projectionScale = engine::render::LodSelector::ProjectionScaleFromFov(
+        glm::radians(CameraFovDegrees()), renderer.FramebufferHeight());
 
     // Build model matrix helper
     auto buildModelMatrix = [](const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale) -> glm::mat4 {
@@ -9307,22 +9721,14 @@ void GameplaySystems::RenderHighPolyMeshes(engine::render::Renderer& renderer)
     };
 
     // Render visible meshes using GPU-cached draw calls
-    std::size_t fullDetailDraws = 0;
-    for (const auto& [idx, distanceSq] : sortedVisible)
+    auto& profStats = engine::core::Profiler::Instance().StatsMut();
+    for (const std::size_t idx : visibleMeshes)
     {
-        const auto& mesh = m_highPolyMeshes[idx];
-        const glm::mat4 modelMatrix = buildModelMatrix(mesh.position, mesh.rotation, mesh.scale);
+        auto& mesh = m_highPolyMeshes[idx];
+        const float radius = glm::length(mesh.halfExtents);
+        const float distance = std::max(glm::length(mesh.position - m_cameraPosition) - radius, 0.05F);
 
-        if (distanceSq <= kHighPolyFullDetailDistanceSq && fullDetailDraws < kMaxFullDetailMeshes && mesh.gpuFullLod != engine::render::Renderer::kInvalidGpuMesh)
-        {
-            renderer.DrawGpuMesh(mesh.gpuFullLod, modelMatrix);
-            ++fullDetailDraws;
-        }
-        else if (distanceSq <= kHighPolyMediumDetailDistanceSq && mesh.gpuMediumLod != engine::render::Renderer::kInvalidGpuMesh)
-        {
-            renderer.DrawGpuMesh(mesh.gpuMediumLod, modelMatrix);
-        }
-        else
+        if (mesh.gpuLods.empty() || engine::render::LodSelector::ProjectedError(radius, distance, projectionScale) < kImpostorPixelRadius)
         {
             renderer.DrawOrientedBox(
                 mesh.position,
@@ -9331,7 +9737,13 @@ void GameplaySystems::RenderHighPolyMeshes(engine::render::Renderer& renderer)
                 mesh.color * 0.9F,
                 engine::render::MaterialParams{0.85F, 0.0F, 0.0F, false}
             );
+            ++profStats.meshLodImpostors;
+            continue;
         }
+
+        mesh.currentLod = engine::render::LodSelector::Select(mesh.lodErrors, distance, projectionScale, mesh.currentLod);
+        renderer.DrawGpuMesh(mesh.gpuLods[mesh.currentLod], buildModelMatrix(mesh.position, mesh.rotation, mesh.scale));
+        ++(mesh.currentLod == 0 ? profStats.meshLodFullDraws : profStats.meshLodReducedDraws);
     }
 }
 
@@ -9349,11 +9761,11 @@ void GameplaySystems::RenderLoopMeshes(engine::render::Renderer& renderer)
         loggedOnce = true;
     }
 
-    static engine::assets::MeshLibrary loopMeshLibrary;
-    engine::assets::MeshLibrary& meshLibrary = (m_meshLibrary != nullptr) ? *m_meshLibrary : loopMeshLibrary;
+    engine::assets::MeshLibrary& meshLibrary = MeshLibraryForLoads();
 
     // Cache of already loaded meshes by path
     static std::unordered_map<std::string, engine::render::Renderer::GpuMeshId> gpuMeshCache;
+    static std::unordered_map<std::string, std::pair<std::vector<engine::render::Renderer::GpuMeshId>, std::vector<float>>> gpuLodCache;
     static std::unordered_map<std::string, glm::vec3> meshBoundsCache;
     static std::unordered_map<std::string, std::vector<engine::physics::WallBoxCollider>> meshColliderCache;
 
@@ -9438,6 +9850,9 @@ void GameplaySystems::RenderLoopMeshes(engine::render::Renderer& renderer)
             {
                 instance.gpuMesh = cacheIt->second;
                 instance.halfExtents = meshBoundsCache[instance.meshPath];
+                const auto& [cachedLods, cachedErrors] = gpuLodCache[instance.meshPath];
+                instance.gpuLods = cachedLods;
+                instance.lodErrors = cachedErrors;
 
                 // Reuse cached generated colliders (or fallback if generation failed).
                 if (!instance.collisionCreated)
@@ -9474,12 +9889,20 @@ void GameplaySystems::RenderLoopMeshes(engine::render::Renderer& renderer)
             // Upload to GPU
             const engine::render::MaterialParams material{};
             instance.gpuMesh = renderer.UploadMesh(meshData->geometry, glm::vec3{1.0F, 1.0F, 1.0F}, material);
+            instance.gpuLods = {instance.gpuMesh};
+            instance.lodErrors = {0.0F};
+            for (const auto& lod : meshData->lods)
+            {
+                instance.gpuLods.push_back(renderer.UploadMesh(lod.geometry, glm::vec3{1.0F, 1.0F, 1.0F}, material));
+                instance.lodErrors.push_back(lod.error);
+            }
 
             // Calculate half extents from actual mesh bounds for frustum culling
             instance.halfExtents = (meshData->boundsMax - meshData->boundsMin) * 0.5F;
 
             // Cache for reuse
             gpuMeshCache[instance.meshPath] = instance.gpuMesh;
+            gpuLodCache[instance.meshPath] = {instance.gpuLods, instance.lodErrors};
             meshBoundsCache[instance.meshPath] = instance.halfExtents;
 
             // Generate mesh collider template once per unique mesh path.
@@ -9487,32 +9910,38 @@ void GameplaySystems::RenderLoopMeshes(engine::render::Renderer& renderer)
             {
                 using namespace engine::physics;
 
-                WallColliderConfig config;
-                config.cellSize = 0.06F;
-                config.maxBoxes = 8;
-                config.padXZ = 0.03F;
-                config.minIslandCells = 1;
-                config.cleanup = true;
-                config.maxVolumeExcess = 2.5F;
-                config.minCoverage = 0.70F;
-
-                auto result = ColliderGen_WallBoxes::Generate(
-                    meshData->geometry.positions,
-                    meshData->geometry.indices,
-                    config
-                );
-
-                if (result.valid && !result.boxes.empty())
+                const WallColliderConfig config = ColliderGen_WallBoxes::LoopMeshConfig();
+                const std::string meshHash =
+                    ColliderGen_WallBoxes::ComputeMeshHash(meshData->geometry.positions, meshData->geometry.indices);
+                // Written by the asset cooker (asset_cook) or by the first generation below.
+                if (auto cached = ColliderGen_WallBoxes::LoadValidCache(meshPath, meshHash, config))
                 {
-                    meshColliderCache[instance.meshPath] = result.boxes;
-                    std::cout << "[LOOP_MESH] Generated " << result.boxes.size() << " colliders for "
-                              << instance.meshPath << " (coverage=" << (result.coverage * 100.0f) << "%)\n";
+                    meshColliderCache[instance.meshPath] = std::move(*cached);
                 }
                 else
                 {
-                    meshColliderCache[instance.meshPath] = {};
-                    std::cout << "[LOOP_MESH] Fallback to single AABB for " << instance.meshPath
-                              << " (reason: " << (result.error.empty() ? "unknown" : result.error) << ")\n";
+                    auto result = ColliderGen_WallBoxes::Generate(
+                        meshData->geometry.positions,
+                        meshData->geometry.indices,
+                        config
+                    );
+
+                    WallColliderCache cache;
+                    cache.meshHash = meshHash;
+                    cache.config = config;
+                    if (result.valid && !result.boxes.empty())
+                    {
+                        cache.boxes = result.boxes;
+                        std::cout << "[LOOP_MESH] Generated " << result.boxes.size() << " colliders for "
+                                  << instance.meshPath << " (coverage=" << (result.coverage * 100.0f) << "%)\n";
+                    }
+                    else
+                    {
+                        std::cout << "[LOOP_MESH] Fallback to single AABB for " << instance.meshPath
+                                  << " (reason: " << (result.error.empty() ? "unknown" : result.error) << ")\n";
+                    }
+                    (void)ColliderGen_WallBoxes::SaveCache(ColliderGen_WallBoxes::GetCachePath(meshPath), cache);
+                    meshColliderCache[instance.meshPath] = std::move(cache.boxes);
                 }
             }
 
@@ -9535,14 +9964,18 @@ void GameplaySystems::RenderLoopMeshes(engine::render::Renderer& renderer)
             m_physicsDirty = true;
         }
         m_loopMeshesUploaded = true;
+        m_loopMeshBounds.Clear();
     }
 
-    // Frustum culling helper
-    auto isVisible = [this](const glm::vec3& center, const glm::vec3& halfExtents) -> bool {
-        const glm::vec3 mins = center - halfExtents;
-        const glm::vec3 maxs = center + halfExtents;
-        return m_frustum.IntersectsAABB(mins, maxs);
-    };
+    if (m_loopMeshBounds.Size() != m_loopMeshes.size())
+    {
+        m_loopMeshBounds.Clear();
+        m_loopMeshBounds.Reserve(m_loopMeshes.size());
+        for (const auto& instance : m_loopMeshes)
+        {
+            m_loopMeshBounds.Add(instance.position - instance.halfExtents, instance.position + instance.halfExtents);
+        }
+    }
 
     // Build model matrix helper
     auto buildModelMatrix = [](const glm::vec3& position, float rotationDegrees) -> glm::mat4 {
@@ -9552,22 +9985,34 @@ void GameplaySystems::RenderLoopMeshes(engine::render::Renderer& renderer)
         return model;
     };
 
-    // Render visible loop meshes
-    for (const auto& instance : m_loopMeshes)
+    const float projectionScale = engine::render::LodSelector::ProjectionScaleFromFov(
+        glm::radians(CameraFovDegrees()), renderer.FramebufferHeight());
+    auto& profStats = engine::core::Profiler::Instance().StatsMut();
+
+    // Render visible loop meshes (batch frustum cull over the SoA bounds, then occlusion)
+    std::vector<std::uint32_t> visibleLoopMeshes;
+    visibleLoopMeshes.reserve(m_loopMeshes.size());
+    m_frustum.CullBatch(m_loopMeshBounds, visibleLoopMeshes);
+    for (const std::uint32_t idx : visibleLoopMeshes)
     {
-        if (instance.gpuMesh == engine::render::Renderer::kInvalidGpuMesh)
+        auto& instance = m_loopMeshes[idx];
+        if (instance.gpuMesh == engine::render::Renderer::kInvalidGpuMesh ||
+            m_occlusionCuller.IsOccluded(instance.position - instance.halfExtents, instance.position + instance.halfExtents))
         {
             continue;
         }
 
-        // Frustum culling
-        if (!isVisible(instance.position, instance.halfExtents))
+        engine::render::Renderer::GpuMeshId gpuMesh = instance.gpuMesh;
+        if (instance.gpuLods.size() > 1)
         {
-            continue;
+            const float distance = std::max(glm::length(instance.position - m_cameraPosition) - glm::length(instance.halfExtents), 0.05F);
+            instance.currentLod = engine::render::LodSelector::Select(instance.lodErrors, distance, projectionScale, instance.currentLod);
+            gpuMesh = instance.gpuLods[instance.currentLod];
         }
+        ++(gpuMesh == instance.gpuMesh ? profStats.meshLodFullDraws : profStats.meshLodReducedDraws);
 
         const glm::mat4 modelMatrix = buildModelMatrix(instance.position, instance.rotationDegrees);
-        renderer.DrawGpuMesh(instance.gpuMesh, modelMatrix);
+        renderer.DrawGpuMesh(gpuMesh, modelMatrix);
     }
 }
 
@@ -9588,8 +10033,7 @@ bool GameplaySystems::LoadSurvivorCharacterBounds(
         return false;
     }
 
-    static engine::assets::MeshLibrary fallbackMeshLibrary;
-    engine::assets::MeshLibrary& meshLibrary = (m_meshLibrary != nullptr) ? *m_meshLibrary : fallbackMeshLibrary;
+    engine::assets::MeshLibrary& meshLibrary = MeshLibraryForLoads();
     const std::filesystem::path meshPath = ResolveAssetPathFromCwd(survivorDef->modelPath);
     std::string error;
     const engine::assets::MeshData* meshData = meshLibrary.LoadMesh(meshPath, &error);
@@ -9617,46 +10061,63 @@ bool GameplaySystems::LoadSurvivorCharacterBounds(
     return true;
 }
 
-bool GameplaySystems::EnsureSurvivorCharacterMeshLoaded(const std::string& characterId)
+engine::assets::MeshLibrary& GameplaySystems::MeshLibraryForLoads()
 {
-    if (characterId.empty())
+    return m_meshLibrary != nullptr ? *m_meshLibrary : engine::assets::AssetManager::Instance().Meshes();
+}
+
+void GameplaySystems::ApplySurvivorVisualMesh(
+    const std::string& characterId,
+    const engine::assets::MeshData& meshData,
+    const std::string& meshPath
+)
+{
+    SurvivorVisualMesh& cached = m_survivorVisualMeshes[characterId];
+    cached.pendingMesh.reset();
+    if (m_rendererPtr == nullptr)
     {
-        return false;
+        return;
     }
 
-    auto cacheIt = m_survivorVisualMeshes.find(characterId);
-    if (cacheIt == m_survivorVisualMeshes.end())
+    const engine::render::MaterialParams material{};
+    cached.gpuMesh = m_rendererPtr->UploadMesh(meshData.geometry, glm::vec3{1.0F, 1.0F, 1.0F}, material);
+    cached.boundsMinY = meshData.boundsMin.y;
+    cached.boundsMaxY = meshData.boundsMax.y;
+    const float absX = std::max(std::abs(meshData.boundsMin.x), std::abs(meshData.boundsMax.x));
+    const float absZ = std::max(std::abs(meshData.boundsMin.z), std::abs(meshData.boundsMax.z));
+    cached.maxAbsXZ = std::max(absX, absZ);
+    cached.boundsLoadAttempted = true;
+    cached.boundsLoaded = true;
+    cached.gpuUploadAttempted = cached.gpuMesh != engine::render::Renderer::kInvalidGpuMesh;
+    if (cached.gpuMesh == engine::render::Renderer::kInvalidGpuMesh)
     {
-        cacheIt = m_survivorVisualMeshes.emplace(characterId, SurvivorVisualMesh{}).first;
+        return;
     }
-    SurvivorVisualMesh& cached = cacheIt->second;
 
-    if (!cached.boundsLoadAttempted)
+    std::cout << "[SURVIVOR_MODEL] Uploaded mesh for " << characterId
+              << " from " << meshPath
+              << " (" << meshData.geometry.positions.size() << " verts)\n";
+
+    if (characterId == m_selectedSurvivorCharacterId && m_animationCharacterId != characterId)
     {
-        cached.boundsLoadAttempted = true;
-        float minY = 0.0F;
-        float maxY = 1.8F;
-        float maxAbsXZ = 0.3F;
-        if (!LoadSurvivorCharacterBounds(characterId, &minY, &maxY, &maxAbsXZ))
-        {
-            cached.boundsLoadFailed = true;
-            if (characterId == m_selectedSurvivorCharacterId)
-            {
-                (void)TryFallbackToAvailableSurvivorModel(characterId);
-            }
-            return false;
-        }
-        cached.boundsMinY = minY;
-        cached.boundsMaxY = maxY;
-        cached.maxAbsXZ = maxAbsXZ;
-        cached.boundsLoaded = true;
-        cached.boundsLoadFailed = false;
+        (void)ReloadSurvivorCharacterAnimations(characterId);
     }
-    else if (cached.boundsLoadFailed || !cached.boundsLoaded)
+}
+
+bool GameplaySystems::EnsureSurvivorCharacterMeshLoaded(const std::string& characterId, bool blocking)
+{
+    if (characterId.empty())
     {
         return false;
     }
 
+    auto cacheIt = m_survivorVisualMeshes.find(characterId);
+    if (cacheIt == m_survivorVisualMeshes.end())
+    {
+        cacheIt = m_survivorVisualMeshes.emplace(characterId, SurvivorVisualMesh{}).first;
+    }
+    SurvivorVisualMesh& cached = cacheIt->second;
+
     if (cached.gpuMesh != engine::render::Renderer::kInvalidGpuMesh)
     {
         if (characterId == m_selectedSurvivorCharacterId && m_animationCharacterId != characterId)
@@ -9665,66 +10126,67 @@ bool GameplaySystems::EnsureSurvivorCharacterMeshLoaded(const std::string& chara
         }
         return true;
     }
-    if (m_rendererPtr == nullptr)
+    if (cached.boundsLoadFailed || m_rendererPtr == nullptr)
     {
-        cached.gpuUploadAttempted = false;
         return false;
     }
-    if (cached.gpuUploadAttempted)
+    if (cached.pendingMesh != nullptr && !blocking)
     {
-        cached.gpuUploadAttempted = false;
+        return false; // placeholder capsule until the upload queue reaches it
     }
-    cached.gpuUploadAttempted = true;
 
     const loadout::SurvivorCharacterDefinition* survivorDef = m_loadoutCatalog.FindSurvivor(characterId);
     if (survivorDef == nullptr || survivorDef->modelPath.empty())
     {
         return false;
     }
-
-    // Use member mesh library or create a temporary one for this load.
-    engine::assets::MeshLibrary* meshLibrary = m_meshLibrary;
-    engine::assets::MeshLibrary tempMeshLibrary;
-    if (meshLibrary == nullptr)
-    {
-        meshLibrary = &tempMeshLibrary;
-    }
-
     const std::filesystem::path meshPath = ResolveAssetPathFromCwd(survivorDef->modelPath);
-    std::string error;
-    const engine::assets::MeshData* meshData = meshLibrary->LoadMesh(meshPath, &error);
-    if (meshData == nullptr || !meshData->loaded)
-    {
-        cached.gpuUploadAttempted = false;
+    const auto onFailed = [this, characterId, meshPath](const std::string& error) {
+        SurvivorVisualMesh& failed = m_survivorVisualMeshes[characterId];
+        failed.pendingMesh.reset();
+        failed.boundsLoadAttempted = true;
+        failed.boundsLoadFailed = true;
         std::cout << "[SURVIVOR_MODEL] Failed to upload mesh for " << characterId
                   << " from " << meshPath.string() << ": " << error << "\n";
-        return false;
-    }
-
-    const engine::render::MaterialParams material{};
-    cached.gpuMesh = m_rendererPtr->UploadMesh(meshData->geometry, glm::vec3{1.0F, 1.0F, 1.0F}, material);
-    cached.boundsMinY = meshData->boundsMin.y;
-    cached.boundsMaxY = meshData->boundsMax.y;
-    const float absX = std::max(std::abs(meshData->boundsMin.x), std::abs(meshData->boundsMax.x));
-    const float absZ = std::max(std::abs(meshData->boundsMin.z), std::abs(meshData->boundsMax.z));
-    cached.maxAbsXZ = std::max(absX, absZ);
-    cached.boundsLoaded = true;
-    if (cached.gpuMesh == engine::render::Renderer::kInvalidGpuMesh)
-    {
-        cached.gpuUploadAttempted = false;
-        return false;
-    }
-
-    std::cout << "[SURVIVOR_MODEL] Uploaded mesh for " << characterId
-              << " from " << meshPath.string()
-              << " (" << meshData->geometry.positions.size() << " verts)\n";
+        if (characterId == m_selectedSurvivorCharacterId)
+        {
+            (void)TryFallbackToAvailableSurvivorModel(characterId);
+        }
+    };
 
-    if (characterId == m_selectedSurvivorCharacterId && m_animationCharacterId != characterId)
+    if (blocking)
     {
-        (void)ReloadSurvivorCharacterAnimations(characterId);
+        // Waits for an in-flight async load of the same file; its queued upload then sees a stale handle.
+        std::string error;
+        const engine::assets::MeshData* meshData = MeshLibraryForLoads().LoadMesh(meshPath, &error);
+        if (meshData == nullptr || !meshData->loaded)
+        {
+            onFailed(error);
+            return false;
+        }
+        ApplySurvivorVisualMesh(characterId, *meshData, meshPath.string());
+        return m_survivorVisualMeshes[characterId].gpuMesh != engine::render::Renderer::kInvalidGpuMesh;
     }
 
-    return true;
+    cached.pendingMesh = MeshLibraryForLoads().LoadMeshAsync(meshPath);
+    const engine::assets::MeshHandle handle = cached.pendingMesh;
+    m_meshUploads.Enqueue(
+        handle,
+        [this, characterId, handle, meshPath](engine::render::Renderer&, const engine::assets::MeshData& meshData) {
+            const auto it = m_survivorVisualMeshes.find(characterId);
+            if (it != m_survivorVisualMeshes.end() && it->second.pendingMesh == handle)
+            {
+                ApplySurvivorVisualMesh(characterId, meshData, meshPath.string());
+            }
+        },
+        [this, characterId, handle, onFailed](const std::string& error) {
+            const auto it = m_survivorVisualMeshes.find(characterId);
+            if (it != m_survivorVisualMeshes.end() && it->second.pendingMesh == handle)
+            {
+                onFailed(error);
+            }
+        });
+    return false;
 }
 
 GameplaySystems::LobbyCharacterMesh GameplaySystems::GetCharacterMeshForLobby(const std::string& characterId)
@@ -9736,7 +10198,8 @@ GameplaySystems::LobbyCharacterMesh GameplaySystems::GetCharacterMeshForLobby(co
     const auto* survivorDef = m_loadoutCatalog.FindSurvivor(characterId);
     if (survivorDef != nullptr)
     {
-        if (EnsureSurvivorCharacterMeshLoaded(characterId))
+        // The lobby caches whatever this returns, so it still loads synchronously.
+        if (EnsureSurvivorCharacterMeshLoaded(characterId, true))
         {
             auto it = m_survivorVisualMeshes.find(characterId);
             if (it != m_survivorVisualMeshes.end())
@@ -9782,13 +10245,9 @@ GameplaySystems::LobbyCharacterMesh GameplaySystems::GetCharacterMeshForLobby(co
         cached.gpuUploadAttempted = true;
         cached.boundsLoadAttempted = true;
 
-        engine::assets::MeshLibrary* meshLibrary = m_meshLibrary;
-        engine::assets::MeshLibrary tempMeshLibrary;
-        if (meshLibrary == nullptr) meshLibrary = &tempMeshLibrary;
-
         const std::filesystem::path meshPath = ResolveAssetPathFromCwd(killerDef->modelPath);
         std::string error;
-        const engine::assets::MeshData* meshData = meshLibrary->LoadMesh(meshPath, &error);
+        const engine::assets::MeshData* meshData = MeshLibraryForLoads().LoadMesh(meshPath, &error);
         if (meshData == nullptr || !meshData->loaded)
         {
             cached.gpuUploadAttempted = false;
@@ -9815,6 +10274,23 @@ GameplaySystems::LobbyCharacterMesh GameplaySystems::GetCharacterMeshForLobby(co
 
 void GameplaySystems::PreloadCharacterMeshes()
 {
+    // Start every decode on the workers first so the blocking lobby loads below mostly just wait.
+    engine::assets::MeshLibrary& meshLibrary = MeshLibraryForLoads();
+    for (const auto& id : ListSurvivorCharacters())
+    {
+        if (const auto* def = m_loadoutCatalog.FindSurvivor(id); def != nullptr && !def->modelPath.empty())
+        {
+            (void)meshLibrary.LoadMeshAsync(ResolveAssetPathFromCwd(def->modelPath));
+        }
+    }
+    for (const auto& id : ListKillerCharacters())
+    {
+        if (const auto* def = m_loadoutCatalog.FindKiller(id); def != nullptr && !def->modelPath.empty())
+        {
+            (void)meshLibrary.LoadMeshAsync(ResolveAssetPathFromCwd(def->modelPath));
+        }
+    }
+
     for (const auto& id : ListSurvivorCharacters())
     {
         (void)GetCharacterMeshForLobby(id);
@@ -10762,7 +11238,7 @@ void GameplaySystems::RefreshSurvivorModelCapsuleOverride()
 
 void GameplaySystems::InitializeLoadoutCatalog()
 {
-    if (!m_loadoutCatalog.Initialize("assets"))
+    if (!m_loadoutCatalogLoaded)
     {
         AddRuntimeMessage("Loadout catalog init failed", 2.0F);
         return;
@@ -11087,6 +11563,11 @@ bool GameplaySystems::ReloadSelectedSurvivorCharacter(bool reloadAnimations)
     {
         m_survivorVisualMeshes.emplace(m_selectedSurvivorCharacterId, SurvivorVisualMesh{});
     }
+    if (const loadout::SurvivorCharacterDefinition* def = m_loadoutCatalog.FindSurvivor(m_selectedSurvivorCharacterId);
+        def != nullptr && !def->modelPath.empty())
+    {
+        MeshLibraryForLoads().Evict(ResolveAssetPathFromCwd(def->modelPath));
+    }
 
     if (reloadAnimations)
     {
@@ -11099,7 +11580,7 @@ bool GameplaySystems::ReloadSelectedSurvivorCharacter(bool reloadAnimations)
 
     const bool loaded = EnsureSurvivorCharacterMeshLoaded(m_selectedSurvivorCharacterId);
     std::cout << "[SURVIVOR_MODEL] Reload "
-              << (loaded ? "succeeded" : "failed")
+              << (loaded ? "succeeded" : "started")
               << " for " << m_selectedSurvivorCharacterId
               << " (clips=" << m_animationSystem.ListClips().size() << ")\n";
     return loaded;
@@ -13179,7 +13660,7 @@ void GameplaySystems::UpdateProjectiles(float fixedDt)
             if (survivorTransformIt != m_world.Transforms().end() &&
                 survivorActorIt != m_world.Actors().end())
             {
-                const glm::vec3 survivorPos = survivorTransformIt->second.position;
+                const glm::vec3 survivorPos = RewoundPosition(m_survivor, KillerRewindTicks());
                 const float survivorRadius = survivorActorIt->second.capsuleRadius;
                 const float survivorHeight = survivorActorIt->second.capsuleHeight;
 
@@ -14647,7 +15128,7 @@ void GameplaySystems::UpdateNurseBlinkPowerSystem(const RoleCommand& killerComma
                 auto survivorTransformIt = m_world.Transforms().find(m_survivor);
                 if (survivorTransformIt != m_world.Transforms().end())
                 {
-                    const glm::vec3 survivorPos = survivorTransformIt->second.position;
+                    const glm::vec3 survivorPos = RewoundPosition(m_survivor, KillerRewindTicks());
                     const float distXZ = DistanceXZ(killerPos, survivorPos);
 
                     if (distXZ <= m_blinkConfig.blinkAttackRange)
@@ -3,10 +3,12 @@
 #include <array>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <random>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <glm/mat4x4.hpp>
@@ -15,11 +17,13 @@
 #include <glm/vec3.hpp>
 
 #include "engine/animation/AnimationSystem.hpp"
+#include "engine/assets/MeshUploadQueue.hpp"
 #include "engine/core/EventBus.hpp"
 #include "engine/fx/FxSystem.hpp"
 #include "engine/platform/ActionBindings.hpp"
 #include "engine/physics/PhysicsWorld.hpp"
 #include "engine/render/Frustum.hpp"
+#include "engine/render/OcclusionCuller.hpp"
 #include "engine/render/Renderer.hpp"
 #include "engine/render/StaticBatcher.hpp"
 #include "engine/scene/World.hpp"
@@ -43,11 +47,6 @@ namespace engine::render
 class Renderer;
 }
 
-namespace engine::assets
-{
-class MeshLibrary;
-}
-
 namespace game::gameplay::perks
 {
 struct PerkLoadout;
@@ -445,6 +444,7 @@ public:
 
         int serverTickRate = 60;
         int interpolationBufferMs = 350;
+        int lagCompensationMaxMs = 200; // how far back the host may rewind for a remote killer's hits
     };
 
     enum class MapType
@@ -481,10 +481,29 @@ public:
         bool pickupItemPressed = false;
         bool wiggleLeftPressed = false;
         bool wiggleRightPressed = false;
+        std::uint32_t viewTick = 0; // remote commands: server tick the sender was looking at
+    };
+
+    static constexpr std::uint8_t kMaxReplicatedSurvivors = 4;
+    static constexpr float kRelevancyPublicOnly = -1.0F;
+
+    struct LagCompensationStats
+    {
+        int windowTicks = 0;
+        int lastRewindTicks = 0;
+        float lastRewindMs = 0.0F;
+        int maxRewindTicks = 0;
+        std::uint64_t rewoundChecks = 0;
+        std::uint64_t clampedChecks = 0; // view tick was older than the configured window
     };
 
+    /// One replicated actor in the entity-list snapshot. Actors are addressed by (role, slot)
+    /// so host and client agree on identity even though local entity ids may differ.
     struct ActorSnapshot
     {
+        engine::scene::Role role = engine::scene::Role::Survivor;
+        std::uint8_t slot = 0;
+        std::uint8_t healthState = 0;
         glm::vec3 position{0.0F};
         glm::vec3 forward{0.0F, 0.0F, -1.0F};
         glm::vec3 velocity{0.0F};
@@ -523,6 +542,30 @@ public:
         std::string addonBId;
     };
 
+    struct ScratchMarkSnapshot
+    {
+        glm::vec3 position{0.0F};
+        float yawDeg = 0.0F;
+        float age = 0.0F;
+        float lifetime = 30.0F;
+        float size = 0.35F;
+    };
+
+    /// Who a per-peer snapshot is being built for (host side interest management).
+    struct ReplicationViewer
+    {
+        engine::scene::Role role = engine::scene::Role::Survivor;
+        std::uint8_t slot = 0;
+        std::uint32_t sequence = 0; // per-peer snapshot counter, drives reduced-rate tiers
+    };
+
+    struct ReplicationRelevancy
+    {
+        float fullRateRadius = 24.0F;  // actors closer than this (or in LOS) replicate every snapshot
+        float maxRadius = 72.0F;       // pallets, traps and ground items beyond this are culled
+        int reducedRateInterval = 3;   // far + occluded actors replicate every Nth snapshot
+    };
+
     struct Snapshot
     {
         MapType mapType = MapType::Test;
@@ -537,9 +580,7 @@ public:
         std::string killerPowerId;
         std::string killerPowerAddonA;
         std::string killerPowerAddonB;
-        ActorSnapshot survivor;
-        ActorSnapshot killer;
-        std::uint8_t survivorState = 0;
+        std::vector<ActorSnapshot> actors;
         std::uint8_t killerAttackState = 0;
         float killerAttackStateTimer = 0.0F;
         float killerLungeCharge = 0.0F;
@@ -569,10 +610,19 @@ public:
         std::vector<PalletSnapshot> pallets;
         std::vector<TrapSnapshot> traps;
         std::vector<GroundItemSnapshot> groundItems;
+        std::vector<ScratchMarkSnapshot> scratchMarks;
+        // 0 = full world state. Otherwise entity lists only cover this radius around the viewer,
+        // so the client must not treat missing far entities as destroyed. kRelevancyPublicOnly:
+        // the viewer has no pawn yet and trap/item/scratch mark lists were withheld entirely.
+        float relevancyRadius = 0.0F;
+        std::uint32_t serverTick = 0;
     };
 
     GameplaySystems();
 
+    /// File-only part of Initialize (FX library, loadout catalog). Touches no other system, so startup
+    /// runs it on a job worker while the window and GL context come up; Initialize skips it afterwards.
+    void PreloadAssets();
     void Initialize(engine::core::EventBus& eventBus);
     void CaptureInputFrame(const engine::platform::Input& input, const engine::platform::ActionBindings& bindings, bool controlsEnabled);
     void FixedUpdate(float fixedDt, const engine::platform::Input& input, bool controlsEnabled);
@@ -580,6 +630,7 @@ public:
 
     void Render(engine::render::Renderer& renderer, float aspectRatio);
     [[nodiscard]] glm::mat4 BuildViewProjection(float aspectRatio) const;
+    [[nodiscard]] float CameraFovDegrees() const;
     [[nodiscard]] glm::vec3 CameraPosition() const { return m_cameraPosition; }
     [[nodiscard]] glm::vec3 CameraForward() const { return m_cameraForward; }
     [[nodiscard]] HudState BuildHudState() const;
@@ -640,12 +691,27 @@ public:
     [[nodiscard]] float GetBloodlustSpeedMultiplier() const;
 
     [[nodiscard]] bool DebugDrawEnabled() const { return m_debugDrawEnabled; }
+    void SetOcclusionCullingEnabled(bool enabled) { m_occlusionCuller.SetEnabled(enabled); }
+    [[nodiscard]] bool OcclusionCullingEnabled() const { return m_occlusionCuller.IsEnabled(); }
 
     void SetNetworkAuthorityMode(bool enabled);
+    /// Headless authority: both roles are driven by remote commands and no GPU resources are created.
+    void SetDedicatedServerMode(bool enabled);
+    [[nodiscard]] bool DedicatedServerMode() const { return m_dedicatedServerMode; }
+    /// No GL context: map loads skip GPU-side batching (dedicated server, soak harness).
+    void SetHeadless(bool enabled) { m_headless = enabled; }
     void SetRemoteRoleCommand(engine::scene::Role role, const RoleCommand& command);
     void ClearRemoteRoleCommands();
     [[nodiscard]] Snapshot BuildSnapshot() const;
+    /// Per-client relevancy filter: distance, line of sight and role rules applied to a full snapshot.
+    [[nodiscard]] Snapshot FilterSnapshotForViewer(const Snapshot& full, const ReplicationViewer& viewer) const;
+    void SetReplicationRelevancy(const ReplicationRelevancy& relevancy) { m_replicationRelevancy = relevancy; }
+    [[nodiscard]] const ReplicationRelevancy& GetReplicationRelevancy() const { return m_replicationRelevancy; }
     void ApplySnapshot(const Snapshot& snapshot, float blendAlpha);
+    [[nodiscard]] std::uint32_t ServerTick() const { return m_serverTick; }
+    /// Client: server tick of the state on screen (latest snapshot minus the ApplySnapshot smoothing lag).
+    [[nodiscard]] std::uint32_t ClientViewTick() const;
+    [[nodiscard]] const LagCompensationStats& GetLagCompensationStats() const { return m_lagCompStats; }
 
     void RequestQuit();
     [[nodiscard]] bool QuitRequested() const { return m_quitRequested; }
@@ -1005,6 +1071,9 @@ private:
 
     [[nodiscard]] CameraMode ResolveCameraMode() const;
     [[nodiscard]] engine::scene::Entity ControlledEntity() const;
+    /// Replication slot -> local entity. Gameplay has one pawn per role, so only slot 0 resolves; higher
+    /// survivor slots are pawnless spectators and resolve to 0 (relevancy centers them on slot 0).
+    [[nodiscard]] engine::scene::Entity ActorEntityForSlot(engine::scene::Role role, std::uint8_t slot) const;
     [[nodiscard]] engine::scene::Role ControlledSceneRole() const;
 
     void BeginWindowVault(engine::scene::Entity actorEntity, engine::scene::Entity windowEntity);
@@ -1064,7 +1133,10 @@ private:
         float* outMaxY,
         float* outMaxAbsXZ
     );
-    [[nodiscard]] bool EnsureSurvivorCharacterMeshLoaded(const std::string& characterId);
+    // Non-blocking by default: starts an async load and returns false until the upload ran.
+    [[nodiscard]] bool EnsureSurvivorCharacterMeshLoaded(const std::string& characterId, bool blocking = false);
+    void ApplySurvivorVisualMesh(const std::string& characterId, const engine::assets::MeshData& meshData, const std::string& meshPath);
+    [[nodiscard]] engine::assets::MeshLibrary& MeshLibraryForLoads();
     [[nodiscard]] bool ReloadSurvivorCharacterAnimations(const std::string& characterId);
     [[nodiscard]] bool LoadSurvivorAnimationRig(const std::string& characterId);
     [[nodiscard]] bool BuildAnimatedSurvivorGeometry(
@@ -1157,6 +1229,7 @@ private:
 
     engine::scene::Entity m_survivor = 0;
     engine::scene::Entity m_killer = 0;
+    ReplicationRelevancy m_replicationRelevancy;
     engine::scene::Entity m_killerBreakingPallet = 0;
     SurvivorHealthState m_survivorState = SurvivorHealthState::Healthy;
     int m_generatorsCompleted = 0;
@@ -1179,15 +1252,22 @@ private:
     bool m_noClipEnabled = false;
     bool m_quitRequested = false;
     bool m_networkAuthorityMode = false;
+    bool m_dedicatedServerMode = false;
+    bool m_headless = false;
 
     // Test model mesh loading and rendering
-    engine::assets::MeshLibrary* m_meshLibrary = nullptr;
+    engine::assets::MeshLibrary* m_meshLibrary = nullptr; // overrides the shared AssetManager library
+    engine::assets::MeshUploadQueue m_meshUploads;     // async character / test-model meshes awaiting GPU upload
     struct TestModelGpuMeshes
     {
         engine::render::Renderer::GpuMeshId maleBody = engine::render::Renderer::kInvalidGpuMesh;
         engine::render::Renderer::GpuMeshId femaleBody = engine::render::Renderer::kInvalidGpuMesh;
         float maleFeetOffset = 0.0F;
         float femaleFeetOffset = 0.0F;
+        engine::assets::MeshHandle malePending;
+        engine::assets::MeshHandle femalePending;
+        bool maleFailed = false;
+        bool femaleFailed = false;
     };
     TestModelGpuMeshes m_testModelMeshes;
 
@@ -1201,6 +1281,7 @@ private:
         bool boundsLoaded = false;
         bool boundsLoadFailed = false;
         bool gpuUploadAttempted = false;
+        engine::assets::MeshHandle pendingMesh; // async load in flight; the upload is stale if this changed
     };
 
     struct SurvivorAnimationRig
@@ -1250,6 +1331,24 @@ private:
     std::optional<RoleCommand> m_remoteSurvivorCommand;
     std::optional<RoleCommand> m_remoteKillerCommand;
 
+    // Lag compensation: actor positions at the end of each fixed tick, indexed by tick % capacity.
+    // Hits by a remote killer are judged against the survivor where the killer's client saw them.
+    struct LagCompensationFrame
+    {
+        std::uint32_t tick = 0;
+        std::vector<std::pair<engine::scene::Entity, glm::vec3>> positions;
+    };
+    static constexpr std::size_t kLagCompensationHistory = 64;
+    void RecordLagCompensationFrame();
+    [[nodiscard]] int KillerRewindTicks();
+    [[nodiscard]] glm::vec3 RewoundPosition(engine::scene::Entity entity, int rewindTicks) const;
+    std::array<LagCompensationFrame, kLagCompensationHistory> m_lagCompHistory{};
+    LagCompensationStats m_lagCompStats{};
+    std::uint32_t m_serverTick = 0;
+    std::uint32_t m_clientLatestServerTick = 0;
+    float m_clientSnapshotTickGap = 1.0F;
+    float m_clientViewLagTicks = 0.0F;
+
     float m_interactBufferWindowSeconds = 0.18F;
     std::array<float, 2> m_interactBufferRemaining{0.0F, 0.0F};
     std::vector<int> m_survivorWigglePressQueue;
@@ -1372,6 +1471,8 @@ private:
     StatusEffectManager m_statusEffectManager;
 
     loadout::GameplayCatalog m_loadoutCatalog;
+    bool m_assetsPreloaded = false;
+    bool m_loadoutCatalogLoaded = false;
     loadout::LoadoutSurvivor m_survivorLoadout;
     loadout::LoadoutKiller m_killerLoadout;
     loadout::AddonModifierContext m_survivorItemModifiers;
@@ -1480,6 +1581,7 @@ private:
     bool m_physicsDirty = false; // Set when interactions change collision geometry; triggers deferred RebuildPhysicsWorld.
     mutable std::vector<engine::physics::TriggerHit> m_triggerHitBuf; // Reusable buffer for trigger queries (avoids per-call heap alloc).
     engine::render::StaticBatcher m_staticBatcher{};
+    engine::render::OcclusionCuller m_occlusionCuller; // map walls as occluders; CPU only, also built headless
 
     [[nodiscard]] static engine::scene::Role OppositeRole(engine::scene::Role role);
 
@@ -1630,9 +1732,10 @@ private:
     struct HighPolyMesh
     {
         engine::render::MeshGeometry geometry;
-        engine::render::MeshGeometry mediumLodGeometry;
-        engine::render::Renderer::GpuMeshId gpuFullLod = engine::render::Renderer::kInvalidGpuMesh;
-        engine::render::Renderer::GpuMeshId gpuMediumLod = engine::render::Renderer::kInvalidGpuMesh;
+        std::shared_ptr<const std::vector<engine::assets::MeshLod>> lodChain;  // simplified LOD 1..N, shared per type/detail
+        std::vector<engine::render::Renderer::GpuMeshId> gpuLods;             // [0] = full detail
+        std::vector<float> lodErrors;                                           // world-space error per entry of gpuLods
+        std::size_t currentLod = 0;
         glm::vec3 position{0.0F};
         glm::vec3 rotation{0.0F};
         glm::vec3 scale{1.0F};
@@ -1640,6 +1743,7 @@ private:
         glm::vec3 halfExtents{1.0F};  // For frustum culling
     };
     std::vector<HighPolyMesh> m_highPolyMeshes;
+    engine::render::AabbBatch m_highPolyBounds;  // world bounds of m_highPolyMeshes, same order
     bool m_highPolyMeshesGenerated = false;
     bool m_highPolyMeshesUploaded = false;
 
@@ -1652,8 +1756,12 @@ private:
         float rotationDegrees = 0.0F;
         glm::vec3 halfExtents{1.0F};  // For frustum culling
         bool collisionCreated = false;  // Whether collision boxes were created
+        std::vector<engine::render::Renderer::GpuMeshId> gpuLods{};  // [0] = gpuMesh, then MeshLibrary LODs
+        std::vector<float> lodErrors{};
+        std::size_t currentLod = 0;
     };
     std::vector<LoopMeshInstance> m_loopMeshes;
+    engine::render::AabbBatch m_loopMeshBounds;  // world bounds of m_loopMeshes, rebuilt with the upload pass
     bool m_loopMeshesUploaded = false;
     void RenderLoopMeshes(engine::render::Renderer& renderer);
     // Animation system for locomotion (survivor)
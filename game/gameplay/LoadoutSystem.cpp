@@ -7,6 +7,8 @@
 #include <glm/common.hpp>
 #include <nlohmann/json.hpp>
 
+#include "engine/assets/AssetPack.hpp"
+
 namespace game::gameplay::loadout
 {
 namespace
@@ -41,7 +43,7 @@ TargetKind TargetKindFromText(const std::string& value)
 
 void SaveIfMissing(const std::filesystem::path& path, const json& payload)
 {
-    if (std::filesystem::exists(path))
+    if (engine::assets::AssetPack::Instance().Find(path).has_value() || std::filesystem::exists(path))
     {
         return;
     }
@@ -51,6 +53,25 @@ void SaveIfMissing(const std::filesystem::path& path, const json& payload)
         out << payload.dump(2) << "\n";
     }
 }
+/// Every valid JSON document in directory, packed or loose; unreadable or invalid files are skipped.
+std::vector<json> LoadJsonDirectory(const std::filesystem::path& directory)
+{
+    std::vector<json> documents;
+    for (const std::string& fileName : engine::assets::AssetPack::ListFiles(directory, ".json"))
+    {
+        std::string text;
+        if (!engine::assets::AssetPack::ReadFile(directory / fileName, text))
+        {
+            continue;
+        }
+        json root = json::parse(text, nullptr, false);
+        if (!root.is_discarded())
+        {
+            documents.push_back(std::move(root));
+        }
+    }
+    return documents;
+}
 } // namespace
 
 bool AddonDefinition::AppliesTo(TargetKind kind, const std::string& targetId) const
@@ -470,26 +491,8 @@ bool GameplayCatalog::EnsureDefaultAssets() const
 bool GameplayCatalog::LoadItems()
 {
     const std::filesystem::path dir = std::filesystem::path(m_assetsRoot) / "items";
-    for (const auto& entry : std::filesystem::directory_iterator(dir))
+    for (const json& root : LoadJsonDirectory(dir))
     {
-        if (!entry.is_regular_file() || entry.path().extension() != ".json")
-        {
-            continue;
-        }
-        std::ifstream in(entry.path());
-        if (!in.is_open())
-        {
-            continue;
-        }
-        json root;
-        try
-        {
-            in >> root;
-        }
-        catch (const std::exception&)
-        {
-            continue;
-        }
         ItemDefinition item;
         item.assetVersion = root.value("asset_version", 1);
         item.id = root.value("id", std::string{});
@@ -519,26 +522,8 @@ bool GameplayCatalog::LoadItems()
 bool GameplayCatalog::LoadAddons()
 {
     const std::filesystem::path dir = std::filesystem::path(m_assetsRoot) / "addons";
-    for (const auto& entry : std::filesystem::directory_iterator(dir))
+    for (const json& root : LoadJsonDirectory(dir))
     {
-        if (!entry.is_regular_file() || entry.path().extension() != ".json")
-        {
-            continue;
-        }
-        std::ifstream in(entry.path());
-        if (!in.is_open())
-        {
-            continue;
-        }
-        json root;
-        try
-        {
-            in >> root;
-        }
-        catch (const std::exception&)
-        {
-            continue;
-        }
         AddonDefinition addon;
         addon.assetVersion = root.value("asset_version", 1);
         addon.id = root.value("id", std::string{});
@@ -606,26 +591,8 @@ bool GameplayCatalog::LoadAddons()
 bool GameplayCatalog::LoadPowers()
 {
     const std::filesystem::path dir = std::filesystem::path(m_assetsRoot) / "powers";
-    for (const auto& entry : std::filesystem::directory_iterator(dir))
+    for (const json& root : LoadJsonDirectory(dir))
     {
-        if (!entry.is_regular_file() || entry.path().extension() != ".json")
-        {
-            continue;
-        }
-        std::ifstream in(entry.path());
-        if (!in.is_open())
-        {
-            continue;
-        }
-        json root;
-        try
-        {
-            in >> root;
-        }
-        catch (const std::exception&)
-        {
-            continue;
-        }
         PowerDefinition power;
         power.assetVersion = root.value("asset_version", 1);
         power.id = root.value("id", std::string{});
@@ -654,26 +621,8 @@ bool GameplayCatalog::LoadCharacters()
     const std::filesystem::path survivorsDir = std::filesystem::path(m_assetsRoot) / "characters" / "survivors";
     const std::filesystem::path killersDir = std::filesystem::path(m_assetsRoot) / "characters" / "killers";
 
-    for (const auto& entry : std::filesystem::directory_iterator(survivorsDir))
+    for (const json& root : LoadJsonDirectory(survivorsDir))
     {
-        if (!entry.is_regular_file() || entry.path().extension() != ".json")
-        {
-            continue;
-        }
-        std::ifstream in(entry.path());
-        if (!in.is_open())
-        {
-            continue;
-        }
-        json root;
-        try
-        {
-            in >> root;
-        }
-        catch (const std::exception&)
-        {
-            continue;
-        }
         SurvivorCharacterDefinition s;
         s.assetVersion = root.value("asset_version", 1);
         s.id = root.value("id", std::string{});
@@ -687,26 +636,8 @@ bool GameplayCatalog::LoadCharacters()
         }
     }
 
-    for (const auto& entry : std::filesystem::directory_iterator(killersDir))
+    for (const json& root : LoadJsonDirectory(killersDir))
     {
-        if (!entry.is_regular_file() || entry.path().extension() != ".json")
-        {
-            continue;
-        }
-        std::ifstream in(entry.path());
-        if (!in.is_open())
-        {
-            continue;
-        }
-        json root;
-        try
-        {
-            in >> root;
-        }
-        catch (const std::exception&)
-        {
-            continue;
-        }
         KillerCharacterDefinition k;
         k.assetVersion = root.value("asset_version", 1);
         k.id = root.value("id", std::string{});
@@ -0,0 +1,943 @@
+#include "game/net/NetProtocol.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace game::net
+{
+game::gameplay::GameplaySystems::MapType ByteToMapType(std::uint8_t value)
+{
+    switch (value)
+    {
+        case 1: return game::gameplay::GameplaySystems::MapType::Main;
+        case 2: return game::gameplay::GameplaySystems::MapType::CollisionTest;
+        case 0:
+        default: return game::gameplay::GameplaySystems::MapType::Test;
+    }
+}
+
+std::uint8_t MapTypeToByte(game::gameplay::GameplaySystems::MapType mapType)
+{
+    switch (mapType)
+    {
+        case game::gameplay::GameplaySystems::MapType::Main: return 1;
+        case game::gameplay::GameplaySystems::MapType::CollisionTest: return 2;
+        case game::gameplay::GameplaySystems::MapType::Test:
+        default: return 0;
+    }
+}
+
+std::string MapTypeToName(game::gameplay::GameplaySystems::MapType mapType)
+{
+    switch (mapType)
+    {
+        case game::gameplay::GameplaySystems::MapType::Main: return "main";
+        case game::gameplay::GameplaySystems::MapType::CollisionTest: return "collision_test";
+        case game::gameplay::GameplaySystems::MapType::Test:
+        default: return "test";
+    }
+}
+
+std::uint8_t RoleNameToByte(const std::string& roleName)
+{
+    return roleName == "killer" ? 1U : 0U;
+}
+
+std::string RoleByteToName(std::uint8_t roleByte)
+{
+    return roleByte == 1U ? "killer" : "survivor";
+}
+
+game::gameplay::GameplaySystems::RoleCommand RoleCommandFromInput(const RoleInputPacket& packet)
+{
+    game::gameplay::GameplaySystems::RoleCommand command;
+    command.moveAxis = glm::vec2{
+        static_cast<float>(packet.moveX) / 100.0F,
+        static_cast<float>(packet.moveY) / 100.0F,
+    };
+    command.lookDelta = glm::vec2{packet.lookX, packet.lookY};
+    command.sprinting = (packet.buttons & kButtonSprint) != 0;
+    command.interactPressed = (packet.buttons & kButtonInteractPressed) != 0;
+    command.interactHeld = (packet.buttons & kButtonInteractHeld) != 0;
+    command.attackPressed = (packet.buttons & kButtonAttackPressed) != 0;
+    command.attackHeld = (packet.buttons & kButtonAttackHeld) != 0;
+    command.attackReleased = (packet.buttons & kButtonAttackReleased) != 0;
+    command.lungeHeld = (packet.buttons & kButtonLungeHeld) != 0;
+    command.jumpPressed = (packet.buttons & kButtonJumpPressed) != 0;
+    command.crouchHeld = (packet.buttons & kButtonCrouchHeld) != 0;
+    command.useAltPressed = (packet.buttons & kButtonUseAltPressed) != 0;
+    command.useAltHeld = (packet.buttons & kButtonUseAltHeld) != 0;
+    command.useAltReleased = (packet.buttons & kButtonUseAltReleased) != 0;
+    command.dropItemPressed = (packet.buttons & kButtonDropItemPressed) != 0;
+    command.pickupItemPressed = (packet.buttons & kButtonPickupItemPressed) != 0;
+    command.wiggleLeftPressed = (packet.buttons & kButtonWiggleLeftPressed) != 0;
+    command.wiggleRightPressed = (packet.buttons & kButtonWiggleRightPressed) != 0;
+    command.viewTick = packet.viewTick;
+    return command;
+}
+
+bool SerializeRoleInput(const RoleInputPacket& packet, std::vector<std::uint8_t>& outBuffer)
+{
+    outBuffer.clear();
+    outBuffer.reserve(1 + sizeof(RoleInputPacket));
+
+    AppendValue(outBuffer, kPacketRoleInput);
+    AppendValue(outBuffer, packet.moveX);
+    AppendValue(outBuffer, packet.moveY);
+    AppendValue(outBuffer, packet.lookX);
+    AppendValue(outBuffer, packet.lookY);
+    AppendValue(outBuffer, packet.buttons);
+    AppendValue(outBuffer, packet.viewTick);
+    return true;
+}
+
+bool DeserializeRoleInput(const std::vector<std::uint8_t>& buffer, RoleInputPacket& outPacket)
+{
+    std::size_t offset = 0;
+    std::uint8_t type = 0;
+    if (!ReadValue(buffer, offset, type) || type != kPacketRoleInput)
+    {
+        return false;
+    }
+
+    return ReadValue(buffer, offset, outPacket.moveX) &&
+           ReadValue(buffer, offset, outPacket.moveY) &&
+           ReadValue(buffer, offset, outPacket.lookX) &&
+           ReadValue(buffer, offset, outPacket.lookY) &&
+           ReadValue(buffer, offset, outPacket.buttons) &&
+           ReadValue(buffer, offset, outPacket.viewTick);
+}
+
+bool SerializeSnapshot(const game::gameplay::GameplaySystems::Snapshot& snapshot, std::vector<std::uint8_t>& outBuffer)
+{
+    outBuffer.clear();
+
+    AppendValue(outBuffer, kPacketSnapshot);
+    AppendValue(outBuffer, MapTypeToByte(snapshot.mapType));
+    AppendValue(outBuffer, snapshot.seed);
+
+    auto writePerks = [&](const std::array<std::string, 3>& perkIds) {
+        for (const auto& perkId : perkIds)
+        {
+            const std::uint16_t length = static_cast<std::uint16_t>(std::min<std::size_t>(perkId.size(), 256));
+            AppendValue(outBuffer, length);
+            outBuffer.insert(outBuffer.end(), perkId.begin(), perkId.begin() + length);
+        }
+    };
+
+    writePerks(snapshot.survivorPerkIds);
+    writePerks(snapshot.killerPerkIds);
+
+    auto writeString = [&](const std::string& value, std::uint16_t maxLen) {
+        const std::uint16_t length = static_cast<std::uint16_t>(std::min<std::size_t>(value.size(), maxLen));
+        AppendValue(outBuffer, length);
+        outBuffer.insert(outBuffer.end(), value.begin(), value.begin() + length);
+    };
+
+    writeString(snapshot.survivorCharacterId, 128);
+    writeString(snapshot.killerCharacterId, 128);
+    writeString(snapshot.survivorItemId, 128);
+    writeString(snapshot.survivorItemAddonA, 128);
+    writeString(snapshot.survivorItemAddonB, 128);
+    writeString(snapshot.killerPowerId, 128);
+    writeString(snapshot.killerPowerAddonA, 128);
+    writeString(snapshot.killerPowerAddonB, 128);
+
+    auto writeActor = [&](const game::gameplay::GameplaySystems::ActorSnapshot& actor) {
+        AppendValue(outBuffer, static_cast<std::uint8_t>(actor.role == engine::scene::Role::Killer ? 1 : 0));
+        AppendValue(outBuffer, actor.slot);
+        AppendValue(outBuffer, actor.healthState);
+        AppendValue(outBuffer, actor.position.x);
+        AppendValue(outBuffer, actor.position.y);
+        AppendValue(outBuffer, actor.position.z);
+        AppendValue(outBuffer, actor.forward.x);
+        AppendValue(outBuffer, actor.forward.y);
+        AppendValue(outBuffer, actor.forward.z);
+        AppendValue(outBuffer, actor.velocity.x);
+        AppendValue(outBuffer, actor.velocity.y);
+        AppendValue(outBuffer, actor.velocity.z);
+        AppendValue(outBuffer, actor.yaw);
+        AppendValue(outBuffer, actor.pitch);
+    };
+
+    const std::uint8_t actorCount = static_cast<std::uint8_t>(std::min<std::size_t>(snapshot.actors.size(), 32));
+    AppendValue(outBuffer, actorCount);
+    for (std::size_t i = 0; i < actorCount; ++i)
+    {
+        writeActor(snapshot.actors[i]);
+    }
+
+    AppendValue(outBuffer, snapshot.killerAttackState);
+    AppendValue(outBuffer, snapshot.killerAttackStateTimer);
+    AppendValue(outBuffer, snapshot.killerLungeCharge);
+    AppendValue(outBuffer, static_cast<std::uint8_t>(snapshot.chaseActive ? 1 : 0));
+    AppendValue(outBuffer, snapshot.chaseDistance);
+    AppendValue(outBuffer, static_cast<std::uint8_t>(snapshot.chaseLos ? 1 : 0));
+    AppendValue(outBuffer, static_cast<std::uint8_t>(snapshot.chaseInCenterFOV ? 1 : 0));
+    AppendValue(outBuffer, snapshot.chaseTimeSinceLOS);
+    AppendValue(outBuffer, snapshot.chaseTimeSinceCenterFOV);
+    AppendValue(outBuffer, snapshot.chaseTimeInChase);
+    AppendValue(outBuffer, snapshot.bloodlustTier);
+    AppendValue(outBuffer, snapshot.survivorItemCharges);
+    AppendValue(outBuffer, snapshot.survivorItemActive);
+    AppendValue(outBuffer, snapshot.survivorItemUsesRemaining);
+    AppendValue(outBuffer, snapshot.wraithCloaked);
+    AppendValue(outBuffer, snapshot.wraithTransitionTimer);
+    AppendValue(outBuffer, snapshot.wraithPostUncloakTimer);
+    AppendValue(outBuffer, snapshot.killerBlindTimer);
+    AppendValue(outBuffer, snapshot.killerBlindStyleWhite);
+    AppendValue(outBuffer, snapshot.carriedTrapCount);
+
+    const std::uint16_t palletCount = static_cast<std::uint16_t>(std::min<std::size_t>(snapshot.pallets.size(), 1024));
+    AppendValue(outBuffer, palletCount);
+    for (std::size_t i = 0; i < palletCount; ++i)
+    {
+        const auto& pallet = snapshot.pallets[i];
+        AppendValue(outBuffer, pallet.entity);
+        AppendValue(outBuffer, pallet.state);
+        AppendValue(outBuffer, pallet.breakTimer);
+        AppendValue(outBuffer, pallet.position.x);
+        AppendValue(outBuffer, pallet.position.y);
+        AppendValue(outBuffer, pallet.position.z);
+        AppendValue(outBuffer, pallet.halfExtents.x);
+        AppendValue(outBuffer, pallet.halfExtents.y);
+        AppendValue(outBuffer, pallet.halfExtents.z);
+    }
+
+    const std::uint16_t trapCount = static_cast<std::uint16_t>(std::min<std::size_t>(snapshot.traps.size(), 1024));
+    AppendValue(outBuffer, trapCount);
+    for (std::size_t i = 0; i < trapCount; ++i)
+    {
+        const auto& trap = snapshot.traps[i];
+        AppendValue(outBuffer, trap.entity);
+        AppendValue(outBuffer, trap.state);
+        AppendValue(outBuffer, trap.trappedEntity);
+        AppendValue(outBuffer, trap.position.x);
+        AppendValue(outBuffer, trap.position.y);
+        AppendValue(outBuffer, trap.position.z);
+        AppendValue(outBuffer, trap.halfExtents.x);
+        AppendValue(outBuffer, trap.halfExtents.y);
+        AppendValue(outBuffer, trap.halfExtents.z);
+        AppendValue(outBuffer, trap.escapeChance);
+        AppendValue(outBuffer, trap.escapeAttempts);
+        AppendValue(outBuffer, trap.maxEscapeAttempts);
+    }
+
+    const std::uint16_t groundItemCount = static_cast<std::uint16_t>(std::min<std::size_t>(snapshot.groundItems.size(), 1024));
+    AppendValue(outBuffer, groundItemCount);
+    for (std::size_t i = 0; i < groundItemCount; ++i)
+    {
+        const auto& groundItem = snapshot.groundItems[i];
+        AppendValue(outBuffer, groundItem.entity);
+        AppendValue(outBuffer, groundItem.position.x);
+        AppendValue(outBuffer, groundItem.position.y);
+        AppendValue(outBuffer, groundItem.position.z);
+        AppendValue(outBuffer, groundItem.charges);
+        writeString(groundItem.itemId, 128);
+        writeString(groundItem.addonAId, 128);
+        writeString(groundItem.addonBId, 128);
+    }
+
+    const std::uint16_t scratchCount = static_cast<std::uint16_t>(std::min<std::size_t>(snapshot.scratchMarks.size(), 256));
+    AppendValue(outBuffer, scratchCount);
+    for (std::size_t i = 0; i < scratchCount; ++i)
+    {
+        const auto& mark = snapshot.scratchMarks[i];
+        AppendValue(outBuffer, mark.position.x);
+        AppendValue(outBuffer, mark.position.y);
+        AppendValue(outBuffer, mark.position.z);
+        AppendValue(outBuffer, mark.yawDeg);
+        AppendValue(outBuffer, mark.age);
+        AppendValue(outBuffer, mark.lifetime);
+        AppendValue(outBuffer, mark.size);
+    }
+
+    AppendValue(outBuffer, snapshot.relevancyRadius);
+    AppendValue(outBuffer, snapshot.serverTick);
+    return true;
+}
+
+bool DeserializeSnapshot(const std::vector<std::uint8_t>& buffer, game::gameplay::GameplaySystems::Snapshot& outSnapshot)
+{
+    std::size_t offset = 0;
+    std::uint8_t type = 0;
+    std::uint8_t mapTypeByte = 0;
+
+    if (!ReadValue(buffer, offset, type) || type != kPacketSnapshot)
+    {
+        return false;
+    }
+
+    if (!ReadValue(buffer, offset, mapTypeByte))
+    {
+        return false;
+    }
+
+    outSnapshot.mapType = ByteToMapType(mapTypeByte);
+    if (!ReadValue(buffer, offset, outSnapshot.seed))
+    {
+        return false;
+    }
+
+    auto readPerks = [&](std::array<std::string, 3>& perkIds) {
+        for (int i = 0; i < 3; ++i)
+        {
+            std::uint16_t length = 0;
+            if (!ReadValue(buffer, offset, length))
+            {
+                return false;
+            }
+            if (offset + length > buffer.size())
+            {
+                return false;
+            }
+            perkIds[i].assign(reinterpret_cast<const char*>(buffer.data() + offset), length);
+            offset += length;
+        }
+        return true;
+    };
+
+    if (!readPerks(outSnapshot.survivorPerkIds) || !readPerks(outSnapshot.killerPerkIds))
+    {
+        return false;
+    }
+
+    auto readString = [&](std::string& outValue) {
+        std::uint16_t length = 0;
+        if (!ReadValue(buffer, offset, length))
+        {
+            return false;
+        }
+        if (offset + length > buffer.size())
+        {
+            return false;
+        }
+        outValue.assign(reinterpret_cast<const char*>(buffer.data() + offset), length);
+        offset += length;
+        return true;
+    };
+
+    if (!readString(outSnapshot.survivorCharacterId) ||
+        !readString(outSnapshot.killerCharacterId) ||
+        !readString(outSnapshot.survivorItemId) ||
+        !readString(outSnapshot.survivorItemAddonA) ||
+        !readString(outSnapshot.survivorItemAddonB) ||
+        !readString(outSnapshot.killerPowerId) ||
+        !readString(outSnapshot.killerPowerAddonA) ||
+        !readString(outSnapshot.killerPowerAddonB))
+    {
+        return false;
+    }
+
+    auto readActor = [&](game::gameplay::GameplaySystems::ActorSnapshot& actor) {
+        std::uint8_t roleByte = 0;
+        if (!ReadValue(buffer, offset, roleByte) ||
+            !ReadValue(buffer, offset, actor.slot) ||
+            !ReadValue(buffer, offset, actor.healthState))
+        {
+            return false;
+        }
+        actor.role = roleByte == 1 ? engine::scene::Role::Killer : engine::scene::Role::Survivor;
+        return ReadValue(buffer, offset, actor.position.x) &&
+               ReadValue(buffer, offset, actor.position.y) &&
+               ReadValue(buffer, offset, actor.position.z) &&
+               ReadValue(buffer, offset, actor.forward.x) &&
+               ReadValue(buffer, offset, actor.forward.y) &&
+               ReadValue(buffer, offset, actor.forward.z) &&
+               ReadValue(buffer, offset, actor.velocity.x) &&
+               ReadValue(buffer, offset, actor.velocity.y) &&
+               ReadValue(buffer, offset, actor.velocity.z) &&
+               ReadValue(buffer, offset, actor.yaw) &&
+               ReadValue(buffer, offset, actor.pitch);
+    };
+
+    std::uint8_t actorCount = 0;
+    if (!ReadValue(buffer, offset, actorCount))
+    {
+        return false;
+    }
+    outSnapshot.actors.clear();
+    outSnapshot.actors.resize(actorCount);
+    for (auto& actor : outSnapshot.actors)
+    {
+        if (!readActor(actor))
+        {
+            return false;
+        }
+    }
+
+    std::uint8_t chaseActiveByte = 0;
+    std::uint8_t chaseLosByte = 0;
+    std::uint8_t chaseInCenterFOVByte = 0;
+    if (!ReadValue(buffer, offset, outSnapshot.killerAttackState) ||
+        !ReadValue(buffer, offset, outSnapshot.killerAttackStateTimer) ||
+        !ReadValue(buffer, offset, outSnapshot.killerLungeCharge) ||
+        !ReadValue(buffer, offset, chaseActiveByte) ||
+        !ReadValue(buffer, offset, outSnapshot.chaseDistance) ||
+        !ReadValue(buffer, offset, chaseLosByte) ||
+        !ReadValue(buffer, offset, chaseInCenterFOVByte) ||
+        !ReadValue(buffer, offset, outSnapshot.chaseTimeSinceLOS) ||
+        !ReadValue(buffer, offset, outSnapshot.chaseTimeSinceCenterFOV) ||
+        !ReadValue(buffer, offset, outSnapshot.chaseTimeInChase) ||
+        !ReadValue(buffer, offset, outSnapshot.bloodlustTier) ||
+        !ReadValue(buffer, offset, outSnapshot.survivorItemCharges) ||
+        !ReadValue(buffer, offset, outSnapshot.survivorItemActive) ||
+        !ReadValue(buffer, offset, outSnapshot.survivorItemUsesRemaining) ||
+        !ReadValue(buffer, offset, outSnapshot.wraithCloaked) ||
+        !ReadValue(buffer, offset, outSnapshot.wraithTransitionTimer) ||
+        !ReadValue(buffer, offset, outSnapshot.wraithPostUncloakTimer) ||
+        !ReadValue(buffer, offset, outSnapshot.killerBlindTimer) ||
+        !ReadValue(buffer, offset, outSnapshot.killerBlindStyleWhite) ||
+        !ReadValue(buffer, offset, outSnapshot.carriedTrapCount))
+    {
+        return false;
+    }
+
+    outSnapshot.chaseActive = chaseActiveByte != 0;
+    outSnapshot.chaseLos = chaseLosByte != 0;
+    outSnapshot.chaseInCenterFOV = chaseInCenterFOVByte != 0;
+
+    std::uint16_t palletCount = 0;
+    if (!ReadValue(buffer, offset, palletCount))
+    {
+        return false;
+    }
+
+    outSnapshot.pallets.clear();
+    outSnapshot.pallets.reserve(palletCount);
+
+    for (std::uint16_t i = 0; i < palletCount; ++i)
+    {
+        game::gameplay::GameplaySystems::PalletSnapshot pallet;
+        if (!ReadValue(buffer, offset, pallet.entity) ||
+            !ReadValue(buffer, offset, pallet.state) ||
+            !ReadValue(buffer, offset, pallet.breakTimer) ||
+            !ReadValue(buffer, offset, pallet.position.x) ||
+            !ReadValue(buffer, offset, pallet.position.y) ||
+            !ReadValue(buffer, offset, pallet.position.z) ||
+            !ReadValue(buffer, offset, pallet.halfExtents.x) ||
+            !ReadValue(buffer, offset, pallet.halfExtents.y) ||
+            !ReadValue(buffer, offset, pallet.halfExtents.z))
+        {
+            return false;
+        }
+
+        outSnapshot.pallets.push_back(pallet);
+    }
+
+    std::uint16_t trapCount = 0;
+    if (!ReadValue(buffer, offset, trapCount))
+    {
+        return false;
+    }
+    outSnapshot.traps.clear();
+    outSnapshot.traps.reserve(trapCount);
+    for (std::uint16_t i = 0; i < trapCount; ++i)
+    {
+        game::gameplay::GameplaySystems::TrapSnapshot trap;
+        if (!ReadValue(buffer, offset, trap.entity) ||
+            !ReadValue(buffer, offset, trap.state) ||
+            !ReadValue(buffer, offset, trap.trappedEntity) ||
+            !ReadValue(buffer, offset, trap.position.x) ||
+            !ReadValue(buffer, offset, trap.position.y) ||
+            !ReadValue(buffer, offset, trap.position.z) ||
+            !ReadValue(buffer, offset, trap.halfExtents.x) ||
+            !ReadValue(buffer, offset, trap.halfExtents.y) ||
+            !ReadValue(buffer, offset, trap.halfExtents.z) ||
+            !ReadValue(buffer, offset, trap.escapeChance) ||
+            !ReadValue(buffer, offset, trap.escapeAttempts) ||
+            !ReadValue(buffer, offset, trap.maxEscapeAttempts))
+        {
+            return false;
+        }
+        outSnapshot.traps.push_back(trap);
+    }
+
+    std::uint16_t groundItemCount = 0;
+    if (!ReadValue(buffer, offset, groundItemCount))
+    {
+        return false;
+    }
+    outSnapshot.groundItems.clear();
+    outSnapshot.groundItems.reserve(groundItemCount);
+    for (std::uint16_t i = 0; i < groundItemCount; ++i)
+    {
+        game::gameplay::GameplaySystems::GroundItemSnapshot groundItem;
+        if (!ReadValue(buffer, offset, groundItem.entity) ||
+            !ReadValue(buffer, offset, groundItem.position.x) ||
+            !ReadValue(buffer, offset, groundItem.position.y) ||
+            !ReadValue(buffer, offset, groundItem.position.z) ||
+            !ReadValue(buffer, offset, groundItem.charges))
+        {
+            return false;
+        }
+        if (!readString(groundItem.itemId) ||
+            !readString(groundItem.addonAId) ||
+            !readString(groundItem.addonBId))
+        {
+            return false;
+        }
+        outSnapshot.groundItems.push_back(groundItem);
+    }
+
+    std::uint16_t scratchCount = 0;
+    if (!ReadValue(buffer, offset, scratchCount))
+    {
+        return false;
+    }
+    outSnapshot.scratchMarks.clear();
+    outSnapshot.scratchMarks.reserve(scratchCount);
+    for (std::uint16_t i = 0; i < scratchCount; ++i)
+    {
+        game::gameplay::GameplaySystems::ScratchMarkSnapshot mark;
+        if (!ReadValue(buffer, offset, mark.position.x) ||
+            !ReadValue(buffer, offset, mark.position.y) ||
+            !ReadValue(buffer, offset, mark.position.z) ||
+            !ReadValue(buffer, offset, mark.yawDeg) ||
+            !ReadValue(buffer, offset, mark.age) ||
+            !ReadValue(buffer, offset, mark.lifetime) ||
+            !ReadValue(buffer, offset, mark.size))
+        {
+            return false;
+        }
+        outSnapshot.scratchMarks.push_back(mark);
+    }
+
+    return ReadValue(buffer, offset, outSnapshot.relevancyRadius) &&
+           ReadValue(buffer, offset, outSnapshot.serverTick);
+}
+
+bool SerializeGameplayTuning(
+    const game::gameplay::GameplaySystems::GameplayTuning& tuning,
+    std::vector<std::uint8_t>& outBuffer
+)
+{
+    outBuffer.clear();
+    AppendValue(outBuffer, kPacketGameplayTuning);
+    AppendValue(outBuffer, tuning.assetVersion);
+    AppendValue(outBuffer, tuning.survivorWalkSpeed);
+    AppendValue(outBuffer, tuning.survivorSprintSpeed);
+    AppendValue(outBuffer, tuning.survivorCrouchSpeed);
+    AppendValue(outBuffer, tuning.survivorCrawlSpeed);
+    AppendValue(outBuffer, tuning.killerMoveSpeed);
+    AppendValue(outBuffer, tuning.survivorCapsuleRadius);
+    AppendValue(outBuffer, tuning.survivorCapsuleHeight);
+    AppendValue(outBuffer, tuning.killerCapsuleRadius);
+    AppendValue(outBuffer, tuning.killerCapsuleHeight);
+    AppendValue(outBuffer, tuning.terrorRadiusMeters);
+    AppendValue(outBuffer, tuning.terrorRadiusChaseMeters);
+    AppendValue(outBuffer, tuning.vaultSlowTime);
+    AppendValue(outBuffer, tuning.vaultMediumTime);
+    AppendValue(outBuffer, tuning.vaultFastTime);
+    AppendValue(outBuffer, tuning.fastVaultDotThreshold);
+    AppendValue(outBuffer, tuning.fastVaultSpeedMultiplier);
+    AppendValue(outBuffer, tuning.fastVaultMinRunup);
+    AppendValue(outBuffer, tuning.shortAttackRange);
+    AppendValue(outBuffer, tuning.shortAttackAngleDegrees);
+    AppendValue(outBuffer, tuning.lungeHoldMinSeconds);
+    AppendValue(outBuffer, tuning.lungeDurationSeconds);
+    AppendValue(outBuffer, tuning.lungeRecoverSeconds);
+    AppendValue(outBuffer, tuning.shortRecoverSeconds);
+    AppendValue(outBuffer, tuning.missRecoverSeconds);
+    AppendValue(outBuffer, tuning.lungeSpeedStart);
+    AppendValue(outBuffer, tuning.lungeSpeedEnd);
+    AppendValue(outBuffer, tuning.healDurationSeconds);
+    AppendValue(outBuffer, tuning.skillCheckMinInterval);
+    AppendValue(outBuffer, tuning.skillCheckMaxInterval);
+    AppendValue(outBuffer, tuning.generatorRepairSecondsBase);
+    AppendValue(outBuffer, tuning.medkitFullHealCharges);
+    AppendValue(outBuffer, tuning.medkitHealSpeedMultiplier);
+    AppendValue(outBuffer, tuning.toolboxCharges);
+    AppendValue(outBuffer, tuning.toolboxChargeDrainPerSecond);
+    AppendValue(outBuffer, tuning.toolboxRepairSpeedBonus);
+    AppendValue(outBuffer, tuning.flashlightMaxUseSeconds);
+    AppendValue(outBuffer, tuning.flashlightBlindBuildSeconds);
+    AppendValue(outBuffer, tuning.flashlightBlindDurationSeconds);
+    AppendValue(outBuffer, tuning.flashlightBeamRange);
+    AppendValue(outBuffer, tuning.flashlightBeamAngleDegrees);
+    AppendValue(outBuffer, tuning.flashlightBlindStyle);
+    AppendValue(outBuffer, tuning.mapChannelSeconds);
+    AppendValue(outBuffer, tuning.mapUses);
+    AppendValue(outBuffer, tuning.mapRevealRangeMeters);
+    AppendValue(outBuffer, tuning.mapRevealDurationSeconds);
+    AppendValue(outBuffer, tuning.trapperStartCarryTraps);
+    AppendValue(outBuffer, tuning.trapperMaxCarryTraps);
+    AppendValue(outBuffer, tuning.trapperGroundSpawnTraps);
+    AppendValue(outBuffer, tuning.trapperSetTrapSeconds);
+    AppendValue(outBuffer, tuning.trapperDisarmSeconds);
+    AppendValue(outBuffer, tuning.trapEscapeBaseChance);
+    AppendValue(outBuffer, tuning.trapEscapeChanceStep);
+    AppendValue(outBuffer, tuning.trapEscapeChanceMax);
+    AppendValue(outBuffer, tuning.trapKillerStunSeconds);
+    AppendValue(outBuffer, tuning.wraithCloakMoveSpeedMultiplier);
+    AppendValue(outBuffer, tuning.wraithCloakTransitionSeconds);
+    AppendValue(outBuffer, tuning.wraithUncloakTransitionSeconds);
+    AppendValue(outBuffer, tuning.wraithPostUncloakHasteSeconds);
+    AppendValue(outBuffer, tuning.weightTLWalls);
+    AppendValue(outBuffer, tuning.weightJungleGymLong);
+    AppendValue(outBuffer, tuning.weightJungleGymShort);
+    AppendValue(outBuffer, tuning.weightShack);
+    AppendValue(outBuffer, tuning.weightFourLane);
+    AppendValue(outBuffer, tuning.weightFillerA);
+    AppendValue(outBuffer, tuning.weightFillerB);
+    AppendValue(outBuffer, tuning.weightLongWall);
+    AppendValue(outBuffer, tuning.weightShortWall);
+    AppendValue(outBuffer, tuning.weightLWallWindow);
+    AppendValue(outBuffer, tuning.weightLWallPallet);
+    AppendValue(outBuffer, tuning.weightTWalls);
+    AppendValue(outBuffer, tuning.weightGymBox);
+    AppendValue(outBuffer, tuning.weightDebrisPile);
+    AppendValue(outBuffer, tuning.maxLoopsPerMap);
+    AppendValue(outBuffer, tuning.minLoopDistanceTiles);
+    AppendValue(outBuffer, tuning.maxSafePallets);
+    AppendValue(outBuffer, tuning.maxDeadzoneTiles);
+    AppendValue(outBuffer, static_cast<std::uint8_t>(tuning.edgeBiasLoops ? 1 : 0));
+    AppendValue(outBuffer, tuning.serverTickRate);
+    AppendValue(outBuffer, tuning.interpolationBufferMs);
+    AppendValue(outBuffer, tuning.lagCompensationMaxMs);
+    return true;
+}
+
+bool DeserializeGameplayTuning(
+    const std::vector<std::uint8_t>& buffer,
+    game::gameplay::GameplaySystems::GameplayTuning& outTuning
+)
+{
+    std::size_t offset = 0;
+    std::uint8_t type = 0;
+    if (!ReadValue(buffer, offset, type) || type != kPacketGameplayTuning)
+    {
+        return false;
+    }
+
+    return ReadValue(buffer, offset, outTuning.assetVersion) &&
+           ReadValue(buffer, offset, outTuning.survivorWalkSpeed) &&
+           ReadValue(buffer, offset, outTuning.survivorSprintSpeed) &&
+           ReadValue(buffer, offset, outTuning.survivorCrouchSpeed) &&
+           ReadValue(buffer, offset, outTuning.survivorCrawlSpeed) &&
+           ReadValue(buffer, offset, outTuning.killerMoveSpeed) &&
+           ReadValue(buffer, offset, outTuning.survivorCapsuleRadius) &&
+           ReadValue(buffer, offset, outTuning.survivorCapsuleHeight) &&
+           ReadValue(buffer, offset, outTuning.killerCapsuleRadius) &&
+           ReadValue(buffer, offset, outTuning.killerCapsuleHeight) &&
+           ReadValue(buffer, offset, outTuning.terrorRadiusMeters) &&
+           ReadValue(buffer, offset, outTuning.terrorRadiusChaseMeters) &&
+           ReadValue(buffer, offset, outTuning.vaultSlowTime) &&
+           ReadValue(buffer, offset, outTuning.vaultMediumTime) &&
+           ReadValue(buffer, offset, outTuning.vaultFastTime) &&
+           ReadValue(buffer, offset, outTuning.fastVaultDotThreshold) &&
+           ReadValue(buffer, offset, outTuning.fastVaultSpeedMultiplier) &&
+           ReadValue(buffer, offset, outTuning.fastVaultMinRunup) &&
+           ReadValue(buffer, offset, outTuning.shortAttackRange) &&
+           ReadValue(buffer, offset, outTuning.shortAttackAngleDegrees) &&
+           ReadValue(buffer, offset, outTuning.lungeHoldMinSeconds) &&
+           ReadValue(buffer, offset, outTuning.lungeDurationSeconds) &&
+           ReadValue(buffer, offset, outTuning.lungeRecoverSeconds) &&
+           ReadValue(buffer, offset, outTuning.shortRecoverSeconds) &&
+           ReadValue(buffer, offset, outTuning.missRecoverSeconds) &&
+           ReadValue(buffer, offset, outTuning.lungeSpeedStart) &&
+           ReadValue(buffer, offset, outTuning.lungeSpeedEnd) &&
+           ReadValue(buffer, offset, outTuning.healDurationSeconds) &&
+           ReadValue(buffer, offset, outTuning.skillCheckMinInterval) &&
+           ReadValue(buffer, offset, outTuning.skillCheckMaxInterval) &&
+           ReadValue(buffer, offset, outTuning.generatorRepairSecondsBase) &&
+           ReadValue(buffer, offset, outTuning.medkitFullHealCharges) &&
+           ReadValue(buffer, offset, outTuning.medkitHealSpeedMultiplier) &&
+           ReadValue(buffer, offset, outTuning.toolboxCharges) &&
+           ReadValue(buffer, offset, outTuning.toolboxChargeDrainPerSecond) &&
+           ReadValue(buffer, offset, outTuning.toolboxRepairSpeedBonus) &&
+           ReadValue(buffer, offset, outTuning.flashlightMaxUseSeconds) &&
+           ReadValue(buffer, offset, outTuning.flashlightBlindBuildSeconds) &&
+           ReadValue(buffer, offset, outTuning.flashlightBlindDurationSeconds) &&
+           ReadValue(buffer, offset, outTuning.flashlightBeamRange) &&
+           ReadValue(buffer, offset, outTuning.flashlightBeamAngleDegrees) &&
+           ReadValue(buffer, offset, outTuning.flashlightBlindStyle) &&
+           ReadValue(buffer, offset, outTuning.mapChannelSeconds) &&
+           ReadValue(buffer, offset, outTuning.mapUses) &&
+           ReadValue(buffer, offset, outTuning.mapRevealRangeMeters) &&
+           ReadValue(buffer, offset, outTuning.mapRevealDurationSeconds) &&
+           ReadValue(buffer, offset, outTuning.trapperStartCarryTraps) &&
+           ReadValue(buffer, offset, outTuning.trapperMaxCarryTraps) &&
+           ReadValue(buffer, offset, outTuning.trapperGroundSpawnTraps) &&
+           ReadValue(buffer, offset, outTuning.trapperSetTrapSeconds) &&
+           ReadValue(buffer, offset, outTuning.trapperDisarmSeconds) &&
+           ReadValue(buffer, offset, outTuning.trapEscapeBaseChance) &&
+           ReadValue(buffer, offset, outTuning.trapEscapeChanceStep) &&
+           ReadValue(buffer, offset, outTuning.trapEscapeChanceMax) &&
+           ReadValue(buffer, offset, outTuning.trapKillerStunSeconds) &&
+           ReadValue(buffer, offset, outTuning.wraithCloakMoveSpeedMultiplier) &&
+           ReadValue(buffer, offset, outTuning.wraithCloakTransitionSeconds) &&
+           ReadValue(buffer, offset, outTuning.wraithUncloakTransitionSeconds) &&
+           ReadValue(buffer, offset, outTuning.wraithPostUncloakHasteSeconds) &&
+           ReadValue(buffer, offset, outTuning.weightTLWalls) &&
+           ReadValue(buffer, offset, outTuning.weightJungleGymLong) &&
+           ReadValue(buffer, offset, outTuning.weightJungleGymShort) &&
+           ReadValue(buffer, offset, outTuning.weightShack) &&
+           ReadValue(buffer, offset, outTuning.weightFourLane) &&
+           ReadValue(buffer, offset, outTuning.weightFillerA) &&
+           ReadValue(buffer, offset, outTuning.weightFillerB) &&
+           ReadValue(buffer, offset, outTuning.weightLongWall) &&
+           ReadValue(buffer, offset, outTuning.weightShortWall) &&
+           ReadValue(buffer, offset, outTuning.weightLWallWindow) &&
+           ReadValue(buffer, offset, outTuning.weightLWallPallet) &&
+           ReadValue(buffer, offset, outTuning.weightTWalls) &&
+           ReadValue(buffer, offset, outTuning.weightGymBox) &&
+           ReadValue(buffer, offset, outTuning.weightDebrisPile) &&
+           ReadValue(buffer, offset, outTuning.maxLoopsPerMap) &&
+           ReadValue(buffer, offset, outTuning.minLoopDistanceTiles) &&
+           [&]() -> bool {
+               if (!ReadValue(buffer, offset, outTuning.maxSafePallets)) return false;
+               if (!ReadValue(buffer, offset, outTuning.maxDeadzoneTiles)) return false;
+               std::uint8_t edgeBias = 0;
+               if (!ReadValue(buffer, offset, edgeBias)) return false;
+               outTuning.edgeBiasLoops = (edgeBias != 0);
+               return true;
+           }() &&
+           ReadValue(buffer, offset, outTuning.serverTickRate) &&
+           ReadValue(buffer, offset, outTuning.interpolationBufferMs) &&
+           ReadValue(buffer, offset, outTuning.lagCompensationMaxMs);
+}
+
+bool SerializeAssignRole(
+    std::uint8_t roleByte,
+    game::gameplay::GameplaySystems::MapType mapType,
+    unsigned int seed,
+    std::vector<std::uint8_t>& outBuffer
+)
+{
+    outBuffer.clear();
+    AppendValue(outBuffer, kPacketAssignRole);
+    AppendValue(outBuffer, roleByte);
+    AppendValue(outBuffer, MapTypeToByte(mapType));
+    AppendValue(outBuffer, seed);
+    return true;
+}
+
+bool DeserializeAssignRole(
+    const std::vector<std::uint8_t>& buffer,
+    std::uint8_t& outRole,
+    game::gameplay::GameplaySystems::MapType& outMapType,
+    unsigned int& outSeed
+)
+{
+    std::size_t offset = 0;
+    std::uint8_t type = 0;
+    std::uint8_t mapTypeByte = 0;
+
+    if (!ReadValue(buffer, offset, type) || type != kPacketAssignRole)
+    {
+        return false;
+    }
+
+    if (!ReadValue(buffer, offset, outRole) ||
+        !ReadValue(buffer, offset, mapTypeByte) ||
+        !ReadValue(buffer, offset, outSeed))
+    {
+        return false;
+    }
+
+    outMapType = ByteToMapType(mapTypeByte);
+    return true;
+}
+
+bool SerializeHello(
+    const std::string& requestedRole,
+    const std::string& mapName,
+    const std::string& playerName,
+    std::vector<std::uint8_t>& outBuffer
+)
+{
+    outBuffer.clear();
+    AppendValue(outBuffer, kPacketHello);
+    AppendValue(outBuffer, static_cast<std::int32_t>(kProtocolVersion));
+
+    const std::string build = kBuildId;
+    const std::uint16_t buildLen = static_cast<std::uint16_t>(std::min<std::size_t>(build.size(), 255));
+    AppendValue(outBuffer, buildLen);
+    outBuffer.insert(outBuffer.end(), build.begin(), build.begin() + buildLen);
+
+    const std::uint16_t roleLen = static_cast<std::uint16_t>(std::min<std::size_t>(requestedRole.size(), 64));
+    AppendValue(outBuffer, roleLen);
+    outBuffer.insert(outBuffer.end(), requestedRole.begin(), requestedRole.begin() + roleLen);
+
+    const std::uint16_t mapLen = static_cast<std::uint16_t>(std::min<std::size_t>(mapName.size(), 64));
+    AppendValue(outBuffer, mapLen);
+    outBuffer.insert(outBuffer.end(), mapName.begin(), mapName.begin() + mapLen);
+
+    const std::uint16_t nameLen = static_cast<std::uint16_t>(std::min<std::size_t>(playerName.size(), 64));
+    AppendValue(outBuffer, nameLen);
+    outBuffer.insert(outBuffer.end(), playerName.begin(), playerName.begin() + nameLen);
+
+    return true;
+}
+
+bool DeserializeHello(
+    const std::vector<std::uint8_t>& buffer,
+    std::string& outRequestedRole,
+    std::string& outMapName,
+    int& outProtocolVersion,
+    std::string& outBuildId,
+    std::string& outPlayerName
+)
+{
+    outRequestedRole.clear();
+    outMapName.clear();
+    outBuildId.clear();
+    outPlayerName.clear();
+    outProtocolVersion = 0;
+
+    std::size_t offset = 0;
+    std::uint8_t type = 0;
+    std::int32_t protocol = 0;
+    std::uint16_t buildLen = 0;
+    std::uint16_t roleLen = 0;
+    std::uint16_t mapLen = 0;
+
+    if (!ReadValue(buffer, offset, type) || type != kPacketHello)
+    {
+        return false;
+    }
+    if (!ReadValue(buffer, offset, protocol))
+    {
+        return false;
+    }
+    outProtocolVersion = protocol;
+    if (!ReadValue(buffer, offset, buildLen))
+    {
+        return false;
+    }
+    if (offset + buildLen > buffer.size())
+    {
+        return false;
+    }
+    outBuildId.assign(reinterpret_cast<const char*>(buffer.data() + offset), buildLen);
+    offset += buildLen;
+
+    if (!ReadValue(buffer, offset, roleLen))
+    {
+        return false;
+    }
+    if (offset + roleLen > buffer.size())
+    {
+        return false;
+    }
+    outRequestedRole.assign(reinterpret_cast<const char*>(buffer.data() + offset), roleLen);
+    offset += roleLen;
+
+    if (!ReadValue(buffer, offset, mapLen))
+    {
+        return false;
+    }
+    if (offset + mapLen > buffer.size())
+    {
+        return false;
+    }
+    outMapName.assign(reinterpret_cast<const char*>(buffer.data() + offset), mapLen);
+    offset += mapLen;
+
+    std::uint16_t nameLen = 0;
+    if (offset + sizeof(nameLen) <= buffer.size())
+    {
+        if (!ReadValue(buffer, offset, nameLen))
+        {
+            return true;
+        }
+        if (offset + nameLen <= buffer.size())
+        {
+            outPlayerName.assign(reinterpret_cast<const char*>(buffer.data() + offset), nameLen);
+        }
+    }
+    return true;
+}
+
+bool SerializeReject(const std::string& reason, std::vector<std::uint8_t>& outBuffer)
+{
+    outBuffer.clear();
+    AppendValue(outBuffer, kPacketReject);
+    const std::uint16_t reasonLen = static_cast<std::uint16_t>(std::min<std::size_t>(reason.size(), 512));
+    AppendValue(outBuffer, reasonLen);
+    outBuffer.insert(outBuffer.end(), reason.begin(), reason.begin() + reasonLen);
+    return true;
+}
+
+bool DeserializeReject(const std::vector<std::uint8_t>& buffer, std::string& outReason)
+{
+    outReason.clear();
+    std::size_t offset = 0;
+    std::uint8_t type = 0;
+    std::uint16_t reasonLen = 0;
+    if (!ReadValue(buffer, offset, type) || type != kPacketReject)
+    {
+        return false;
+    }
+    if (!ReadValue(buffer, offset, reasonLen))
+    {
+        return false;
+    }
+    if (offset + reasonLen > buffer.size())
+    {
+        return false;
+    }
+    outReason.assign(reinterpret_cast<const char*>(buffer.data() + offset), reasonLen);
+    return true;
+}
+bool SerializeFxSpawnEvent(const engine::fx::FxSpawnEvent& event, std::vector<std::uint8_t>& outBuffer)
+{
+    outBuffer.clear();
+    outBuffer.reserve(1 + sizeof(std::uint16_t) + event.assetId.size() + sizeof(float) * 6 + sizeof(std::uint8_t));
+    AppendValue(outBuffer, kPacketFxSpawn);
+
+    const std::uint16_t length = static_cast<std::uint16_t>(std::min<std::size_t>(event.assetId.size(), 4096));
+    AppendValue(outBuffer, length);
+    outBuffer.insert(outBuffer.end(), event.assetId.begin(), event.assetId.begin() + length);
+
+    AppendValue(outBuffer, event.position.x);
+    AppendValue(outBuffer, event.position.y);
+    AppendValue(outBuffer, event.position.z);
+    AppendValue(outBuffer, event.forward.x);
+    AppendValue(outBuffer, event.forward.y);
+    AppendValue(outBuffer, event.forward.z);
+    AppendValue(outBuffer, static_cast<std::uint8_t>(event.netMode));
+    return true;
+}
+
+bool DeserializeFxSpawnEvent(const std::vector<std::uint8_t>& buffer, engine::fx::FxSpawnEvent& outEvent)
+{
+    std::size_t offset = 0;
+    std::uint8_t type = 0;
+    if (!ReadValue(buffer, offset, type) || type != kPacketFxSpawn)
+    {
+        return false;
+    }
+
+    std::uint16_t length = 0;
+    if (!ReadValue(buffer, offset, length))
+    {
+        return false;
+    }
+    if (offset + length > buffer.size())
+    {
+        return false;
+    }
+    outEvent.assetId.assign(reinterpret_cast<const char*>(buffer.data() + offset), length);
+    offset += length;
+
+    if (!ReadValue(buffer, offset, outEvent.position.x) ||
+        !ReadValue(buffer, offset, outEvent.position.y) ||
+        !ReadValue(buffer, offset, outEvent.position.z) ||
+        !ReadValue(buffer, offset, outEvent.forward.x) ||
+        !ReadValue(buffer, offset, outEvent.forward.y) ||
+        !ReadValue(buffer, offset, outEvent.forward.z))
+    {
+        return false;
+    }
+
+    std::uint8_t modeByte = 0;
+    if (!ReadValue(buffer, offset, modeByte))
+    {
+        return false;
+    }
+    outEvent.netMode = static_cast<engine::fx::FxNetMode>(modeByte);
+    return true;
+}
+} // namespace game::net
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "game/gameplay/GameplaySystems.hpp"
+
+#ifndef BUILD_ID
+#define BUILD_ID "unknown"
+#endif
+
+namespace game::net
+{
+// Wire protocol shared by the game client/listen host (App) and the dedicated server.
+
+constexpr std::uint8_t kPacketRoleInput = 1;
+constexpr std::uint8_t kPacketSnapshot = 2;
+constexpr std::uint8_t kPacketAssignRole = 3;
+constexpr std::uint8_t kPacketHello = 4;
+constexpr std::uint8_t kPacketReject = 5;
+constexpr std::uint8_t kPacketGameplayTuning = 6;
+constexpr std::uint8_t kPacketRoleChangeRequest = 7;
+constexpr std::uint8_t kPacketFxSpawn = 8;
+constexpr std::uint8_t kPacketLobbyState = 9;
+constexpr std::uint8_t kPacketLobbyPlayerJoin = 10;
+constexpr std::uint8_t kPacketLobbyPlayerLeave = 11;
+constexpr std::uint8_t kPacketLobbyPlayerUpdate = 12;
+
+// v2: entity-list snapshots (actors addressed by role + slot), scratch marks, relevancy radius.
+// v3: snapshots carry the server tick; inputs carry the tick the client was viewing (lag compensation).
+constexpr int kProtocolVersion = 3;
+constexpr const char* kBuildId = BUILD_ID;
+
+constexpr std::uint16_t kButtonSprint = 1 << 0;
+constexpr std::uint16_t kButtonInteractPressed = 1 << 1;
+constexpr std::uint16_t kButtonInteractHeld = 1 << 2;
+constexpr std::uint16_t kButtonAttackPressed = 1 << 3;
+constexpr std::uint16_t kButtonJumpPressed = 1 << 4;
+constexpr std::uint16_t kButtonWiggleLeftPressed = 1 << 5;
+constexpr std::uint16_t kButtonWiggleRightPressed = 1 << 6;
+constexpr std::uint16_t kButtonAttackHeld = 1 << 7;
+constexpr std::uint16_t kButtonAttackReleased = 1 << 8;
+constexpr std::uint16_t kButtonCrouchHeld = 1 << 9;
+constexpr std::uint16_t kButtonLungeHeld = 1 << 10;
+constexpr std::uint16_t kButtonUseAltPressed = 1 << 11;
+constexpr std::uint16_t kButtonUseAltHeld = 1 << 12;
+constexpr std::uint16_t kButtonUseAltReleased = 1 << 13;
+constexpr std::uint16_t kButtonDropItemPressed = 1 << 14;
+constexpr std::uint16_t kButtonPickupItemPressed = 1 << 15;
+
+struct RoleInputPacket
+{
+    std::int8_t moveX = 0;
+    std::int8_t moveY = 0;
+    float lookX = 0.0F;
+    float lookY = 0.0F;
+    std::uint16_t buttons = 0;
+    std::uint32_t viewTick = 0; // server tick of the world state on the client's screen, 0 = unknown
+};
+
+template <typename T>
+void AppendValue(std::vector<std::uint8_t>& buffer, const T& value)
+{
+    const std::uint8_t* ptr = reinterpret_cast<const std::uint8_t*>(&value);
+    buffer.insert(buffer.end(), ptr, ptr + sizeof(T));
+}
+
+template <typename T>
+bool ReadValue(const std::vector<std::uint8_t>& buffer, std::size_t& offset, T& outValue)
+{
+    if (offset + sizeof(T) > buffer.size())
+    {
+        return false;
+    }
+
+    std::memcpy(&outValue, buffer.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+[[nodiscard]] game::gameplay::GameplaySystems::MapType ByteToMapType(std::uint8_t value);
+[[nodiscard]] std::uint8_t MapTypeToByte(game::gameplay::GameplaySystems::MapType mapType);
+[[nodiscard]] std::string MapTypeToName(game::gameplay::GameplaySystems::MapType mapType);
+[[nodiscard]] std::uint8_t RoleNameToByte(const std::string& roleName);
+[[nodiscard]] std::string RoleByteToName(std::uint8_t roleByte);
+
+/// Decodes the packed move axis and button bits into the command gameplay consumes.
+[[nodiscard]] game::gameplay::GameplaySystems::RoleCommand RoleCommandFromInput(const RoleInputPacket& packet);
+
+bool SerializeRoleInput(const RoleInputPacket& packet, std::vector<std::uint8_t>& outBuffer);
+bool DeserializeRoleInput(const std::vector<std::uint8_t>& buffer, RoleInputPacket& outPacket);
+bool SerializeSnapshot(const game::gameplay::GameplaySystems::Snapshot& snapshot, std::vector<std::uint8_t>& outBuffer);
+bool DeserializeSnapshot(const std::vector<std::uint8_t>& buffer, game::gameplay::GameplaySystems::Snapshot& outSnapshot);
+bool SerializeGameplayTuning(const game::gameplay::GameplaySystems::GameplayTuning& tuning, std::vector<std::uint8_t>& outBuffer);
+bool DeserializeGameplayTuning(const std::vector<std::uint8_t>& buffer, game::gameplay::GameplaySystems::GameplayTuning& outTuning);
+bool SerializeAssignRole(std::uint8_t roleByte, game::gameplay::GameplaySystems::MapType mapType, unsigned int seed, std::vector<std::uint8_t>& outBuffer);
+bool DeserializeAssignRole(const std::vector<std::uint8_t>& buffer, std::uint8_t& outRole, game::gameplay::GameplaySystems::MapType& outMapType, unsigned int& outSeed);
+bool SerializeHello(
+    const std::string& requestedRole,
+    const std::string& mapName,
+    const std::string& playerName,
+    std::vector<std::uint8_t>& outBuffer
+);
+bool DeserializeHello(
+    const std::vector<std::uint8_t>& buffer,
+    std::string& outRequestedRole,
+    std::string& outMapName,
+    int& outProtocolVersion,
+    std::string& outBuildId,
+    std::string& outPlayerName
+);
+bool SerializeReject(const std::string& reason, std::vector<std::uint8_t>& outBuffer);
+bool DeserializeReject(const std::vector<std::uint8_t>& buffer, std::string& outReason);
+bool SerializeFxSpawnEvent(const engine::fx::FxSpawnEvent& event, std::vector<std::uint8_t>& outBuffer);
+bool DeserializeFxSpawnEvent(const std::vector<std::uint8_t>& buffer, engine::fx::FxSpawnEvent& outEvent);
+} // namespace game::net
@@ -0,0 +1,640 @@
+#include "game/server/DedicatedServer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+
+#include <nlohmann/json.hpp>
+
+#include "game/net/NetProtocol.hpp"
+
+namespace game::server
+{
+namespace
+{
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+// Sleep coarse-grained until just before the deadline, then yield-spin the remainder:
+// OS sleep granularity (1-15 ms) would otherwise show up directly as tick jitter.
+constexpr auto kSpinWindow = std::chrono::microseconds(1500);
+// If a tick overruns by more than this many ticks, resynchronize instead of bursting catch-up ticks.
+constexpr int kMaxCatchUpTicks = 4;
+
+void SleepUntilPrecise(Clock::time_point deadline)
+{
+    const Clock::time_point coarseDeadline = deadline - kSpinWindow;
+    if (Clock::now() < coarseDeadline)
+    {
+        std::this_thread::sleep_until(coarseDeadline);
+    }
+    while (Clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+}
+
+std::string NormalizeMapName(const std::string& mapName)
+{
+    if (mapName == "main_map")
+    {
+        return "main";
+    }
+    return mapName;
+}
+
+game::gameplay::GameplaySystems::MapType MapTypeFromName(const std::string& mapName)
+{
+    if (mapName == "main")
+    {
+        return game::gameplay::GameplaySystems::MapType::Main;
+    }
+    if (mapName == "collision_test")
+    {
+        return game::gameplay::GameplaySystems::MapType::CollisionTest;
+    }
+    return game::gameplay::GameplaySystems::MapType::Test;
+}
+
+std::string RoleName(engine::scene::Role role)
+{
+    return role == engine::scene::Role::Killer ? "killer" : "survivor";
+}
+} // namespace
+
+bool LoadServerConfig(const std::string& path, ServerConfig& inOutConfig, std::string* outError)
+{
+    std::ifstream stream(path);
+    if (!stream.is_open())
+    {
+        if (outError != nullptr)
+        {
+            *outError = "Failed to open server config: " + path;
+        }
+        return false;
+    }
+
+    json root;
+    try
+    {
+        stream >> root;
+    }
+    catch (const std::exception& ex)
+    {
+        if (outError != nullptr)
+        {
+            *outError = "Invalid server config JSON: " + std::string(ex.what());
+        }
+        return false;
+    }
+
+    if (root.contains("port") && root["port"].is_number_integer())
+    {
+        inOutConfig.port = static_cast<std::uint16_t>(root["port"].get<int>());
+    }
+    if (root.contains("discovery_port") && root["discovery_port"].is_number_integer())
+    {
+        inOutConfig.discoveryPort = static_cast<std::uint16_t>(root["discovery_port"].get<int>());
+    }
+    if (root.contains("host_name") && root["host_name"].is_string())
+    {
+        inOutConfig.hostName = root["host_name"].get<std::string>();
+    }
+    if (root.contains("map") && root["map"].is_string())
+    {
+        inOutConfig.mapName = root["map"].get<std::string>();
+    }
+    if (root.contains("seed") && root["seed"].is_number_unsigned())
+    {
+        inOutConfig.seed = root["seed"].get<unsigned int>();
+    }
+    if (root.contains("tick_rate") && root["tick_rate"].is_number_integer())
+    {
+        inOutConfig.tickRate = root["tick_rate"].get<int>();
+    }
+    if (root.contains("max_players") && root["max_players"].is_number_integer())
+    {
+        inOutConfig.maxPlayers = root["max_players"].get<int>();
+    }
+    if (root.contains("lan_discovery") && root["lan_discovery"].is_boolean())
+    {
+        inOutConfig.lanDiscovery = root["lan_discovery"].get<bool>();
+    }
+    if (root.contains("stats_interval_seconds") && root["stats_interval_seconds"].is_number())
+    {
+        inOutConfig.statsIntervalSeconds = root["stats_interval_seconds"].get<float>();
+    }
+    return true;
+}
+
+bool ParseServerArgs(int argc, char** argv, ServerConfig& inOutConfig, std::string* outError)
+{
+    auto fail = [&](const std::string& message) {
+        if (outError != nullptr)
+        {
+            *outError = message;
+        }
+        return false;
+    };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        auto nextValue = [&]() -> std::string { return argv[++i]; };
+
+        try
+        {
+            if (arg == "--config" && hasValue)
+            {
+                if (!LoadServerConfig(nextValue(), inOutConfig, outError))
+                {
+                    return false;
+                }
+            }
+            else if (arg == "--port" && hasValue)
+            {
+                inOutConfig.port = static_cast<std::uint16_t>(std::stoi(nextValue()));
+            }
+            else if (arg == "--discovery-port" && hasValue)
+            {
+                inOutConfig.discoveryPort = static_cast<std::uint16_t>(std::stoi(nextValue()));
+            }
+            else if (arg == "--map" && hasValue)
+            {
+                inOutConfig.mapName = nextValue();
+            }
+            else if (arg == "--seed" && hasValue)
+            {
+                inOutConfig.seed = static_cast<unsigned int>(std::stoul(nextValue()));
+            }
+            else if (arg == "--tick-rate" && hasValue)
+            {
+                inOutConfig.tickRate = std::stoi(nextValue());
+            }
+            else if (arg == "--max-players" && hasValue)
+            {
+                inOutConfig.maxPlayers = std::stoi(nextValue());
+            }
+            else if (arg == "--name" && hasValue)
+            {
+                inOutConfig.hostName = nextValue();
+            }
+            else if (arg == "--no-lan")
+            {
+                inOutConfig.lanDiscovery = false;
+            }
+            else
+            {
+                return fail("Unknown or incomplete argument: " + arg);
+            }
+        }
+        catch (const std::exception&)
+        {
+            return fail("Invalid value for " + arg);
+        }
+    }
+
+    inOutConfig.tickRate = std::clamp(inOutConfig.tickRate, 10, 128);
+    inOutConfig.maxPlayers = std::clamp(inOutConfig.maxPlayers, 1, 32);
+    return true;
+}
+
+DedicatedServer::DedicatedServer(ServerConfig config)
+    : m_config(std::move(config))
+{
+}
+
+bool DedicatedServer::Run()
+{
+    if (!Initialize())
+    {
+        Shutdown();
+        return false;
+    }
+
+    const double fixedDt = 1.0 / static_cast<double>(m_config.tickRate);
+    const auto tickDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(fixedDt));
+    Clock::time_point nextTick = Clock::now();
+
+    while (!m_stopRequested.load())
+    {
+        const Clock::time_point tickStart = Clock::now();
+        const double jitterMs = std::chrono::duration<double, std::milli>(tickStart - nextTick).count();
+
+        PollNetwork();
+        m_gameplay.FixedUpdate(static_cast<float>(fixedDt), m_input, false);
+        m_eventBus.DispatchQueued();
+        m_gameplay.Update(static_cast<float>(fixedDt), m_input, false);
+        SendSnapshots();
+
+        const double now = NowSeconds();
+        if (m_config.lanDiscovery)
+        {
+            m_lanDiscovery.Tick(now);
+        }
+        if (m_gameplay.QuitRequested())
+        {
+            RequestStop();
+        }
+
+        const Clock::time_point tickEnd = Clock::now();
+        const double workMs = std::chrono::duration<double, std::milli>(tickEnd - tickStart).count();
+
+        nextTick += tickDuration;
+        const bool overrun = tickEnd > nextTick;
+        if (tickEnd - nextTick > tickDuration * kMaxCatchUpTicks)
+        {
+            nextTick = tickEnd;
+        }
+        RecordTick(workMs, std::max(0.0, jitterMs), overrun);
+
+        if (now - m_lastStatsSeconds >= static_cast<double>(m_config.statsIntervalSeconds))
+        {
+            LogTickStats();
+            m_lastStatsSeconds = now;
+        }
+
+        SleepUntilPrecise(nextTick);
+    }
+
+    std::cout << "[SERVER] Stopping\n";
+    Shutdown();
+    return true;
+}
+
+bool DedicatedServer::Initialize()
+{
+    m_startTime = Clock::now();
+    std::cout << "[SERVER] Dedicated server build " << game::net::kBuildId
+              << " protocol " << game::net::kProtocolVersion << "\n";
+
+    if (!m_network.Initialize())
+    {
+        std::cerr << "[SERVER] ENet initialization failed\n";
+        return false;
+    }
+    if (!m_network.StartHost(m_config.port, static_cast<std::size_t>(m_config.maxPlayers)))
+    {
+        std::cerr << "[SERVER] Failed to listen on port " << m_config.port << "\n";
+        return false;
+    }
+
+    m_gameplay.Initialize(m_eventBus);
+    m_gameplay.SetDedicatedServerMode(true);
+    m_gameplay.SetFxReplicationCallback([this](const engine::fx::FxSpawnEvent& event) {
+        std::vector<std::uint8_t> payload;
+        if (game::net::SerializeFxSpawnEvent(event, payload))
+        {
+            SendToAll(payload);
+        }
+    });
+    LoadMatch();
+
+    if (m_config.lanDiscovery)
+    {
+        m_lanDiscovery.StartHost(
+            m_config.discoveryPort,
+            m_config.port,
+            m_config.hostName,
+            m_config.mapName,
+            0,
+            m_config.maxPlayers,
+            game::net::kProtocolVersion,
+            game::net::kBuildId,
+            ""
+        );
+    }
+
+    std::cout << "[SERVER] Listening on port " << m_config.port << " map=" << m_config.mapName
+              << " seed=" << m_seed << " tick=" << m_config.tickRate << "Hz"
+              << " maxPlayers=" << m_config.maxPlayers << "\n";
+    return true;
+}
+
+void DedicatedServer::Shutdown()
+{
+    m_lanDiscovery.Stop();
+    m_network.Disconnect();
+    m_network.Shutdown();
+    m_clients.clear();
+}
+
+void DedicatedServer::LoadMatch()
+{
+    const std::string mapName = NormalizeMapName(m_config.mapName);
+    m_mapType = MapTypeFromName(mapName);
+    m_seed = m_config.seed != 0 ? m_config.seed : std::random_device{}();
+
+    game::gameplay::GameplaySystems::GameplayTuning tuning = m_gameplay.GetGameplayTuning();
+    tuning.serverTickRate = m_config.tickRate;
+    m_gameplay.ApplyGameplayTuning(tuning);
+
+    m_gameplay.LoadMap(mapName);
+    if (m_mapType == game::gameplay::GameplaySystems::MapType::Main)
+    {
+        m_gameplay.RegenerateLoops(m_seed);
+    }
+}
+
+void DedicatedServer::PollNetwork()
+{
+    m_network.Poll(0);
+    while (const auto event = m_network.PopEvent())
+    {
+        if (event->connected)
+        {
+            m_clients[event->peerId] = ClientState{};
+            std::cout << "[SERVER] Peer " << event->peerId << " connected\n";
+            continue;
+        }
+        if (event->disconnected)
+        {
+            HandleDisconnect(event->peerId);
+            continue;
+        }
+        if (!event->payload.empty())
+        {
+            HandlePacket(event->payload, event->peerId);
+        }
+    }
+}
+
+void DedicatedServer::HandlePacket(const std::vector<std::uint8_t>& payload, engine::net::NetworkSession::PeerId fromPeer)
+{
+    const auto clientIt = m_clients.find(fromPeer);
+    if (clientIt == m_clients.end())
+    {
+        return;
+    }
+
+    if (payload[0] == game::net::kPacketHello)
+    {
+        HandleHello(payload, fromPeer);
+        return;
+    }
+
+    ClientState& client = clientIt->second;
+    if (payload[0] == game::net::kPacketRoleInput && client.handshaken && client.slot == 0)
+    {
+        game::net::RoleInputPacket inputPacket;
+        if (!game::net::DeserializeRoleInput(payload, inputPacket))
+        {
+            return;
+        }
+        m_gameplay.SetRemoteRoleCommand(client.role, game::net::RoleCommandFromInput(inputPacket));
+        client.lastInputSeconds = NowSeconds();
+    }
+}
+
+void DedicatedServer::HandleHello(const std::vector<std::uint8_t>& payload, engine::net::NetworkSession::PeerId fromPeer)
+{
+    std::string requestedRole;
+    std::string requestedMap;
+    int protocolVersion = 0;
+    std::string buildId;
+    std::string playerName;
+    if (!game::net::DeserializeHello(payload, requestedRole, requestedMap, protocolVersion, buildId, playerName))
+    {
+        return;
+    }
+
+    if (protocolVersion != game::net::kProtocolVersion || buildId != game::net::kBuildId)
+    {
+        SendReject(
+            fromPeer,
+            "Version mismatch: client " + std::to_string(protocolVersion) + "/" + buildId +
+                ", server " + std::to_string(game::net::kProtocolVersion) + "/" + std::string(game::net::kBuildId)
+        );
+        return;
+    }
+
+    // Pawns go to the first client asking for each role; the other role is offered before
+    // falling back to a spectating survivor slot (gameplay has one pawn per role today).
+    engine::scene::Role role = requestedRole == "killer" ? engine::scene::Role::Killer : engine::scene::Role::Survivor;
+    const engine::scene::Role otherRole = role == engine::scene::Role::Killer ? engine::scene::Role::Survivor : engine::scene::Role::Killer;
+    std::uint8_t slot = 0;
+    if (IsPawnTaken(role))
+    {
+        if (!IsPawnTaken(otherRole))
+        {
+            role = otherRole;
+        }
+        else if (role == engine::scene::Role::Killer)
+        {
+            SendReject(fromPeer, "Role killer is full (1 killer max)");
+            return;
+        }
+        else
+        {
+            slot = NextSpectatorSlot();
+        }
+    }
+
+    ClientState& client = m_clients[fromPeer];
+    client.handshaken = true;
+    client.name = playerName.empty() ? ("Player_" + std::to_string(fromPeer)) : playerName;
+    client.role = role;
+    client.slot = slot;
+
+    std::vector<std::uint8_t> assign;
+    if (game::net::SerializeAssignRole(game::net::RoleNameToByte(RoleName(role)), m_mapType, m_seed, assign))
+    {
+        m_network.SendReliableTo(fromPeer, assign.data(), assign.size());
+    }
+    std::vector<std::uint8_t> tuning;
+    if (game::net::SerializeGameplayTuning(m_gameplay.GetGameplayTuning(), tuning))
+    {
+        m_network.SendReliableTo(fromPeer, tuning.data(), tuning.size());
+    }
+
+    const int players = HandshakenCount();
+    if (m_config.lanDiscovery)
+    {
+        m_lanDiscovery.UpdateHostInfo(m_config.mapName, players, m_config.maxPlayers, "");
+    }
+    std::cout << "[SERVER] " << client.name << " (peer " << fromPeer << ") joined as " << RoleName(role)
+              << (slot == 0 ? "" : " spectator slot " + std::to_string(slot)) << " - " << players << " players\n";
+}
+
+void DedicatedServer::HandleDisconnect(engine::net::NetworkSession::PeerId peerId)
+{
+    const auto it = m_clients.find(peerId);
+    if (it == m_clients.end())
+    {
+        return;
+    }
+
+    const ClientState client = it->second;
+    m_clients.erase(it);
+    if (client.handshaken && client.slot == 0)
+    {
+        // Leave the pawn idle instead of replaying the last received input forever.
+        m_gameplay.SetRemoteRoleCommand(client.role, game::gameplay::GameplaySystems::RoleCommand{});
+    }
+    if (m_config.lanDiscovery)
+    {
+        m_lanDiscovery.UpdateHostInfo(m_config.mapName, HandshakenCount(), m_config.maxPlayers, "");
+    }
+    std::cout << "[SERVER] Peer " << peerId << " disconnected"
+              << (client.name.empty() ? "" : " (" + client.name + ")") << "\n";
+}
+
+void DedicatedServer::SendReject(engine::net::NetworkSession::PeerId peerId, const std::string& reason)
+{
+    std::vector<std::uint8_t> reject;
+    if (game::net::SerializeReject(reason, reject))
+    {
+        m_network.SendReliableTo(peerId, reject.data(), reject.size());
+    }
+    std::cout << "[SERVER] Rejected peer " << peerId << ": " << reason << "\n";
+}
+
+void DedicatedServer::SendSnapshots()
+{
+    if (HandshakenCount() == 0)
+    {
+        return;
+    }
+
+    const game::gameplay::GameplaySystems::Snapshot snapshot = m_gameplay.BuildSnapshot();
+
+    // Same sharing scheme as the listen host: peers whose filtered view encodes identically
+    // get one ref-counted packet.
+    struct EncodedSnapshot
+    {
+        std::vector<std::uint8_t> data;
+        std::vector<engine::net::NetworkSession::PeerId> peers;
+    };
+    std::vector<EncodedSnapshot> encoded;
+    encoded.reserve(m_clients.size());
+
+    for (auto& [peerId, client] : m_clients)
+    {
+        if (!client.handshaken)
+        {
+            continue;
+        }
+
+        game::gameplay::GameplaySystems::ReplicationViewer viewer;
+        viewer.role = client.role;
+        viewer.slot = client.slot;
+        viewer.sequence = client.snapshotSequence++;
+        if (!game::net::SerializeSnapshot(m_gameplay.FilterSnapshotForViewer(snapshot, viewer), m_scratchBuffer))
+        {
+            continue;
+        }
+
+        client.snapshotBytesSent += m_scratchBuffer.size();
+        m_tickStats.snapshotBytes += m_scratchBuffer.size();
+
+        const auto sameIt = std::find_if(encoded.begin(), encoded.end(), [&](const EncodedSnapshot& entry) {
+            return entry.data == m_scratchBuffer;
+        });
+        if (sameIt != encoded.end())
+        {
+            sameIt->peers.push_back(peerId);
+        }
+        else
+        {
+            encoded.push_back(EncodedSnapshot{m_scratchBuffer, {peerId}});
+        }
+    }
+
+    for (const EncodedSnapshot& entry : encoded)
+    {
+        m_network.SendReliableToPeers(entry.peers, entry.data.data(), entry.data.size(), false);
+    }
+    m_network.Flush();
+}
+
+void DedicatedServer::SendToAll(const std::vector<std::uint8_t>& payload)
+{
+    std::vector<engine::net::NetworkSession::PeerId> peers;
+    peers.reserve(m_clients.size());
+    for (const auto& [peerId, client] : m_clients)
+    {
+        if (client.handshaken)
+        {
+            peers.push_back(peerId);
+        }
+    }
+    if (!peers.empty())
+    {
+        m_network.SendReliableToPeers(peers, payload.data(), payload.size());
+    }
+}
+
+bool DedicatedServer::IsPawnTaken(engine::scene::Role role) const
+{
+    return std::any_of(m_clients.begin(), m_clients.end(), [&](const auto& entry) {
+        return entry.second.handshaken && entry.second.role == role && entry.second.slot == 0;
+    });
+}
+
+std::uint8_t DedicatedServer::NextSpectatorSlot() const
+{
+    std::uint8_t slot = 1;
+    for (const auto& [peerId, client] : m_clients)
+    {
+        (void)peerId;
+        if (client.handshaken && client.role == engine::scene::Role::Survivor)
+        {
+            slot = static_cast<std::uint8_t>(std::max<int>(slot, client.slot + 1));
+        }
+    }
+    return slot;
+}
+
+int DedicatedServer::HandshakenCount() const
+{
+    return static_cast<int>(std::count_if(m_clients.begin(), m_clients.end(), [](const auto& entry) {
+        return entry.second.handshaken;
+    }));
+}
+
+double DedicatedServer::NowSeconds() const
+{
+    return std::chrono::duration<double>(Clock::now() - m_startTime).count();
+}
+
+void DedicatedServer::RecordTick(double workMs, double jitterMs, bool overrun)
+{
+    ++m_tickStats.ticks;
+    m_tickStats.workMsTotal += workMs;
+    m_tickStats.workMsMax = std::max(m_tickStats.workMsMax, workMs);
+    m_tickStats.jitterMsMax = std::max(m_tickStats.jitterMsMax, jitterMs);
+    if (overrun)
+    {
+        ++m_tickStats.overruns;
+    }
+}
+
+void DedicatedServer::LogTickStats()
+{
+    if (m_tickStats.ticks == 0)
+    {
+        return;
+    }
+
+    const double avgWorkMs = m_tickStats.workMsTotal / static_cast<double>(m_tickStats.ticks);
+    const double budgetMs = 1000.0 / static_cast<double>(m_config.tickRate);
+    std::cout << std::fixed << std::setprecision(2)
+              << "[SERVER] ticks=" << m_tickStats.ticks
+              << " work avg=" << avgWorkMs << "ms max=" << m_tickStats.workMsMax << "ms"
+              << " (budget " << budgetMs << "ms)"
+              << " jitter max=" << m_tickStats.jitterMsMax << "ms"
+              << " overruns=" << m_tickStats.overruns
+              << " clients=" << HandshakenCount()
+              << " snapshotKB=" << static_cast<double>(m_tickStats.snapshotBytes) / 1024.0
+              << " lagCompMaxRewind=" << m_gameplay.GetLagCompensationStats().maxRewindTicks << "t"
+              << "\n";
+    std::cout.unsetf(std::ios::floatfield);
+    m_tickStats = TickStats{};
+}
+} // namespace game::server
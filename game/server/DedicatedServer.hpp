@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/core/EventBus.hpp"
+#include "engine/net/LanDiscovery.hpp"
+#include "engine/net/NetworkSession.hpp"
+#include "engine/platform/Input.hpp"
+#include "game/gameplay/GameplaySystems.hpp"
+
+namespace game::server
+{
+struct ServerConfig
+{
+    std::uint16_t port = 7777;
+    std::uint16_t discoveryPort = 7778;
+    std::string hostName = "Dedicated Server";
+    std::string mapName = "main";
+    unsigned int seed = 0; // 0 = random per process start.
+    int tickRate = 60;
+    int maxPlayers = 5;
+    bool lanDiscovery = true;
+    float statsIntervalSeconds = 10.0F;
+};
+
+/// Reads config/server.json style settings; missing keys keep their current value.
+bool LoadServerConfig(const std::string& path, ServerConfig& inOutConfig, std::string* outError);
+/// Applies --port/--map/--seed/--tick-rate/--max-players/--name/--no-lan/--config overrides.
+bool ParseServerArgs(int argc, char** argv, ServerConfig& inOutConfig, std::string* outError);
+
+/// Headless authority: runs gameplay + physics at a fixed tick and replicates to every client.
+/// No window, GL context, audio or UI is created.
+class DedicatedServer
+{
+public:
+    explicit DedicatedServer(ServerConfig config);
+
+    bool Run();
+    void RequestStop() { m_stopRequested.store(true); }
+
+private:
+    struct ClientState
+    {
+        bool handshaken = false;
+        std::string name;
+        engine::scene::Role role = engine::scene::Role::Survivor;
+        std::uint8_t slot = 0;
+        std::uint32_t snapshotSequence = 0;
+        std::uint64_t snapshotBytesSent = 0;
+        double lastInputSeconds = 0.0;
+    };
+
+    struct TickStats
+    {
+        std::uint64_t ticks = 0;
+        std::uint64_t overruns = 0;
+        double workMsTotal = 0.0;
+        double workMsMax = 0.0;
+        double jitterMsMax = 0.0;
+        std::uint64_t snapshotBytes = 0;
+    };
+
+    bool Initialize();
+    void Shutdown();
+    void LoadMatch();
+
+    void PollNetwork();
+    void HandlePacket(const std::vector<std::uint8_t>& payload, engine::net::NetworkSession::PeerId fromPeer);
+    void HandleHello(const std::vector<std::uint8_t>& payload, engine::net::NetworkSession::PeerId fromPeer);
+    void HandleDisconnect(engine::net::NetworkSession::PeerId peerId);
+    void SendReject(engine::net::NetworkSession::PeerId peerId, const std::string& reason);
+    void SendSnapshots();
+    void SendToAll(const std::vector<std::uint8_t>& payload);
+
+    [[nodiscard]] bool IsPawnTaken(engine::scene::Role role) const;
+    [[nodiscard]] std::uint8_t NextSpectatorSlot() const;
+    [[nodiscard]] int HandshakenCount() const;
+    [[nodiscard]] double NowSeconds() const;
+
+    void RecordTick(double workMs, double jitterMs, bool overrun);
+    void LogTickStats();
+
+    ServerConfig m_config;
+    std::atomic<bool> m_stopRequested{false};
+
+    engine::core::EventBus m_eventBus;
+    engine::platform::Input m_input;
+    game::gameplay::GameplaySystems m_gameplay;
+    engine::net::NetworkSession m_network;
+    engine::net::LanDiscovery m_lanDiscovery;
+
+    std::unordered_map<engine::net::NetworkSession::PeerId, ClientState> m_clients;
+    game::gameplay::GameplaySystems::MapType m_mapType = game::gameplay::GameplaySystems::MapType::Main;
+    unsigned int m_seed = 0;
+
+    std::chrono::steady_clock::time_point m_startTime{};
+    double m_lastStatsSeconds = 0.0;
+    TickStats m_tickStats;
+    std::vector<std::uint8_t> m_scratchBuffer;
+};
+} // namespace game::server
@@ -568,13 +568,12 @@ void LoadingManager::SpawnEntities(LoadingState& state, LoadingContext& context)
 
 void LoadingManager::CompileShaders(LoadingState& state, LoadingContext& context)
 {
-    // Placeholder: Compile or validate shaders
     state.currentTask = "Compiling Shaders";
     state.currentSubtask = "Rendering pipeline initialization";
 
-    if (context.renderer)
+    if (context.compileShaders)
     {
-        // context.renderer->RecompileShaders();
+        context.compileShaders();
     }
 
     state.stageProgress = 1.0F;
@@ -62,6 +62,9 @@ struct LoadingContext
     engine::render::Renderer* renderer = nullptr;
     game::gameplay::GameplaySystems* gameplay = nullptr;
 
+    // Builds GL programs the menus don't need; run by the "Compiling Shaders" stage.
+    std::function<void()> compileShaders;
+
     std::string mapName;
     std::string gameMode;
     bool isMultiplayer = false;
@@ -1,9 +1,70 @@
 #include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
 
+#include "engine/assets/AssetCooker.hpp"
+#include "engine/assets/AssetPack.hpp"
 #include "engine/core/App.hpp"
+#include "engine/core/JobSystem.hpp"
 
-int main()
+namespace
 {
+/// --cook-assets [--force]: cook assets/ without opening a window (build scripts, CI).
+/// --pack-assets additionally writes assets.pak from the cooked tree.
+int CookAssets(bool force, bool pack)
+{
+    auto& jobs = engine::core::JobSystem::Instance();
+    (void)jobs.Initialize();
+    const engine::assets::CookReport report = engine::assets::AssetCooker().Run(force);
+    jobs.Shutdown();
+    if (report.failed != 0)
+    {
+        return EXIT_FAILURE;
+    }
+    std::string error;
+    if (pack && !engine::assets::AssetPack::Build({"assets"}, engine::assets::AssetPack::kDefaultPath, &error))
+    {
+        std::cerr << "[ASSET PACK] " << error << "\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bool cook = false;
+    bool force = false;
+    bool pack = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        if (arg == "--cook-assets")
+        {
+            cook = true;
+        }
+        else if (arg == "--pack-assets")
+        {
+            cook = true;
+            pack = true;
+        }
+        else if (arg == "--force")
+        {
+            force = true;
+        }
+        else
+        {
+            std::cerr << "Unknown argument: " << arg << "\n";
+            std::cerr << "Usage: " << argv[0] << " [--cook-assets | --pack-assets] [--force]\n";
+            return EXIT_FAILURE;
+        }
+    }
+    if (cook)
+    {
+        return CookAssets(force, pack);
+    }
+
     engine::core::App app;
     return app.Run() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
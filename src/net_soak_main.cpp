@@ -0,0 +1,454 @@
+// Loopback soak harness: one authoritative host and one client GameplaySystems in this process,
+// talking over real ENet sockets through NetworkSession's condition simulator.
+// Reports position error, snapshot bandwidth, reliable retransmits and CPU time per tick.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glm/geometric.hpp>
+
+#include "engine/core/EventBus.hpp"
+#include "engine/net/NetworkSession.hpp"
+#include "engine/platform/Input.hpp"
+#include "game/gameplay/GameplaySystems.hpp"
+#include "game/net/NetProtocol.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+using game::gameplay::GameplaySystems;
+
+struct SoakOptions
+{
+    double durationSeconds = 60.0;
+    double reportIntervalSeconds = 10.0;
+    int tickRate = 60;
+    std::uint16_t port = 7790;
+    std::string mapName = "main";
+    unsigned int seed = 1337U;
+    std::string conditionedSide = "both"; // host | client | both
+    float failAboveErrorMeters = -1.0F;
+    engine::net::NetworkConditions conditions;
+};
+
+struct WindowStats
+{
+    std::uint64_t ticks = 0;
+    std::uint64_t errorSamples = 0;
+    double errorSum = 0.0;
+    double errorMax = 0.0;
+    double hostCpuMsSum = 0.0;
+    double hostCpuMsMax = 0.0;
+    double clientCpuMsSum = 0.0;
+    double clientCpuMsMax = 0.0;
+    std::uint64_t snapshotPayloadBytes = 0;
+    std::uint64_t snapshotsSent = 0;
+    std::uint64_t snapshotsApplied = 0;
+};
+
+void PrintUsage()
+{
+    std::cout << "Usage: asym_net_soak [--minutes M | --seconds S] [--latency ms] [--jitter ms] [--loss %]"
+                 " [--dup %] [--reorder %] [--kbps N] [--side host|client|both] [--tick-rate Hz]"
+                 " [--map name] [--seed N] [--port N] [--report-seconds S] [--fail-above-error m]\n";
+}
+
+bool ParseArgs(int argc, char** argv, SoakOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            return false;
+        }
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for " << arg << "\n";
+            return false;
+        }
+        const std::string value = argv[++i];
+        try
+        {
+            if (arg == "--minutes")
+            {
+                options.durationSeconds = std::stod(value) * 60.0;
+            }
+            else if (arg == "--seconds")
+            {
+                options.durationSeconds = std::stod(value);
+            }
+            else if (arg == "--latency")
+            {
+                options.conditions.latencyMs = std::stof(value);
+            }
+            else if (arg == "--jitter")
+            {
+                options.conditions.jitterMs = std::stof(value);
+            }
+            else if (arg == "--loss")
+            {
+                options.conditions.lossPercent = std::stof(value);
+            }
+            else if (arg == "--dup")
+            {
+                options.conditions.duplicatePercent = std::stof(value);
+            }
+            else if (arg == "--reorder")
+            {
+                options.conditions.reorderPercent = std::stof(value);
+            }
+            else if (arg == "--kbps")
+            {
+                options.conditions.bandwidthKbps = static_cast<std::uint32_t>(std::stoul(value));
+            }
+            else if (arg == "--side")
+            {
+                options.conditionedSide = value;
+            }
+            else if (arg == "--tick-rate")
+            {
+                options.tickRate = std::clamp(std::stoi(value), 10, 128);
+            }
+            else if (arg == "--map")
+            {
+                options.mapName = value;
+            }
+            else if (arg == "--seed")
+            {
+                options.seed = static_cast<unsigned int>(std::stoul(value));
+            }
+            else if (arg == "--port")
+            {
+                options.port = static_cast<std::uint16_t>(std::stoi(value));
+            }
+            else if (arg == "--report-seconds")
+            {
+                options.reportIntervalSeconds = std::max(1.0, std::stod(value));
+            }
+            else if (arg == "--fail-above-error")
+            {
+                options.failAboveErrorMeters = std::stof(value);
+            }
+            else
+            {
+                std::cerr << "Unknown argument: " << arg << "\n";
+                return false;
+            }
+        }
+        catch (const std::exception&)
+        {
+            std::cerr << "Invalid value for " << arg << ": " << value << "\n";
+            return false;
+        }
+    }
+
+    const engine::net::NetworkConditions& c = options.conditions;
+    options.conditions.enabled = c.latencyMs > 0.0F || c.jitterMs > 0.0F || c.lossPercent > 0.0F ||
+                                 c.duplicatePercent > 0.0F || c.reorderPercent > 0.0F || c.bandwidthKbps > 0;
+    return true;
+}
+
+void LoadMatch(GameplaySystems& gameplay, const std::string& mapName, unsigned int seed)
+{
+    gameplay.LoadMap(mapName);
+    if (mapName == "main")
+    {
+        gameplay.RegenerateLoops(seed);
+    }
+}
+
+std::optional<glm::vec3> SurvivorPosition(const GameplaySystems::Snapshot& snapshot)
+{
+    for (const auto& actor : snapshot.actors)
+    {
+        if (actor.role == engine::scene::Role::Survivor && actor.slot == 0)
+        {
+            return actor.position;
+        }
+    }
+    return std::nullopt;
+}
+
+// Deterministic input script: weaving movement, periodic sprint/crouch and steady look sweeps.
+game::net::RoleInputPacket ScriptedInput(double t)
+{
+    glm::vec2 axis{static_cast<float>(std::sin(t * 0.7)), static_cast<float>(std::cos(t * 0.45))};
+    if (glm::length(axis) > 1.0F)
+    {
+        axis = glm::normalize(axis);
+    }
+
+    game::net::RoleInputPacket packet;
+    packet.moveX = static_cast<std::int8_t>(std::lround(axis.x * 100.0F));
+    packet.moveY = static_cast<std::int8_t>(std::lround(axis.y * 100.0F));
+    packet.lookX = static_cast<float>(std::sin(t * 0.3) * 4.0);
+    packet.lookY = 0.0F;
+    const int phase = static_cast<int>(t) % 12;
+    if (phase < 5)
+    {
+        packet.buttons |= game::net::kButtonSprint;
+    }
+    else if (phase >= 10)
+    {
+        packet.buttons |= game::net::kButtonCrouchHeld;
+    }
+    return packet;
+}
+
+double CpuMsSince(std::clock_t start)
+{
+    return 1000.0 * static_cast<double>(std::clock() - start) / static_cast<double>(CLOCKS_PER_SEC);
+}
+
+std::uint64_t TotalRetransmits(const engine::net::NetworkSession& session)
+{
+    std::uint64_t total = 0;
+    for (const auto& peer : session.GetPeerStats())
+    {
+        total += peer.reliableRetransmits;
+    }
+    return total;
+}
+
+void PrintReport(
+    const char* label,
+    double elapsedSeconds,
+    double windowSeconds,
+    const WindowStats& stats,
+    std::uint64_t hostSentBytesDelta,
+    const engine::net::NetworkSession& host,
+    const engine::net::NetworkSession& client
+)
+{
+    const double ticks = static_cast<double>(std::max<std::uint64_t>(1, stats.ticks));
+    const double errorAvg = stats.errorSamples > 0 ? stats.errorSum / static_cast<double>(stats.errorSamples) : 0.0;
+    const auto clientStats = client.GetConnectionStats();
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "[SOAK] " << label << " t=" << std::setprecision(1) << elapsedSeconds << "s"
+              << std::setprecision(3)
+              << " pos_err avg=" << errorAvg << "m max=" << stats.errorMax << "m"
+              << " snapshot=" << std::setprecision(1)
+              << static_cast<double>(stats.snapshotPayloadBytes) / windowSeconds << "B/s payload, "
+              << static_cast<double>(hostSentBytesDelta) / windowSeconds << "B/s wire"
+              << " snapshots sent=" << stats.snapshotsSent << " applied=" << stats.snapshotsApplied
+              << " retransmits host=" << TotalRetransmits(host) << " client=" << TotalRetransmits(client)
+              << " rtt=" << clientStats.rttMs << "ms"
+              << std::setprecision(3)
+              << " cpu/tick host avg=" << stats.hostCpuMsSum / ticks << "ms max=" << stats.hostCpuMsMax << "ms"
+              << " client avg=" << stats.clientCpuMsSum / ticks << "ms max=" << stats.clientCpuMsMax << "ms"
+              << " dropped_dgrams=" << host.ConditionerStats().droppedDatagrams + client.ConditionerStats().droppedDatagrams
+              << "\n";
+    std::cout.unsetf(std::ios::floatfield);
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    SoakOptions options;
+    if (!ParseArgs(argc, argv, options))
+    {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    engine::platform::Input input;
+    engine::core::EventBus hostEvents;
+    engine::core::EventBus clientEvents;
+    GameplaySystems hostGameplay;
+    GameplaySystems clientGameplay;
+
+    hostGameplay.Initialize(hostEvents);
+    hostGameplay.SetDedicatedServerMode(true);
+    clientGameplay.Initialize(clientEvents);
+    clientGameplay.SetHeadless(true);
+    clientGameplay.SetNetworkAuthorityMode(false);
+    LoadMatch(hostGameplay, options.mapName, options.seed);
+    LoadMatch(clientGameplay, options.mapName, options.seed);
+    clientGameplay.SetControlledRole("survivor");
+
+    engine::net::NetworkSession host;
+    engine::net::NetworkSession client;
+    if (!host.StartHost(options.port, 1) || !client.StartClient("127.0.0.1", options.port))
+    {
+        std::cerr << "[SOAK] Failed to open loopback sessions on port " << options.port << "\n";
+        return EXIT_FAILURE;
+    }
+
+    const Clock::time_point connectDeadline = Clock::now() + std::chrono::seconds(5);
+    engine::net::NetworkSession::PeerId clientPeer = engine::net::NetworkSession::kInvalidPeer;
+    while (clientPeer == engine::net::NetworkSession::kInvalidPeer || !client.IsConnected())
+    {
+        host.Poll(1);
+        client.Poll(1);
+        while (const auto event = host.PopEvent())
+        {
+            if (event->connected)
+            {
+                clientPeer = event->peerId;
+            }
+        }
+        while (client.PopEvent())
+        {
+        }
+        if (Clock::now() > connectDeadline)
+        {
+            std::cerr << "[SOAK] Loopback connect timed out\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (options.conditionedSide == "host" || options.conditionedSide == "both")
+    {
+        host.SetConditions(options.conditions);
+    }
+    if (options.conditionedSide == "client" || options.conditionedSide == "both")
+    {
+        client.SetConditions(options.conditions);
+    }
+
+    const engine::net::NetworkConditions& c = options.conditions;
+    std::cout << "[SOAK] " << options.durationSeconds << "s on " << options.mapName << " seed=" << options.seed
+              << " tick=" << options.tickRate << "Hz side=" << options.conditionedSide
+              << " latency=" << c.latencyMs << "+-" << c.jitterMs << "ms loss=" << c.lossPercent
+              << "% dup=" << c.duplicatePercent << "% reorder=" << c.reorderPercent << "% kbps=" << c.bandwidthKbps << "\n";
+
+    const double fixedDt = 1.0 / static_cast<double>(options.tickRate);
+    const auto tickDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(fixedDt));
+    const int interpolationMs = std::clamp(clientGameplay.GetGameplayTuning().interpolationBufferMs, 50, 1000);
+    const float blendAlpha = std::clamp(16.0F / static_cast<float>(std::max(16, interpolationMs)), 0.08F, 0.65F);
+
+    const Clock::time_point start = Clock::now();
+    Clock::time_point nextTick = start;
+    double lastReportSeconds = 0.0;
+    std::uint64_t lastHostSentBytes = host.GetConnectionStats().totalSentBytes;
+    WindowStats window;
+    WindowStats total;
+    std::vector<std::uint8_t> buffer;
+
+    auto accumulate = [](WindowStats& into, const WindowStats& from) {
+        into.ticks += from.ticks;
+        into.errorSamples += from.errorSamples;
+        into.errorSum += from.errorSum;
+        into.errorMax = std::max(into.errorMax, from.errorMax);
+        into.hostCpuMsSum += from.hostCpuMsSum;
+        into.hostCpuMsMax = std::max(into.hostCpuMsMax, from.hostCpuMsMax);
+        into.clientCpuMsSum += from.clientCpuMsSum;
+        into.clientCpuMsMax = std::max(into.clientCpuMsMax, from.clientCpuMsMax);
+        into.snapshotPayloadBytes += from.snapshotPayloadBytes;
+        into.snapshotsSent += from.snapshotsSent;
+        into.snapshotsApplied += from.snapshotsApplied;
+    };
+
+    double elapsed = 0.0;
+    while (elapsed < options.durationSeconds)
+    {
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+        // Client: send this tick's scripted input.
+        const std::clock_t clientSendStart = std::clock();
+        game::net::RoleInputPacket scripted = ScriptedInput(elapsed);
+        scripted.viewTick = clientGameplay.ClientViewTick();
+        if (game::net::SerializeRoleInput(scripted, buffer))
+        {
+            client.SendReliable(buffer.data(), buffer.size());
+        }
+        double clientCpuMs = CpuMsSince(clientSendStart);
+
+        // Host: consume input, simulate one fixed step, replicate.
+        const std::clock_t hostStart = std::clock();
+        host.Poll(0);
+        while (const auto event = host.PopEvent())
+        {
+            game::net::RoleInputPacket packet;
+            if (!event->payload.empty() && game::net::DeserializeRoleInput(event->payload, packet))
+            {
+                hostGameplay.SetRemoteRoleCommand(engine::scene::Role::Survivor, game::net::RoleCommandFromInput(packet));
+            }
+        }
+        hostGameplay.FixedUpdate(static_cast<float>(fixedDt), input, false);
+        hostEvents.DispatchQueued();
+        hostGameplay.Update(static_cast<float>(fixedDt), input, false);
+        const GameplaySystems::Snapshot authoritative = hostGameplay.BuildSnapshot();
+        if (game::net::SerializeSnapshot(authoritative, buffer))
+        {
+            host.SendReliableTo(clientPeer, buffer.data(), buffer.size());
+            window.snapshotPayloadBytes += buffer.size();
+            ++window.snapshotsSent;
+        }
+        const double hostCpuMs = CpuMsSince(hostStart);
+
+        // Client: apply whatever snapshots arrived, then advance presentation.
+        const std::clock_t clientRecvStart = std::clock();
+        client.Poll(0);
+        while (const auto event = client.PopEvent())
+        {
+            GameplaySystems::Snapshot snapshot;
+            if (!event->payload.empty() && game::net::DeserializeSnapshot(event->payload, snapshot))
+            {
+                clientGameplay.ApplySnapshot(snapshot, blendAlpha);
+                ++window.snapshotsApplied;
+            }
+        }
+        clientGameplay.Update(static_cast<float>(fixedDt), input, false);
+        clientCpuMs += CpuMsSince(clientRecvStart);
+
+        const std::optional<glm::vec3> hostPosition = SurvivorPosition(authoritative);
+        const std::optional<glm::vec3> clientPosition = SurvivorPosition(clientGameplay.BuildSnapshot());
+        if (hostPosition.has_value() && clientPosition.has_value())
+        {
+            const double error = glm::length(*hostPosition - *clientPosition);
+            window.errorSum += error;
+            window.errorMax = std::max(window.errorMax, error);
+            ++window.errorSamples;
+        }
+
+        ++window.ticks;
+        window.hostCpuMsSum += hostCpuMs;
+        window.hostCpuMsMax = std::max(window.hostCpuMsMax, hostCpuMs);
+        window.clientCpuMsSum += clientCpuMs;
+        window.clientCpuMsMax = std::max(window.clientCpuMsMax, clientCpuMs);
+
+        if (elapsed - lastReportSeconds >= options.reportIntervalSeconds)
+        {
+            const std::uint64_t sent = host.GetConnectionStats().totalSentBytes;
+            PrintReport("window", elapsed, elapsed - lastReportSeconds, window, sent - lastHostSentBytes, host, client);
+            accumulate(total, window);
+            window = WindowStats{};
+            lastHostSentBytes = sent;
+            lastReportSeconds = elapsed;
+        }
+
+        nextTick += tickDuration;
+        if (Clock::now() - nextTick > tickDuration * 4)
+        {
+            nextTick = Clock::now();
+        }
+        std::this_thread::sleep_until(nextTick);
+    }
+
+    accumulate(total, window);
+    const std::uint64_t wireBytes = host.GetConnectionStats().totalSentBytes;
+    PrintReport("total", elapsed, std::max(elapsed, 1.0e-3), total, wireBytes, host, client);
+
+    client.Disconnect();
+    host.Disconnect();
+
+    if (options.failAboveErrorMeters >= 0.0F && total.errorMax > static_cast<double>(options.failAboveErrorMeters))
+    {
+        std::cerr << "[SOAK] FAIL: max position error " << total.errorMax << "m exceeds "
+                  << options.failAboveErrorMeters << "m\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,49 @@
+#include <csignal>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include "game/server/DedicatedServer.hpp"
+
+namespace
+{
+game::server::DedicatedServer* g_server = nullptr;
+
+void HandleStopSignal(int)
+{
+    if (g_server != nullptr)
+    {
+        g_server->RequestStop();
+    }
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    game::server::ServerConfig config;
+    std::string error;
+
+    const std::filesystem::path defaultConfig = std::filesystem::path("config") / "server.json";
+    if (std::filesystem::exists(defaultConfig) && !game::server::LoadServerConfig(defaultConfig.string(), config, &error))
+    {
+        std::cerr << "[SERVER] " << error << "\n";
+        return EXIT_FAILURE;
+    }
+    if (!game::server::ParseServerArgs(argc, argv, config, &error))
+    {
+        std::cerr << "[SERVER] " << error << "\n"
+                  << "Usage: asym_server [--config file] [--port N] [--discovery-port N] [--map name]"
+                     " [--seed N] [--tick-rate Hz] [--max-players N] [--name text] [--no-lan]\n";
+        return EXIT_FAILURE;
+    }
+
+    game::server::DedicatedServer server(config);
+    g_server = &server;
+    std::signal(SIGINT, HandleStopSignal);
+    std::signal(SIGTERM, HandleStopSignal);
+
+    const bool ok = server.Run();
+    g_server = nullptr;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
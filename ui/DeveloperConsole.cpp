@@ -17,6 +17,7 @@
 #include <glm/vec4.hpp>
 
 #include "engine/platform/Window.hpp"
+#include "engine/render/RenderThread.hpp"
 #include "game/gameplay/GameplaySystems.hpp"
 
 #if BUILD_WITH_IMGUI
@@ -653,7 +654,8 @@ std::string CommandCategoryForUsage(const std::string& usage)
 
     const std::string& command = tokens.front();
     if (command == "host" || command == "join" || command == "disconnect" || command == "net_status" ||
-        command == "net_dump" || command == "lan_scan" || command == "lan_status" || command == "lan_debug")
+        command == "net_dump" || command == "lan_scan" || command == "lan_status" || command == "lan_debug" ||
+        command == "net_sim")
     {
         return "Network";
     }
@@ -662,11 +664,12 @@ std::string CommandCategoryForUsage(const std::string& usage)
         command == "audio_loop" || command == "audio_stop_all" ||
         command == "perf" || command == "perf_pin" || command == "perf_compact" ||
         command == "benchmark" || command == "benchmark_stop" ||
-        command == "perf_test" || command == "perf_report")
+        command == "perf_test" || command == "perf_report" || command == "cull_bench" || command == "light_bench" ||
+        command == "mesh_bench" || command == "asset_budget" || command == "asset_cook")
     {
         return "System";
     }
-    if (command == "toggle_collision" || command == "toggle_debug_draw" || command == "physics_debug" ||
+    if (command == "toggle_collision" || command == "toggle_debug_draw" || command == "occlusion_cull" || command == "physics_debug" ||
         command == "noclip" || command == "tr_vis" || command == "tr_set" || command == "set_chase" ||
         command == "cam_mode" || command == "control_role" || command == "set_role" ||
         command == "trap_spawn" || command == "trap_clear" || command == "trap_debug" ||
@@ -685,6 +688,14 @@ std::string CommandCategoryForUsage(const std::string& usage)
     }
     return "Gameplay";
 }
+
+// ImGui draw data stays valid until the next NewFrame, which only happens after Swap takes the context back.
+void ExecuteImGuiDrawData(void* user, const engine::render::RenderCommandList& list)
+{
+    (void)user;
+    (void)list;
+    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+}
 } // namespace
 
 struct DeveloperConsole::Impl
@@ -723,6 +734,9 @@ struct DeveloperConsole::Impl
     int completionCycleIndex = 0;
     std::string lastCompletionInput;
 
+    // Empty list: the ImGui draw is submitted behind the scene and UI lists.
+    engine::render::RenderCommandList renderList;
+
     static std::string SanitizeText(const std::string& text)
     {
         std::string sanitized;
@@ -1061,6 +1075,47 @@ RegisterCommand("clear", "Clear console output", [this](const std::vector<std::s
             LogSuccess("Parallel test complete");
         });
 
+        RegisterCommand("cull_bench [boxes]", "Benchmark SIMD batch frustum culling (default: 100000 boxes)", [this](const std::vector<std::string>& tokens, const ConsoleContext& context) {
+            if (!context.cullBenchmark)
+            {
+                LogError("cull_bench not available");
+                return;
+            }
+            int boxes = 100000;
+            if (tokens.size() > 1)
+            {
+                try { boxes = std::stoi(tokens[1]); }
+                catch (...) { boxes = 100000; }
+            }
+            boxes = std::clamp(boxes, 1, 2000000);
+            LogInfo(context.cullBenchmark(boxes));
+        });
+
+        RegisterCommand("light_bench [lights]", "Benchmark clustered light binning and check it against brute force (default: 256 lights)", [this](const std::vector<std::string>& tokens, const ConsoleContext& context) {
+            if (!context.lightBenchmark)
+            {
+                LogError("light_bench not available");
+                return;
+            }
+            int lights = 256;
+            if (tokens.size() > 1)
+            {
+                try { lights = std::stoi(tokens[1]); }
+                catch (...) { lights = 256; }
+            }
+            lights = std::clamp(lights, 1, 4096);
+            LogInfo(context.lightBenchmark(lights));
+        });
+
+        RegisterCommand("mesh_bench", "Compare source and cooked (.amesh) load times for assets/meshes", [this](const std::vector<std::string>&, const ConsoleContext& context) {
+            if (!context.meshBenchmark)
+            {
+                LogError("mesh_bench not available");
+                return;
+            }
+            LogInfo(context.meshBenchmark());
+        });
+
         RegisterCommand("asset_stats", "Show async asset loader statistics", [this](const std::vector<std::string>&, const ConsoleContext& context) {
             if (!context.assetLoaderStats)
             {
@@ -1070,6 +1125,35 @@ RegisterCommand("clear", "Clear console output", [this](const std::vector<std::s
             LogInfo(context.assetLoaderStats());
         });
 
+        RegisterCommand("asset_budget [MB]", "Show or set the shared asset cache budget", [this](const std::vector<std::string>& tokens, const ConsoleContext& context) {
+            if (!context.assetBudget)
+            {
+                LogError("asset_budget not available");
+                return;
+            }
+            int megabytes = 0;
+            if (tokens.size() >= 2)
+            {
+                try { megabytes = std::stoi(tokens[1]); }
+                catch (...)
+                {
+                    LogError("Usage: asset_budget [MB]");
+                    return;
+                }
+                megabytes = std::clamp(megabytes, 16, 16384);
+            }
+            LogInfo(context.assetBudget(megabytes));
+        });
+
+        RegisterCommand("asset_cook [force]", "Re-cook changed assets (meshes, loop colliders)", [this](const std::vector<std::string>& tokens, const ConsoleContext& context) {
+            if (!context.assetCook)
+            {
+                LogError("asset_cook not available");
+                return;
+            }
+            LogInfo(context.assetCook(tokens.size() >= 2 && tokens[1] == "force"));
+        });
+
         RegisterCommand("spawn survivor|killer|pallet|window [yaw_degrees]", "Spawn gameplay entities", [this](const std::vector<std::string>& tokens, const ConsoleContext& context) {
             if (context.gameplay == nullptr || tokens.size() < 2)
             {
@@ -1383,6 +1467,24 @@ RegisterCommand("clear", "Clear console output", [this](const std::vector<std::s
             LogSuccess(std::string("Debug draw ") + (enabled ? "enabled" : "disabled"));
         });
 
+        RegisterCommand("occlusion_cull on|off", "Enable/disable CPU occlusion culling against map walls", [this](const std::vector<std::string>& tokens, const ConsoleContext& context) {
+            if (context.gameplay == nullptr || tokens.size() != 2)
+            {
+                LogError("Usage: occlusion_cull on|off");
+                return;
+            }
+
+            bool enabled = true;
+            if (!ParseBoolToken(tokens[1], enabled))
+            {
+                LogError("Expected on|off");
+                return;
+            }
+
+            context.gameplay->SetOcclusionCullingEnabled(enabled);
+            LogSuccess(std::string("Occlusion culling ") + (enabled ? "enabled" : "disabled"));
+        });
+
         RegisterCommand("physics_debug on|off", "Toggle physics debug readout", [this](const std::vector<std::string>& tokens, const ConsoleContext& context) {
             if (context.gameplay == nullptr || tokens.size() != 2)
             {
@@ -1522,6 +1624,32 @@ RegisterCommand("clear", "Clear console output", [this](const std::vector<std::s
             LogSuccess(std::string("LAN debug ") + (enabled ? "enabled" : "disabled"));
         });
 
+        RegisterCommand("net_sim off|<latency_ms> [jitter_ms] [loss%] [dup%] [reorder%] [kbps]", "Simulate network conditions on send+receive", [this](const std::vector<std::string>& tokens, const ConsoleContext& context) {
+            if (tokens.size() < 2 || tokens.size() > 7 || context.setNetConditions == nullptr)
+            {
+                LogError("Usage: net_sim off|<latency_ms> [jitter_ms] [loss%] [dup%] [reorder%] [kbps]");
+                return;
+            }
+
+            engine::net::NetworkConditions conditions;
+            if (tokens[1] == "off")
+            {
+                context.setNetConditions(conditions);
+                LogSuccess("Network simulation disabled");
+                return;
+            }
+
+            conditions.enabled = true;
+            conditions.latencyMs = ParseFloatOr(0.0F, tokens[1]);
+            conditions.jitterMs = tokens.size() > 2 ? ParseFloatOr(0.0F, tokens[2]) : 0.0F;
+            conditions.lossPercent = tokens.size() > 3 ? ParseFloatOr(0.0F, tokens[3]) : 0.0F;
+            conditions.duplicatePercent = tokens.size() > 4 ? ParseFloatOr(0.0F, tokens[4]) : 0.0F;
+            conditions.reorderPercent = tokens.size() > 5 ? ParseFloatOr(0.0F, tokens[5]) : 0.0F;
+            conditions.bandwidthKbps = tokens.size() > 6 ? static_cast<std::uint32_t>(std::max(0, ParseIntOr(0, tokens[6]))) : 0U;
+            context.setNetConditions(conditions);
+            LogSuccess("Network simulation: " + tokens[1] + "ms latency");
+        });
+
         RegisterCommand("tr_vis on|off", "Toggle terror radius visualization", [this](const std::vector<std::string>& tokens, const ConsoleContext& context) {
             if (tokens.size() != 2)
             {
@@ -3932,7 +4060,7 @@ void DeveloperConsole::Render(const ConsoleContext& context, float fps, const ga
     }
 
     ImGui::Render();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    engine::render::RenderThread::Instance().Submit(m_impl->renderList, &ExecuteImGuiDrawData, nullptr);
 #else
     (void)context;
     (void)fps;
@@ -4,6 +4,8 @@
 #include <string>
 #include <glm/glm.hpp>
 
+#include "engine/net/NetworkConditioner.hpp"
+
 namespace engine::platform
 {
 class Window;
@@ -53,6 +55,7 @@ struct ConsoleContext
     std::function<void()> lanScan;
     std::function<std::string()> lanStatus;
     std::function<void(bool)> lanDebug;
+    std::function<void(const engine::net::NetworkConditions&)> setNetConditions;
     std::function<void(bool)> setTerrorRadiusVisible;
     std::function<void(float)> setTerrorRadiusMeters;
     std::function<void(bool)> setTerrorAudioDebug;
@@ -88,7 +91,12 @@ struct ConsoleContext
     std::function<std::string()> jobStats;                 // returns job system stats
     std::function<void(bool)> jobEnabled;                  // enable/disable job system
     std::function<void(int)> testParallel;                 // run parallel test with N iterations
+    std::function<std::string(int)> cullBenchmark;         // scalar vs SIMD frustum cull over N boxes
+    std::function<std::string(int)> lightBenchmark;        // cluster build time + brute-force check over N lights
+    std::function<std::string()> meshBenchmark;            // source vs cooked .amesh load times
     std::function<std::string()> assetLoaderStats;         // returns async asset loader stats
+    std::function<std::string(int)> assetBudget;           // sets the asset cache budget in MB (<= 0 queries)
+    std::function<std::string(bool)> assetCook;            // incremental asset cook (true = force)
 };
 
 class DeveloperConsole